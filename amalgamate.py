@@ -104,7 +104,9 @@ def merge_c_files():
 	def _replace(m):
 		path = m.group(1)
 		if path.startswith('xmacros/'):
-			return read_file(f'{ROOT}/{path}') + '\n'
+			# xmacros may include other xmacros
+			content = read_file(f'{ROOT}/{path}')
+			return re.sub(r'#include\s+"pocketpy/(.+)"\s*', _replace, content) + '\n'
 		return ''	# remove include
 
 	for root, _, files in os.walk('src/'):
@@ -0,0 +1,31 @@
+from array2d import array2d
+from vmath import vec2i
+
+# walls every few cells with gaps, 0 is floor and 1 is wall
+def cell(p: vec2i):
+    if p.x % 8 == 4 and p.y % 8 != 0:
+        return 1
+    if p.y % 8 == 4 and p.x % 8 != 0:
+        return 1
+    return 0
+
+grid = array2d(128, 128, default=cell, dtype='int8')
+
+# one distance field from the goal serves every agent
+goal = vec2i(0, 0)
+total = 0
+for _ in range(100):
+    field = grid.get_distance_field(goal, 0, 'Moore')
+    total += field[99, 99]
+
+# agents with their own goals
+for i in range(1000):
+    start = vec2i(i * 7 % 128, i * 13 % 128)
+    target = vec2i(i * 11 % 128, i * 5 % 128)
+    path = grid.find_path(start, target, 0)
+    if path is not None:
+        total += len(path)
+
+labels, count = grid.get_connected_components(0, 'von Neumann')
+total += count
+assert total == 86311, total
@@ -0,0 +1,21 @@
+from array2d import array2d
+
+# game of life on a packed grid, every step runs in typed loops
+def step(cells):
+    n = cells.count_neighbors(True, 'Moore')
+    return (n == 3) | (cells & (n == 2))
+
+cells = array2d(256, 256, default=lambda p: (p.x * 7 + p.y * 13) % 5 == 0, dtype='bool')
+for _ in range(100):
+    cells = step(cells)
+
+# blur and threshold of an int8 height map
+heights = array2d(256, 256, default=lambda p: (p.x ^ p.y) % 100, dtype='int8')
+kernel = array2d(3, 3, default=1)
+total = 0
+for _ in range(50):
+    blurred = heights.convolve(kernel, 0)
+    total += (blurred > 400).count(True)
+
+assert cells.count(True) == 628
+assert total == 1533200, total
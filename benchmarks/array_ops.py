@@ -0,0 +1,30 @@
+from array import array
+
+# element-wise methods are pocketpy extensions
+def scale(a, k):
+    if hasattr(a, 'mul'):
+        return a.mul(k)
+    return array(a.typecode, [x * k for x in a])
+
+def above(a, k):
+    if hasattr(a, 'gt'):
+        return a.compress(a.gt(k))
+    return array(a.typecode, [x for x in a if x > k])
+
+def dot(a, b):
+    if hasattr(a, 'dot'):
+        return a.dot(b)
+    return sum([x * y for x, y in zip(a, b)])
+
+xs = array('d', [i % 1000 / 10 for i in range(100000)])
+ys = array('i', range(100000))
+
+total = 0
+for _ in range(100):
+    zs = scale(xs, 2.0)
+    total += len(above(zs, 100.0))
+    total += dot(ys, ys) % 1000
+    data = ys.tobytes()
+    total += len(array('i', data))
+
+assert total == 14990000, total
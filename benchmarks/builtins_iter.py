@@ -0,0 +1,18 @@
+a = list(range(100000))
+b = [i * 3 % 1000 for i in range(100000)]
+
+total = 0
+for _ in range(20):
+    for i, x in enumerate(a):
+        total += i - x
+    for x, y in zip(a, b):
+        total += x - y
+    total += sum(map(lambda x: x & 1, a))
+    total += len(list(filter(lambda x: x > 500, b)))
+    total += sum(a) + sum(range(100000))
+    total += min(b) + max(b) + max(b, key=lambda x: -x)
+    if any([x < 0 for x in b]) or not all(b):
+        total += 1
+    total += sorted(b)[50000] + list(reversed(a))[0]
+
+assert total == 299002027980, total
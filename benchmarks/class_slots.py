@@ -0,0 +1,17 @@
+class Particle:
+    __slots__ = ('x', 'v')
+
+    def __init__(self, x, v):
+        self.x = x
+        self.v = v
+
+particles = [Particle(float(i), 0.5) for i in range(1000000)]
+
+for _ in range(4):
+    for p in particles:
+        p.x += p.v
+
+total = 0.0
+for p in particles:
+    total += p.x
+assert total == 1000000 * 999999 / 2 + 2.0 * 1000000
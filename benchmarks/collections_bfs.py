@@ -0,0 +1,32 @@
+from collections import deque, defaultdict, Counter
+
+W, H = 300, 300
+grid = [[(x * 7 + y * 13) % 11 == 0 for x in range(W)] for y in range(H)]
+
+def bfs(sx, sy):
+    dist = [[-1] * W for _ in range(H)]
+    dist[sy][sx] = 0
+    queue = deque()
+    queue.append((sx, sy))
+    while queue:
+        x, y = queue.popleft()
+        d = dist[y][x] + 1
+        for nx, ny in ((x + 1, y), (x - 1, y), (x, y + 1), (x, y - 1)):
+            if 0 <= nx < W and 0 <= ny < H and not grid[ny][nx] and dist[ny][nx] == -1:
+                dist[ny][nx] = d
+                queue.append((nx, ny))
+    return dist
+
+for _ in range(3):
+    dist = bfs(1, 1)
+assert dist[H - 2][W - 2] > 0
+
+groups = defaultdict(list)
+for i in range(200000):
+    groups[i % 1000].append(i)
+assert len(groups) == 1000
+
+words = [str(i % 500) for i in range(200000)]
+c = Counter(words)
+assert c['7'] == 400
+assert c.most_common(1)[0][1] == 400
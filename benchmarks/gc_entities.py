@@ -0,0 +1,22 @@
+import time
+
+class Entity:
+    def __init__(self, i):
+        self.id = i
+        self.x = i
+        self.pos = [i, i]
+        self.tags = {'k': i}
+
+world = [Entity(i) for i in range(100000)]
+
+worst = 0.0
+for frame in range(300):
+    t = time.perf_counter()
+    for i in range(2000):
+        e = world[(frame * 2000 + i) % 100000]
+        tmp = [e.x + 1, (e.id, e.id), {'x': e.id}]
+        e.x = tmp[0]
+    worst = max(worst, time.perf_counter() - t)
+
+assert world[0].x == 6
+# print(f'worst frame: {worst * 1000:.2f}ms')
@@ -0,0 +1,20 @@
+import time
+
+class Entity:
+    def __init__(self, i):
+        self.id = i
+        self.pos = [i, i]
+        self.tags = {'k': i}
+
+world = [Entity(i) for i in range(200000)]
+
+worst = 0.0
+for frame in range(300):
+    t = time.perf_counter()
+    for i in range(2000):
+        k = (frame * 2000 + i) % 200000
+        world[k] = Entity(world[k].id + 1)
+    worst = max(worst, time.perf_counter() - t)
+
+assert world[0].id == 3
+# print(f'worst frame: {worst * 1000:.2f}ms')
@@ -0,0 +1,10 @@
+# a few objects with many bytes each, the heap should stay small
+rows = []
+for i in range(2000):
+    line = str(i % 10) * 100000
+    if i % 100 == 0:
+        rows.append(line)
+    chunk = [i] * 20000
+
+assert len(rows) == 20
+assert rows[-1][0] == '0'
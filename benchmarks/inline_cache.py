@@ -0,0 +1,39 @@
+try:
+    import pkpy
+    # only built with PK_ENABLE_IC_STATS
+    inline_cache_stats = getattr(pkpy, 'inline_cache_stats', None)
+except ImportError:
+    inline_cache_stats = None
+
+class Entity:
+    def __init__(self, x, y):
+        self.x = x
+        self.y = y
+        self.vx = 1
+        self.vy = 2
+
+    def move(self):
+        self.x += self.vx
+        self.y += self.vy
+
+    def pos(self):
+        return self.x, self.y
+
+entities = [Entity(i, i) for i in range(100)]
+
+if inline_cache_stats is not None:
+    hits_0, misses_0 = inline_cache_stats()
+
+for _ in range(20000):
+    for e in entities:
+        e.move()
+
+assert entities[0].pos() == (20000, 40000)
+
+if inline_cache_stats is not None:
+    hits_1, misses_1 = inline_cache_stats()
+    hits = hits_1 - hits_0
+    misses = misses_1 - misses_0
+    rate = hits / (hits + misses)
+    print(f'inline cache: {hits} hits, {misses} misses, hit rate {rate * 100:.2f}%')
+    assert rate > 0.99
@@ -0,0 +1,17 @@
+class Entity:
+    def __init__(self, i):
+        self.id = i
+        self.x = 1.5
+        self.y = 2.5
+        self.alive = True
+
+world = [Entity(i) for i in range(500000)]
+
+total = 0
+for _ in range(4):
+    for e in world:
+        total += e.id
+        e.x += 1.0
+
+assert total == 4 * 499999 * 500000 // 2
+assert world[0].x == 5.5
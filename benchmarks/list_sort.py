@@ -0,0 +1,31 @@
+import random
+
+random.seed(42)
+ints = [random.randint(-100000, 100000) for _ in range(200000)]
+floats = [x / 7 for x in ints]
+strs = [str(x) for x in ints[:50000]]
+records = [(x % 1000, x) for x in ints[:50000]]
+
+class Score:
+    def __init__(self, value):
+        self.value = value
+
+    def __lt__(self, other):
+        return self.value < other.value
+
+scores = [Score(x) for x in ints[:20000]]
+
+for _ in range(5):
+    a = sorted(ints)
+    assert a[0] <= a[1000] <= a[-1]
+    # already sorted and reversed inputs are single runs
+    assert sorted(a) == a
+    assert sorted(a, reverse=True)[0] == a[-1]
+    # an almost sorted leaderboard
+    b = a + [random.randint(-100000, 100000) for _ in range(100)]
+    b.sort()
+
+    assert sorted(floats)[0] == a[0] / 7
+    assert sorted(strs)[0] <= sorted(strs)[-1]
+    assert sorted(records, key=lambda r: r[0])[0][0] == 0
+    assert sorted(scores)[0].value == min(ints[:20000])
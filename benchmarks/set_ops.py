@@ -0,0 +1,26 @@
+a = set()
+for i in range(200000):
+    a.add(i)
+
+evens = {i for i in range(0, 200000, 2)}
+odds = {i for i in range(1, 200000, 2)}
+
+for _ in range(10):
+    assert len(evens | odds) == 200000
+    assert len(a & evens) == 100000
+    assert len(a - evens) == 100000
+    assert len(evens ^ odds) == 200000
+    assert evens.isdisjoint(odds)
+    assert evens.issubset(a)
+
+words = set([str(i % 1000) for i in range(200000)])
+assert len(words) == 1000
+
+hits = 0
+for i in range(1000000):
+    if i in a:
+        hits += 1
+assert hits == 200000
+
+keys = {frozenset([i, i + 1]) for i in range(20000)}
+assert frozenset([1, 0]) in keys
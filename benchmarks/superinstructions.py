@@ -0,0 +1,16 @@
+class P:
+    def __init__(self):
+        self.x = 0
+
+def f(n):
+    i = 0
+    s = 0
+    p = P()
+    while i < n:
+        s = s + p.x
+        if s > i:
+            s = i
+        i = i + 1
+    return s
+
+f(10000000)
@@ -2,11 +2,11 @@
 // generated by prebuild.py
 
 const char* load_kPythonLib(const char* name);
+const unsigned char* load_kPythonLibBytecode(const char* name, int* size);
 
 extern const char kPythonLibs_bisect[];
 extern const char kPythonLibs_builtins[];
 extern const char kPythonLibs_cmath[];
-extern const char kPythonLibs_collections[];
 extern const char kPythonLibs_dataclasses[];
 extern const char kPythonLibs_datetime[];
 extern const char kPythonLibs_functools[];
@@ -52,3 +52,15 @@ bool c11__stable_sort(void* ptr,
                       int elem_size,
                       int (*f_lt)(const void* a, const void* b, void* extra),
                       void* extra);
+
+/**
+ * @brief Same as `c11__stable_sort`, a stable timsort that exploits existing runs.
+ * @param buffer Scratch space for `length / 2 + 1` elements, or `NULL` to allocate one.
+ * If `f_lt` fails, the array is left as a permutation of its elements.
+ */
+bool c11__timsort(void* ptr,
+                  int length,
+                  int elem_size,
+                  int (*f_lt)(const void* a, const void* b, void* extra),
+                  void* extra,
+                  void* buffer);
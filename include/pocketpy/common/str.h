@@ -13,7 +13,13 @@ typedef struct c11_string {
     char data[];  // flexible array member
 } c11_string;
 
+// a str object that is not inline keeps its hash in front of its `c11_string`, 0 if not computed yet
+#define pk_strobj__hash(ud) ((uint64_t*)(ud))
+#define pk_strobj__string(ud) ((c11_string*)((uint64_t*)(ud) + 1))
+
 c11_string* pk_tostr(py_Ref self);
+// same as `c11_sv__hash`, but cached by str objects
+uint64_t pk_strhash(py_Ref self);
 
 /* bytes */
 typedef struct c11_bytes {
@@ -3,6 +3,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <stdint.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 #define PK_REGION(name) 1
 
@@ -33,6 +38,25 @@
 
 #define c11__count_array(a) (sizeof(a) / sizeof(a[0]))
 
+// index of the lowest set bit, `x` must not be 0
+static inline int c11__ctz64(uint64_t x) {
+    assert(x != 0);
+#if(defined(__clang__) || defined(__GNUC__))
+    return __builtin_ctzll(x);
+#elif defined(_MSC_VER) && defined(_WIN64)
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return (int)index;
+#else
+    int n = 0;
+    while((x & 1) == 0) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
 // ref counting
 typedef struct RefCounted {
     int count;
@@ -27,13 +27,40 @@
 #define PK_ENABLE_CUSTOM_SNAME      0                
 #endif
 
+#ifndef PK_ENABLE_IC_STATS          // can be overridden by cmake
+#define PK_ENABLE_IC_STATS          0
+#endif
+
 #ifndef PK_ENABLE_MIMALLOC          // can be overridden by cmake
 #define PK_ENABLE_MIMALLOC          0                
 #endif
 
-// GC min threshold
-#ifndef PK_GC_MIN_THRESHOLD         // can be overridden by cmake
-    #define PK_GC_MIN_THRESHOLD     32768
+#ifndef PK_ENABLE_COMPUTED_GOTO     // can be overridden by cmake
+    #if defined(__GNUC__) || defined(__clang__)
+        #define PK_ENABLE_COMPUTED_GOTO     1
+    #else
+        #define PK_ENABLE_COMPUTED_GOTO     0
+    #endif
+#endif
+
+// Bytes allocated between two automatic collections when the heap is small
+#ifndef PK_GC_MIN_BYTES             // can be overridden by cmake
+    #define PK_GC_MIN_BYTES         (4 * 1024 * 1024)
+#endif
+
+// Heap growth since the last full collection that starts the next one, in percent of live bytes
+#ifndef PK_GC_HEAP_GROWTH           // can be overridden by cmake
+    #define PK_GC_HEAP_GROWTH       100
+#endif
+
+// Time budget of an automatic incremental GC step in microseconds
+#ifndef PK_GC_STEP_BUDGET_US        // can be overridden by cmake
+    #define PK_GC_STEP_BUDGET_US    1000
+#endif
+
+// Number of collections an empty pool arena is kept for before it is freed
+#ifndef PK_GC_ARENA_GRACE           // can be overridden by cmake
+    #define PK_GC_ARENA_GRACE       2
 #endif
 
 // This is the maximum size of the value stack in py_TValue units
@@ -64,6 +91,14 @@
 // For class itself
 #define PK_TYPE_ATTR_LOAD_FACTOR    0.5f
 
+// Hidden classes of instances
+// Maximum number of attributes of a shape, instances with more attributes fall back to a dict
+#define PK_SHAPE_MAX_ATTRS          32
+// Maximum number of shapes of a VM, instances that need a new one fall back to a dict
+#define PK_SHAPE_MAX_COUNT          8192
+// Maximum number of attribute values stored inside an instance, the rest are in a separate buffer
+#define PK_INST_MAX_INLINE_ATTRS    8
+
 #ifdef _WIN32
     #define PK_PLATFORM_SEP '\\'
 #else
@@ -103,3 +138,18 @@
         #endif
     #endif
 #endif
+
+// Aligned allocation of pool arenas, `size` is a multiple of `align`
+#ifndef PK_ALIGNED_MALLOC
+    #if PK_ENABLE_MIMALLOC
+        #define PK_ALIGNED_MALLOC(align, size)  mi_malloc_aligned(size, align)
+        #define PK_ALIGNED_FREE(ptr)            mi_free(ptr)
+    #elif defined(_WIN32)
+        #include <malloc.h>
+        #define PK_ALIGNED_MALLOC(align, size)  _aligned_malloc(size, align)
+        #define PK_ALIGNED_FREE(ptr)            _aligned_free(ptr)
+    #else
+        #define PK_ALIGNED_MALLOC(align, size)  aligned_alloc(align, size)
+        #define PK_ALIGNED_FREE(ptr)            free(ptr)
+    #endif
+#endif
@@ -18,11 +18,40 @@ typedef struct c11_array2d_like_iterator {
     int i;
 } c11_array2d_like_iterator;
 
+// element type of an `array2d`, typed arrays pack their values in `buffer`
+typedef enum c11_array2d_dtype {
+    c11_array2d_object,
+    c11_array2d_int8,
+    c11_array2d_int32,
+    c11_array2d_float32,
+    c11_array2d_bool,
+} c11_array2d_dtype;
+
 typedef struct c11_array2d {
     c11_array2d_like header;
-    py_TValue* data;  // slots
+    py_TValue* data;  // slots, NULL for typed arrays
+    c11_array2d_dtype dtype;
+    void* buffer;
+    // `f_get` of a typed array boxes values here, a reference stays valid for 3 more calls
+    py_TValue boxed[4];
+    unsigned int boxed_index;
 } c11_array2d;
 
+static inline int c11_array2d_dtype__itemsize(c11_array2d_dtype dtype) {
+    switch(dtype) {
+        case c11_array2d_int8: return 1;
+        case c11_array2d_int32: return 4;
+        case c11_array2d_float32: return 4;
+        case c11_array2d_bool: return 1;
+        default: return sizeof(py_TValue);
+    }
+}
+
+static inline int64_t c11_array2d__external_bytes(c11_array2d* self) {
+    if(self->dtype == c11_array2d_object) return 0;
+    return (int64_t)self->header.numel * c11_array2d_dtype__itemsize(self->dtype);
+}
+
 typedef struct c11_array2d_view {
     c11_array2d_like header;
     void* ctx;
@@ -32,6 +61,8 @@ typedef struct c11_array2d_view {
 } c11_array2d_view;
 
 c11_array2d* c11_newarray2d(py_OutRef out, int n_cols, int n_rows);
+// a typed array filled with zeros, NULL with `MemoryError` if the memory limit is exceeded
+c11_array2d* c11_newarray2d_typed(py_OutRef out, int n_cols, int n_rows, c11_array2d_dtype dtype);
 
 /* chunked_array2d */
 #define SMALLMAP_T__HEADER
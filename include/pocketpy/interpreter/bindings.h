@@ -7,5 +7,13 @@ bool array2d_like_iterator__next__(int argc, py_Ref argv);
 bool list_iterator__next__(int argc, py_Ref argv);
 bool tuple_iterator__next__(int argc, py_Ref argv);
 bool dict_items__next__(int argc, py_Ref argv);
+// a `dict_iterator` over the keys of a dict, set or frozenset
+bool dict_keys(int argc, py_Ref argv);
+// 1: next item in retval, 0: exhausted, -1: error
+int dict_items__next(py_Ref self);
 bool range_iterator__next__(int argc, py_Ref argv);
-bool str_iterator__next__(int argc, py_Ref argv);
\ No newline at end of file
+bool str_iterator__next__(int argc, py_Ref argv);
+bool enumerate__next__(int argc, py_Ref argv);
+bool zip__next__(int argc, py_Ref argv);
+bool map__next__(int argc, py_Ref argv);
+bool filter__next__(int argc, py_Ref argv);
@@ -6,6 +6,7 @@
 typedef struct Generator{
     py_Frame* frame;
     int state;
+    c11_vector /*T=py_TValue*/ stack;  // saved stack region [p0, sp) while suspended
 } Generator;
 
 void pk_newgenerator(py_Ref out, py_Frame* frame, py_TValue* begin, py_TValue* end);
@@ -4,19 +4,56 @@
 #include "pocketpy/interpreter/objectpool.h"
 #include <time.h>
 
+typedef struct ManagedHeapYoung {
+    PyObject* obj;
+    PoolArena* arena;  // NULL for large objects
+} ManagedHeapYoung;
+
 typedef struct ManagedHeap {
     MultiPool small_objects;
-    c11_vector /* PyObject_p */ large_objects;
+    c11_vector /* PyObject_p */ large_objects;  // indexed by slot, NULL for free slots
+    c11_vector /* int */ large_free_slots;
+    c11_vector /* uint64_t */ large_marks;      // one bit per slot of `large_objects`
+    int large_object_count;
+    int64_t large_bytes;                        // bytes of `large_objects`, headers included
+    int64_t external_bytes;                     // buffers owned by objects (approx.)
+    int64_t gc_marked_external;                 // `external_bytes` of the marked objects
     c11_vector /* PyObject_p */ gc_roots;
 
-    int freed_ma[3];
-    int gc_threshold;  // threshold for gc_counter
-    int gc_counter;    // objects created since last gc
+    // byte-based pacing, see `ManagedHeap__used_bytes`
+    int64_t gc_threshold;   // threshold for gc_allocated
+    int64_t gc_allocated;   // bytes allocated since last gc
+    int64_t gc_live_bytes;  // bytes in use after last full gc
+    int64_t gc_limit;       // hard limit of the bytes in use, 0 for no limit
+    int64_t gc_trigger;     // `gc_allocated` value of the next `ManagedHeap__safepoint`
     bool gc_enabled;
     py_TValue debug_callback;
+
+    // generational gc
+    bool gc_generational;
+    bool gc_minor;                               // whether the current mark is a minor one
+    c11_vector /* ManagedHeapYoung */ nursery;   // objects created since last gc
+    c11_vector /* PyObject_p */ remembered;      // old objects that may point to young ones
+    int64_t gc_promoted;                         // growth of the old generation since last full gc
+    int64_t gc_promoted_limit;                   // run a full gc when `gc_promoted` exceeds it
+
+    // incremental gc
+    int gc_state;                                // PK_GC_IDLE, PK_GC_MARKING or PK_GC_SWEEPING
+    int64_t gc_next_step;                        // `gc_allocated` value of the next step
+    int gc_cycle_freed;                          // objects freed in this cycle
+    clock_t gc_cycle_start;
+    clock_t gc_mark_clocks;                      // time spent on marking in this cycle
+    clock_t gc_swpet_clocks;                     // time spent on sweeping in this cycle
+    struct ManagedHeapSwpetInfo* gc_cycle_info;  // debug info of this cycle
+
+    struct HeapTracer* tracer;                   // NULL unless tracing allocations
 } ManagedHeap;
 
-typedef struct {
+#define PK_GC_IDLE 0
+#define PK_GC_MARKING 1
+#define PK_GC_SWEEPING 2
+
+typedef struct ManagedHeapSwpetInfo {
     clock_t start;
     clock_t mark_end;
     clock_t swpet_end;
@@ -25,16 +62,14 @@ typedef struct {
     int* small_types;
     int* large_types;
 
+    const char* kind;  // "minor", "full" or "incremental"
     int small_freed;
     int large_freed;
 
     struct {
-        int before;
-        int after;
-        int upper;
-        int lower;
-        int avg_freed;
-        float free_ratio;
+        int64_t before;
+        int64_t after;
+        int64_t live_bytes;
     } auto_thres;
 } ManagedHeapSwpetInfo;
 
@@ -45,12 +80,36 @@ ManagedHeapSwpetInfo* ManagedHeapSwpetInfo__new();
 void ManagedHeapSwpetInfo__delete(ManagedHeapSwpetInfo* self);
 
 void ManagedHeap__collect_hint(ManagedHeap* self);
+void ManagedHeap__safepoint(ManagedHeap* self);
+bool ManagedHeap__reserve(ManagedHeap* self, int64_t bytes) PY_RAISE;
+void ManagedHeap__update_trigger(ManagedHeap* self);
+void ManagedHeap__set_limit(ManagedHeap* self, int64_t limit);
 int ManagedHeap__collect(ManagedHeap* self);
+int ManagedHeap__collect_young(ManagedHeap* self);
 int ManagedHeap__sweep(ManagedHeap* self, ManagedHeapSwpetInfo* out_info);
+void ManagedHeap__set_generational(ManagedHeap* self, bool enabled);
+bool ManagedHeap__step(ManagedHeap* self, int budget_us);
+int ManagedHeap__finish_cycle(ManagedHeap* self);
 
 #define ManagedHeap__new(self, type, slots, udsize)                                                \
     ManagedHeap__gcnew((self), (type), (slots), (udsize))
 PyObject* ManagedHeap__gcnew(ManagedHeap* self, py_Type type, int slots, int udsize);
 
+// bytes in use, including garbage that is not swept yet
+static inline int64_t ManagedHeap__used_bytes(ManagedHeap* self) {
+    return self->small_objects.used_bytes + self->large_bytes + self->external_bytes;
+}
+
+// must be called when a list or a dict grows its buffers by `bytes`
+static inline void ManagedHeap__account(ManagedHeap* self, int64_t bytes) {
+    self->external_bytes += bytes;
+    self->gc_allocated += bytes;
+}
+
 // external implementation
 void ManagedHeap__mark(ManagedHeap* self);
+void ManagedHeap__mark_roots(ManagedHeap* self);
+// put the old objects on the value stack and in the registers into the remembered set
+void ManagedHeap__remember_roots(ManagedHeap* self);
+bool ManagedHeap__propagate(ManagedHeap* self, int max_count);
+int64_t PyObject__external_bytes(PyObject* self);
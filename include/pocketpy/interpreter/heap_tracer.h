@@ -0,0 +1,48 @@
+#pragma once
+
+#include "pocketpy/common/smallmap.h"
+#include "pocketpy/objects/sourcedata.h"
+#include "pocketpy/interpreter/objectpool.h"
+
+// an allocation site is a source line and the type of the objects created there
+typedef struct HeapTraceSite {
+    SourceData_ src;  // NULL for allocations outside of python frames
+    int lineno;
+    py_Type type;
+    int next;  // next site of the same line, 0 if none
+    py_i64 total_count;  // objects created since tracing started
+    py_i64 total_size;   // bytes of objects created since tracing started
+} HeapTraceSite;
+
+typedef struct HeapTraceLarge {
+    int site;
+    int size;
+} HeapTraceLarge;
+
+typedef struct HeapTracer {
+    c11_vector /*T=HeapTraceSite*/ sites;  // site 0 means untraced
+    c11_smallmap_p2i lines;                // SourceData* -> int[], the first site of each line
+    int native_sites;                      // the first site of allocations outside of frames
+    c11_vector /*T=HeapTraceLarge*/ large;  // one per slot of `ManagedHeap::large_objects`
+} HeapTracer;
+
+// live objects and totals of a site when a snapshot was taken
+typedef struct HeapSnapshotRecord {
+    SourceData_ src;
+    int lineno;
+    py_Type type;
+    py_i64 count;
+    py_i64 size;  // including the buffers owned by the objects
+    py_i64 total_count;
+    py_i64 total_size;
+} HeapSnapshotRecord;
+
+struct ManagedHeap;
+
+void HeapTracer__start(struct ManagedHeap* heap);
+void HeapTracer__stop(struct ManagedHeap* heap);
+// `slot` is the slot of a large object, -1 if it is in `arena`
+void HeapTracer__on_alloc(HeapTracer* self, void* obj, PoolArena* arena, int slot, int size);
+// collect garbage and return the records of all sites
+c11_vector /*T=HeapSnapshotRecord*/ HeapTracer__snapshot(struct ManagedHeap* heap);
+void HeapSnapshotRecord__dtor_all(c11_vector* records);
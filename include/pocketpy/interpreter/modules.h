@@ -9,6 +9,7 @@ void pk__add_module_dis();
 void pk__add_module_random();
 void pk__add_module_json();
 void pk__add_module_gc();
+void pk__add_module_tracemalloc();
 void pk__add_module_time();
 void pk__add_module_easing();
 void pk__add_module_traceback();
@@ -21,6 +22,8 @@ void pk__add_module_unicodedata();
 
 void pk__add_module_vmath();
 void pk__add_module_array2d();
+void pk__add_module_collections();
+void pk__add_module_array();
 void pk__add_module_colorcvt();
 
 void pk__add_module_conio();
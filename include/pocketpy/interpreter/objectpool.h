@@ -3,35 +3,62 @@
 #include "pocketpy/common/vector.h"
 #include "pocketpy/common/str.h"
 
-#define kPoolArenaSize (120 * 1024)
+#define kPoolArenaAlign (128 * 1024)  // arenas are aligned to it, see `PoolArena__of`
+#define kPoolArenaSize (118 * 1024)
+#define kPoolArenaUnits (kPoolArenaSize / 32)
+#define kPoolArenaBitmapWords ((kPoolArenaUnits + 63) / 64)
 #define kMultiPoolCount 5
+#define kPoolLazySweepLimit 4
 // #define kPoolMaxBlockSize (32 * kMultiPoolCount)
 
 typedef struct PoolArena {
     int block_size;
     int block_count;
     int unused_length;
+    int empty_since;  // `MultiPool::epoch` when it became empty, -1 if not empty
+    int* sites;       // allocation site of each unit, NULL unless `HeapTracer` used this arena
+
+    // one bit per 32-byte unit of `data`, only the first unit of a block is used
+    uint64_t used[kPoolArenaBitmapWords];   // allocated blocks
+    uint64_t marks[kPoolArenaBitmapWords];  // marked blocks, see `PyObject__mark`
+    uint16_t unused[kPoolArenaUnits];       // first units of free blocks
 
     union {
         char data[kPoolArenaSize];
         int64_t _align64;
     };
-
-    int unused[];
 } PoolArena;
 
+// the arena of an object that is not large
+#define PoolArena__of(p) ((PoolArena*)((uintptr_t)(p) & ~(uintptr_t)(kPoolArenaAlign - 1)))
+#define PoolArena__unit(self, p) ((int)(((char*)(p) - (self)->data) >> 5))
+
 typedef struct Pool {
     c11_vector /* PoolArena* */ arenas;
     c11_vector /* PoolArena* */ no_free_arenas;
+    c11_vector /* PoolArena* */ unswept_arenas;
     int block_size;
 } Pool;
 
 typedef struct MultiPool {
     Pool pools[kMultiPoolCount];
+    int epoch;            // number of `MultiPool__reclaim_arenas` calls
+    int released_arenas;  // number of arenas given back to the allocator
+    int64_t used_bytes;   // bytes of the allocated blocks
+    // lazy sweeping
+    int* sweep_out_types;
+    int sweep_freed;
 } MultiPool;
 
-void* MultiPool__alloc(MultiPool* self, int size);
+void* MultiPool__alloc(MultiPool* self, int size, PoolArena** out_arena);
 int MultiPool__sweep_dealloc(MultiPool* self, int* out_types);
+void MultiPool__begin_lazy_sweep(MultiPool* self, int* out_types);
+bool MultiPool__lazy_sweep_one(MultiPool* self);
+void MultiPool__clear_marks(MultiPool* self);
+void MultiPool__reclaim_arenas(MultiPool* self, int grace);
+void MultiPool__dealloc(MultiPool* self, PoolArena* arena, void* p);
+int PoolArena__sweep_dealloc(PoolArena* self, int* out_types);
 void MultiPool__ctor(MultiPool* self);
 void MultiPool__dtor(MultiPool* self);
+void MultiPool__clear_sites(MultiPool* self);
 c11_string* MultiPool__summary(MultiPool* self);
\ No newline at end of file
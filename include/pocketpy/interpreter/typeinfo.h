@@ -9,6 +9,7 @@ typedef struct py_TypeInfo {
     py_Type index;
     py_Type base;
     struct py_TypeInfo* base_ti;
+    py_Type native_base;  // the type itself, or the nearest base defined in C for python classes
 
     py_TValue self;
     py_GlobalRef module;
@@ -16,20 +17,35 @@ typedef struct py_TypeInfo {
     bool is_python;  // is it a python class? (not derived from c object)
     bool is_final;  // can it be subclassed?
 
+    uint32_t version;  // version tag for inline caches, 0 if unassigned
+    int inline_attrs;  // inline attribute values of new instances, see `PyObject__instdict_append`
+    int inst_slots;    // fixed slots of instances created by `object.__new__`, -1 for a `__dict__`
+
     bool (*getattribute)(py_Ref self, py_Name name) PY_RAISE PY_RETURN;
     bool (*setattribute)(py_Ref self, py_Name name, py_Ref val) PY_RAISE PY_RETURN;
     bool (*delattribute)(py_Ref self, py_Name name) PY_RAISE;
     bool (*getunboundmethod)(py_Ref self, py_Name name) PY_RETURN;
 
     py_TValue annotations;
+    py_TValue slot_names;  // tuple of the names of the fixed slots, nil if `inst_slots < 0`
     py_Dtor dtor;  // destructor for this type, NULL if no dtor
     void (*on_end_subclass)(struct py_TypeInfo*);  // backdoor for enum module
 } py_TypeInfo;
 
+// the userdata of a `member_descriptor`, which is created for each name in `__slots__`
+typedef struct py_MemberInfo {
+    py_Name name;
+    py_Type owner;
+    int index;  // slot index in the instances, -1 if they keep the value in their `__dict__`
+} py_MemberInfo;
+
 py_TypeInfo* pk_typeinfo(py_Type type);
 py_ItemRef pk_tpfindname(py_TypeInfo* ti, py_Name name);
 #define pk_tpfindmagic pk_tpfindname
 
+uint32_t pk_tpversion(py_TypeInfo* ti);
+void pk_tpmodified(py_TypeInfo* ti);
+
 py_Type pk_newtype(const char* name,
                    py_Type base,
                    const py_GlobalRef module,
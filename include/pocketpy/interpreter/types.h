@@ -3,6 +3,8 @@
 #include "pocketpy/common/vector.h"
 #include "pocketpy/objects/base.h"
 
+#include <stddef.h>
+
 typedef struct {
     uint64_t hash;
     py_TValue key;
@@ -11,14 +13,85 @@ typedef struct {
 
 typedef struct {
     int length;
-    uint32_t capacity;
-    uint32_t null_index_value;
+    uint32_t capacity;     // number of slots, a power of two
+    uint32_t growth_left;  // empty slots that can be used before the table is rebuilt
     bool index_is_short;
-    void* indices;
+    uint8_t* table;        // groups of control bytes and indices, see `PyDict.c`
     c11_vector /*T=DictEntry*/ entries;
 } Dict;
 
 typedef c11_vector List;
 
+// `set` and `frozenset` share the hash table of `dict`, their entries have no `val`
+#define kDictMinCapacity 16
+#define kSetEntrySize ((int)offsetof(DictEntry, val))
+
+// the `i`-th entry, entries are `entries.elem_size` bytes apart
+#define Dict__entry(self, i)                                                                       \
+    ((DictEntry*)((char*)(self)->entries.data + (size_t)(i) * (self)->entries.elem_size))
+#define Dict__has_values(self) ((self)->entries.elem_size == sizeof(DictEntry))
+
+void Dict__ctor(Dict* self, uint32_t capacity, int entries_capacity, int entry_size);
+void Dict__dtor(Dict* self);
+// false if the copy would exceed the memory limit, `out` is left empty
+bool Dict__copy(Dict* self, Dict* out);
+void Dict__clear(Dict* self);
+// false on error, `*out` is NULL if not found
+bool Dict__try_get(Dict* self, py_TValue* key, DictEntry** out);
+bool Dict__set(Dict* self, py_TValue* key, py_TValue* val);
+// find or insert `key`, the `val` of a new entry is uninitialized. -1: error, 0: found, 1: inserted
+int Dict__emplace(Dict* self, py_TValue* key, DictEntry** out);
+// -1: error, 0: not found, 1: found and deleted
+int Dict__discard(Dict* self, py_TValue* key);
+
+// bytes of the buffers owned by a dict or a list, see `ManagedHeap__account`
+static inline int64_t Dict__external_bytes(Dict* self) {
+    size_t index_size = self->index_is_short ? sizeof(uint16_t) : sizeof(uint32_t);
+    return (int64_t)(self->capacity * (1 + index_size) +
+                     (size_t)self->entries.capacity * self->entries.elem_size);
+}
+
+static inline int64_t List__external_bytes(List* self) {
+    return (int64_t)self->capacity * self->elem_size;
+}
+
+/* collections */
+
+// `collections.deque`, a ring buffer
+typedef struct {
+    py_TValue* data;
+    int capacity;  // a power of two
+    int head;      // index of the first element in `data`
+    int length;
+    int maxlen;  // -1 if unbounded
+} Deque;
+
+// `collections.defaultdict`, `dict` methods work on it as a `Dict`
+typedef struct {
+    Dict dict;
+    py_TValue default_factory;
+} DefaultDict;
+
+static inline int64_t Deque__external_bytes(Deque* self) {
+    return (int64_t)self->capacity * sizeof(py_TValue);
+}
+
+/* array */
+
+// `array.array`, packed numbers of one `typecode`
+typedef struct {
+    char* data;
+    int length;
+    int capacity;
+    int offset;  // index of the first element in `base` for views
+    char typecode;
+    int itemsize;
+    py_TValue base;  // the array a view shares its buffer with, or nil
+} Array;
+
+static inline int64_t Array__external_bytes(Array* self) {
+    return (int64_t)self->capacity * self->itemsize;
+}
+
 void c11_chunked_array2d__mark(void* ud, c11_vector* p_stack);
 void function__gc_mark(void* ud, c11_vector* p_stack);
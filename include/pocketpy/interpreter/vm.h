@@ -29,6 +29,11 @@ typedef struct WatchdogInfo {
     clock_t max_reset_time;
 } WatchdogInfo;
 
+typedef struct InlineCacheStats {
+    int64_t hits;
+    int64_t misses;
+} InlineCacheStats;
+
 typedef struct TypePointer {
     py_TypeInfo* ti;
     py_Dtor dtor;
@@ -57,6 +62,7 @@ typedef struct VM {
 
     int recursion_depth;
     int max_recursion_depth;
+    bool compile_cache;  // read and write `.pkc` files in `py_import`
 
     py_TValue reg[8];  // users' registers
     void* ctx;         // user-defined context
@@ -68,6 +74,9 @@ typedef struct VM {
     py_StackRef curr_decl_based_function;   // this is for get current function without frame
     TraceInfo trace_info;
     WatchdogInfo watchdog_info;
+    InlineCacheStats ic_stats;
+    ShapeTree shapes;
+    uint32_t next_type_version;
     LineProfiler line_profiler;
     py_TValue vectorcall_buffer[PK_MAX_CO_VARNAMES];
 
@@ -90,6 +99,9 @@ bool pk__parse_int_slice(py_Ref slice,
                          int* restrict step);
 bool pk__normalize_index(int* index, int length);
 
+py_i64 cpy11__fast_floor_div(py_i64 a, py_i64 b);
+py_i64 cpy11__fast_mod(py_i64 a, py_i64 b);
+
 bool pk__object_new(int argc, py_Ref argv);
 
 bool pk_wrapper__self(int argc, py_Ref argv);
@@ -101,6 +113,7 @@ typedef enum FrameResult {
     RES_RETURN = 1,
     RES_CALL = 2,
     RES_YIELD = 3,
+    RES_SWITCH = 4,  // internal, switch between the traced and untraced interpreter loop
 } FrameResult;
 
 FrameResult VM__run_top_frame(VM* self);
@@ -113,11 +126,18 @@ int pk_arrayview(py_Ref self, py_TValue** p);
 bool pk_wrapper__arrayequal(py_Type type, int argc, py_Ref argv);
 bool pk_arraycontains(py_Ref self, py_Ref val);
 
+void pk_newset(py_OutRef out);
+bool pk_set__add(py_Ref self, py_Ref key);
+
 bool pk_loadmethod(py_StackRef self, py_Name name);
 bool pk_callmagic(py_Name name, int argc, py_Ref argv);
 
 bool pk_exec(CodeObject* co, py_Ref module);
 bool pk_execdyn(CodeObject* co, py_Ref module, py_Ref globals, py_Ref locals);
+// like `py_exec(source, filename, EXEC_MODE, module)`, but goes through the `.pkc` cache if enabled
+bool pk_exec_cached(const char* source, const char* filename, py_Ref module);
+// run a module bundled in `_generated.c`, from its precompiled bytecode if it is up to date
+bool pk_exec_pythonlib(const char* name, const char* source, const char* filename, py_Ref module);
 
 /// Assumes [a, b] are on the stack, performs a binary op.
 /// The result is stored in `self->last_retval`.
@@ -136,6 +156,8 @@ py_Type pk_str_iterator__register();
 py_Type pk_bytes__register();
 py_Type pk_dict__register();
 py_Type pk_dict_items__register();
+py_Type pk_set__register();
+py_Type pk_frozenset__register();
 py_Type pk_list__register();
 py_Type pk_tuple__register();
 py_Type pk_list_iterator__register();
@@ -152,13 +174,25 @@ py_Type pk_Exception__register();
 py_Type pk_StopIteration__register();
 py_Type pk_super__register();
 py_Type pk_property__register();
+py_Type pk_member_descriptor__register();
 py_Type pk_staticmethod__register();
 py_Type pk_classmethod__register();
 py_Type pk_generator__register();
+py_Type pk_enumerate__register();
+py_Type pk_zip__register();
+py_Type pk_map__register();
+py_Type pk_filter__register();
 py_Type pk_namedict__register();
 py_Type pk_code__register();
 
 py_GlobalRef pk_builtins__register();
 
 /* mappingproxy */
-void pk_mappingproxy__namedict(py_Ref out, py_Ref object);
\ No newline at end of file
+void pk_mappingproxy__namedict(py_Ref out, py_Ref object);
+/* __slots__ */
+// create the member descriptors of `ti` and choose the layout of its instances
+bool pk__tpsetslots(py_TypeInfo* ti, py_Ref slots) PY_RAISE;
+// the value of a member in `self`, NULL if it is unset
+py_TValue* pk_member__ref(py_Ref member, py_Ref self);
+bool pk_member__set(py_Ref member, py_Ref self, py_Ref val) PY_RAISE;
+bool pk_member__del(py_Ref member, py_Ref self) PY_RAISE;
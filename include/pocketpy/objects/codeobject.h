@@ -8,6 +8,7 @@
 #include "pocketpy/objects/base.h"
 #include "pocketpy/objects/sourcedata.h"
 #include "pocketpy/objects/namedict.h"
+#include "pocketpy/objects/shape.h"
 #include "pocketpy/pocketpy.h"
 
 #define BC_NOARG 0
@@ -46,11 +47,14 @@ typedef enum Opcode {
 
 typedef struct Bytecode {
     uint8_t op;
+    uint8_t counter;  // warmup and backoff of BINARY_* and COMPARE_* quickening
     uint16_t arg;
 } Bytecode;
 
 void Bytecode__set_signed_arg(Bytecode* self, int arg);
 bool Bytecode__is_forward_jump(const Bytecode* self);
+// fuse `self` and `next` into a superinstruction stored in `self`, `next` is left unchanged
+bool Bytecode__fuse(Bytecode* self, const Bytecode* next);
 
 typedef struct CodeBlock {
     CodeBlockType type;
@@ -63,8 +67,35 @@ typedef struct CodeBlock {
 typedef struct BytecodeEx {
     int lineno;       // line number for each bytecode
     int iblock;       // block index
+    int icache;       // inline cache index, -1 if none
 } BytecodeEx;
 
+typedef enum InlineCacheKind {
+    InlineCacheKind_INSTANCE_DICT,  // not found in the class, look up the instance dict
+    InlineCacheKind_METHOD,         // function or nativefunc found in the class
+    InlineCacheKind_STATICMETHOD,
+    InlineCacheKind_CLASSMETHOD,
+    InlineCacheKind_PROPERTY,
+    InlineCacheKind_MEMBER,         // member descriptor of `__slots__`
+    InlineCacheKind_CLASS_VALUE,    // any other class attribute
+} InlineCacheKind;
+
+// per-instruction cache for LOAD_ATTR, LOAD_METHOD and STORE_ATTR
+typedef struct InlineCache {
+    py_Type type;          // receiver type, 0 if empty
+    uint32_t version;      // version tag of `type` when this entry was filled
+    InlineCacheKind kind;
+    py_TValue value;       // resolved class attribute (weak ref)
+    Shape* shape;          // instance shape seen last, NULL if none
+    int shape_index;       // index of the name in `shape`, -1 if absent
+    Shape* shape_next;     // `shape` plus the name, for STORE_ATTR if it is absent
+} InlineCache;
+
+bool Opcode__has_inline_cache(Opcode op);
+Opcode Opcode__generic(Opcode op);
+Opcode Opcode__quicken_binary(Opcode op, py_Type lhs, py_Type rhs);
+Opcode Opcode__quicken_for_iter(py_Type iter);
+
 typedef struct CodeObject {
     SourceData_ src;
     c11_string* name;
@@ -82,6 +113,7 @@ typedef struct CodeObject {
 
     c11_vector /*T=CodeBlock*/ blocks;
     c11_vector /*T=FuncDecl_*/ func_decls;
+    c11_vector /*T=InlineCache*/ caches;
 
     int start_line;
     int end_line;
@@ -91,7 +123,12 @@ void CodeObject__ctor(CodeObject* self, SourceData_ src, c11_sv name);
 void CodeObject__dtor(CodeObject* self);
 int CodeObject__add_varname(CodeObject* self, py_Name name);
 int CodeObject__add_name(CodeObject* self, py_Name name);
+int CodeObject__add_inline_cache(CodeObject* self);
 void CodeObject__gc_mark(const CodeObject* self, c11_vector* p_stack);
+// binary format, see codeobject_ser.c
+bool CodeObject__serialize(const CodeObject* self, c11_sv source, c11_vector* out /*T=char*/) PY_RAISE;
+// returns NULL on success, otherwise the reason; `source` is optional and must match the hash
+const char* CodeObject__deserialize(CodeObject* out, const void* data, int size, const char* source);
 
 typedef struct FuncDeclKwArg {
     int index;        // index in co->varnames
@@ -1,35 +1,116 @@
 #pragma once
 
 #include "pocketpy/objects/namedict.h"
+#include "pocketpy/objects/shape.h"
 #include "pocketpy/objects/base.h"
+#include "pocketpy/interpreter/objectpool.h"
 
 typedef struct PyObject {
     py_Type type;  // we have a duplicated type here for convenience
-    // bool _;
-    bool gc_marked;
+    uint8_t gc_gen;  // PK_GC_YOUNG, PK_GC_OLD or PK_GC_REMEMBERED
+    bool gc_large;   // allocated by `PK_MALLOC` instead of a pool arena
     int slots;  // number of slots in the object
     char flex[];
 } PyObject;
 
 // slots >= 0, allocate N slots
 // slots == -1, allocate a dict
+// slots <= -2, allocate an instance dict with `PK_OBJ_INLINE_ATTRS(slots)` inline values
 
-// | HEADER | <N slots> | <userdata>
-// | HEADER | <dict>    | <userdata>
+// | HEADER | <N slots>       | <userdata>
+// | HEADER | <dict>          | <userdata>
+// | HEADER | <instance dict> | <userdata>
+
+// `ManagedHeap__gcnew` turns -1 into an instance dict unless the object is a type or a module
+#define PK_OBJ_INLINE_ATTRS(slots) (-2 - (slots))
 
 py_TValue* PyObject__slots(PyObject* self);
 NameDict* PyObject__dict(PyObject* self);
 void* PyObject__userdata(PyObject* self);
 
-#define PK_OBJ_SLOTS_SIZE(slots) ((slots) >= 0 ? sizeof(py_TValue) * (slots) : sizeof(NameDict))
+#define PK_OBJ_SLOTS_SIZE(slots)                                                                   \
+    ((slots) >= 0     ? sizeof(py_TValue) * (slots)                                                \
+     : (slots) == -1 ? sizeof(NameDict)                                                           \
+                     : sizeof(InstanceDict) + sizeof(py_TValue) * PK_OBJ_INLINE_ATTRS(slots))
+
+static inline InstanceDict* PyObject__instdict(PyObject* self) {
+    return (InstanceDict*)self->flex;
+}
+
+// the value of the `i`-th attribute of an instance with a shape
+static inline py_TValue* PyObject__instdict_at(PyObject* self, int i) {
+    InstanceDict* d = (InstanceDict*)self->flex;
+    int n = PK_OBJ_INLINE_ATTRS(self->slots);
+    return i < n ? &d->values[i] : &d->extra[i - n];
+}
+
+// add the last attribute of `next`, whose parent is the shape of `self`
+void PyObject__instdict_append(PyObject* self, Shape* next, py_TValue* val);
+
+// attributes of an object with a `__dict__` (slots < 0), whichever layout it has
+py_TValue* PyObject__getdict(PyObject* self, py_Name name);
+void PyObject__setdict(PyObject* self, py_Name name, py_TValue* val);
+bool PyObject__deldict(PyObject* self, py_Name name);
+void PyObject__cleardict(PyObject* self);
+int PyObject__dictlen(PyObject* self);
+// iterate with `for(int i = 0; PyObject__nextdict(self, &i, &name, &val);)`,
+// instances with a shape are iterated in insertion order
+bool PyObject__nextdict(PyObject* self, int* i, py_Name* name, py_TValue** val);
+int64_t PyObject__dict_external_bytes(PyObject* self);
 
 void PyObject__dtor(PyObject* self);
 
+// mark bits are kept out of the objects, in `PoolArena::marks` or `ManagedHeap::large_marks`,
+// so that a collection does not write to the pages of living objects
+bool PyObject__is_marked_large(PyObject* self);
+bool PyObject__mark_large(PyObject* self);
+
+static inline bool PyObject__is_marked(PyObject* self) {
+    if(self->gc_large) return PyObject__is_marked_large(self);
+    PoolArena* arena = PoolArena__of(self);
+    int unit = PoolArena__unit(arena, self);
+    return (arena->marks[unit >> 6] >> (unit & 63)) & 1;
+}
+
+// mark `self`, return false if it was already marked
+static inline bool PyObject__mark(PyObject* self) {
+    if(self->gc_large) return PyObject__mark_large(self);
+    PoolArena* arena = PoolArena__of(self);
+    int unit = PoolArena__unit(arena, self);
+    uint64_t bit = (uint64_t)1 << (unit & 63);
+    if(arena->marks[unit >> 6] & bit) return false;
+    arena->marks[unit >> 6] |= bit;
+    return true;
+}
+
+// generational gc
+// old objects stay marked between collections, so a minor collection
+// never traverses them unless they are in the remembered set
+#define PK_GC_YOUNG 0
+#define PK_GC_OLD 1
+#define PK_GC_REMEMBERED 2
+
+void PyObject__remember(PyObject* self);
+void PyObject__remember_value(PyObject* self, PyObject* val);
+
+// must be called before a reference is stored into an existing object
+#define pk__write_barrier(obj)                                                                     \
+    do {                                                                                           \
+        if((obj)->gc_gen == PK_GC_OLD) PyObject__remember(obj);                                    \
+    } while(0)
+
+// same as `pk__write_barrier`, but skipped if `val` is marked (old, or already reached),
+// while an incremental gc is marking, `val` is marked instead
+#define pk__write_barrier_value(obj, val)                                                          \
+    do {                                                                                           \
+        if((val)->is_ptr && (obj)->gc_gen == PK_GC_OLD && !PyObject__is_marked((val)->_obj)) {     \
+            PyObject__remember_value((obj), (val)->_obj);                                          \
+        }                                                                                          \
+    } while(0)
+
 
 #define pk__mark_value(val)                                                                        \
-    if((val)->is_ptr && !(val)->_obj->gc_marked) {                                                 \
-        PyObject* obj = (val)->_obj;                                                               \
-        obj->gc_marked = true;                                                                     \
-        c11_vector__push(PyObject*, p_stack, obj);                                                 \
+    if((val)->is_ptr && PyObject__mark((val)->_obj)) {                                             \
+        c11_vector__push(PyObject*, p_stack, (val)->_obj);                                         \
     }
 
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "pocketpy/objects/base.h"
+#include "pocketpy/objects/namedict.h"
+#include "pocketpy/pocketpy.h"
+
+// a hidden class, shared by the instances that got the same attributes in the same order
+typedef struct Shape {
+    struct Shape* parent;        // NULL for the root
+    struct Shape* first_child;   // shapes with one more attribute, linked by `next_sibling`
+    struct Shape* next_sibling;
+    int length;                  // number of attributes
+    py_Name names[];             // attribute names in insertion order
+} Shape;
+
+// all shapes of a VM, they live until the VM is destroyed
+typedef struct ShapeTree {
+    Shape* root;
+    int count;
+} ShapeTree;
+
+void ShapeTree__ctor(ShapeTree* self);
+void ShapeTree__dtor(ShapeTree* self);
+// the shape after adding `name` to `shape`, NULL if it would exceed `PK_SHAPE_MAX_ATTRS` or
+// `PK_SHAPE_MAX_COUNT`
+Shape* ShapeTree__transition(ShapeTree* self, Shape* shape, py_Name name);
+
+// index of `name` in `self`, -1 if not found
+static inline int Shape__index(const Shape* self, py_Name name) {
+    for(int i = 0; i < self->length; i++) {
+        if(self->names[i] == name) return i;
+    }
+    return -1;
+}
+
+// the `__dict__` of an instance, which is an object with `slots <= -2`
+// | HEADER | shape | extra | <N inline values> | <userdata>
+typedef struct InstanceDict {
+    Shape* shape;  // NULL if the attributes are kept in `dict`
+    union {
+        py_TValue* extra;  // values after the inline ones, maybe NULL
+        NameDict* dict;
+    };
+    py_TValue values[];
+} InstanceDict;
+
+// capacity of `InstanceDict::extra` for `n` values, it grows by powers of two
+static inline int InstanceDict__extra_capacity(int n) {
+    if(n == 0) return 0;
+    int cap = 4;
+    while(cap < n)
+        cap *= 2;
+    return cap;
+}
@@ -143,6 +143,17 @@ PK_API void py_sys_setargv(int argc, char** argv);
 PK_API void py_sys_settrace(py_TraceFunc func, bool reset);
 /// Invoke the garbage collector.
 PK_API int py_gc_collect();
+/// Run the garbage collector for at most `budget_us` microseconds if a collection is due.
+/// A full collection is done in several steps, call this again to continue it.
+/// Returns `true` if there is no unfinished collection.
+PK_API bool py_gc_step(int budget_us);
+/// Set the memory limit of the current VM in bytes, `0` means no limit.
+/// When the objects of the VM use more, a full collection is done before the next call.
+/// Growing a container buffer, or building a big str, bytes, array or typed array2d,
+/// raises `MemoryError` if that does not free enough.
+PK_API void py_setmemorylimit(size_t bytes);
+/// Get the bytes used by the objects of the current VM, including buffers of lists and dicts.
+PK_API size_t py_getmemoryusage();
 
 /// Wrapper for `PK_MALLOC(size)`.
 PK_API void* py_malloc(size_t size);
@@ -190,6 +201,23 @@ PK_API bool py_exec(const char* source,
                     const char* filename,
                     enum py_CompileMode mode,
                     py_Ref module) PY_RAISE PY_RETURN;
+/// Compile a source string into a portable bytecode buffer.
+/// The result is a `bytes` object stored in `py_retval()`.
+/// Constants that are not `None`, `bool`, `int`, `float`, `str`, `bytes`, `tuple` or `...`
+/// (e.g. results of compile-time calls) cannot be serialized and raise `TypeError`.
+PK_API bool py_compile_to_bytes(const char* source,
+                                const char* filename,
+                                enum py_CompileMode mode) PY_RAISE PY_RETURN;
+/// Run a bytecode buffer created by `py_compile_to_bytes`.
+/// Buffers from a different pocketpy version are rejected with `ValueError`.
+/// So are malformed buffers, including instructions whose arguments are out of range
+/// of the code object's tables or jump outside of its code.
+/// @param module target module. Use NULL for the main module.
+PK_API bool py_exec_bytes(const unsigned char* data, int size, py_Ref module) PY_RAISE PY_RETURN;
+/// Enable or disable the compile cache of `py_import` (disabled by default).
+/// When enabled, `foo.py` is compiled to `foo.pkc` next to it and later imports load the cache
+/// directly, as long as the source hash and the pocketpy version still match.
+PK_API void py_setcompilecache(bool enabled);
 /// Evaluate a source string. Equivalent to `py_exec(source, "<string>", EVAL_MODE, module)`.
 PK_API bool py_eval(const char* source, py_Ref module) PY_RAISE PY_RETURN;
 /// Run a source string with smart interpretation.
@@ -324,6 +352,8 @@ PK_API bool py_tobool(py_Ref);
 /// Convert a `type` object in python to `py_Type`.
 PK_API py_Type py_totype(py_Ref);
 /// Convert a user-defined object to its userdata.
+/// Writes through this pointer have no write barrier, so the gc does not see references
+/// stored into the userdata. Keep them in slots and store them with `py_setslot()`.
 PK_API void* py_touserdata(py_Ref);
 /// Convert a `str` object in python to null-terminated string.
 PK_API const char* py_tostr(py_Ref);
@@ -439,7 +469,7 @@ PK_API py_GlobalRef py_retval();
 #define py_r7() py_getreg(7)
 
 /// Get an item from the object's `__dict__`.
-/// Return `NULL` if not found.
+/// Return `NULL` if not found. The returned item is read-only, use `py_setdict()` to modify it.
 PK_API py_ItemRef py_getdict(py_Ref self, py_Name name);
 /// Set an item to the object's `__dict__`.
 PK_API void py_setdict(py_Ref self, py_Name name, py_Ref val);
@@ -457,6 +487,8 @@ PK_API bool
 PK_API void py_cleardict(py_Ref self);
 /// Get the i-th slot of the object.
 /// The object must have slots and `i` must be in valid range.
+/// Writes through the returned reference have no write barrier, use `py_setslot()` to store
+/// a reference once python code has run since the object was created.
 PK_API py_ObjectRef py_getslot(py_Ref self, int i);
 /// Set the i-th slot of the object.
 PK_API void py_setslot(py_Ref self, int i, py_Ref val);
@@ -656,6 +688,7 @@ PK_API bool py_raise(py_Ref) PY_RAISE;
 #define IndexError(...) py_exception(tp_IndexError, __VA_ARGS__)
 #define ImportError(...) py_exception(tp_ImportError, __VA_ARGS__)
 #define ZeroDivisionError(...) py_exception(tp_ZeroDivisionError, __VA_ARGS__)
+#define MemoryError(...) py_exception(tp_MemoryError, __VA_ARGS__)
 #define AttributeError(self, n)                                                                    \
     py_exception(tp_AttributeError, "'%t' object has no attribute '%n'", (self)->type, (n))
 #define UnboundLocalError(n)                                                                       \
@@ -684,7 +717,10 @@ PK_API void py_debugger_exit(int code);
 
 /// Create a `tuple` with `n` UNINITIALIZED elements.
 /// You should initialize all elements before using it.
+/// Writes through the returned pointer have no write barrier, use `py_tuple_setitem()`
+/// to store a reference once python code has run since the tuple was created.
 PK_API py_ObjectRef py_newtuple(py_OutRef, int n);
+/// Writes through the returned pointer have no write barrier, see `py_newtuple()`.
 PK_API py_ObjectRef py_tuple_data(py_Ref self);
 PK_API py_ObjectRef py_tuple_getitem(py_Ref self, int i);
 PK_API void py_tuple_setitem(py_Ref self, int i, py_Ref val);
@@ -758,7 +794,7 @@ PK_API void py_newarray2d(py_OutRef out, int width, int height);
 PK_API int py_array2d_getwidth(py_Ref self);
 PK_API int py_array2d_getheight(py_Ref self);
 PK_API py_ObjectRef py_array2d_getitem(py_Ref self, int x, int y);
-PK_API void py_array2d_setitem(py_Ref self, int x, int y, py_Ref val);
+PK_API bool py_array2d_setitem(py_Ref self, int x, int y, py_Ref val) PY_RAISE;
 
 /************* vmath module *************/
 PK_API void py_newvec2(py_OutRef out, c11_vec2);
@@ -846,7 +882,10 @@ enum py_PredefinedType {
     tp_code,
     tp_dict,
     tp_dict_iterator,  // 1 slot
+    tp_set,            // Dict without values
+    tp_frozenset,      // Dict without values
     tp_property,       // 2 slots (getter + setter)
+    tp_member_descriptor,  // py_MemberInfo
     tp_star_wrapper,   // 1 slot + int level
     tp_staticmethod,   // 1 slot
     tp_classmethod,    // 1 slot
@@ -854,6 +893,10 @@ enum py_PredefinedType {
     tp_NotImplementedType,
     tp_ellipsis,
     tp_generator,
+    tp_enumerate,  // 1 slot + py_i64
+    tp_zip,        // N slots
+    tp_map,        // N+1 slots
+    tp_filter,     // 2 slots
     /* builtin exceptions */
     tp_SystemExit,
     tp_KeyboardInterrupt,
@@ -874,6 +917,7 @@ enum py_PredefinedType {
     tp_ImportError,
     tp_AssertionError,
     tp_KeyError,
+    tp_MemoryError,
     /* vmath */
     tp_vec2,
     tp_vec3,
@@ -887,6 +931,14 @@ enum py_PredefinedType {
     tp_array2d,
     tp_array2d_view,
     tp_chunked_array2d,
+    /* collections */
+    tp_deque,           // Deque
+    tp_deque_iterator,  // 1 slot + int index
+    tp_defaultdict,     // DefaultDict
+    tp_Counter,         // Dict
+    /* array */
+    tp_array,           // Array
+    tp_array_iterator,  // 1 slot + int index
 };
 
 #ifdef __cplusplus
@@ -0,0 +1,1434 @@
+// The interpreter loop, included twice by ceval.c.
+// `PK_CEVAL_TRACED == 1` generates the slow loop with per-instruction hooks (trace function,
+// watchdog, debug printing), while `PK_CEVAL_TRACED == 0` generates the fast loop without them.
+// Both loops switch to each other by returning `RES_SWITCH` at frame boundaries and after calls.
+
+#if !defined(PK_CEVAL_NAME) || !defined(PK_CEVAL_TRACED)
+#error "PK_CEVAL_NAME and PK_CEVAL_TRACED must be defined"
+#endif
+
+#if PK_ENABLE_COMPUTED_GOTO
+#define TARGET(op) TARGET_##op: case op
+#else
+#define TARGET(op) case op
+#endif
+
+#if PK_CEVAL_TRACED || !PK_ENABLE_COMPUTED_GOTO
+#define DISPATCH_NEXT() goto __NEXT_STEP
+#else
+#define DISPATCH_NEXT()                                                                            \
+    do {                                                                                           \
+        byte = co_codes[frame->ip];                                                                \
+        goto* dispatch_table[byte.op];                                                             \
+    } while(0)
+#endif
+
+#define DISPATCH()                                                                                 \
+    do {                                                                                           \
+        frame->ip++;                                                                               \
+        DISPATCH_NEXT();                                                                           \
+    } while(0)
+#define DISPATCH_JUMP(__offset)                                                                    \
+    do {                                                                                           \
+        frame->ip += __offset;                                                                     \
+        DISPATCH_NEXT();                                                                           \
+    } while(0)
+#define DISPATCH_JUMP_ABSOLUTE(__target)                                                           \
+    do {                                                                                           \
+        frame->ip = __target;                                                                      \
+        DISPATCH_NEXT();                                                                           \
+    } while(0)
+// run the second instruction of a superinstruction, skipping the per-instruction hooks
+#if PK_ENABLE_COMPUTED_GOTO
+#define DISPATCH_FUSED(op)                                                                         \
+    do {                                                                                           \
+        byte = co_codes[++frame->ip];                                                              \
+        goto TARGET_##op;                                                                          \
+    } while(0)
+#else
+#define DISPATCH_FUSED(op)                                                                         \
+    do {                                                                                           \
+        byte = co_codes[++frame->ip];                                                              \
+        goto __DISPATCH_SWITCH;                                                                    \
+    } while(0)
+#endif
+// calls may enable or disable tracing, check if we need to switch the loop
+#define DISPATCH_OR_SWITCH()                                                                       \
+    do {                                                                                           \
+        frame->ip++;                                                                               \
+        if(VM__need_traced_loop(self) != PK_CEVAL_TRACED) return RES_SWITCH;                      \
+        DISPATCH_NEXT();                                                                           \
+    } while(0)
+
+static FrameResult PK_CEVAL_NAME(VM* self, const py_Frame* base_frame, bool resume) {
+    py_Frame* frame = self->top_frame;
+    Bytecode* co_codes;
+    py_Name* co_names;
+    Bytecode byte;
+
+#if PK_ENABLE_COMPUTED_GOTO
+    static const void* dispatch_table[] = {
+    #define OPCODE(name) &&TARGET_OP_##name,
+    #include "pocketpy/xmacros/opcodes.h"
+    #undef OPCODE
+    };
+#endif
+
+    if(resume) {
+        RESET_CO_CACHE();
+        goto __NEXT_STEP;
+    }
+
+__NEXT_FRAME:
+    if(self->recursion_depth >= self->max_recursion_depth) {
+        py_exception(tp_RecursionError, "maximum recursion depth exceeded");
+        goto __ERROR;
+    }
+    RESET_CO_CACHE();
+    frame->ip++;
+    if(VM__need_traced_loop(self) != PK_CEVAL_TRACED) return RES_SWITCH;
+
+__NEXT_STEP:
+    byte = co_codes[frame->ip];
+
+#if PK_CEVAL_TRACED
+    if(self->trace_info.func) {
+        bool is_virtual = byte.op == OP_RETURN_VALUE && byte.arg == BC_RETURN_VIRTUAL;
+        if(!is_virtual) {
+            SourceLocation loc = Frame__source_location(frame);
+            SourceLocation prev_loc = self->trace_info.prev_loc;
+            if(loc.lineno != prev_loc.lineno || loc.src != prev_loc.src) {
+                if(prev_loc.src) PK_DECREF(prev_loc.src);
+                PK_INCREF(loc.src);
+                self->trace_info.prev_loc = loc;
+                self->trace_info.func(frame, TRACE_EVENT_LINE);
+            }
+        }
+    }
+
+#if PK_ENABLE_WATCHDOG
+    if(self->watchdog_info.max_reset_time > 0) {
+        if(py_debugger_status() == 0 && clock() > self->watchdog_info.max_reset_time) {
+            self->watchdog_info.max_reset_time = 0;
+            TimeoutError("watchdog timeout");
+            goto __ERROR;
+        }
+    }
+#endif
+
+#ifndef NDEBUG
+    pk_print_stack(self, frame, byte);
+#endif
+#endif  // PK_CEVAL_TRACED
+
+#if PK_ENABLE_COMPUTED_GOTO
+    goto* dispatch_table[byte.op];
+#else
+__DISPATCH_SWITCH:
+#endif
+    switch((Opcode)byte.op) {
+        TARGET(OP_NO_OP): DISPATCH();
+        /*****************************************/
+        TARGET(OP_POP_TOP): POP(); DISPATCH();
+        TARGET(OP_DUP_TOP): PUSH(TOP()); DISPATCH();
+        TARGET(OP_DUP_TOP_TWO):
+            // [a, b]
+            PUSH(SECOND());  // [a, b, a]
+            PUSH(SECOND());  // [a, b, a, b]
+            DISPATCH();
+        TARGET(OP_ROT_TWO): {
+            py_TValue tmp = *TOP();
+            *TOP() = *SECOND();
+            *SECOND() = tmp;
+            DISPATCH();
+        }
+        TARGET(OP_ROT_THREE): {
+            // [a, b, c] -> [c, a, b]
+            py_TValue tmp = *TOP();
+            *TOP() = *SECOND();
+            *SECOND() = *THIRD();
+            *THIRD() = tmp;
+            DISPATCH();
+        }
+        TARGET(OP_PRINT_EXPR): {
+            if(self->callbacks.displayhook) {
+                bool ok = self->callbacks.displayhook(TOP());
+                if(!ok) goto __ERROR;
+            } else {
+                if(TOP()->type != tp_NoneType) {
+                    bool ok = py_repr(TOP());
+                    if(!ok) goto __ERROR;
+                    self->callbacks.print(py_tostr(&self->last_retval));
+                    self->callbacks.print("\n");
+                }
+            }
+            POP();
+            DISPATCH();
+        }
+        /*****************************************/
+        TARGET(OP_LOAD_CONST): {
+            PUSH(c11__at(py_TValue, &frame->co->consts, byte.arg));
+            DISPATCH();
+        }
+        TARGET(OP_LOAD_NONE): {
+            py_newnone(SP()++);
+            DISPATCH();
+        }
+        TARGET(OP_LOAD_TRUE): {
+            py_newbool(SP()++, true);
+            DISPATCH();
+        }
+        TARGET(OP_LOAD_FALSE): {
+            py_newbool(SP()++, false);
+            DISPATCH();
+        }
+        /*****************************************/
+        TARGET(OP_LOAD_SMALL_INT): {
+            py_newint(SP()++, (int16_t)byte.arg);
+            DISPATCH();
+        }
+        TARGET(OP_LOAD_KWARG_KEY): {
+            // keyword keys are passed as names, see `prepare_py_call`
+            py_newint(SP()++, (uintptr_t)co_names[byte.arg]);
+            DISPATCH();
+        }
+        /*****************************************/
+        TARGET(OP_LOAD_ELLIPSIS): {
+            py_newellipsis(SP()++);
+            DISPATCH();
+        }
+        TARGET(OP_LOAD_FUNCTION): {
+            FuncDecl_ decl = c11__getitem(FuncDecl_, &frame->co->func_decls, byte.arg);
+            Function* ud = py_newobject(SP(), tp_function, 0, sizeof(Function));
+            Function__ctor(ud, decl, frame->module, frame->globals);
+            if(decl->nested) {
+                if(frame->is_locals_special) {
+                    RuntimeError("cannot create closure from special locals");
+                    goto __ERROR;
+                }
+                ud->closure = FastLocals__to_namedict(frame->locals, frame->co);
+                py_Name name = py_name(decl->code.name->data);
+                // capture itself to allow recursion
+                NameDict__set(ud->closure, name, SP());
+            } else {
+                if(self->curr_class) ud->clazz = self->curr_class->_obj;
+            }
+            SP()++;
+            DISPATCH();
+        }
+        TARGET(OP_LOAD_NULL):
+            py_newnil(SP()++);
+            DISPATCH();
+            /*****************************************/
+        TARGET(OP_LOAD_FAST): {
+            assert(!frame->is_locals_special);
+            py_Ref val = &frame->locals[byte.arg];
+            if(!py_isnil(val)) {
+                PUSH(val);
+                DISPATCH();
+            }
+            py_Name name = c11__getitem(py_Name, &frame->co->varnames, byte.arg);
+            UnboundLocalError(name);
+            goto __ERROR;
+        }
+        TARGET(OP_LOAD_NAME): {
+            assert(frame->is_locals_special);
+            py_Name name = co_names[byte.arg];
+            // locals
+            switch(frame->locals->type) {
+                case tp_locals: {
+                    py_Frame* noproxy = frame->locals->_ptr;
+                    py_Ref slot = Frame__getlocal_noproxy(noproxy, name);
+                    if(slot == NULL) break;
+                    if(py_isnil(slot)) {
+                        UnboundLocalError(name);
+                        goto __ERROR;
+                    }
+                    PUSH(slot);
+                    DISPATCH();
+                }
+                case tp_dict: {
+                    int res = py_dict_getitem(frame->locals, py_name2ref(name));
+                    if(res == 1) {
+                        PUSH(&self->last_retval);
+                        DISPATCH();
+                    }
+                    if(res == 0) break;
+                    assert(res == -1);
+                    goto __ERROR;
+                }
+                case tp_nil: break;
+                default: c11__unreachable();
+            }
+            // globals
+            int res = Frame__getglobal(frame, name);
+            if(res == 1) {
+                PUSH(&self->last_retval);
+                DISPATCH();
+            }
+            if(res == -1) goto __ERROR;
+            // builtins
+            py_Ref tmp = py_getdict(self->builtins, name);
+            if(tmp != NULL) {
+                PUSH(tmp);
+                DISPATCH();
+            }
+            NameError(name);
+            goto __ERROR;
+        }
+        TARGET(OP_LOAD_NONLOCAL): {
+            py_Name name = co_names[byte.arg];
+            py_Ref tmp = Frame__getclosure(frame, name);
+            if(tmp != NULL) {
+                PUSH(tmp);
+                DISPATCH();
+            }
+            int res = Frame__getglobal(frame, name);
+            if(res == 1) {
+                PUSH(&self->last_retval);
+                DISPATCH();
+            }
+            if(res == -1) goto __ERROR;
+
+            tmp = py_getdict(self->builtins, name);
+            if(tmp != NULL) {
+                PUSH(tmp);
+                DISPATCH();
+            }
+            NameError(name);
+            goto __ERROR;
+        }
+        TARGET(OP_LOAD_GLOBAL): {
+            py_Name name = co_names[byte.arg];
+            int res = Frame__getglobal(frame, name);
+            if(res == 1) {
+                PUSH(&self->last_retval);
+                DISPATCH();
+            }
+            if(res == -1) goto __ERROR;
+            py_Ref tmp = py_getdict(self->builtins, name);
+            if(tmp != NULL) {
+                PUSH(tmp);
+                DISPATCH();
+            }
+            NameError(name);
+            goto __ERROR;
+        }
+        TARGET(OP_LOAD_ATTR): {
+            py_Name name = co_names[byte.arg];
+            int res = InlineCache__getattr(self, INLINE_CACHE(), TOP(), name);
+            if(res == 0) res = py_getattr(TOP(), name) ? 1 : -1;
+            if(res == -1) goto __ERROR;
+            py_assign(TOP(), py_retval());
+            DISPATCH();
+        }
+        TARGET(OP_LOAD_CLASS_GLOBAL): {
+            assert(self->curr_class);
+            py_Name name = co_names[byte.arg];
+            py_Ref tmp = py_getdict(self->curr_class, name);
+            if(tmp) {
+                PUSH(tmp);
+                DISPATCH();
+            }
+            // load global if attribute not found
+            int res = Frame__getglobal(frame, name);
+            if(res == 1) {
+                PUSH(&self->last_retval);
+                DISPATCH();
+            }
+            if(res == -1) goto __ERROR;
+            tmp = py_getdict(self->builtins, name);
+            if(tmp) {
+                PUSH(tmp);
+                DISPATCH();
+            }
+            NameError(name);
+            goto __ERROR;
+        }
+        TARGET(OP_LOAD_METHOD): {
+            // [self] -> [unbound, self]
+            py_Name name = co_names[byte.arg];
+            int res = InlineCache__loadmethod(self, INLINE_CACHE(), TOP(), name);
+            if(res == 1) {
+                STACK_GROW(1);
+                DISPATCH();
+            }
+            if(res == -1) goto __ERROR;
+            bool ok = py_pushmethod(name);
+            if(!ok) {
+                // fallback to getattr
+                if(py_getattr(TOP(), name)) {
+                    py_assign(TOP(), py_retval());
+                    py_newnil(SP()++);
+                } else {
+                    goto __ERROR;
+                }
+            }
+            DISPATCH();
+        }
+        TARGET(OP_LOAD_SUBSCR): {
+            // [a, b] -> a[b]
+            py_Ref magic = py_tpfindmagic(SECOND()->type, __getitem__);
+            if(magic) {
+                if(magic->type == tp_nativefunc) {
+                    if(!py_callcfunc(magic->_cfunc, 2, SECOND())) goto __ERROR;
+                    POP();
+                    py_assign(TOP(), py_retval());
+                } else {
+                    INSERT_THIRD();     // [?, a, b]
+                    *THIRD() = *magic;  // [__getitem__, a, b]
+                    vectorcall_opcall(1, 0);
+                }
+                DISPATCH();
+            }
+            TypeError("'%t' object is not subscriptable", SECOND()->type);
+            goto __ERROR;
+        }
+        TARGET(OP_STORE_FAST): {
+            assert(!frame->is_locals_special);
+            frame->locals[byte.arg] = POPX();
+            DISPATCH();
+        }
+        TARGET(OP_STORE_NAME): {
+            assert(frame->is_locals_special);
+            py_Name name = co_names[byte.arg];
+            switch(frame->locals->type) {
+                case tp_locals: {
+                    py_Frame* noproxy = frame->locals->_ptr;
+                    py_Ref slot = Frame__getlocal_noproxy(noproxy, name);
+                    if(slot == NULL) {
+                        UnboundLocalError(name);
+                        goto __ERROR;
+                    }
+                    *slot = POPX();
+                    DISPATCH();
+                }
+                case tp_dict: {
+                    if(!py_dict_setitem(frame->locals, py_name2ref(name), TOP())) goto __ERROR;
+                    POP();
+                    DISPATCH();
+                }
+                case tp_nil: {
+                    // globals
+                    if(!Frame__setglobal(frame, name, TOP())) goto __ERROR;
+                    POP();
+                    DISPATCH();
+                }
+                default: c11__unreachable();
+            }
+        }
+        TARGET(OP_STORE_GLOBAL): {
+            py_Name name = co_names[byte.arg];
+            if(!Frame__setglobal(frame, name, TOP())) goto __ERROR;
+            POP();
+            DISPATCH();
+        }
+        TARGET(OP_STORE_ATTR): {
+            // [val, a] -> a.b = val
+            py_Name name = co_names[byte.arg];
+            if(!InlineCache__setattr(self, INLINE_CACHE(), TOP(), name, SECOND())) {
+                if(!py_setattr(TOP(), name, SECOND())) goto __ERROR;
+            }
+            STACK_SHRINK(2);
+            DISPATCH();
+        }
+        TARGET(OP_STORE_SUBSCR): {
+            // [val, a, b] -> a[b] = val
+            py_Ref magic = py_tpfindmagic(SECOND()->type, __setitem__);
+            if(magic) {
+                PUSH(THIRD());  // [val, a, b, val]
+                if(magic->type == tp_nativefunc) {
+                    if(!py_callcfunc(magic->_cfunc, 3, THIRD())) goto __ERROR;
+                    STACK_SHRINK(4);
+                } else {
+                    *FOURTH() = *magic;  // [__setitem__, a, b, val]
+                    if(!py_vectorcall(2, 0)) goto __ERROR;
+                }
+                DISPATCH();
+            }
+            TypeError("'%t' object does not support item assignment", SECOND()->type);
+            goto __ERROR;
+        }
+        TARGET(OP_DELETE_FAST): {
+            assert(!frame->is_locals_special);
+            py_Ref tmp = &frame->locals[byte.arg];
+            if(py_isnil(tmp)) {
+                py_Name name = c11__getitem(py_Name, &frame->co->varnames, byte.arg);
+                UnboundLocalError(name);
+                goto __ERROR;
+            }
+            py_newnil(tmp);
+            DISPATCH();
+        }
+        TARGET(OP_DELETE_NAME): {
+            assert(frame->is_locals_special);
+            py_Name name = co_names[byte.arg];
+            switch(frame->locals->type) {
+                case tp_locals: {
+                    py_Frame* noproxy = frame->locals->_ptr;
+                    py_Ref slot = Frame__getlocal_noproxy(noproxy, name);
+                    if(slot == NULL || py_isnil(slot)) {
+                        UnboundLocalError(name);
+                        goto __ERROR;
+                    }
+                    py_newnil(slot);
+                    DISPATCH();
+                }
+                case tp_dict: {
+                    int res = py_dict_delitem(frame->locals, py_name2ref(name));
+                    if(res == 1) DISPATCH();
+                    if(res == 0) UnboundLocalError(name);
+                    goto __ERROR;
+                }
+                case tp_nil: {
+                    // globals
+                    int res = Frame__delglobal(frame, name);
+                    if(res == 1) DISPATCH();
+                    if(res == 0) NameError(name);
+                    goto __ERROR;
+                }
+                default: c11__unreachable();
+            }
+        }
+        TARGET(OP_DELETE_GLOBAL): {
+            py_Name name = co_names[byte.arg];
+            int res = Frame__delglobal(frame, name);
+            if(res == 1) DISPATCH();
+            if(res == -1) goto __ERROR;
+            NameError(name);
+            goto __ERROR;
+        }
+
+        TARGET(OP_DELETE_ATTR): {
+            py_Name name = co_names[byte.arg];
+            if(!py_delattr(TOP(), name)) goto __ERROR;
+            DISPATCH();
+        }
+
+        TARGET(OP_DELETE_SUBSCR): {
+            // [a, b] -> del a[b]
+            py_Ref magic = py_tpfindmagic(SECOND()->type, __delitem__);
+            if(magic) {
+                if(magic->type == tp_nativefunc) {
+                    if(!py_callcfunc(magic->_cfunc, 2, SECOND())) goto __ERROR;
+                    STACK_SHRINK(2);
+                } else {
+                    INSERT_THIRD();     // [?, a, b]
+                    *THIRD() = *magic;  // [__delitem__, a, b]
+                    if(!py_vectorcall(1, 0)) goto __ERROR;
+                }
+                DISPATCH();
+            }
+            TypeError("'%t' object does not support item deletion", SECOND()->type);
+            goto __ERROR;
+        }
+        /*****************************************/
+        TARGET(OP_BUILD_IMAG): {
+            // [x]
+            py_Ref f = py_getdict(self->builtins, py_name("complex"));
+            assert(f != NULL);
+            py_TValue tmp = *TOP();
+            *TOP() = *f;           // [complex]
+            py_newnil(SP()++);     // [complex, NULL]
+            py_newint(SP()++, 0);  // [complex, NULL, 0]
+            *SP()++ = tmp;         // [complex, NULL, 0, x]
+            vectorcall_opcall(2, 0);
+            DISPATCH();
+        }
+        TARGET(OP_BUILD_BYTES): {
+            int size;
+            py_Ref string = c11__at(py_TValue, &frame->co->consts, byte.arg);
+            const char* data = py_tostrn(string, &size);
+            unsigned char* p = py_newbytes(SP()++, size);
+            memcpy(p, data, size);
+            DISPATCH();
+        }
+        TARGET(OP_BUILD_TUPLE): {
+            py_TValue tmp;
+            py_Ref p = py_newtuple(&tmp, byte.arg);
+            py_TValue* begin = SP() - byte.arg;
+            for(int i = 0; i < byte.arg; i++)
+                p[i] = begin[i];
+            SP() = begin;
+            PUSH(&tmp);
+            DISPATCH();
+        }
+        TARGET(OP_BUILD_LIST): {
+            py_TValue tmp;
+            py_newlistn(&tmp, byte.arg);
+            py_TValue* begin = SP() - byte.arg;
+            for(int i = 0; i < byte.arg; i++) {
+                py_list_setitem(&tmp, i, begin + i);
+            }
+            SP() = begin;
+            PUSH(&tmp);
+            DISPATCH();
+        }
+        TARGET(OP_BUILD_DICT): {
+            py_TValue* begin = SP() - byte.arg * 2;
+            py_Ref tmp = py_pushtmp();
+            py_newdict(tmp);
+            for(int i = 0; i < byte.arg * 2; i += 2) {
+                bool ok = py_dict_setitem(tmp, begin + i, begin + i + 1);
+                if(!ok) goto __ERROR;
+            }
+            SP() = begin;
+            PUSH(tmp);
+            DISPATCH();
+        }
+        TARGET(OP_BUILD_SET): {
+            py_TValue* begin = SP() - byte.arg;
+            py_StackRef set = py_pushtmp();
+            pk_newset(set);
+            for(int i = 0; i < byte.arg; i++) {
+                if(!pk_set__add(set, begin + i)) goto __ERROR;
+            }
+            py_TValue tmp = *TOP();
+            SP() = begin;
+            PUSH(&tmp);
+            DISPATCH();
+        }
+        TARGET(OP_BUILD_SLICE): {
+            // [start, stop, step]
+            py_TValue tmp;
+            py_ObjectRef slots = py_newslice(&tmp);
+            slots[0] = *THIRD();
+            slots[1] = *SECOND();
+            slots[2] = *TOP();
+            STACK_SHRINK(3);
+            PUSH(&tmp);
+            DISPATCH();
+        }
+        TARGET(OP_BUILD_STRING): {
+            py_TValue* begin = SP() - byte.arg;
+            c11_sbuf ss;
+            c11_sbuf__ctor(&ss);
+            for(int i = 0; i < byte.arg; i++) {
+                if(!py_str(begin + i)) goto __ERROR;
+                c11_sbuf__write_sv(&ss, py_tosv(&self->last_retval));
+            }
+            SP() = begin;
+            c11_sbuf__py_submit(&ss, SP()++);
+            DISPATCH();
+        }
+        /*****************************/
+#define CASE_BINARY_OP(label, op, rop)                                                             \
+    TARGET(label): {                                                                               \
+        Bytecode__quicken_binary(co_codes + frame->ip, SECOND(), TOP());                           \
+        if(!pk_stack_binaryop(self, op, rop)) goto __ERROR;                                        \
+        POP();                                                                                     \
+        *TOP() = self->last_retval;                                                                \
+        DISPATCH();                                                                                \
+    }
+            CASE_BINARY_OP(OP_BINARY_ADD, __add__, __radd__)
+            CASE_BINARY_OP(OP_BINARY_SUB, __sub__, __rsub__)
+            CASE_BINARY_OP(OP_BINARY_MUL, __mul__, __rmul__)
+            CASE_BINARY_OP(OP_BINARY_TRUEDIV, __truediv__, __rtruediv__)
+            CASE_BINARY_OP(OP_BINARY_FLOORDIV, __floordiv__, __rfloordiv__)
+            CASE_BINARY_OP(OP_BINARY_MOD, __mod__, __rmod__)
+            CASE_BINARY_OP(OP_BINARY_POW, __pow__, __rpow__)
+            CASE_BINARY_OP(OP_BINARY_LSHIFT, __lshift__, 0)
+            CASE_BINARY_OP(OP_BINARY_RSHIFT, __rshift__, 0)
+            CASE_BINARY_OP(OP_BINARY_AND, __and__, 0)
+            CASE_BINARY_OP(OP_BINARY_OR, __or__, 0)
+            CASE_BINARY_OP(OP_BINARY_XOR, __xor__, 0)
+            CASE_BINARY_OP(OP_BINARY_MATMUL, __matmul__, 0)
+            CASE_BINARY_OP(OP_COMPARE_LT, __lt__, __gt__)
+            CASE_BINARY_OP(OP_COMPARE_LE, __le__, __ge__)
+            CASE_BINARY_OP(OP_COMPARE_EQ, __eq__, __eq__)
+            CASE_BINARY_OP(OP_COMPARE_NE, __ne__, __ne__)
+            CASE_BINARY_OP(OP_COMPARE_GT, __gt__, __lt__)
+            CASE_BINARY_OP(OP_COMPARE_GE, __ge__, __le__)
+#undef CASE_BINARY_OP
+/* quickened forms, de-optimize to the generic form if the guard fails */
+#define IS_NUMBER(v) ((v)->type == tp_int || (v)->type == tp_float)
+#define AS_FLOAT(v) ((v)->type == tp_float ? (v)->_f64 : (double)(v)->_i64)
+#define CASE_QUICKENED_OP(label, guard, lhs_t, rhs_t, to, expr)                                    \
+    TARGET(label): {                                                                               \
+        py_Ref a = SECOND();                                                                       \
+        py_Ref b = TOP();                                                                          \
+        if(guard) {                                                                                \
+            lhs_t lhs = to(a);                                                                     \
+            rhs_t rhs = to(b);                                                                     \
+            POP();                                                                                 \
+            expr;                                                                                  \
+            DISPATCH();                                                                            \
+        }                                                                                          \
+        Bytecode__deopt_binary(co_codes + frame->ip);                                              \
+        goto __NEXT_STEP;                                                                          \
+    }
+#define GUARD_INT (a->type == tp_int && b->type == tp_int)
+#define GUARD_INT_NONZERO (GUARD_INT && b->_i64 != 0)
+#define GUARD_FLOAT (IS_NUMBER(a) && IS_NUMBER(b) && !GUARD_INT)
+#define GUARD_FLOAT_NONZERO (IS_NUMBER(a) && IS_NUMBER(b) && AS_FLOAT(b) != 0.0)
+#define AS_INT(v) ((v)->_i64)
+            CASE_QUICKENED_OP(OP_BINARY_ADD_INT, GUARD_INT, py_i64, py_i64, AS_INT,
+                              py_newint(TOP(), lhs + rhs))
+            CASE_QUICKENED_OP(OP_BINARY_SUB_INT, GUARD_INT, py_i64, py_i64, AS_INT,
+                              py_newint(TOP(), lhs - rhs))
+            CASE_QUICKENED_OP(OP_BINARY_MUL_INT, GUARD_INT, py_i64, py_i64, AS_INT,
+                              py_newint(TOP(), lhs * rhs))
+            CASE_QUICKENED_OP(OP_BINARY_FLOORDIV_INT, GUARD_INT_NONZERO, py_i64, py_i64, AS_INT,
+                              py_newint(TOP(), cpy11__fast_floor_div(lhs, rhs)))
+            CASE_QUICKENED_OP(OP_BINARY_MOD_INT, GUARD_INT_NONZERO, py_i64, py_i64, AS_INT,
+                              py_newint(TOP(), cpy11__fast_mod(lhs, rhs)))
+            CASE_QUICKENED_OP(OP_BINARY_ADD_FLOAT, GUARD_FLOAT, py_f64, py_f64, AS_FLOAT,
+                              py_newfloat(TOP(), lhs + rhs))
+            CASE_QUICKENED_OP(OP_BINARY_SUB_FLOAT, GUARD_FLOAT, py_f64, py_f64, AS_FLOAT,
+                              py_newfloat(TOP(), lhs - rhs))
+            CASE_QUICKENED_OP(OP_BINARY_MUL_FLOAT, GUARD_FLOAT, py_f64, py_f64, AS_FLOAT,
+                              py_newfloat(TOP(), lhs * rhs))
+            CASE_QUICKENED_OP(OP_BINARY_TRUEDIV_FLOAT, GUARD_FLOAT_NONZERO, py_f64, py_f64,
+                              AS_FLOAT, py_newfloat(TOP(), lhs / rhs))
+            CASE_QUICKENED_OP(OP_COMPARE_LT_INT, GUARD_INT, py_i64, py_i64, AS_INT,
+                              py_newbool(TOP(), lhs < rhs))
+            CASE_QUICKENED_OP(OP_COMPARE_LE_INT, GUARD_INT, py_i64, py_i64, AS_INT,
+                              py_newbool(TOP(), lhs <= rhs))
+            CASE_QUICKENED_OP(OP_COMPARE_EQ_INT, GUARD_INT, py_i64, py_i64, AS_INT,
+                              py_newbool(TOP(), lhs == rhs))
+            CASE_QUICKENED_OP(OP_COMPARE_NE_INT, GUARD_INT, py_i64, py_i64, AS_INT,
+                              py_newbool(TOP(), lhs != rhs))
+            CASE_QUICKENED_OP(OP_COMPARE_GT_INT, GUARD_INT, py_i64, py_i64, AS_INT,
+                              py_newbool(TOP(), lhs > rhs))
+            CASE_QUICKENED_OP(OP_COMPARE_GE_INT, GUARD_INT, py_i64, py_i64, AS_INT,
+                              py_newbool(TOP(), lhs >= rhs))
+            CASE_QUICKENED_OP(OP_COMPARE_LT_FLOAT, GUARD_FLOAT, py_f64, py_f64, AS_FLOAT,
+                              py_newbool(TOP(), lhs < rhs))
+            CASE_QUICKENED_OP(OP_COMPARE_LE_FLOAT, GUARD_FLOAT, py_f64, py_f64, AS_FLOAT,
+                              py_newbool(TOP(), lhs <= rhs))
+            CASE_QUICKENED_OP(OP_COMPARE_EQ_FLOAT, GUARD_FLOAT, py_f64, py_f64, AS_FLOAT,
+                              py_newbool(TOP(), lhs == rhs))
+            CASE_QUICKENED_OP(OP_COMPARE_NE_FLOAT, GUARD_FLOAT, py_f64, py_f64, AS_FLOAT,
+                              py_newbool(TOP(), lhs != rhs))
+            CASE_QUICKENED_OP(OP_COMPARE_GT_FLOAT, GUARD_FLOAT, py_f64, py_f64, AS_FLOAT,
+                              py_newbool(TOP(), lhs > rhs))
+            CASE_QUICKENED_OP(OP_COMPARE_GE_FLOAT, GUARD_FLOAT, py_f64, py_f64, AS_FLOAT,
+                              py_newbool(TOP(), lhs >= rhs))
+#undef CASE_QUICKENED_OP
+#undef GUARD_INT
+#undef GUARD_INT_NONZERO
+#undef GUARD_FLOAT
+#undef GUARD_FLOAT_NONZERO
+#undef AS_INT
+#undef AS_FLOAT
+#undef IS_NUMBER
+        TARGET(OP_IS_OP): {
+            bool res = py_isidentical(SECOND(), TOP());
+            POP();
+            if(byte.arg) res = !res;
+            py_newbool(TOP(), res);
+            DISPATCH();
+        }
+        TARGET(OP_CONTAINS_OP): {
+            // [b, a] -> b __contains__ a (a in b) -> [retval]
+            py_Ref magic = py_tpfindmagic(SECOND()->type, __contains__);
+            if(magic) {
+                if(magic->type == tp_nativefunc) {
+                    if(!py_callcfunc(magic->_cfunc, 2, SECOND())) goto __ERROR;
+                    STACK_SHRINK(2);
+                } else {
+                    INSERT_THIRD();     // [?, b, a]
+                    *THIRD() = *magic;  // [__contains__, a, b]
+                    if(!py_vectorcall(1, 0)) goto __ERROR;
+                }
+                bool res = py_tobool(py_retval());
+                if(byte.arg) res = !res;
+                py_newbool(SP()++, res);
+                DISPATCH();
+            }
+            TypeError("'%t' type does not support '__contains__'", SECOND()->type);
+            goto __ERROR;
+        }
+            /*****************************************/
+        TARGET(OP_JUMP_FORWARD): DISPATCH_JUMP((int16_t)byte.arg);
+        TARGET(OP_POP_JUMP_IF_NOT_MATCH): {
+            int res = py_equal(SECOND(), TOP());
+            if(res < 0) goto __ERROR;
+            STACK_SHRINK(2);
+            if(!res) DISPATCH_JUMP((int16_t)byte.arg);
+            DISPATCH();
+        }
+        TARGET(OP_POP_JUMP_IF_FALSE): {
+            int res = py_bool(TOP());
+            if(res < 0) goto __ERROR;
+            POP();
+            if(!res) DISPATCH_JUMP((int16_t)byte.arg);
+            DISPATCH();
+        }
+        TARGET(OP_POP_JUMP_IF_TRUE): {
+            int res = py_bool(TOP());
+            if(res < 0) goto __ERROR;
+            POP();
+            if(res) DISPATCH_JUMP((int16_t)byte.arg);
+            DISPATCH();
+        }
+        TARGET(OP_JUMP_IF_TRUE_OR_POP): {
+            int res = py_bool(TOP());
+            if(res < 0) goto __ERROR;
+            if(res) {
+                DISPATCH_JUMP((int16_t)byte.arg);
+            } else {
+                POP();
+                DISPATCH();
+            }
+        }
+        TARGET(OP_JUMP_IF_FALSE_OR_POP): {
+            int res = py_bool(TOP());
+            if(res < 0) goto __ERROR;
+            if(!res) {
+                DISPATCH_JUMP((int16_t)byte.arg);
+            } else {
+                POP();
+                DISPATCH();
+            }
+        }
+        TARGET(OP_SHORTCUT_IF_FALSE_OR_POP): {
+            int res = py_bool(TOP());
+            if(res < 0) goto __ERROR;
+            if(!res) {                      // [b, False]
+                STACK_SHRINK(2);            // []
+                py_newbool(SP()++, false);  // [False]
+                DISPATCH_JUMP((int16_t)byte.arg);
+            } else {
+                POP();  // [b]
+                DISPATCH();
+            }
+        }
+        TARGET(OP_LOOP_CONTINUE): {
+            DISPATCH_JUMP((int16_t)byte.arg);
+        }
+        TARGET(OP_LOOP_BREAK): {
+            DISPATCH_JUMP((int16_t)byte.arg);
+        }
+        /*****************************************/
+        TARGET(OP_CALL): {
+            if(self->heap.gc_allocated >= self->heap.gc_trigger) {
+                ManagedHeap__safepoint(&self->heap);
+            }
+            vectorcall_opcall(byte.arg & 0xFF, byte.arg >> 8);
+            DISPATCH_OR_SWITCH();
+        }
+        TARGET(OP_CALL_VARGS): {
+            // [_0, _1, _2 | k1, v1, k2, v2]
+            uint16_t argc = byte.arg & 0xFF;
+            uint16_t kwargc = byte.arg >> 8;
+
+            int n = 0;
+            py_TValue* sp = SP();
+            py_TValue* p1 = sp - kwargc * 2;
+            py_TValue* base = p1 - argc;
+            py_TValue* buf = self->vectorcall_buffer;
+
+            for(py_TValue* curr = base; curr != p1; curr++) {
+                if(curr->type != tp_star_wrapper) {
+                    buf[n++] = *curr;
+                } else {
+                    py_TValue* args = py_getslot(curr, 0);
+                    py_TValue* p;
+                    int length = pk_arrayview(args, &p);
+                    if(length != -1) {
+                        for(int j = 0; j < length; j++) {
+                            buf[n++] = p[j];
+                        }
+                        argc += length - 1;
+                    } else {
+                        TypeError("*args must be a list or tuple, got '%t'", args->type);
+                        goto __ERROR;
+                    }
+                }
+            }
+
+            for(py_TValue* curr = p1; curr != sp; curr += 2) {
+                if(curr[1].type != tp_star_wrapper) {
+                    buf[n++] = curr[0];
+                    buf[n++] = curr[1];
+                } else {
+                    assert(py_toint(&curr[0]) == 0);
+                    py_TValue* kwargs = py_getslot(&curr[1], 0);
+                    if(kwargs->type == tp_dict) {
+                        py_TValue* p = buf + n;
+                        if(!py_dict_apply(kwargs, unpack_dict_to_buffer, &p)) goto __ERROR;
+                        n = p - buf;
+                        kwargc += py_dict_len(kwargs) - 1;
+                    } else {
+                        TypeError("**kwargs must be a dict, got '%t'", kwargs->type);
+                        goto __ERROR;
+                    }
+                }
+            }
+
+            memcpy(base, buf, n * sizeof(py_TValue));
+            SP() = base + n;
+
+            vectorcall_opcall(argc, kwargc);
+            DISPATCH_OR_SWITCH();
+        }
+        TARGET(OP_RETURN_VALUE): {
+            if(byte.arg == BC_NOARG) {
+                self->last_retval = POPX();
+            } else {
+                py_newnone(&self->last_retval);
+            }
+            VM__pop_frame(self);
+            if(frame == base_frame) {  // [ frameBase<- ]
+                return RES_RETURN;
+            } else {
+                frame = self->top_frame;
+                PUSH(&self->last_retval);
+                goto __NEXT_FRAME;
+            }
+            DISPATCH();
+        }
+        TARGET(OP_YIELD_VALUE): {
+            if(byte.arg == 1) {
+                py_newnone(py_retval());
+            } else {
+                py_assign(py_retval(), TOP());
+                POP();
+            }
+            return RES_YIELD;
+        }
+        TARGET(OP_FOR_ITER_YIELD_VALUE): {
+            int res = py_next(TOP());
+            if(res == -1) goto __ERROR;
+            if(res) {
+                return RES_YIELD;
+            } else {
+                assert(self->last_retval.type == tp_StopIteration);
+                BaseException* ud = py_touserdata(py_retval());
+                py_ObjectRef value = &ud->args;
+                if(py_isnil(value)) value = py_None();
+                *TOP() = *value;  // [iter] -> [retval]
+                DISPATCH_JUMP((int16_t)byte.arg);
+            }
+        }
+        /////////
+        TARGET(OP_LIST_APPEND): {
+            // [list, iter, value]
+            py_list_append(THIRD(), TOP());
+            POP();
+            DISPATCH();
+        }
+        TARGET(OP_DICT_ADD): {
+            // [dict, iter, key, value]
+            bool ok = py_dict_setitem(FOURTH(), SECOND(), TOP());
+            if(!ok) goto __ERROR;
+            STACK_SHRINK(2);
+            DISPATCH();
+        }
+        TARGET(OP_SET_ADD): {
+            // [set, iter, value]
+            if(!pk_set__add(THIRD(), TOP())) goto __ERROR;
+            POP();
+            DISPATCH();
+        }
+        /////////
+        TARGET(OP_UNARY_NEGATIVE): {
+            if(!pk_callmagic(__neg__, 1, TOP())) goto __ERROR;
+            *TOP() = self->last_retval;
+            DISPATCH();
+        }
+        TARGET(OP_UNARY_NOT): {
+            int res = py_bool(TOP());
+            if(res < 0) goto __ERROR;
+            py_newbool(TOP(), !res);
+            DISPATCH();
+        }
+        TARGET(OP_UNARY_STAR): {
+            py_TValue value = POPX();
+            int* level = py_newobject(SP()++, tp_star_wrapper, 1, sizeof(int));
+            *level = byte.arg;
+            py_setslot(TOP(), 0, &value);
+            DISPATCH();
+        }
+        TARGET(OP_UNARY_INVERT): {
+            if(!pk_callmagic(__invert__, 1, TOP())) goto __ERROR;
+            *TOP() = self->last_retval;
+            DISPATCH();
+        }
+        ////////////////
+        TARGET(OP_GET_ITER): {
+            if(!py_iter(TOP())) goto __ERROR;
+            *TOP() = *py_retval();
+            DISPATCH();
+        }
+        TARGET(OP_FOR_ITER): {
+            co_codes[frame->ip].op = Opcode__quicken_for_iter(TOP()->type);
+            int res = py_next(TOP());
+            if(res == -1) goto __ERROR;
+            if(res) {
+                PUSH(py_retval());
+                DISPATCH();
+            } else {
+                assert(self->last_retval.type == tp_StopIteration);
+                POP();  // [iter] -> []
+                DISPATCH_JUMP((int16_t)byte.arg);
+            }
+        }
+        /* quickened forms, de-optimize to FOR_ITER if the iterator type changes */
+        TARGET(OP_FOR_ITER_RANGE): {
+            if(TOP()->type != tp_range_iterator) {
+                co_codes[frame->ip].op = OP_FOR_ITER;
+                goto __NEXT_STEP;
+            }
+            RangeIterator* ud = py_touserdata(TOP());
+            if(ud->range.step > 0 ? ud->current < ud->range.stop
+                                  : ud->current > ud->range.stop) {
+                py_newint(SP()++, ud->current);
+                ud->current += ud->range.step;
+                DISPATCH();
+            }
+            POP();
+            DISPATCH_JUMP((int16_t)byte.arg);
+        }
+        TARGET(OP_FOR_ITER_LIST): {
+            if(TOP()->type != tp_list_iterator) {
+                co_codes[frame->ip].op = OP_FOR_ITER;
+                goto __NEXT_STEP;
+            }
+            list_iterator* ud = py_touserdata(TOP());
+            if(ud->index < ud->vec->length) {
+                PUSH(c11__at(py_TValue, ud->vec, ud->index));
+                ud->index++;
+                DISPATCH();
+            }
+            POP();
+            DISPATCH_JUMP((int16_t)byte.arg);
+        }
+        TARGET(OP_FOR_ITER_TUPLE): {
+            if(TOP()->type != tp_tuple_iterator) {
+                co_codes[frame->ip].op = OP_FOR_ITER;
+                goto __NEXT_STEP;
+            }
+            tuple_iterator* ud = py_touserdata(TOP());
+            if(ud->index < ud->length) {
+                PUSH(ud->p + ud->index);
+                ud->index++;
+                DISPATCH();
+            }
+            POP();
+            DISPATCH_JUMP((int16_t)byte.arg);
+        }
+        TARGET(OP_FOR_ITER_DICT): {
+            if(TOP()->type != tp_dict_iterator) {
+                co_codes[frame->ip].op = OP_FOR_ITER;
+                goto __NEXT_STEP;
+            }
+            int res = dict_items__next(TOP());
+            if(res == -1) goto __ERROR;
+            if(res) {
+                PUSH(py_retval());
+                DISPATCH();
+            }
+            POP();
+            DISPATCH_JUMP((int16_t)byte.arg);
+        }
+        ////////
+        TARGET(OP_IMPORT_PATH): {
+            py_Ref path_object = c11__at(py_TValue, &frame->co->consts, byte.arg);
+            const char* path = py_tostr(path_object);
+            int res = py_import(path);
+            if(res == -1) goto __ERROR;
+            if(res == 0) {
+                ImportError("No module named '%s'", path);
+                goto __ERROR;
+            }
+            PUSH(py_retval());
+            DISPATCH();
+        }
+        TARGET(OP_POP_IMPORT_STAR): {
+            // [module]
+            NameDict* dict = PyObject__dict(TOP()->_obj);
+            py_ItemRef all = NameDict__try_get(dict, __all__);
+            if(all) {
+                py_TValue* p;
+                int length = pk_arrayview(all, &p);
+                if(length == -1) {
+                    TypeError("'__all__' must be a list or tuple, got '%t'", all->type);
+                    goto __ERROR;
+                }
+                for(int i = 0; i < length; i++) {
+                    py_Name name = py_namev(py_tosv(p + i));
+                    py_ItemRef value = NameDict__try_get(dict, name);
+                    if(value == NULL) {
+                        ImportError("cannot import name '%n'", name);
+                        goto __ERROR;
+                    } else {
+                        if(!Frame__setglobal(frame, name, value)) goto __ERROR;
+                    }
+                }
+            } else {
+                for(int i = 0; i < dict->capacity; i++) {
+                    NameDict_KV* kv = &dict->items[i];
+                    if(kv->key == NULL) continue;
+                    c11_sv name = py_name2sv(kv->key);
+                    if(name.size == 0 || name.data[0] == '_') continue;
+                    if(!Frame__setglobal(frame, kv->key, &kv->value)) goto __ERROR;
+                }
+            }
+            POP();
+            DISPATCH();
+        }
+        ////////
+        TARGET(OP_UNPACK_SEQUENCE): {
+            py_TValue* p;
+            int length;
+
+            switch(TOP()->type) {
+                case tp_tuple: {
+                    length = py_tuple_len(TOP());
+                    p = py_tuple_data(TOP());
+                    break;
+                }
+                case tp_list: {
+                    length = py_list_len(TOP());
+                    p = py_list_data(TOP());
+                    break;
+                }
+                case tp_vec2i: {
+                    length = 2;
+                    if(byte.arg != length) break;
+                    c11_vec2i val = py_tovec2i(TOP());
+                    POP();
+                    py_newint(SP()++, val.x);
+                    py_newint(SP()++, val.y);
+                    DISPATCH();
+                }
+                case tp_vec2: {
+                    length = 2;
+                    if(byte.arg != length) break;
+                    c11_vec2 val = py_tovec2(TOP());
+                    POP();
+                    py_newfloat(SP()++, val.x);
+                    py_newfloat(SP()++, val.y);
+                    DISPATCH();
+                }
+                case tp_vec3i: {
+                    length = 3;
+                    if(byte.arg != length) break;
+                    c11_vec3i val = py_tovec3i(TOP());
+                    POP();
+                    py_newint(SP()++, val.x);
+                    py_newint(SP()++, val.y);
+                    py_newint(SP()++, val.z);
+                    DISPATCH();
+                }
+                case tp_vec3: {
+                    length = 3;
+                    if(byte.arg != length) break;
+                    c11_vec3 val = py_tovec3(TOP());
+                    POP();
+                    py_newfloat(SP()++, val.x);
+                    py_newfloat(SP()++, val.y);
+                    py_newfloat(SP()++, val.z);
+                    DISPATCH();
+                }
+                default: {
+                    TypeError("expected list or tuple to unpack, got %t", TOP()->type);
+                    goto __ERROR;
+                }
+            }
+            if(length != byte.arg) {
+                ValueError("expected %d values to unpack, got %d", byte.arg, length);
+                goto __ERROR;
+            }
+            POP();
+            for(int i = 0; i < length; i++) {
+                PUSH(p + i);
+            }
+            DISPATCH();
+        }
+        TARGET(OP_UNPACK_EX): {
+            py_TValue* p;
+            int length = pk_arrayview(TOP(), &p);
+            if(length == -1) {
+                TypeError("expected list or tuple to unpack, got %t", TOP()->type);
+                goto __ERROR;
+            }
+            int exceed = length - byte.arg;
+            if(exceed < 0) {
+                ValueError("not enough values to unpack");
+                goto __ERROR;
+            }
+            POP();
+            for(int i = 0; i < byte.arg; i++) {
+                PUSH(p + i);
+            }
+            py_newlistn(SP()++, exceed);
+            for(int i = 0; i < exceed; i++) {
+                py_list_setitem(TOP(), i, p + byte.arg + i);
+            }
+            DISPATCH();
+        }
+        ///////////
+        TARGET(OP_BEGIN_CLASS): {
+            // [base]
+            py_Name name = co_names[byte.arg];
+            py_Type base;
+            if(py_isnone(TOP())) {
+                base = tp_object;
+            } else {
+                if(!py_checktype(TOP(), tp_type)) goto __ERROR;
+                base = py_totype(TOP());
+            }
+            POP();
+
+            py_TypeInfo* base_ti = pk_typeinfo(base);
+            if(base_ti->is_final) {
+                TypeError("type '%t' is not an acceptable base type", base);
+                goto __ERROR;
+            }
+
+            py_Type type = pk_newtypewithmode(name,
+                                              base,
+                                              frame->module,
+                                              NULL,
+                                              base_ti->is_python,
+                                              false,
+                                              frame->co->src->mode);
+            PUSH(py_tpobject(type));
+            self->curr_class = TOP();
+            DISPATCH();
+        }
+        TARGET(OP_END_CLASS): {
+            // [cls or decorated]
+            py_Name name = co_names[byte.arg];
+            if(!Frame__setglobal(frame, name, TOP())) goto __ERROR;
+
+            if(py_istype(TOP(), tp_type)) {
+                // call on_end_subclass
+                py_TypeInfo* ti = py_touserdata(TOP());
+                if(ti->base != tp_object) {
+                    py_TypeInfo* base_ti = ti->base_ti;
+                    if(base_ti->on_end_subclass) base_ti->on_end_subclass(ti);
+                }
+                py_TValue* slot_eq = py_getdict(&ti->self, __eq__);
+                py_TValue* slot_ne = py_getdict(&ti->self, __ne__);
+                if(slot_eq && !slot_ne) {
+                    TypeError("'%n' implements '__eq__' but not '__ne__'", ti->name);
+                    goto __ERROR;
+                }
+            }
+            // class with decorator is unsafe currently
+            // it skips the above check
+            POP();
+            self->curr_class = NULL;
+            DISPATCH();
+        }
+        TARGET(OP_STORE_CLASS_ATTR): {
+            assert(self->curr_class);
+            py_Name name = co_names[byte.arg];
+            if(name == __slots__) {
+                if(!pk__tpsetslots(py_touserdata(self->curr_class), TOP())) goto __ERROR;
+            } else {
+                py_ItemRef prev = py_getdict(self->curr_class, name);
+                if(prev && py_istype(prev, tp_member_descriptor)) {
+                    ValueError("'%n' in __slots__ conflicts with class variable", name);
+                    goto __ERROR;
+                }
+            }
+            // TOP() can be a function, classmethod or custom decorator
+            py_setdict(self->curr_class, name, TOP());
+            POP();
+            DISPATCH();
+        }
+        TARGET(OP_ADD_CLASS_ANNOTATION): {
+            assert(self->curr_class);
+            // [type_hint string]
+            py_TypeInfo* ti = py_touserdata(self->curr_class);
+            if(py_isnil(&ti->annotations)) py_newdict(&ti->annotations);
+            py_Name name = co_names[byte.arg];
+            bool ok = py_dict_setitem_by_str(&ti->annotations, py_name2str(name), TOP());
+            if(!ok) goto __ERROR;
+            POP();
+            DISPATCH();
+        }
+        ///////////
+        TARGET(OP_WITH_ENTER): {
+            // [expr]
+            py_push(TOP());
+            if(!py_pushmethod(__enter__)) {
+                TypeError("'%t' object does not support the context manager protocol", TOP()->type);
+                goto __ERROR;
+            }
+            vectorcall_opcall(0, 0);
+            DISPATCH();
+        }
+        TARGET(OP_WITH_EXIT): {
+            // [expr]
+            py_push(TOP());
+            if(!py_pushmethod(__exit__)) {
+                TypeError("'%t' object does not support the context manager protocol", TOP()->type);
+                goto __ERROR;
+            }
+            if(!py_vectorcall(0, 0)) goto __ERROR;
+            POP();
+            DISPATCH();
+        }
+        ///////////
+        TARGET(OP_BEGIN_TRY): {
+            Frame__begin_try(frame, SP());
+            DISPATCH();
+        }
+        TARGET(OP_END_TRY): {
+            c11_vector__pop(&frame->exc_stack);
+            DISPATCH();
+        }
+        TARGET(OP_EXCEPTION_MATCH): {
+            if(!py_checktype(TOP(), tp_type)) goto __ERROR;
+            bool ok = py_isinstance(&self->unhandled_exc, py_totype(TOP()));
+            py_newbool(TOP(), ok);
+            DISPATCH();
+        }
+        TARGET(OP_HANDLE_EXCEPTION): {
+            FrameExcInfo* info = Frame__top_exc_info(frame);
+            assert(info != NULL && py_isnil(&info->exc));
+            info->exc = self->unhandled_exc;
+            py_newnil(&self->unhandled_exc);
+            DISPATCH();
+        }
+        TARGET(OP_RAISE): {
+            // [exception]
+            if(py_istype(TOP(), tp_type)) {
+                if(!py_tpcall(py_totype(TOP()), 0, NULL)) goto __ERROR;
+                py_assign(TOP(), py_retval());
+            }
+            if(!py_isinstance(TOP(), tp_BaseException)) {
+                TypeError("exceptions must derive from BaseException");
+                goto __ERROR;
+            }
+            py_raise(TOP());
+            goto __ERROR;
+        }
+        TARGET(OP_RAISE_ASSERT): {
+            if(byte.arg) {
+                if(!py_str(TOP())) goto __ERROR;
+                POP();
+                py_exception(tp_AssertionError, "%s", py_tostr(py_retval()));
+            } else {
+                py_exception(tp_AssertionError, "");
+            }
+            goto __ERROR;
+        }
+        TARGET(OP_RE_RAISE): {
+            if(py_isnil(&self->unhandled_exc)) {
+                FrameExcInfo* info = Frame__top_exc_info(frame);
+                assert(info != NULL && !py_isnil(&info->exc));
+                self->unhandled_exc = info->exc;
+            }
+            c11_vector__pop(&frame->exc_stack);
+            goto __ERROR_RE_RAISE;
+        }
+        TARGET(OP_PUSH_EXCEPTION): {
+            FrameExcInfo* info = Frame__top_exc_info(frame);
+            assert(info != NULL && !py_isnil(&info->exc));
+            PUSH(&info->exc);
+            DISPATCH();
+        }
+        //////////////////
+        TARGET(OP_FORMAT_STRING): {
+            py_Ref spec = c11__at(py_TValue, &frame->co->consts, byte.arg);
+            bool ok = pk_format_object(self, TOP(), py_tosv(spec));
+            if(!ok) goto __ERROR;
+            py_assign(TOP(), py_retval());
+            DISPATCH();
+        }
+        /*****************************************/
+        TARGET(OP_LOAD_FAST_LOAD_FAST): {
+            assert(!frame->is_locals_special);
+            py_Ref val = &frame->locals[byte.arg];
+            if(py_isnil(val)) {
+                UnboundLocalError(c11__getitem(py_Name, &frame->co->varnames, byte.arg));
+                goto __ERROR;
+            }
+            PUSH(val);
+            byte = co_codes[++frame->ip];
+            val = &frame->locals[byte.arg];
+            if(py_isnil(val)) {
+                UnboundLocalError(c11__getitem(py_Name, &frame->co->varnames, byte.arg));
+                goto __ERROR;
+            }
+            PUSH(val);
+            DISPATCH();
+        }
+        TARGET(OP_LOAD_FAST_LOAD_ATTR): {
+            assert(!frame->is_locals_special);
+            py_Ref val = &frame->locals[byte.arg];
+            if(py_isnil(val)) {
+                UnboundLocalError(c11__getitem(py_Name, &frame->co->varnames, byte.arg));
+                goto __ERROR;
+            }
+            PUSH(val);
+            DISPATCH_FUSED(OP_LOAD_ATTR);
+        }
+        TARGET(OP_COMPARE_POP_JUMP_IF_FALSE): {
+            int res = pk_stack_compare(self, (Opcode)byte.arg);
+            if(res < 0) goto __ERROR;
+            byte = co_codes[++frame->ip];
+            if(!res) DISPATCH_JUMP((int16_t)byte.arg);
+            DISPATCH();
+        }
+        TARGET(OP_LOAD_CONST_RETURN_VALUE): {
+            PUSH(c11__at(py_TValue, &frame->co->consts, byte.arg));
+            DISPATCH_FUSED(OP_RETURN_VALUE);
+        }
+        TARGET(OP_LOAD_SMALL_INT_BINARY_ADD): {
+            py_Ref a = TOP();
+            if(a->type == tp_int) {
+                py_newint(a, a->_i64 + (int16_t)byte.arg);
+                DISPATCH_JUMP(2);
+            }
+            if(a->type == tp_float) {
+                py_newfloat(a, a->_f64 + (int16_t)byte.arg);
+                DISPATCH_JUMP(2);
+            }
+            py_newint(SP()++, (int16_t)byte.arg);
+            DISPATCH();  // the generic BINARY_ADD
+        }
+        default: c11__unreachable();
+    }
+
+    c11__unreachable();
+
+__ERROR:
+    assert(!py_isnil(&self->unhandled_exc));
+    py_BaseException__stpush(frame,
+                             &self->unhandled_exc,
+                             frame->co->src,
+                             Frame__lineno(frame),
+                             !frame->is_locals_special ? frame->co->name->data : NULL);
+__ERROR_RE_RAISE:
+    do {
+        self->curr_class = NULL;
+        self->curr_decl_based_function = NULL;
+    } while(0);
+
+    int target = Frame__goto_exception_handler(frame, &self->stack, &self->unhandled_exc);
+    if(target >= 0) {
+        // 1. Exception can be handled inside the current frame
+        DISPATCH_JUMP_ABSOLUTE(target);
+    } else {
+        // 2. Exception need to be propagated to the upper frame
+        bool is_base_frame_to_be_popped = frame == base_frame;
+        VM__pop_frame(self);
+        if(self->top_frame == NULL || is_base_frame_to_be_popped) {
+            // propagate to the top level
+            return RES_ERROR;
+        }
+        frame = self->top_frame;
+        RESET_CO_CACHE();
+        goto __ERROR;
+    }
+
+    c11__unreachable();
+}
+
+#undef TARGET
+#undef DISPATCH_NEXT
+#undef DISPATCH
+#undef DISPATCH_JUMP
+#undef DISPATCH_JUMP_ABSOLUTE
+#undef DISPATCH_FUSED
+#undef DISPATCH_OR_SWITCH
+#undef PK_CEVAL_NAME
+#undef PK_CEVAL_TRACED
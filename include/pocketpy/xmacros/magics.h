@@ -62,5 +62,6 @@ MAGIC_METHOD(__class__)
 MAGIC_METHOD(__getattr__)
 MAGIC_METHOD(__reduce__)
 MAGIC_METHOD(__missing__)
+MAGIC_METHOD(__slots__)
 
 #endif
\ No newline at end of file
@@ -16,6 +16,7 @@ OPCODE(LOAD_TRUE)
 OPCODE(LOAD_FALSE)
 /**************************/
 OPCODE(LOAD_SMALL_INT)
+OPCODE(LOAD_KWARG_KEY)
 /**************************/
 OPCODE(LOAD_ELLIPSIS)
 OPCODE(LOAD_FUNCTION)
@@ -127,4 +128,39 @@ OPCODE(PUSH_EXCEPTION)
 /**************************/
 OPCODE(FORMAT_STRING)
 /**************************/
+// quickened forms of BINARY_* and COMPARE_*
+OPCODE(BINARY_ADD_INT)
+OPCODE(BINARY_SUB_INT)
+OPCODE(BINARY_MUL_INT)
+OPCODE(BINARY_FLOORDIV_INT)
+OPCODE(BINARY_MOD_INT)
+OPCODE(BINARY_ADD_FLOAT)
+OPCODE(BINARY_SUB_FLOAT)
+OPCODE(BINARY_MUL_FLOAT)
+OPCODE(BINARY_TRUEDIV_FLOAT)
+OPCODE(COMPARE_LT_INT)
+OPCODE(COMPARE_LE_INT)
+OPCODE(COMPARE_EQ_INT)
+OPCODE(COMPARE_NE_INT)
+OPCODE(COMPARE_GT_INT)
+OPCODE(COMPARE_GE_INT)
+OPCODE(COMPARE_LT_FLOAT)
+OPCODE(COMPARE_LE_FLOAT)
+OPCODE(COMPARE_EQ_FLOAT)
+OPCODE(COMPARE_NE_FLOAT)
+OPCODE(COMPARE_GT_FLOAT)
+OPCODE(COMPARE_GE_FLOAT)
+// quickened forms of FOR_ITER
+OPCODE(FOR_ITER_RANGE)
+OPCODE(FOR_ITER_LIST)
+OPCODE(FOR_ITER_TUPLE)
+OPCODE(FOR_ITER_DICT)
+/**************************/
+// superinstructions fused by the peephole pass, the second instruction is kept in place
+OPCODE(LOAD_FAST_LOAD_FAST)
+OPCODE(LOAD_FAST_LOAD_ATTR)
+OPCODE(COMPARE_POP_JUMP_IF_FALSE)
+OPCODE(LOAD_CONST_RETURN_VALUE)
+OPCODE(LOAD_SMALL_INT_BINARY_ADD)
+/**************************/
 #endif
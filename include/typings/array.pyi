@@ -0,0 +1,68 @@
+from typing import Iterable, Iterator, Literal, Self
+from array2d import array2d, array2d_like
+
+TypeCode = Literal['b', 'h', 'i', 'q', 'f', 'd']
+
+typecodes: str
+
+class array:
+    """A packed array of `int8`, `int16`, `int32`, `int64`, `float32` or `float64` numbers."""
+
+    def __new__(cls, typecode: TypeCode, initializer: bytes | Iterable[int | float] | array2d_like | None = None) -> Self: ...
+
+    @property
+    def typecode(self) -> TypeCode: ...
+    @property
+    def itemsize(self) -> int: ...
+
+    def __len__(self) -> int: ...
+    def __getitem__(self, index: int) -> int | float: ...
+    def __setitem__(self, index: int | slice, value: int | float | array) -> None: ...
+    def __delitem__(self, index: int) -> None: ...
+    def __contains__(self, value: int | float) -> bool: ...
+    def __iter__(self) -> Iterator[int | float]: ...
+
+    def append(self, value: int | float) -> None: ...
+    def extend(self, iterable: Iterable[int | float]) -> None: ...
+    def insert(self, index: int, value: int | float) -> None: ...
+    def pop(self, index: int = -1) -> int | float: ...
+    def remove(self, value: int | float) -> None: ...
+    def index(self, value: int | float) -> int: ...
+    def count(self, value: int | float) -> int: ...
+    def reverse(self) -> None: ...
+    def tolist(self) -> list[int | float]: ...
+    def fromlist(self, values: list[int | float]) -> None: ...
+    def tobytes(self) -> bytes: ...
+    def frombytes(self, data: bytes) -> None: ...
+
+    def fill(self, value: int | float) -> None: ...
+    def view(self, start: int = 0, stop: int | None = None) -> array:
+        """Return an array sharing the buffer of `self[start:stop]`.
+
+        A view cannot be resized. It raises `ValueError` when its base array shrinks below it.
+        """
+    def compress(self, mask: array) -> array:
+        """Return the elements whose `mask` element is nonzero."""
+    def to_array2d(self, n_cols: int, n_rows: int) -> array2d[int | float]:
+        """Reshape the elements in row-major order."""
+
+    # element-wise operations, `other` is an array of the same length or a number.
+    # The result has the wider typecode of both operands, integers wrap around on overflow.
+    def add(self, other: array | int | float) -> array: ...
+    def sub(self, other: array | int | float) -> array: ...
+    def mul(self, other: array | int | float) -> array: ...
+    def div(self, other: array | int | float) -> array:
+        """Divide element-wise, integer arrays are divided as `'d'`."""
+
+    # comparisons return a `'b'` array of 0 and 1
+    def lt(self, other: array | int | float) -> array: ...
+    def le(self, other: array | int | float) -> array: ...
+    def gt(self, other: array | int | float) -> array: ...
+    def ge(self, other: array | int | float) -> array: ...
+    def eq(self, other: array | int | float) -> array: ...
+    def ne(self, other: array | int | float) -> array: ...
+
+    def sum(self) -> int | float: ...
+    def min(self) -> int | float: ...
+    def max(self) -> int | float: ...
+    def dot(self, other: array) -> int | float: ...
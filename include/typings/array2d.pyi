@@ -2,6 +2,7 @@ from typing import Callable, Literal, overload, Iterator, Self
 from vmath import vec2i, color32
 
 Neighborhood = Literal['Moore', 'von Neumann']
+DType = Literal['int8', 'int32', 'float32', 'bool']
 
 class array2d_like[T]:
     @property
@@ -44,6 +45,11 @@ class array2d_like[T]:
     def apply(self, f: Callable[[T], T]) -> None: ...
     def zip_with[R, U](self, other: array2d_like[U], f: Callable[[T, U], R]) -> array2d[R]: ...
     def copy(self) -> 'array2d[T]': ...
+    def astype(self, dtype: DType | None) -> 'array2d':
+        """Copy the values into a new `array2d` of the given dtype.
+
+        Raises `ValueError` if a value is out of range of the dtype.
+        """
     def tolist(self) -> list[list[T]]: ...
 
     def __le__(self, other: T | array2d_like[T]) -> array2d[bool]: ...
@@ -113,6 +119,36 @@ class array2d_like[T]:
         where `0` means unvisited, and non-zero means the index of the connected component.
         """
 
+    def get_distance_field(
+            self,
+            sources: vec2i | list[vec2i],
+            passable: T | Callable[[T], bool],
+            neighborhood: Neighborhood = 'von Neumann'
+            ) -> array2d[int]:
+        """Get the number of steps from the nearest source to each cell via BFS algorithm.
+
+        A cell is passable if it equals `passable`, or if `passable(cell)` is true.
+        Returns an `int32` array where `-1` means unreachable.
+        """
+
+    def flood_fill(self, pos: vec2i, neighborhood: Neighborhood = 'von Neumann') -> array2d[bool]:
+        """Get the region of cells equal to `self[pos]` that is connected to `pos`."""
+
+    def find_path(
+            self,
+            start: vec2i,
+            goal: vec2i,
+            passable: T | Callable[[T], bool] | None = None,
+            neighborhood: Neighborhood = 'von Neumann'
+            ) -> list[vec2i] | None:
+        """Find a shortest path from `start` to `goal` via A* algorithm.
+
+        If `passable` is `None`, the cells are numbers and each step costs the value of the cell
+        it enters, where a negative value blocks the cell. Otherwise each step costs `1`.
+        Diagonal steps of `'Moore'` cost the same as straight ones.
+        Returns the cells of the path including `start` and `goal`, or `None` if there is no path.
+        """
+
 
 class array2d_view[T](array2d_like[T]):
     @property
@@ -124,8 +160,17 @@ class array2d[T](array2d_like[T]):
             cls,
             n_cols: int,
             n_rows: int,
-            default: T | Callable[[vec2i], T] | None = None
-            ): ...
+            default: T | Callable[[vec2i], T] | None = None,
+            dtype: DType | None = None
+            ):
+        """Create a 2D array.
+
+        With a `dtype` values are stored packed and `default=None` means zeros.
+        """
+
+    @property
+    def dtype(self) -> DType | None:
+        """The element type of a packed array, `None` for an array of objects."""
 
     @staticmethod
     def fromlist(data: list[list[T]]) -> array2d[T]: ...
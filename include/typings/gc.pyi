@@ -9,9 +9,20 @@ def enable() -> None:
 def disable() -> None:
     """Disable automatic garbage collection."""
 
-def collect() -> int:
-    """Run a full collection immediately.
+def isgenerational() -> bool:
+    """Check if generational garbage collection is enabled."""
 
+def set_generational(enabled: bool) -> None:
+    """Enable or disable generational garbage collection.
+
+    When enabled, automatic collections only trace objects created since the last collection
+    and old objects that were written to. A full collection runs once the old generation has doubled.
+    """
+
+def collect(generation: int = 1) -> int:
+    """Run a collection immediately.
+
+    `generation=0` collects the young generation only, `generation=1` runs a full collection.
     Returns an integer indicating the number of unreachable objects found.
     """
 
@@ -23,5 +34,31 @@ def collect_hint() -> None:
     and `gc.collect_hint()` is called at the end of each frame.
     """
 
+def step(budget_us: int) -> bool:
+    """Run the garbage collector for at most `budget_us` microseconds if a collection is due.
+
+    Full collections are incremental, a collection that does not fit in the budget
+    is continued by the next call. Returns `True` if there is no unfinished collection.
+
+    Call it in the idle time of each frame, so that collections do not pause the next frame.
+    """
+
+def set_memory_limit(limit: int) -> None:
+    """Set the memory limit of the current VM in bytes, `0` means no limit.
+
+    When the objects of the VM use more than `limit` bytes, a full collection runs
+    before the next call. Growing a container buffer, or building a big str, bytes,
+    array or typed array2d, raises `MemoryError` if it cannot free enough memory.
+    """
+
+def get_memory_limit() -> int:
+    """Get the memory limit of the current VM in bytes, `0` means no limit."""
+
+def get_memory_usage() -> int:
+    """Get the bytes used by the objects of the current VM, including the buffers of lists and dicts.
+
+    Garbage is counted until it is collected.
+    """
+
 def setup_debug_callback(cb: Callable[[str], None] | None) -> None:
     """Setup a callback that will be triggered at the end of each collection."""
@@ -17,6 +17,28 @@ configmacros: dict[str, int]
 def memory_usage() -> str:
     """Return a summary of the memory usage."""
 
+def inline_cache_stats() -> tuple[int, int]:
+    """Return `(hits, misses)` of the attribute inline caches.
+
+    `PK_ENABLE_IC_STATS` must be defined to `1` to use this feature.
+    """
+
+
+def compile_to_bytes(source: str, filename: str, mode: Literal['exec', 'eval', 'single']) -> bytes:
+    """Compile `source` into a bytecode buffer that `exec_bytes()` can run later.
+
+    Only `None`, `bool`, `int`, `float`, `str`, `bytes`, `tuple` and `...` constants are supported.
+    """
+
+def exec_bytes(data: bytes):
+    """Run a bytecode buffer created by `compile_to_bytes()` in `__main__`.
+
+    Returns the value of the expression in `eval` mode.
+    """
+
+def compile_cache(enabled: bool) -> None:
+    """Enable or disable the `.pkc` compile cache used by `import`."""
+
 
 def currentvm() -> int:
     """Return the current VM index."""
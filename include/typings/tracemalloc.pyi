@@ -0,0 +1,48 @@
+from typing import Literal, TypedDict
+
+_KeyType = Literal['lineno', 'filename', 'type', 'site']
+_SortBy = Literal['size', 'count', 'total_size', 'total_count']
+
+class Statistic(TypedDict):
+    filename: str | None    # `'<unknown>'` for objects created outside of python code
+    lineno: int | None
+    type: str | None
+    count: int              # living objects
+    size: int               # bytes of living objects, including the buffers of lists and dicts
+    total_count: int        # objects created since tracing started
+    total_size: int         # bytes of objects created since tracing started, without buffers
+
+class StatisticDiff(Statistic):
+    count_diff: int
+    size_diff: int
+    total_count_diff: int
+    total_size_diff: int
+
+class Snapshot:
+    def statistics(self, key_type: _KeyType = 'lineno', sort_by: _SortBy = 'size', limit: int | None = None) -> list[Statistic]:
+        """Group the allocations by `key_type` and sort them by `sort_by` in descending order.
+
+        `key_type` is one of `'lineno'`, `'filename'`, `'type'` or `'site'` (line and type).
+        Fields that are not part of the key are `None`.
+        """
+
+    def compare_to(self, old: 'Snapshot', key_type: _KeyType = 'lineno', sort_by: _SortBy = 'size', limit: int | None = None) -> list[StatisticDiff]:
+        """Like `statistics()`, with the differences to `old`, sorted by the absolute difference of `sort_by`."""
+
+    def to_json(self) -> str:
+        """Export the records of every allocation site as a JSON string."""
+
+def start() -> None:
+    """Start tracing the source line and the type of each new object of the current VM."""
+
+def stop() -> None:
+    """Stop tracing and forget the recorded allocation sites."""
+
+def is_tracing() -> bool:
+    """Check if allocations are being traced."""
+
+def take_snapshot() -> Snapshot:
+    """Run a full collection and take a snapshot of the objects created since tracing started.
+
+    Raise `RuntimeError` if allocations are not being traced.
+    """
@@ -1,4 +1,8 @@
 import os
+import shutil
+import subprocess
+import sys
+import tempfile
 
 def get_sources():
     sources = {}
@@ -6,52 +10,117 @@ def get_sources():
         if not file.endswith(".py"):
             continue
         key = file.split(".")[0]
-        const_char_array = []
         with open("python/" + file) as f:
-            specials = { 10: '\\n', 34: '\\"' }
-            for c in f.read().encode('utf-8'):
-                if c in specials:
-                    const_char_array.append(specials[c])
-                elif c >= 32 and c <= 126 and c != 92:
-                    const_char_array.append(chr(c))
-                else:
-                    const_char_array.append(f'\\x{c:02x}')
-        const_char_array = ''.join(const_char_array)
-        sources[key] = '"' + const_char_array + '"'
+            sources[key] = f.read().encode('utf-8')
     return sources
 
-sources = get_sources()
+def to_c_string(data: bytes):
+    const_char_array = []
+    specials = { 10: '\\n', 34: '\\"' }
+    for c in data:
+        if c in specials:
+            const_char_array.append(specials[c])
+        elif c >= 32 and c <= 126 and c != 92:
+            const_char_array.append(chr(c))
+        else:
+            const_char_array.append(f'\\x{c:02x}')
+    const_char_array = ''.join(const_char_array)
+    return '"' + const_char_array + '"'
+
+def to_c_bytes(data: bytes):
+    lines = []
+    for i in range(0, len(data), 24):
+        lines.append('    ' + ','.join(str(c) for c in data[i:i+24]) + ',')
+    return '{\n' + '\n'.join(lines) + '\n}'
+
+def get_filename(key):
+    # must match the filename used by `VM__ctor` and `py_import`
+    return '<builtins>' if key == 'builtins' else f'{key}.py'
 
-# use LF line endings instead of CRLF
-with open("include/pocketpy/common/_generated.h", "wt", encoding='utf-8', newline='\n') as f:
-    data = '''#pragma once
+def write_generated(sources, bytecodes):
+    # use LF line endings instead of CRLF
+    with open("include/pocketpy/common/_generated.h", "wt", encoding='utf-8', newline='\n') as f:
+        data = '''#pragma once
 // generated by prebuild.py
 
 const char* load_kPythonLib(const char* name);
+const unsigned char* load_kPythonLibBytecode(const char* name, int* size);
 
 '''
-    for key in sorted(sources.keys()):
-        value = sources[key]
-        data += f'extern const char kPythonLibs_{key}[];\n'
-    f.write(data)
+        for key in sorted(sources.keys()):
+            data += f'extern const char kPythonLibs_{key}[];\n'
+        f.write(data)
 
-with open("src/common/_generated.c", "wt", encoding='utf-8', newline='\n') as f:
-    data = '''// generated by prebuild.py
+    with open("src/common/_generated.c", "wt", encoding='utf-8', newline='\n') as f:
+        data = '''// generated by prebuild.py
 #include "pocketpy/common/_generated.h"
 #include <string.h>
 '''
-    for key in sorted(sources.keys()):
-        value = sources[key]
-        data += f'const char kPythonLibs_{key}[] = {value};\n'
-    f.write(data)
-
-    f.write("\n")
-    f.write("const char* load_kPythonLib(const char* name) {\n")
-    f.write("    if (strchr(name, '.') != NULL) return NULL;\n")
-    for key in sorted(sources.keys()):
-        if key.startswith('_'):
-            continue
-        f.write(f'    if (strcmp(name, "{key}") == 0) return kPythonLibs_{key};\n')
-    f.write("    return NULL;\n")
-    f.write("}\n")
+        for key in sorted(sources.keys()):
+            data += f'const char kPythonLibs_{key}[] = {to_c_string(sources[key])};\n'
+        for key in sorted(bytecodes.keys()):
+            data += f'static const unsigned char kPythonLibsBytecode_{key}[] = {to_c_bytes(bytecodes[key])};\n'
+        f.write(data)
+
+        f.write("\n")
+        f.write("const char* load_kPythonLib(const char* name) {\n")
+        f.write("    if (strchr(name, '.') != NULL) return NULL;\n")
+        for key in sorted(sources.keys()):
+            if key.startswith('_'):
+                continue
+            f.write(f'    if (strcmp(name, "{key}") == 0) return kPythonLibs_{key};\n')
+        f.write("    return NULL;\n")
+        f.write("}\n")
 
+        f.write("\n")
+        f.write("const unsigned char* load_kPythonLibBytecode(const char* name, int* size) {\n")
+        if bytecodes:
+            f.write("    if (strchr(name, '.') != NULL) return NULL;\n")
+        for key in sorted(bytecodes.keys()):
+            f.write(f'    if (strcmp(name, "{key}") == 0) {{\n')
+            f.write(f'        *size = (int)sizeof(kPythonLibsBytecode_{key});\n')
+            f.write(f'        return kPythonLibsBytecode_{key};\n')
+            f.write('    }\n')
+        f.write("    return NULL;\n")
+        f.write("}\n")
+
+def fail(message):
+    print(f'prebuild.py: {message}', file=sys.stderr)
+    sys.exit(1)
+
+def compile_bytecodes(sources, allow_no_cc):
+    """Build a host compiler from the current tree and precompile every module.
+
+    Any failure is fatal. Without a C compiler it returns an empty dict if
+    `allow_no_cc` is set, and the modules are then compiled from source at runtime.
+    """
+    cc = os.environ.get('CC') or shutil.which('cc') or shutil.which('gcc') or shutil.which('clang')
+    if cc is None:
+        if not allow_no_cc:
+            fail('no C compiler found, pass --no-bytecode to embed the sources only')
+        print('prebuild.py: no C compiler found, skipping precompiled bytecode')
+        return {}
+    c_files = ['scripts/prebuild_bytecode.c']
+    for root, _, files in os.walk('src'):
+        c_files += [os.path.join(root, file) for file in files if file.endswith('.c')]
+    bytecodes = {}
+    with tempfile.TemporaryDirectory() as tmp:
+        exe = os.path.join(tmp, 'prebuild_bytecode')
+        cmd = [cc, '-std=c11', '-O0', '-w', '-Iinclude', '-o', exe, *sorted(c_files), '-lm', '-ldl', '-lpthread']
+        if subprocess.run(cmd).returncode != 0:
+            fail('failed to build the host compiler')
+        for key in sorted(sources.keys()):
+            src_path = os.path.join(tmp, key + '.py')
+            out_path = os.path.join(tmp, key + '.pkc')
+            with open(src_path, 'wb') as f:
+                f.write(sources[key])
+            if subprocess.run([exe, src_path, get_filename(key), out_path]).returncode != 0:
+                fail(f'cannot precompile {key}.py')
+            with open(out_path, 'rb') as f:
+                bytecodes[key] = f.read()
+    return bytecodes
+
+sources = get_sources()
+# the host compiler links against the generated files, so emit a source-only version first
+write_generated(sources, {})
+write_generated(sources, compile_bytecodes(sources, '--no-bytecode' in sys.argv[1:]))
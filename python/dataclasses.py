@@ -9,6 +9,10 @@ def _get_annotations(cls: type):
         res.update(cls.__annotations__)
     return res.keys()
 
+def _has_default(cls_d, field):
+    # names in `__slots__` are member descriptors of the class, not default values
+    return field in cls_d and type(cls_d[field]).__name__ != 'member_descriptor'
+
 def _wrapped__init__(self, *args, **kwargs):
     cls = type(self)
     cls_d = cls.__dict__
@@ -21,7 +25,7 @@ def _wrapped__init__(self, *args, **kwargs):
             if i < len(args):
                 setattr(self, field, args[i])
                 i += 1
-            elif field in cls_d:    # has default value
+            elif _has_default(cls_d, field):
                 setattr(self, field, cls_d[field])
             else:
                 raise TypeError(f"{cls.__name__} missing required argument {field!r}")
@@ -32,8 +36,7 @@ def _wrapped__init__(self, *args, **kwargs):
 
 def _wrapped__repr__(self):
     fields = _get_annotations(type(self))
-    obj_d = self.__dict__
-    args: list = [f"{field}={obj_d[field]!r}" for field in fields]
+    args: list = [f"{field}={getattr(self, field)!r}" for field in fields]
     return f"{type(self).__name__}({', '.join(args)})"
 
 def _wrapped__eq__(self, other):
@@ -62,7 +65,7 @@ def dataclass(cls: type):
     fields = _get_annotations(cls)
     has_default = False
     for field in fields:
-        if field in cls_d:
+        if _has_default(cls_d, field):
             has_default = True
         else:
             if has_default:
@@ -71,5 +74,4 @@ def dataclass(cls: type):
 
 def asdict(obj) -> dict:
     fields = _get_annotations(type(obj))
-    obj_d = obj.__dict__
-    return {field: obj_d[field] for field in fields}
\ No newline at end of file
+    return {field: getattr(obj, field) for field in fields}
\ No newline at end of file
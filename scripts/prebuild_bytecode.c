@@ -0,0 +1,44 @@
+// used by prebuild.py to compile python/*.py into bytecode
+#include "pocketpy.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static char* read_file(const char* path) {
+    FILE* f = fopen(path, "rb");
+    if(f == NULL) return NULL;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char* buffer = malloc(size + 1);
+    size = fread(buffer, 1, size, f);
+    buffer[size] = 0;
+    fclose(f);
+    return buffer;
+}
+
+int main(int argc, char** argv) {
+    if(argc != 4) {
+        fprintf(stderr, "usage: %s <source.py> <filename> <output.pkc>\n", argv[0]);
+        return 1;
+    }
+    char* source = read_file(argv[1]);
+    if(source == NULL) {
+        fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+    py_initialize();
+    bool ok = py_compile_to_bytes(source, argv[2], EXEC_MODE);
+    if(ok) {
+        int size;
+        unsigned char* data = py_tobytes(py_retval(), &size);
+        FILE* f = fopen(argv[3], "wb");
+        ok = f != NULL && fwrite(data, 1, size, f) == (size_t)size;
+        if(f) fclose(f);
+        if(!ok) fprintf(stderr, "cannot write %s\n", argv[3]);
+    } else {
+        py_printexc();
+    }
+    py_finalize();
+    free(source);
+    return ok ? 0 : 1;
+}
@@ -2,11 +2,14 @@
 #include "pocketpy/objects/object.h"
 #include "pocketpy/objects/iterator.h"
 #include "pocketpy/interpreter/vm.h"
+#include "pocketpy/interpreter/types.h"
 
 int pk_arrayview(py_Ref self, py_TValue** p) {
     if(self->type == tp_list) {
-        *p = py_list_data(self);
-        return py_list_len(self);
+        // read-only view, no write barrier
+        List* ud = PyObject__userdata(self->_obj);
+        *p = ud->data;
+        return ud->length;
     }
     if(self->type == tp_tuple) {
         *p = PyObject__slots(self->_obj);
@@ -0,0 +1,174 @@
+#include "pocketpy/pocketpy.h"
+
+#include "pocketpy/common/utils.h"
+#include "pocketpy/objects/object.h"
+#include "pocketpy/interpreter/bindings.h"
+#include "pocketpy/interpreter/vm.h"
+
+/* lazy iterators of builtins, the iterators they wrap are kept in slots */
+
+// __new__(cls, iterable, start=0)
+static bool enumerate__new__(int argc, py_Ref argv) {
+    PY_CHECK_ARG_TYPE(2, tp_int);
+    if(!py_iter(py_arg(1))) return false;
+    py_push(py_retval());
+    py_i64* index = py_newobject(py_retval(), tp_enumerate, 1, sizeof(py_i64));
+    *index = py_toint(py_arg(2));
+    py_setslot(py_retval(), 0, py_peek(-1));
+    py_pop();
+    return true;
+}
+
+bool enumerate__next__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    int res = py_next(py_getslot(argv, 0));
+    if(res == -1) return false;
+    if(res == 0) return StopIteration();
+    py_push(py_retval());
+    py_i64* index = py_touserdata(argv);
+    py_Ref p = py_newtuple(py_retval(), 2);
+    py_newint(&p[0], (*index)++);
+    p[1] = *py_peek(-1);
+    py_pop();
+    return true;
+}
+
+// __new__(cls, *iterables)
+static bool zip__new__(int argc, py_Ref argv) {
+    int n = py_tuple_len(py_arg(1));
+    py_StackRef out = py_pushtmp();
+    py_newobject(out, tp_zip, n, 0);
+    for(int i = 0; i < n; i++) {
+        if(!py_iter(py_tuple_getitem(py_arg(1), i))) return false;
+        py_setslot(out, i, py_retval());
+    }
+    py_assign(py_retval(), out);
+    py_pop();
+    return true;
+}
+
+bool zip__next__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    int n = argv->_obj->slots;
+    if(n == 0) return StopIteration();
+    py_StackRef out = py_pushtmp();
+    py_Ref p = py_newtuple(out, n);
+    for(int i = 0; i < n; i++) {
+        int res = py_next(py_getslot(argv, i));
+        if(res == -1) return false;
+        if(res == 0) {
+            py_pop();
+            return StopIteration();
+        }
+        // `out` may have been made old by a gc in `py_next()`
+        pk__write_barrier_value(out->_obj, py_retval());
+        p[i] = *py_retval();
+    }
+    py_assign(py_retval(), out);
+    py_pop();
+    return true;
+}
+
+// __new__(cls, func, *iterables), slot 0 is `func`
+static bool map__new__(int argc, py_Ref argv) {
+    int n = py_tuple_len(py_arg(2));
+    if(n == 0) return TypeError("map() must have at least two arguments");
+    py_StackRef out = py_pushtmp();
+    py_newobject(out, tp_map, n + 1, 0);
+    py_setslot(out, 0, py_arg(1));
+    for(int i = 0; i < n; i++) {
+        if(!py_iter(py_tuple_getitem(py_arg(2), i))) return false;
+        py_setslot(out, i + 1, py_retval());
+    }
+    py_assign(py_retval(), out);
+    py_pop();
+    return true;
+}
+
+bool map__next__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    int n = argv->_obj->slots - 1;
+    py_StackRef p0 = py_peek(0);
+    // [func, NULL, args...]
+    py_push(py_getslot(argv, 0));
+    py_pushnil();
+    for(int i = 0; i < n; i++) {
+        int res = py_next(py_getslot(argv, i + 1));
+        if(res == -1) return false;
+        if(res == 0) {
+            py_shrink(py_peek(0) - p0);
+            return StopIteration();
+        }
+        py_push(py_retval());
+    }
+    return py_vectorcall(n, 0);
+}
+
+static bool filter__new__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(3);
+    if(!py_iter(py_arg(2))) return false;
+    py_push(py_retval());
+    py_newobject(py_retval(), tp_filter, 2, 0);
+    py_setslot(py_retval(), 0, py_arg(1));
+    py_setslot(py_retval(), 1, py_peek(-1));
+    py_pop();
+    return true;
+}
+
+bool filter__next__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    py_Ref func = py_getslot(argv, 0);
+    py_StackRef item = py_pushtmp();
+    while(true) {
+        int res = py_next(py_getslot(argv, 1));
+        if(res == -1) return false;
+        if(res == 0) {
+            py_pop();
+            return StopIteration();
+        }
+        *item = *py_retval();
+        if(py_isnone(func)) {
+            res = py_bool(item);
+        } else {
+            if(!py_call(func, 1, item)) return false;
+            res = py_bool(py_retval());
+        }
+        if(res == -1) return false;
+        if(res == 1) break;
+    }
+    py_assign(py_retval(), item);
+    py_pop();
+    return true;
+}
+
+py_Type pk_enumerate__register() {
+    py_Type type = pk_newtype("enumerate", tp_object, NULL, NULL, false, true);
+    py_bind(py_tpobject(type), "__new__(cls, iterable, start=0)", enumerate__new__);
+    py_bindmagic(type, __iter__, pk_wrapper__self);
+    py_bindmagic(type, __next__, enumerate__next__);
+    return type;
+}
+
+py_Type pk_zip__register() {
+    py_Type type = pk_newtype("zip", tp_object, NULL, NULL, false, true);
+    py_bind(py_tpobject(type), "__new__(cls, *iterables)", zip__new__);
+    py_bindmagic(type, __iter__, pk_wrapper__self);
+    py_bindmagic(type, __next__, zip__next__);
+    return type;
+}
+
+py_Type pk_map__register() {
+    py_Type type = pk_newtype("map", tp_object, NULL, NULL, false, true);
+    py_bind(py_tpobject(type), "__new__(cls, func, *iterables)", map__new__);
+    py_bindmagic(type, __iter__, pk_wrapper__self);
+    py_bindmagic(type, __next__, map__next__);
+    return type;
+}
+
+py_Type pk_filter__register() {
+    py_Type type = pk_newtype("filter", tp_object, NULL, NULL, false, true);
+    py_bindmagic(type, __new__, filter__new__);
+    py_bindmagic(type, __iter__, pk_wrapper__self);
+    py_bindmagic(type, __next__, filter__next__);
+    return type;
+}
@@ -6,7 +6,7 @@
 
 void pk_mappingproxy__namedict(py_Ref out, py_Ref object) {
     py_newobject(out, tp_namedict, 1, 0);
-    assert(object->is_ptr && object->_obj->slots == -1);
+    assert(object->is_ptr && object->_obj->slots < 0);
     py_setslot(out, 0, object);
 }
 
@@ -59,15 +59,14 @@ static bool namedict__contains__(int argc, py_Ref argv) {
 static bool namedict_items(int argc, py_Ref argv) {
     PY_CHECK_ARGC(1);
     py_Ref object = py_getslot(argv, 0);
-    NameDict* dict = PyObject__dict(object->_obj);
     py_newlist(py_retval());
-    for(int i = 0; i < dict->capacity; i++) {
-        NameDict_KV* kv = &dict->items[i];
-        if(kv->key == NULL) continue;
+    py_Name name;
+    py_TValue* val;
+    for(int i = 0; PyObject__nextdict(object->_obj, &i, &name, &val);) {
         py_Ref slot = py_list_emplace(py_retval());
         py_Ref p = py_newtuple(slot, 2);
-        p[0] = *py_name2ref(kv->key);
-        p[1] = kv->value;
+        p[0] = *py_name2ref(name);
+        p[1] = *val;
     }
     return true;
 }
@@ -75,8 +74,7 @@ static bool namedict_items(int argc, py_Ref argv) {
 static bool namedict_clear(int argc, py_Ref argv) {
     PY_CHECK_ARGC(1);
     py_Ref object = py_getslot(argv, 0);
-    NameDict* dict = PyObject__dict(object->_obj);
-    NameDict__clear(dict);
+    py_cleardict(object);
     py_newnone(py_retval());
     return true;
 }
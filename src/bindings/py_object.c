@@ -9,7 +9,7 @@ bool pk__object_new(int argc, py_Ref argv) {
     if(!ti->is_python) {
         return TypeError("object.__new__(%t) is not safe, use %t.__new__() instead", cls, cls);
     }
-    py_newobject(py_retval(), cls, -1, 0);
+    py_newobject(py_retval(), cls, ti->inst_slots, 0);
     return true;
 }
 
@@ -46,7 +46,7 @@ static bool object__repr__(int argc, py_Ref argv) {
 
 static bool object__dict__(int argc, py_Ref argv) {
     PY_CHECK_ARGC(1);
-    if(argv->is_ptr && argv->_obj->slots == -1) {
+    if(argv->is_ptr && argv->_obj->slots < 0) {
         pk_mappingproxy__namedict(py_retval(), argv);
     } else {
         py_newnone(py_retval());
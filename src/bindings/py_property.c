@@ -1,6 +1,7 @@
 #include "pocketpy/pocketpy.h"
 
 #include "pocketpy/common/utils.h"
+#include "pocketpy/common/sstream.h"
 #include "pocketpy/objects/object.h"
 #include "pocketpy/interpreter/vm.h"
 
@@ -49,3 +50,122 @@ py_Type pk_property__register() {
     py_bindproperty(type, "fset", property_fset, NULL);
     return type;
 }
+
+/* member_descriptor */
+
+static bool member_descriptor__repr__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    py_MemberInfo* m = py_touserdata(argv);
+    c11_sbuf buf;
+    c11_sbuf__ctor(&buf);
+    pk_sprintf(&buf, "<member '%n' of '%t' objects>", m->name, m->owner);
+    c11_sbuf__py_submit(&buf, py_retval());
+    return true;
+}
+
+py_Type pk_member_descriptor__register() {
+    py_Type type = pk_newtype("member_descriptor", tp_object, NULL, NULL, false, true);
+
+    py_bindmagic(type, __repr__, member_descriptor__repr__);
+    return type;
+}
+
+// `names` is a list of the items of `__slots__`
+static bool pk__tpsetslots_list(py_TypeInfo* ti, py_Ref names) {
+    py_Name name_dict = py_name("__dict__");
+    py_Name name_weakref = py_name("__weakref__");
+
+    // instances get fixed slots only if the bases have them too, `object` has none
+    bool has_dict = false;
+    int length = py_list_len(names);
+    for(int i = 0; i < length; i++) {
+        py_Ref item = py_list_getitem(names, i);
+        if(!py_isstr(item)) return TypeError("__slots__ items must be strings, not '%t'", item->type);
+        if(py_namev(py_tosv(item)) == name_dict) has_dict = true;
+    }
+    int base_slots = ti->base == tp_object ? 0 : ti->base_ti->inst_slots;
+    bool fixed = !has_dict && base_slots >= 0;
+
+    int index = base_slots;
+    for(int i = 0; i < length; i++) {
+        py_Name name = py_namev(py_tosv(py_list_getitem(names, i)));
+        if(name == name_dict || name == name_weakref) continue;
+        if(py_getdict(&ti->self, name)) {
+            return ValueError("'%n' in __slots__ conflicts with class variable", name);
+        }
+        py_MemberInfo* m = py_newobject(py_retval(), tp_member_descriptor, 0, sizeof(py_MemberInfo));
+        m->name = name;
+        m->owner = ti->index;
+        m->index = fixed ? index++ : -1;
+        py_setdict(&ti->self, name, py_retval());
+    }
+    if(!fixed) return true;
+
+    py_TValue* p = py_newtuple(&ti->slot_names, index);
+    for(int i = 0; i < base_slots; i++) {
+        p[i] = py_tuple_data(&ti->base_ti->slot_names)[i];
+    }
+    for(int i = 0; i < length; i++) {
+        py_Ref item = py_list_getitem(names, i);
+        py_Ref member = py_getdict(&ti->self, py_namev(py_tosv(item)));
+        if(member == NULL || !py_istype(member, tp_member_descriptor)) continue;
+        py_MemberInfo* m = py_touserdata(member);
+        p[m->index] = *item;
+    }
+    ti->inst_slots = index;
+    return true;
+}
+
+bool pk__tpsetslots(py_TypeInfo* ti, py_Ref slots) {
+    if(py_getdict(&ti->self, __slots__)) return TypeError("__slots__ is already defined");
+    py_StackRef names = py_pushtmp();
+    if(py_isstr(slots)) {
+        py_newlist(names);
+        py_list_append(names, slots);
+    } else {
+        if(!py_tpcall(tp_list, 1, slots)) {
+            py_pop();
+            return false;
+        }
+        *names = *py_retval();
+    }
+    bool ok = pk__tpsetslots_list(ti, names);
+    py_pop();
+    return ok;
+}
+
+py_TValue* pk_member__ref(py_Ref member, py_Ref self) {
+    py_MemberInfo* m = py_touserdata(member);
+    if(!self->is_ptr) return NULL;
+    PyObject* obj = self->_obj;
+    if(obj->slots < 0) return PyObject__getdict(obj, m->name);
+    if(m->index < 0 || m->index >= obj->slots) return NULL;
+    py_TValue* res = PyObject__slots(obj) + m->index;
+    return py_isnil(res) ? NULL : res;
+}
+
+bool pk_member__set(py_Ref member, py_Ref self, py_Ref val) {
+    py_MemberInfo* m = py_touserdata(member);
+    if(self->is_ptr) {
+        if(self->_obj->slots < 0) {
+            py_setdict(self, m->name, val);
+            return true;
+        }
+        if(m->index >= 0 && m->index < self->_obj->slots) {
+            py_setslot(self, m->index, val);
+            return true;
+        }
+    }
+    return TypeError("'%t' object has no storage for member '%n'", self->type, m->name);
+}
+
+bool pk_member__del(py_Ref member, py_Ref self) {
+    py_MemberInfo* m = py_touserdata(member);
+    if(self->is_ptr && self->_obj->slots < 0) {
+        if(py_deldict(self, m->name)) return true;
+    } else if(pk_member__ref(member, self)) {
+        py_newnil(PyObject__slots(self->_obj) + m->index);
+        return true;
+    }
+    return AttributeError(self, m->name);
+}
@@ -0,0 +1,588 @@
+#include "pocketpy/pocketpy.h"
+
+#include "pocketpy/common/utils.h"
+#include "pocketpy/common/sstream.h"
+#include "pocketpy/objects/object.h"
+#include "pocketpy/interpreter/types.h"
+#include "pocketpy/interpreter/bindings.h"
+#include "pocketpy/interpreter/vm.h"
+
+/* `set` and `frozenset` use the hash table of `dict`, their entries have no value */
+
+// `tp_set` or `tp_frozenset` if `val` is one of them or their python subclass, otherwise 0
+static py_Type Set__kind(py_Ref val) {
+    py_Type type = val->type;
+    if(type == tp_set || type == tp_frozenset) return type;
+    type = pk_typeinfo(type)->native_base;
+    return type == tp_set || type == tp_frozenset ? type : 0;
+}
+
+// a set without its table, for `Dict__copy`
+static Dict* Set__alloc(py_OutRef out, py_Type type) {
+    int slots = type == tp_set || type == tp_frozenset ? 0 : -1;
+    return py_newobject(out, type, slots, sizeof(Dict));
+}
+
+static Dict* Set__new(py_OutRef out, py_Type type) {
+    Dict* ud = Set__alloc(out, type);
+    Dict__ctor(ud, kDictMinCapacity, 4, kSetEntrySize);
+    return ud;
+}
+
+static bool Set__add(py_Ref self, py_Ref key) {
+    pk__write_barrier_value(self->_obj, key);
+    DictEntry* entry;
+    return Dict__emplace(py_touserdata(self), key, &entry) != -1;
+}
+
+// -1: error, 0: no, 1: yes
+static int Set__contains(Dict* self, py_Ref key) {
+    DictEntry* entry;
+    if(!Dict__try_get(self, key, &entry)) return -1;
+    return entry != NULL;
+}
+
+static bool Set__update(py_Ref self, py_Ref iterable) {
+    Dict* other = NULL;
+    if(Set__kind(iterable) || py_isdict(iterable)) other = py_touserdata(iterable);
+    if(other) {
+        for(int i = 0; i < other->entries.length; i++) {
+            DictEntry* entry = Dict__entry(other, i);
+            if(py_isnil(&entry->key)) continue;
+            if(!Set__add(self, &entry->key)) return false;
+        }
+        return true;
+    }
+    py_TValue* p;
+    int length = pk_arrayview(iterable, &p);
+    if(length != -1) {
+        for(int i = 0; i < length; i++) {
+            if(!Set__add(self, &p[i])) return false;
+        }
+        return true;
+    }
+    if(!py_iter(iterable)) return false;
+    py_push(py_retval());
+    while(true) {
+        int res = py_next(py_peek(-1));
+        if(res == -1) return false;
+        if(res == 0) break;
+        // `py_retval()` is reset by the `__hash__` call
+        py_push(py_retval());
+        if(!Set__add(self, py_peek(-1))) return false;
+        py_pop();
+    }
+    py_pop();
+    return true;
+}
+
+// the table of a set or frozenset, other iterables are copied to a new set on the stack
+static Dict* Set__view(py_Ref val) {
+    if(Set__kind(val)) return py_touserdata(val);
+    py_StackRef tmp = py_pushtmp();
+    Dict* ud = Set__new(tmp, tp_set);
+    if(!Set__update(tmp, val)) return NULL;
+    return ud;
+}
+
+// the type of the result of a set operation, results of subclasses are not subclasses
+static py_Type Set__result_type(py_Ref self) { return Set__kind(self); }
+
+// -1: error, 0: no, 1: yes
+static int Set__issubset(Dict* self, Dict* other) {
+    if(self->length > other->length) return 0;
+    for(int i = 0; i < self->entries.length; i++) {
+        DictEntry* entry = Dict__entry(self, i);
+        if(py_isnil(&entry->key)) continue;
+        int res = Set__contains(other, &entry->key);
+        if(res != 1) return res;
+    }
+    return 1;
+}
+
+// the elements of `self` that are (or are not) in `other`
+static bool Set__filter(py_OutRef out, Dict* self, Dict* other, bool keep_common) {
+    for(int i = 0; i < self->entries.length; i++) {
+        DictEntry* entry = Dict__entry(self, i);
+        if(py_isnil(&entry->key)) continue;
+        int res = Set__contains(other, &entry->key);
+        if(res == -1) return false;
+        if(res == keep_common) {
+            if(!Set__add(out, &entry->key)) return false;
+        }
+    }
+    return true;
+}
+
+static bool Set__symmetric_update(py_Ref self, Dict* other) {
+    Dict* ud = py_touserdata(self);
+    for(int i = 0; i < other->entries.length; i++) {
+        DictEntry* entry = Dict__entry(other, i);
+        if(py_isnil(&entry->key)) continue;
+        int res = Dict__discard(ud, &entry->key);
+        if(res == -1) return false;
+        if(res == 0 && !Set__add(self, &entry->key)) return false;
+    }
+    return true;
+}
+
+void pk_newset(py_OutRef out) { Set__new(out, tp_set); }
+
+bool pk_set__add(py_Ref self, py_Ref key) { return Set__add(self, key); }
+
+///////////////////////////////
+static bool set__new__(int argc, py_Ref argv) {
+    Set__new(py_retval(), py_totype(argv));
+    return true;
+}
+
+static bool set__init__(int argc, py_Ref argv) {
+    if(argc > 2) return TypeError("set() takes at most 1 argument (%d given)", argc - 1);
+    Dict__clear(py_touserdata(argv));
+    if(argc == 2) {
+        if(!Set__update(argv, py_arg(1))) return false;
+    }
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool frozenset__new__(int argc, py_Ref argv) {
+    if(argc > 2) return TypeError("frozenset() takes at most 1 argument (%d given)", argc - 1);
+    py_Type cls = py_totype(argv);
+    if(argc == 2 && cls == tp_frozenset && py_istype(py_arg(1), tp_frozenset)) {
+        py_assign(py_retval(), py_arg(1));
+        return true;
+    }
+    py_StackRef out = py_pushtmp();
+    Set__new(out, cls);
+    if(argc == 2) {
+        if(!Set__update(out, py_arg(1))) return false;
+    }
+    py_assign(py_retval(), out);
+    py_pop();
+    return true;
+}
+
+static bool set__len__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Dict* self = py_touserdata(argv);
+    py_newint(py_retval(), self->length);
+    return true;
+}
+
+static bool set__contains__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    int res = Set__contains(py_touserdata(argv), py_arg(1));
+    if(res == -1) return false;
+    py_newbool(py_retval(), res);
+    return true;
+}
+
+static bool set__repr__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Dict* self = py_touserdata(argv);
+    c11_sbuf buf;
+    c11_sbuf__ctor(&buf);
+    bool is_braced = argv->type == tp_set;
+    if(!is_braced) pk_sprintf(&buf, "%t(", argv->type);
+    if(self->length == 0) {
+        if(is_braced) c11_sbuf__write_cstr(&buf, "set()");
+    } else {
+        c11_sbuf__write_char(&buf, '{');
+        bool is_first = true;
+        for(int i = 0; i < self->entries.length; i++) {
+            DictEntry* entry = Dict__entry(self, i);
+            if(py_isnil(&entry->key)) continue;
+            if(!is_first) c11_sbuf__write_cstr(&buf, ", ");
+            if(!py_repr(&entry->key)) {
+                c11_sbuf__dtor(&buf);
+                return false;
+            }
+            c11_sbuf__write_sv(&buf, py_tosv(py_retval()));
+            is_first = false;
+        }
+        c11_sbuf__write_char(&buf, '}');
+    }
+    if(!is_braced) c11_sbuf__write_char(&buf, ')');
+    c11_sbuf__py_submit(&buf, py_retval());
+    return true;
+}
+
+// `op`: 0 is ==, 1 is <=, 2 is <, the reflected ones are handled by swapping the operands
+static bool set__compare(int argc, py_Ref argv, int op, bool swap) {
+    PY_CHECK_ARGC(2);
+    if(!Set__kind(py_arg(1))) {
+        py_newnotimplemented(py_retval());
+        return true;
+    }
+    Dict* self = py_touserdata(py_arg(swap ? 1 : 0));
+    Dict* other = py_touserdata(py_arg(swap ? 0 : 1));
+    if(op == 0 && self->length != other->length) {
+        py_newbool(py_retval(), false);
+        return true;
+    }
+    if(op == 2 && self->length >= other->length) {
+        py_newbool(py_retval(), false);
+        return true;
+    }
+    int res = Set__issubset(self, other);
+    if(res == -1) return false;
+    py_newbool(py_retval(), res);
+    return true;
+}
+
+static bool set__eq__(int argc, py_Ref argv) { return set__compare(argc, argv, 0, false); }
+
+static bool set__ne__(int argc, py_Ref argv) {
+    if(!set__compare(argc, argv, 0, false)) return false;
+    if(py_isbool(py_retval())) py_newbool(py_retval(), !py_tobool(py_retval()));
+    return true;
+}
+
+static bool set__le__(int argc, py_Ref argv) { return set__compare(argc, argv, 1, false); }
+
+static bool set__lt__(int argc, py_Ref argv) { return set__compare(argc, argv, 2, false); }
+
+static bool set__ge__(int argc, py_Ref argv) { return set__compare(argc, argv, 1, true); }
+
+static bool set__gt__(int argc, py_Ref argv) { return set__compare(argc, argv, 2, true); }
+
+// `op`: '|', '&', '-' or '^'. `others` are sets for operators, or any iterables for methods
+static bool set__binaryop(py_Ref self, int argc, py_Ref others, char op) {
+    py_StackRef p0 = py_peek(0);
+    py_StackRef out = py_pushtmp();
+    py_Type type = Set__result_type(self);
+    if(argc == 0 || op == '|' || op == '^') {
+        if(!Dict__copy(py_touserdata(self), Set__alloc(out, type))) return false;
+    } else {
+        // the result is a subset of `self`, each operand makes a new set from the last one
+        *out = *self;
+    }
+    for(int i = 0; i < argc; i++) {
+        if(op == '|') {
+            if(!Set__update(out, &others[i])) return false;
+            continue;
+        }
+        Dict* other = Set__view(&others[i]);
+        if(other == NULL) return false;
+        Dict* curr = py_touserdata(out);
+        switch(op) {
+            case '&': {
+                py_StackRef res = py_pushtmp();
+                Set__new(res, type);
+                // iterate the smaller one
+                bool ok = curr->length <= other->length ? Set__filter(res, curr, other, true)
+                                                         : Set__filter(res, other, curr, true);
+                if(!ok) return false;
+                *out = *res;
+                break;
+            }
+            case '-': {
+                py_StackRef res = py_pushtmp();
+                Set__new(res, type);
+                if(!Set__filter(res, curr, other, false)) return false;
+                *out = *res;
+                break;
+            }
+            case '^': {
+                if(!Set__symmetric_update(out, other)) return false;
+                break;
+            }
+            default: c11__unreachable();
+        }
+    }
+    py_assign(py_retval(), out);
+    py_shrink(py_peek(0) - p0);
+    return true;
+}
+
+static bool set__or__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    if(!Set__kind(py_arg(1))) {
+        py_newnotimplemented(py_retval());
+        return true;
+    }
+    return set__binaryop(argv, 1, py_arg(1), '|');
+}
+
+static bool set__and__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    if(!Set__kind(py_arg(1))) {
+        py_newnotimplemented(py_retval());
+        return true;
+    }
+    return set__binaryop(argv, 1, py_arg(1), '&');
+}
+
+static bool set__sub__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    if(!Set__kind(py_arg(1))) {
+        py_newnotimplemented(py_retval());
+        return true;
+    }
+    return set__binaryop(argv, 1, py_arg(1), '-');
+}
+
+static bool set__xor__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    if(!Set__kind(py_arg(1))) {
+        py_newnotimplemented(py_retval());
+        return true;
+    }
+    return set__binaryop(argv, 1, py_arg(1), '^');
+}
+
+static bool set_union(int argc, py_Ref argv) {
+    return set__binaryop(argv, argc - 1, py_arg(1), '|');
+}
+
+static bool set_intersection(int argc, py_Ref argv) {
+    return set__binaryop(argv, argc - 1, py_arg(1), '&');
+}
+
+static bool set_difference(int argc, py_Ref argv) {
+    return set__binaryop(argv, argc - 1, py_arg(1), '-');
+}
+
+static bool set_symmetric_difference(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    return set__binaryop(argv, 1, py_arg(1), '^');
+}
+
+static bool set_issubset(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    Dict* other = Set__view(py_arg(1));
+    if(other == NULL) return false;
+    int res = Set__issubset(py_touserdata(argv), other);
+    if(res == -1) return false;
+    py_newbool(py_retval(), res);
+    py_shrink(py_peek(0) - (argv + argc));
+    return true;
+}
+
+static bool set_issuperset(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    Dict* other = Set__view(py_arg(1));
+    if(other == NULL) return false;
+    int res = Set__issubset(other, py_touserdata(argv));
+    if(res == -1) return false;
+    py_newbool(py_retval(), res);
+    py_shrink(py_peek(0) - (argv + argc));
+    return true;
+}
+
+static bool set_isdisjoint(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    Dict* self = py_touserdata(argv);
+    Dict* other = Set__view(py_arg(1));
+    if(other == NULL) return false;
+    if(self->length > other->length) {
+        Dict* tmp = self;
+        self = other;
+        other = tmp;
+    }
+    bool res = true;
+    for(int i = 0; i < self->entries.length && res; i++) {
+        DictEntry* entry = Dict__entry(self, i);
+        if(py_isnil(&entry->key)) continue;
+        int found = Set__contains(other, &entry->key);
+        if(found == -1) return false;
+        res = !found;
+    }
+    py_newbool(py_retval(), res);
+    py_shrink(py_peek(0) - (argv + argc));
+    return true;
+}
+
+static bool set_copy(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    if(argv->type == tp_frozenset) {
+        py_assign(py_retval(), argv);
+        return true;
+    }
+    Dict* self = py_touserdata(argv);
+    if(!Dict__copy(self, Set__alloc(py_retval(), Set__result_type(argv)))) return false;
+    return true;
+}
+
+static bool set__reduce__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Dict* self = py_touserdata(argv);
+    py_Ref p = py_newtuple(py_pushtmp(), 2);
+    p[0] = *py_tpobject(argv->type);
+    py_Ref args = py_newtuple(&p[1], 1);
+    py_newlistn(&args[0], self->length);
+    int n = 0;
+    for(int i = 0; i < self->entries.length; i++) {
+        DictEntry* entry = Dict__entry(self, i);
+        if(py_isnil(&entry->key)) continue;
+        py_list_setitem(&args[0], n++, &entry->key);
+    }
+    py_assign(py_retval(), py_peek(-1));
+    py_pop();
+    return true;
+}
+
+/* set only */
+
+static bool set_add(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    if(!Set__add(argv, py_arg(1))) return false;
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool set_discard(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    if(Dict__discard(py_touserdata(argv), py_arg(1)) == -1) return false;
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool set_remove(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    int res = Dict__discard(py_touserdata(argv), py_arg(1));
+    if(res == -1) return false;
+    if(res == 0) return KeyError(py_arg(1));
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool set_pop(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Dict* self = py_touserdata(argv);
+    for(int i = self->entries.length - 1; i >= 0; i--) {
+        DictEntry* entry = Dict__entry(self, i);
+        if(py_isnil(&entry->key)) continue;
+        py_TValue key = entry->key;
+        if(Dict__discard(self, &key) == -1) return false;
+        py_assign(py_retval(), &key);
+        return true;
+    }
+    py_Ref msg = py_pushtmp();
+    py_newstr(msg, "pop from an empty set");
+    return KeyError(msg);
+}
+
+static bool set_clear(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Dict__clear(py_touserdata(argv));
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool set_update(int argc, py_Ref argv) {
+    for(int i = 1; i < argc; i++) {
+        if(!Set__update(argv, py_arg(i))) return false;
+    }
+    py_newnone(py_retval());
+    return true;
+}
+
+// replace the table of `self` with the result of an operation
+static bool set__inplace(int argc, py_Ref argv, char op) {
+    if(!set__binaryop(argv, argc - 1, py_arg(1), op)) return false;
+    Dict* self = py_touserdata(argv);
+    Dict* res = py_touserdata(py_retval());
+    Dict tmp = *self;
+    *self = *res;
+    *res = tmp;
+    pk__write_barrier(argv->_obj);
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool set_intersection_update(int argc, py_Ref argv) {
+    return set__inplace(argc, argv, '&');
+}
+
+static bool set_difference_update(int argc, py_Ref argv) { return set__inplace(argc, argv, '-'); }
+
+static bool set_symmetric_difference_update(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    Dict* other = Set__view(py_arg(1));
+    if(other == NULL) return false;
+    if(other == py_touserdata(argv)) {
+        Dict__clear(other);
+    } else {
+        if(!Set__symmetric_update(argv, other)) return false;
+    }
+    py_newnone(py_retval());
+    py_shrink(py_peek(0) - (argv + argc));
+    return true;
+}
+
+/* frozenset only */
+
+static bool frozenset__hash__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Dict* self = py_touserdata(argv);
+    // independent of the order, the hashes of the entries are already well mixed
+    uint64_t x = (uint64_t)self->length * 0x9e3779b97f4a7c15ull;
+    for(int i = 0; i < self->entries.length; i++) {
+        DictEntry* entry = Dict__entry(self, i);
+        if(py_isnil(&entry->key)) continue;
+        x ^= entry->hash;
+    }
+    py_newint(py_retval(), (py_i64)x);
+    return true;
+}
+
+static void Set__bind_common(py_Type type) {
+    py_bindmagic(type, __len__, set__len__);
+    py_bindmagic(type, __contains__, set__contains__);
+    py_bindmagic(type, __iter__, dict_keys);
+    py_bindmagic(type, __repr__, set__repr__);
+    py_bindmagic(type, __eq__, set__eq__);
+    py_bindmagic(type, __ne__, set__ne__);
+    py_bindmagic(type, __le__, set__le__);
+    py_bindmagic(type, __lt__, set__lt__);
+    py_bindmagic(type, __ge__, set__ge__);
+    py_bindmagic(type, __gt__, set__gt__);
+    py_bindmagic(type, __or__, set__or__);
+    py_bindmagic(type, __and__, set__and__);
+    py_bindmagic(type, __sub__, set__sub__);
+    py_bindmagic(type, __xor__, set__xor__);
+    py_bindmagic(type, __reduce__, set__reduce__);
+
+    py_bindmethod(type, "copy", set_copy);
+    py_bindmethod(type, "union", set_union);
+    py_bindmethod(type, "intersection", set_intersection);
+    py_bindmethod(type, "difference", set_difference);
+    py_bindmethod(type, "symmetric_difference", set_symmetric_difference);
+    py_bindmethod(type, "issubset", set_issubset);
+    py_bindmethod(type, "issuperset", set_issuperset);
+    py_bindmethod(type, "isdisjoint", set_isdisjoint);
+}
+
+py_Type pk_set__register() {
+    py_Type type = pk_newtype("set", tp_object, NULL, (void (*)(void*))Dict__dtor, false, false);
+
+    py_bindmagic(type, __new__, set__new__);
+    py_bindmagic(type, __init__, set__init__);
+    Set__bind_common(type);
+
+    py_bindmethod(type, "add", set_add);
+    py_bindmethod(type, "discard", set_discard);
+    py_bindmethod(type, "remove", set_remove);
+    py_bindmethod(type, "pop", set_pop);
+    py_bindmethod(type, "clear", set_clear);
+    py_bindmethod(type, "update", set_update);
+    py_bindmethod(type, "intersection_update", set_intersection_update);
+    py_bindmethod(type, "difference_update", set_difference_update);
+    py_bindmethod(type, "symmetric_difference_update", set_symmetric_difference_update);
+
+    py_setdict(py_tpobject(type), __hash__, py_None());
+    return type;
+}
+
+py_Type pk_frozenset__register() {
+    py_Type type =
+        pk_newtype("frozenset", tp_object, NULL, (void (*)(void*))Dict__dtor, false, false);
+
+    py_bindmagic(type, __new__, frozenset__new__);
+    Set__bind_common(type);
+
+    py_bindmagic(type, __hash__, frozenset__hash__);
+    return type;
+}
@@ -12,10 +12,19 @@ c11_string* pk_tostr(py_Ref self) {
     if(!self->is_ptr) {
         return (c11_string*)(&self->extra);
     } else {
-        return PyObject__userdata(self->_obj);
+        return pk_strobj__string(PyObject__userdata(self->_obj));
     }
 }
 
+uint64_t pk_strhash(py_Ref self) {
+    assert(self->type == tp_str);
+    if(!self->is_ptr) return c11_sv__hash(c11_string__sv((c11_string*)(&self->extra)));
+    void* ud = PyObject__userdata(self->_obj);
+    uint64_t* p_hash = pk_strobj__hash(ud);
+    if(*p_hash == 0) *p_hash = c11_sv__hash(c11_string__sv(pk_strobj__string(ud)));
+    return *p_hash;
+}
+
 ////////////////////////////////
 static bool str__new__(int argc, py_Ref argv) {
     assert(argc >= 1);
@@ -29,7 +38,7 @@ static bool str__new__(int argc, py_Ref argv) {
 
 static bool str__hash__(int argc, py_Ref argv) {
     PY_CHECK_ARGC(1);
-    uint64_t res = c11_sv__hash(py_tosv(argv));
+    uint64_t res = pk_strhash(argv);
     py_newint(py_retval(), (py_i64)res);
     return true;
 }
@@ -48,6 +57,8 @@ static bool str__add__(int argc, py_Ref argv) {
         py_newnotimplemented(py_retval());
     } else {
         c11_string* other = pk_tostr(&argv[1]);
+        int64_t size = (int64_t)self->size + other->size;
+        if(!ManagedHeap__reserve(&pk_current_vm->heap, size)) return false;
         char* p = py_newstrn(py_retval(), self->size + other->size);
         memcpy(p, self->data, self->size);
         memcpy(p + self->size, other->data, other->size);
@@ -65,6 +76,7 @@ static bool str__mul__(int argc, py_Ref argv) {
         if(n <= 0) {
             py_newstr(py_retval(), "");
         } else {
+            if(!ManagedHeap__reserve(&pk_current_vm->heap, self->size * n)) return false;
             char* p = py_newstrn(py_retval(), self->size * n);
             for(int i = 0; i < n; i++) {
                 memcpy(p + i * self->size, self->data, self->size);
@@ -661,6 +673,8 @@ static bool bytes__add__(int argc, py_Ref argv) {
         py_newnotimplemented(py_retval());
     } else {
         c11_bytes* other = py_touserdata(&argv[1]);
+        int64_t size = (int64_t)self->size + other->size;
+        if(!ManagedHeap__reserve(&pk_current_vm->heap, size)) return false;
         unsigned char* p = py_newbytes(py_retval(), self->size + other->size);
         memcpy(p, self->data, self->size);
         memcpy(p + self->size, other->data, other->size);
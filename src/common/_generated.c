@@ -2,23 +2,1275 @@
 #include "pocketpy/common/_generated.h"
 #include <string.h>
 const char kPythonLibs_bisect[] = "\"\"\"Bisection algorithms.\"\"\"\n\ndef insort_right(a, x, lo=0, hi=None):\n    \"\"\"Insert item x in list a, and keep it sorted assuming a is sorted.\n\n    If x is already in a, insert it to the right of the rightmost x.\n\n    Optional args lo (default 0) and hi (default len(a)) bound the\n    slice of a to be searched.\n    \"\"\"\n\n    lo = bisect_right(a, x, lo, hi)\n    a.insert(lo, x)\n\ndef bisect_right(a, x, lo=0, hi=None):\n    \"\"\"Return the index where to insert item x in list a, assuming a is sorted.\n\n    The return value i is such that all e in a[:i] have e <= x, and all e in\n    a[i:] have e > x.  So if x already appears in the list, a.insert(x) will\n    insert just after the rightmost x already there.\n\n    Optional args lo (default 0) and hi (default len(a)) bound the\n    slice of a to be searched.\n    \"\"\"\n\n    if lo < 0:\n        raise ValueError('lo must be non-negative')\n    if hi is None:\n        hi = len(a)\n    while lo < hi:\n        mid = (lo+hi)//2\n        if x < a[mid]: hi = mid\n        else: lo = mid+1\n    return lo\n\ndef insort_left(a, x, lo=0, hi=None):\n    \"\"\"Insert item x in list a, and keep it sorted assuming a is sorted.\n\n    If x is already in a, insert it to the left of the leftmost x.\n\n    Optional args lo (default 0) and hi (default len(a)) bound the\n    slice of a to be searched.\n    \"\"\"\n\n    lo = bisect_left(a, x, lo, hi)\n    a.insert(lo, x)\n\n\ndef bisect_left(a, x, lo=0, hi=None):\n    \"\"\"Return the index where to insert item x in list a, assuming a is sorted.\n\n    The return value i is such that all e in a[:i] have e < x, and all e in\n    a[i:] have e >= x.  So if x already appears in the list, a.insert(x) will\n    insert just before the leftmost x already there.\n\n    Optional args lo (default 0) and hi (default len(a)) bound the\n    slice of a to be searched.\n    \"\"\"\n\n    if lo < 0:\n        raise ValueError('lo must be non-negative')\n    if hi is None:\n        hi = len(a)\n    while lo < hi:\n        mid = (lo+hi)//2\n        if a[mid] < x: lo = mid+1\n        else: hi = mid\n    return lo\n\n# Create aliases\nbisect = bisect_right\ninsort = insort_right\n";
-const char kPythonLibs_builtins[] = "def all(iterable):\n    for i in iterable:\n        if not i:\n            return False\n    return True\n\ndef any(iterable):\n    for i in iterable:\n        if i:\n            return True\n    return False\n\ndef enumerate(iterable, start=0):\n    n = start\n    for elem in iterable:\n        yield n, elem\n        n += 1\n\ndef __minmax_reduce(op, args):\n    if len(args) == 2:  # min(1, 2)\n        return args[0] if op(args[0], args[1]) else args[1]\n    if len(args) == 0:  # min()\n        raise TypeError('expected 1 arguments, got 0')\n    if len(args) == 1:  # min([1, 2, 3, 4]) -> min(1, 2, 3, 4)\n        args = args[0]\n    args = iter(args)\n    try:\n        res = next(args)\n    except StopIteration:\n        raise ValueError('args is an empty sequence')\n    while True:\n        try:\n            i = next(args)\n        except StopIteration:\n            break\n        if op(i, res):\n            res = i\n    return res\n\ndef min(*args, key=None):\n    key = key or (lambda x: x)\n    return __minmax_reduce(lambda x,y: key(x)<key(y), args)\n\ndef max(*args, key=None):\n    key = key or (lambda x: x)\n    return __minmax_reduce(lambda x,y: key(x)>key(y), args)\n\ndef sum(iterable):\n    res = 0\n    for i in iterable:\n        res += i\n    return res\n\ndef map(f, iterable):\n    for i in iterable:\n        yield f(i)\n\ndef filter(f, iterable):\n    for i in iterable:\n        if f(i):\n            yield i\n\ndef zip(a, b):\n    a = iter(a)\n    b = iter(b)\n    while True:\n        try:\n            ai = next(a)\n            bi = next(b)\n        except StopIteration:\n            break\n        yield ai, bi\n\ndef reversed(iterable):\n    a = list(iterable)\n    a.reverse()\n    return a\n\ndef sorted(iterable, key=None, reverse=False):\n    a = list(iterable)\n    a.sort(key=key, reverse=reverse)\n    return a\n\n\ndef help(obj):\n    if hasattr(obj, '__func__'):\n        obj = obj.__func__\n    # print(obj.__signature__)\n    if obj.__doc__:\n        print(obj.__doc__)\n\ndef complex(real, imag=0):\n    import cmath\n    return cmath.complex(real, imag) # type: ignore\n\ndef dir(obj) -> list[str]:\n    tp_module = type(__import__('math'))\n    if isinstance(obj, tp_module):\n        return [k for k, _ in obj.__dict__.items()]\n    names = set()\n    if not isinstance(obj, type):\n        obj_d = obj.__dict__\n        if obj_d is not None:\n            names.update([k for k, _ in obj_d.items()])\n        cls = type(obj)\n    else:\n        cls = obj\n    while cls is not None:\n        names.update([k for k, _ in cls.__dict__.items()])\n        cls = cls.__base__\n    return sorted(list(names))\n\nclass set:\n    def __init__(self, iterable=None):\n        iterable = iterable or []\n        self._a = {}\n        self.update(iterable)\n\n    def add(self, elem):\n        self._a[elem] = None\n        \n    def discard(self, elem):\n        self._a.pop(elem, None)\n\n    def remove(self, elem):\n        del self._a[elem]\n        \n    def clear(self):\n        self._a.clear()\n\n    def update(self, other):\n        for elem in other:\n            self.add(elem)\n\n    def __len__(self):\n        return len(self._a)\n    \n    def copy(self):\n        return set(self._a.keys())\n    \n    def __and__(self, other):\n        return {elem for elem in self if elem in other}\n\n    def __sub__(self, other):\n        return {elem for elem in self if elem not in other}\n    \n    def __or__(self, other):\n        ret = self.copy()\n        ret.update(other)\n        return ret\n\n    def __xor__(self, other): \n        _0 = self - other\n        _1 = other - self\n        return _0 | _1\n\n    def union(self, other):\n        return self | other\n\n    def intersection(self, other):\n        return self & other\n\n    def difference(self, other):\n        return self - other\n\n    def symmetric_difference(self, other):      \n        return self ^ other\n    \n    def __eq__(self, other):\n        if not isinstance(other, set):\n            return NotImplemented\n        return len(self ^ other) == 0\n    \n    def __ne__(self, other):\n        if not isinstance(other, set):\n            return NotImplemented\n        return len(self ^ other) != 0\n\n    def isdisjoint(self, other):\n        return len(self & other) == 0\n    \n    def issubset(self, other):\n        return len(self - other) == 0\n    \n    def issuperset(self, other):\n        return len(other - self) == 0\n\n    def __contains__(self, elem):\n        return elem in self._a\n    \n    def __repr__(self):\n        if len(self) == 0:\n            return 'set()'\n        return '{'+ ', '.join([repr(i) for i in self._a.keys()]) + '}'\n    \n    def __iter__(self):\n        return iter(self._a.keys())";
+const char kPythonLibs_builtins[] = "def help(obj):\n    if hasattr(obj, '__func__'):\n        obj = obj.__func__\n    # print(obj.__signature__)\n    if obj.__doc__:\n        print(obj.__doc__)\n\ndef complex(real, imag=0):\n    import cmath\n    return cmath.complex(real, imag) # type: ignore\n\ndef dir(obj) -> list[str]:\n    tp_module = type(__import__('math'))\n    if isinstance(obj, tp_module):\n        return [k for k, _ in obj.__dict__.items()]\n    names = set()\n    if not isinstance(obj, type):\n        obj_d = obj.__dict__\n        if obj_d is not None:\n            names.update([k for k, _ in obj_d.items()])\n        cls = type(obj)\n    else:\n        cls = obj\n    while cls is not None:\n        names.update([k for k, _ in cls.__dict__.items()])\n        cls = cls.__base__\n    return sorted(list(names))\n";
 const char kPythonLibs_cmath[] = "import math\n\nclass complex:\n    def __init__(self, real, imag=0):\n        self._real = float(real)\n        self._imag = float(imag)\n\n    @property\n    def real(self):\n        return self._real\n    \n    @property\n    def imag(self):\n        return self._imag\n\n    def conjugate(self):\n        return complex(self.real, -self.imag)\n    \n    def __repr__(self):\n        s = ['(', str(self.real)]\n        s.append('-' if self.imag < 0 else '+')\n        s.append(str(abs(self.imag)))\n        s.append('j)')\n        return ''.join(s)\n    \n    def __eq__(self, other):\n        if type(other) is complex:\n            return self.real == other.real and self.imag == other.imag\n        if type(other) in (int, float):\n            return self.real == other and self.imag == 0\n        return NotImplemented\n    \n    def __ne__(self, other):\n        res = self == other\n        if res is NotImplemented:\n            return res\n        return not res\n    \n    def __add__(self, other):\n        if type(other) is complex:\n            return complex(self.real + other.real, self.imag + other.imag)\n        if type(other) in (int, float):\n            return complex(self.real + other, self.imag)\n        return NotImplemented\n        \n    def __radd__(self, other):\n        return self.__add__(other)\n    \n    def __sub__(self, other):\n        if type(other) is complex:\n            return complex(self.real - other.real, self.imag - other.imag)\n        if type(other) in (int, float):\n            return complex(self.real - other, self.imag)\n        return NotImplemented\n    \n    def __rsub__(self, other):\n        if type(other) is complex:\n            return complex(other.real - self.real, other.imag - self.imag)\n        if type(other) in (int, float):\n            return complex(other - self.real, -self.imag)\n        return NotImplemented\n    \n    def __mul__(self, other):\n        if type(other) is complex:\n            return complex(self.real * other.real - self.imag * other.imag,\n                           self.real * other.imag + self.imag * other.real)\n        if type(other) in (int, float):\n            return complex(self.real * other, self.imag * other)\n        return NotImplemented\n    \n    def __rmul__(self, other):\n        return self.__mul__(other)\n    \n    def __truediv__(self, other):\n        if type(other) is complex:\n            denominator = other.real ** 2 + other.imag ** 2\n            real_part = (self.real * other.real + self.imag * other.imag) / denominator\n            imag_part = (self.imag * other.real - self.real * other.imag) / denominator\n            return complex(real_part, imag_part)\n        if type(other) in (int, float):\n            return complex(self.real / other, self.imag / other)\n        return NotImplemented\n    \n    def __pow__(self, other: int | float):\n        if type(other) in (int, float):\n            return complex(self.__abs__() ** other * math.cos(other * phase(self)),\n                           self.__abs__() ** other * math.sin(other * phase(self)))\n        return NotImplemented\n    \n    def __abs__(self) -> float:\n        return math.sqrt(self.real ** 2 + self.imag ** 2)\n\n    def __neg__(self):\n        return complex(-self.real, -self.imag)\n    \n    def __hash__(self):\n        return hash((self.real, self.imag))\n\n\n# Conversions to and from polar coordinates\n\ndef phase(z: complex):\n    return math.atan2(z.imag, z.real)\n\ndef polar(z: complex):\n    return z.__abs__(), phase(z)\n\ndef rect(r: float, phi: float):\n    return r * math.cos(phi) + r * math.sin(phi) * 1j\n\n# Power and logarithmic functions\n\ndef exp(z: complex):\n    return math.exp(z.real) * rect(1, z.imag)\n\ndef log(z: complex, base=2.718281828459045):\n    return math.log(z.__abs__(), base) + phase(z) * 1j\n\ndef log10(z: complex):\n    return log(z, 10)\n\ndef sqrt(z: complex):\n    return z ** 0.5\n\n# Trigonometric functions\n\ndef acos(z: complex):\n    return -1j * log(z + sqrt(z * z - 1))\n\ndef asin(z: complex):\n    return -1j * log(1j * z + sqrt(1 - z * z))\n\ndef atan(z: complex):\n    return 1j / 2 * log((1 - 1j * z) / (1 + 1j * z))\n\ndef cos(z: complex):\n    return (exp(z) + exp(-z)) / 2\n\ndef sin(z: complex):\n    return (exp(z) - exp(-z)) / (2 * 1j)\n\ndef tan(z: complex):\n    return sin(z) / cos(z)\n\n# Hyperbolic functions\n\ndef acosh(z: complex):\n    return log(z + sqrt(z * z - 1))\n\ndef asinh(z: complex):\n    return log(z + sqrt(z * z + 1))\n\ndef atanh(z: complex):\n    return 1 / 2 * log((1 + z) / (1 - z))\n\ndef cosh(z: complex):\n    return (exp(z) + exp(-z)) / 2\n\ndef sinh(z: complex):\n    return (exp(z) - exp(-z)) / 2\n\ndef tanh(z: complex):\n    return sinh(z) / cosh(z)\n\n# Classification functions\n\ndef isfinite(z: complex):\n    return math.isfinite(z.real) and math.isfinite(z.imag)\n\ndef isinf(z: complex):\n    return math.isinf(z.real) or math.isinf(z.imag)\n\ndef isnan(z: complex):\n    return math.isnan(z.real) or math.isnan(z.imag)\n\ndef isclose(a: complex, b: complex):\n    return math.isclose(a.real, b.real) and math.isclose(a.imag, b.imag)\n\n# Constants\n\npi = math.pi\ne = math.e\ntau = 2 * pi\ninf = math.inf\ninfj = complex(0, inf)\nnan = math.nan\nnanj = complex(0, nan)\n";
-const char kPythonLibs_collections[] = "from typing import TypeVar, Iterable\n\ndef Counter[T](iterable: Iterable[T]):\n    a: dict[T, int] = {}\n    for x in iterable:\n        if x in a:\n            a[x] += 1\n        else:\n            a[x] = 1\n    return a\n\n\nclass defaultdict(dict):\n    def __init__(self, default_factory, *args):\n        super().__init__(*args)\n        self.default_factory = default_factory\n\n    def __missing__(self, key):\n        self[key] = self.default_factory()\n        return self[key]\n\n    def __repr__(self) -> str:\n        return f\"defaultdict({self.default_factory}, {super().__repr__()})\"\n\n    def copy(self):\n        return defaultdict(self.default_factory, self)\n\n\nclass deque[T]:\n    _head: int\n    _tail: int\n    _maxlen: int | None\n    _capacity: int\n    _data: list[T]\n\n    def __init__(self, iterable: Iterable[T] = None, maxlen: int | None = None):\n        if maxlen is not None:\n            assert maxlen > 0\n\n        self._head = 0\n        self._tail = 0\n        self._maxlen = maxlen\n        self._capacity = 8 if maxlen is None else maxlen + 1\n        self._data = [None] * self._capacity # type: ignore\n\n        if iterable is not None:\n            self.extend(iterable)\n\n    @property\n    def maxlen(self) -> int | None:\n        return self._maxlen\n\n    def __resize_2x(self):\n        backup = list(self)\n        self._capacity *= 2\n        self._head = 0\n        self._tail = len(backup)\n        self._data.clear()\n        self._data.extend(backup)\n        self._data.extend([None] * (self._capacity - len(backup)))\n\n    def append(self, x: T):\n        if (self._tail + 1) % self._capacity == self._head:\n            if self._maxlen is None:\n                self.__resize_2x()\n            else:\n                self.popleft()\n        self._data[self._tail] = x\n        self._tail = (self._tail + 1) % self._capacity\n\n    def appendleft(self, x: T):\n        if (self._tail + 1) % self._capacity == self._head:\n            if self._maxlen is None:\n                self.__resize_2x()\n            else:\n                self.pop()\n        self._head = (self._head - 1) % self._capacity\n        self._data[self._head] = x\n\n    def copy(self):\n        return deque(self, maxlen=self.maxlen)\n    \n    def count(self, x: T) -> int:\n        n = 0\n        for item in self:\n            if item == x:\n                n += 1\n        return n\n    \n    def extend(self, iterable: Iterable[T]):\n        for x in iterable:\n            self.append(x)\n\n    def extendleft(self, iterable: Iterable[T]):\n        for x in iterable:\n            self.appendleft(x)\n    \n    def pop(self) -> T:\n        if self._head == self._tail:\n            raise IndexError(\"pop from an empty deque\")\n        self._tail = (self._tail - 1) % self._capacity\n        x = self._data[self._tail]\n        self._data[self._tail] = None\n        return x\n    \n    def popleft(self) -> T:\n        if self._head == self._tail:\n            raise IndexError(\"pop from an empty deque\")\n        x = self._data[self._head]\n        self._data[self._head] = None\n        self._head = (self._head + 1) % self._capacity\n        return x\n    \n    def clear(self):\n        i = self._head\n        while i != self._tail:\n            self._data[i] = None # type: ignore\n            i = (i + 1) % self._capacity\n        self._head = 0\n        self._tail = 0\n\n    def rotate(self, n: int = 1):\n        if len(self) == 0:\n            return\n        if n > 0:\n            n = n % len(self)\n            for _ in range(n):\n                self.appendleft(self.pop())\n        elif n < 0:\n            n = -n % len(self)\n            for _ in range(n):\n                self.append(self.popleft())\n\n    def __len__(self) -> int:\n        return (self._tail - self._head) % self._capacity\n\n    def __contains__(self, x: object) -> bool:\n        for item in self:\n            if item == x:\n                return True\n        return False\n    \n    def __iter__(self):\n        i = self._head\n        while i != self._tail:\n            yield self._data[i]\n            i = (i + 1) % self._capacity\n\n    def __eq__(self, other: object) -> bool:\n        if not isinstance(other, deque):\n            return NotImplemented\n        if len(self) != len(other):\n            return False\n        for x, y in zip(self, other):\n            if x != y:\n                return False\n        return True\n    \n    def __ne__(self, other: object) -> bool:\n        if not isinstance(other, deque):\n            return NotImplemented\n        return not self == other\n    \n    def __repr__(self) -> str:\n        if self.maxlen is None:\n            return f\"deque({list(self)!r})\"\n        return f\"deque({list(self)!r}, maxlen={self.maxlen})\"\n\n";
-const char kPythonLibs_dataclasses[] = "def _get_annotations(cls: type):\n    inherits = []\n    while cls is not object:\n        inherits.append(cls)\n        cls = cls.__base__\n    inherits.reverse()\n    res = {}\n    for cls in inherits:\n        res.update(cls.__annotations__)\n    return res.keys()\n\ndef _wrapped__init__(self, *args, **kwargs):\n    cls = type(self)\n    cls_d = cls.__dict__\n    fields = _get_annotations(cls)\n    i = 0   # index into args\n    for field in fields:\n        if field in kwargs:\n            setattr(self, field, kwargs.pop(field))\n        else:\n            if i < len(args):\n                setattr(self, field, args[i])\n                i += 1\n            elif field in cls_d:    # has default value\n                setattr(self, field, cls_d[field])\n            else:\n                raise TypeError(f\"{cls.__name__} missing required argument {field!r}\")\n    if len(args) > i:\n        raise TypeError(f\"{cls.__name__} takes {len(fields)} positional arguments but {len(args)} were given\")\n    if len(kwargs) > 0:\n        raise TypeError(f\"{cls.__name__} got an unexpected keyword argument {next(iter(kwargs))!r}\")\n\ndef _wrapped__repr__(self):\n    fields = _get_annotations(type(self))\n    obj_d = self.__dict__\n    args: list = [f\"{field}={obj_d[field]!r}\" for field in fields]\n    return f\"{type(self).__name__}({', '.join(args)})\"\n\ndef _wrapped__eq__(self, other):\n    if type(self) is not type(other):\n        return False\n    fields = _get_annotations(type(self))\n    for field in fields:\n        if getattr(self, field) != getattr(other, field):\n            return False\n    return True\n\ndef _wrapped__ne__(self, other):\n    return not self.__eq__(other)\n\ndef dataclass(cls: type):\n    assert type(cls) is type\n    cls_d = cls.__dict__\n    if '__init__' not in cls_d:\n        cls.__init__ = _wrapped__init__\n    if '__repr__' not in cls_d:\n        cls.__repr__ = _wrapped__repr__\n    if '__eq__' not in cls_d:\n        cls.__eq__ = _wrapped__eq__\n    if '__ne__' not in cls_d:\n        cls.__ne__ = _wrapped__ne__\n    fields = _get_annotations(cls)\n    has_default = False\n    for field in fields:\n        if field in cls_d:\n            has_default = True\n        else:\n            if has_default:\n                raise TypeError(f\"non-default argument {field!r} follows default argument\")\n    return cls\n\ndef asdict(obj) -> dict:\n    fields = _get_annotations(type(obj))\n    obj_d = obj.__dict__\n    return {field: obj_d[field] for field in fields}";
+const char kPythonLibs_dataclasses[] = "def _get_annotations(cls: type):\n    inherits = []\n    while cls is not object:\n        inherits.append(cls)\n        cls = cls.__base__\n    inherits.reverse()\n    res = {}\n    for cls in inherits:\n        res.update(cls.__annotations__)\n    return res.keys()\n\ndef _has_default(cls_d, field):\n    # names in `__slots__` are member descriptors of the class, not default values\n    return field in cls_d and type(cls_d[field]).__name__ != 'member_descriptor'\n\ndef _wrapped__init__(self, *args, **kwargs):\n    cls = type(self)\n    cls_d = cls.__dict__\n    fields = _get_annotations(cls)\n    i = 0   # index into args\n    for field in fields:\n        if field in kwargs:\n            setattr(self, field, kwargs.pop(field))\n        else:\n            if i < len(args):\n                setattr(self, field, args[i])\n                i += 1\n            elif _has_default(cls_d, field):\n                setattr(self, field, cls_d[field])\n            else:\n                raise TypeError(f\"{cls.__name__} missing required argument {field!r}\")\n    if len(args) > i:\n        raise TypeError(f\"{cls.__name__} takes {len(fields)} positional arguments but {len(args)} were given\")\n    if len(kwargs) > 0:\n        raise TypeError(f\"{cls.__name__} got an unexpected keyword argument {next(iter(kwargs))!r}\")\n\ndef _wrapped__repr__(self):\n    fields = _get_annotations(type(self))\n    args: list = [f\"{field}={getattr(self, field)!r}\" for field in fields]\n    return f\"{type(self).__name__}({', '.join(args)})\"\n\ndef _wrapped__eq__(self, other):\n    if type(self) is not type(other):\n        return False\n    fields = _get_annotations(type(self))\n    for field in fields:\n        if getattr(self, field) != getattr(other, field):\n            return False\n    return True\n\ndef _wrapped__ne__(self, other):\n    return not self.__eq__(other)\n\ndef dataclass(cls: type):\n    assert type(cls) is type\n    cls_d = cls.__dict__\n    if '__init__' not in cls_d:\n        cls.__init__ = _wrapped__init__\n    if '__repr__' not in cls_d:\n        cls.__repr__ = _wrapped__repr__\n    if '__eq__' not in cls_d:\n        cls.__eq__ = _wrapped__eq__\n    if '__ne__' not in cls_d:\n        cls.__ne__ = _wrapped__ne__\n    fields = _get_annotations(cls)\n    has_default = False\n    for field in fields:\n        if _has_default(cls_d, field):\n            has_default = True\n        else:\n            if has_default:\n                raise TypeError(f\"non-default argument {field!r} follows default argument\")\n    return cls\n\ndef asdict(obj) -> dict:\n    fields = _get_annotations(type(obj))\n    return {field: getattr(obj, field) for field in fields}";
 const char kPythonLibs_datetime[] = "from time import localtime\nimport operator\n\nclass timedelta:\n    def __init__(self, days=0, seconds=0):\n        self.days = days\n        self.seconds = seconds\n\n    def __repr__(self):\n        return f\"datetime.timedelta(days={self.days}, seconds={self.seconds})\"\n\n    def __eq__(self, other) -> bool:\n        if not isinstance(other, timedelta):\n            return NotImplemented\n        return (self.days, self.seconds) == (other.days, other.seconds)\n\n    def __ne__(self, other) -> bool:\n        if not isinstance(other, timedelta):\n            return NotImplemented\n        return (self.days, self.seconds) != (other.days, other.seconds)\n\n\nclass date:\n    def __init__(self, year: int, month: int, day: int):\n        self.year = year\n        self.month = month\n        self.day = day\n\n    @staticmethod\n    def today():\n        t = localtime()\n        return date(t.tm_year, t.tm_mon, t.tm_mday)\n    \n    def __cmp(self, other, op):\n        if not isinstance(other, date):\n            return NotImplemented\n        if self.year != other.year:\n            return op(self.year, other.year)\n        if self.month != other.month:\n            return op(self.month, other.month)\n        return op(self.day, other.day)\n\n    def __eq__(self, other) -> bool:\n        return self.__cmp(other, operator.eq)\n    \n    def __ne__(self, other) -> bool:\n        return self.__cmp(other, operator.ne)\n\n    def __lt__(self, other: 'date') -> bool:\n        return self.__cmp(other, operator.lt)\n\n    def __le__(self, other: 'date') -> bool:\n        return self.__cmp(other, operator.le)\n\n    def __gt__(self, other: 'date') -> bool:\n        return self.__cmp(other, operator.gt)\n\n    def __ge__(self, other: 'date') -> bool:\n        return self.__cmp(other, operator.ge)\n\n    def __str__(self):\n        return f\"{self.year}-{self.month:02}-{self.day:02}\"\n\n    def __repr__(self):\n        return f\"datetime.date({self.year}, {self.month}, {self.day})\"\n\n\nclass datetime(date):\n    def __init__(self, year: int, month: int, day: int, hour: int, minute: int, second: int):\n        super().__init__(year, month, day)\n        # Validate and set hour, minute, and second\n        if not 0 <= hour <= 23:\n            raise ValueError(\"Hour must be between 0 and 23\")\n        self.hour = hour\n        if not 0 <= minute <= 59:\n            raise ValueError(\"Minute must be between 0 and 59\")\n        self.minute = minute\n        if not 0 <= second <= 59:\n            raise ValueError(\"Second must be between 0 and 59\")\n        self.second = second\n\n    def date(self) -> date:\n        return date(self.year, self.month, self.day)\n\n    @staticmethod\n    def now():\n        t = localtime()\n        tm_sec = t.tm_sec\n        if tm_sec == 60:\n            tm_sec = 59\n        return datetime(t.tm_year, t.tm_mon, t.tm_mday, t.tm_hour, t.tm_min, tm_sec)\n\n    def __str__(self):\n        return f\"{self.year}-{self.month:02}-{self.day:02} {self.hour:02}:{self.minute:02}:{self.second:02}\"\n\n    def __repr__(self):\n        return f\"datetime.datetime({self.year}, {self.month}, {self.day}, {self.hour}, {self.minute}, {self.second})\"\n\n    def __cmp(self, other, op):\n        if not isinstance(other, datetime):\n            return NotImplemented\n        if self.year != other.year:\n            return op(self.year, other.year)\n        if self.month != other.month:\n            return op(self.month, other.month)\n        if self.day != other.day:\n            return op(self.day, other.day)\n        if self.hour != other.hour:\n            return op(self.hour, other.hour)\n        if self.minute != other.minute:\n            return op(self.minute, other.minute)\n        return op(self.second, other.second)\n\n    def __eq__(self, other) -> bool:\n        return self.__cmp(other, operator.eq)\n    \n    def __ne__(self, other) -> bool:\n        return self.__cmp(other, operator.ne)\n    \n    def __lt__(self, other) -> bool:\n        return self.__cmp(other, operator.lt)\n    \n    def __le__(self, other) -> bool:\n        return self.__cmp(other, operator.le)\n    \n    def __gt__(self, other) -> bool:\n        return self.__cmp(other, operator.gt)\n    \n    def __ge__(self, other) -> bool:\n        return self.__cmp(other, operator.ge)\n\n\n";
 const char kPythonLibs_functools[] = "class cache:\n    def __init__(self, f):\n        self.f = f\n        self.cache = {}\n\n    def __call__(self, *args):\n        if args not in self.cache:\n            self.cache[args] = self.f(*args)\n        return self.cache[args]\n    \nclass lru_cache:\n    def __init__(self, maxsize=128):\n        self.maxsize = maxsize\n        self.cache = {}\n\n    def __call__(self, f):\n        def wrapped(*args):\n            if args in self.cache:\n                res = self.cache.pop(args)\n                self.cache[args] = res\n                return res\n            \n            res = f(*args)\n            if len(self.cache) >= self.maxsize:\n                first_key = next(iter(self.cache))\n                self.cache.pop(first_key)\n            self.cache[args] = res\n            return res\n        return wrapped\n    \ndef reduce(function, sequence, initial=...):\n    it = iter(sequence)\n    if initial is ...:\n        try:\n            value = next(it)\n        except StopIteration:\n            raise TypeError(\"reduce() of empty sequence with no initial value\")\n    else:\n        value = initial\n    for element in it:\n        value = function(value, element)\n    return value\n\nclass partial:\n    def __init__(self, f, *args, **kwargs):\n        self.f = f\n        if not callable(f):\n            raise TypeError(\"the first argument must be callable\")\n        self.args = args\n        self.kwargs = kwargs\n\n    def __call__(self, *args, **kwargs):\n        kwargs.update(self.kwargs)\n        return self.f(*self.args, *args, **kwargs)\n\n";
 const char kPythonLibs_heapq[] = "# Heap queue algorithm (a.k.a. priority queue)\ndef heappush(heap, item):\n    \"\"\"Push item onto heap, maintaining the heap invariant.\"\"\"\n    heap.append(item)\n    _siftdown(heap, 0, len(heap)-1)\n\ndef heappop(heap):\n    \"\"\"Pop the smallest item off the heap, maintaining the heap invariant.\"\"\"\n    lastelt = heap.pop()    # raises appropriate IndexError if heap is empty\n    if heap:\n        returnitem = heap[0]\n        heap[0] = lastelt\n        _siftup(heap, 0)\n        return returnitem\n    return lastelt\n\ndef heapreplace(heap, item):\n    \"\"\"Pop and return the current smallest value, and add the new item.\n\n    This is more efficient than heappop() followed by heappush(), and can be\n    more appropriate when using a fixed-size heap.  Note that the value\n    returned may be larger than item!  That constrains reasonable uses of\n    this routine unless written as part of a conditional replacement:\n\n        if item > heap[0]:\n            item = heapreplace(heap, item)\n    \"\"\"\n    returnitem = heap[0]    # raises appropriate IndexError if heap is empty\n    heap[0] = item\n    _siftup(heap, 0)\n    return returnitem\n\ndef heappushpop(heap, item):\n    \"\"\"Fast version of a heappush followed by a heappop.\"\"\"\n    if heap and heap[0] < item:\n        item, heap[0] = heap[0], item\n        _siftup(heap, 0)\n    return item\n\ndef heapify(x):\n    \"\"\"Transform list into a heap, in-place, in O(len(x)) time.\"\"\"\n    n = len(x)\n    # Transform bottom-up.  The largest index there's any point to looking at\n    # is the largest with a child index in-range, so must have 2*i + 1 < n,\n    # or i < (n-1)/2.  If n is even = 2*j, this is (2*j-1)/2 = j-1/2 so\n    # j-1 is the largest, which is n//2 - 1.  If n is odd = 2*j+1, this is\n    # (2*j+1-1)/2 = j so j-1 is the largest, and that's again n//2-1.\n    for i in reversed(range(n//2)):\n        _siftup(x, i)\n\n# 'heap' is a heap at all indices >= startpos, except possibly for pos.  pos\n# is the index of a leaf with a possibly out-of-order value.  Restore the\n# heap invariant.\ndef _siftdown(heap, startpos, pos):\n    newitem = heap[pos]\n    # Follow the path to the root, moving parents down until finding a place\n    # newitem fits.\n    while pos > startpos:\n        parentpos = (pos - 1) >> 1\n        parent = heap[parentpos]\n        if newitem < parent:\n            heap[pos] = parent\n            pos = parentpos\n            continue\n        break\n    heap[pos] = newitem\n\ndef _siftup(heap, pos):\n    endpos = len(heap)\n    startpos = pos\n    newitem = heap[pos]\n    # Bubble up the smaller child until hitting a leaf.\n    childpos = 2*pos + 1    # leftmost child position\n    while childpos < endpos:\n        # Set childpos to index of smaller child.\n        rightpos = childpos + 1\n        if rightpos < endpos and not heap[childpos] < heap[rightpos]:\n            childpos = rightpos\n        # Move the smaller child up.\n        heap[pos] = heap[childpos]\n        pos = childpos\n        childpos = 2*pos + 1\n    # The leaf at pos is empty now.  Put newitem there, and bubble it up\n    # to its final resting place (by sifting its parents down).\n    heap[pos] = newitem\n    _siftdown(heap, startpos, pos)";
 const char kPythonLibs_linalg[] = "from vmath import *";
 const char kPythonLibs_operator[] = "# https://docs.python.org/3/library/operator.html#mapping-operators-to-functions\n\ndef le(a, b): return a <= b\ndef lt(a, b): return a < b\ndef ge(a, b): return a >= b\ndef gt(a, b): return a > b\ndef eq(a, b): return a == b\ndef ne(a, b): return a != b\n\ndef and_(a, b): return a & b\ndef or_(a, b): return a | b\ndef xor(a, b): return a ^ b\ndef invert(a): return ~a\ndef lshift(a, b): return a << b\ndef rshift(a, b): return a >> b\n\ndef is_(a, b): return a is b\ndef is_not(a, b): return a is not b\ndef not_(a): return not a\ndef truth(a): return bool(a)\ndef contains(a, b): return b in a\n\ndef add(a, b): return a + b\ndef sub(a, b): return a - b\ndef mul(a, b): return a * b\ndef truediv(a, b): return a / b\ndef floordiv(a, b): return a // b\ndef mod(a, b): return a % b\ndef pow(a, b): return a ** b\ndef neg(a): return -a\ndef matmul(a, b): return a @ b\n\ndef getitem(a, b): return a[b]\ndef setitem(a, b, c): a[b] = c\ndef delitem(a, b): del a[b]\n\ndef iadd(a, b): a += b; return a\ndef isub(a, b): a -= b; return a\ndef imul(a, b): a *= b; return a\ndef itruediv(a, b): a /= b; return a\ndef ifloordiv(a, b): a //= b; return a\ndef imod(a, b): a %= b; return a\n# def ipow(a, b): a **= b; return a\n# def imatmul(a, b): a @= b; return a\ndef iand(a, b): a &= b; return a\ndef ior(a, b): a |= b; return a\ndef ixor(a, b): a ^= b; return a\ndef ilshift(a, b): a <<= b; return a\ndef irshift(a, b): a >>= b; return a\n";
 const char kPythonLibs_typing[] = "class _Placeholder:\n    def __init__(self, *args, **kwargs):\n        pass\n    def __getitem__(self, *args):\n        return self\n    def __call__(self, *args, **kwargs):\n        return self\n    def __and__(self, other):\n        return self\n    def __or__(self, other):\n        return self\n    def __xor__(self, other):\n        return self\n\n\n_PLACEHOLDER = _Placeholder()\n\nSequence = _PLACEHOLDER\nList = _PLACEHOLDER\nDict = _PLACEHOLDER\nTuple = _PLACEHOLDER\nSet = _PLACEHOLDER\nAny = _PLACEHOLDER\nUnion = _PLACEHOLDER\nOptional = _PLACEHOLDER\nCallable = _PLACEHOLDER\nType = _PLACEHOLDER\nTypeAlias = _PLACEHOLDER\nNewType = _PLACEHOLDER\n\nLiteral = _PLACEHOLDER\nLiteralString = _PLACEHOLDER\n\nIterable = _PLACEHOLDER\nGenerator = _PLACEHOLDER\nIterator = _PLACEHOLDER\n\nHashable = _PLACEHOLDER\n\nTypeVar = _PLACEHOLDER\nSelf = _PLACEHOLDER\n\nProtocol = object\nGeneric = object\nNever = object\n\nTYPE_CHECKING = False\n\n# decorators\noverload = lambda x: x\nfinal = lambda x: x\n\n# exhaustiveness checking\nassert_never = lambda x: x\n\nTypedDict = dict\nNotRequired = _PLACEHOLDER\n";
+static const unsigned char kPythonLibsBytecode_bisect[] = {
+    112,107,99,2,10,50,46,49,46,53,182,93,159,58,113,46,203,6,0,0,18,98,105,115,
+    101,99,116,46,112,121,76,15,188,14,224,94,17,165,220,32,18,98,105,115,101,99,116,46,
+    112,121,2,144,1,30,7,0,1,0,14,0,26,0,14,1,26,1,14,2,26,2,14,3,
+    26,3,19,1,26,4,19,0,26,5,74,5,2,0,1,2,0,1,6,0,1,6,0,1,
+    30,0,1,30,0,1,72,0,1,72,0,1,98,0,1,98,0,1,142,1,0,1,142,1,
+    0,1,144,1,0,1,144,1,0,1,144,1,0,1,0,2,5,42,66,105,115,101,99,116,
+    105,111,110,32,97,108,103,111,114,105,116,104,109,115,46,0,12,24,105,110,115,111,114,116,
+    95,114,105,103,104,116,24,98,105,115,101,99,116,95,114,105,103,104,116,22,105,110,115,111,
+    114,116,95,108,101,102,116,22,98,105,115,101,99,116,95,108,101,102,116,12,98,105,115,101,
+    99,116,12,105,110,115,111,114,116,2,0,1,0,1,1,8,24,105,110,115,111,114,116,95,
+    114,105,103,104,116,6,26,34,0,0,0,0,18,0,15,0,130,0,16,1,130,2,16,3,
+    72,4,24,2,16,0,22,1,130,2,16,1,72,2,1,0,74,5,20,0,1,20,0,1,
+    24,0,1,24,0,1,24,0,1,24,0,1,24,0,1,24,0,1,24,0,1,24,0,1,
+    26,0,1,26,0,0,26,0,1,26,0,1,26,0,1,26,0,1,26,0,1,2,2,5,
+    222,3,73,110,115,101,114,116,32,105,116,101,109,32,120,32,105,110,32,108,105,115,116,32,
+    97,44,32,97,110,100,32,107,101,101,112,32,105,116,32,115,111,114,116,101,100,32,97,115,
+    115,117,109,105,110,103,32,97,32,105,115,32,115,111,114,116,101,100,46,10,10,32,32,32,
+    32,73,102,32,120,32,105,115,32,97,108,114,101,97,100,121,32,105,110,32,97,44,32,105,
+    110,115,101,114,116,32,105,116,32,116,111,32,116,104,101,32,114,105,103,104,116,32,111,102,
+    32,116,104,101,32,114,105,103,104,116,109,111,115,116,32,120,46,10,10,32,32,32,32,79,
+    112,116,105,111,110,97,108,32,97,114,103,115,32,108,111,32,40,100,101,102,97,117,108,116,
+    32,48,41,32,97,110,100,32,104,105,32,40,100,101,102,97,117,108,116,32,108,101,110,40,
+    97,41,41,32,98,111,117,110,100,32,116,104,101,10,32,32,32,32,115,108,105,99,101,32,
+    111,102,32,97,32,116,111,32,98,101,32,115,101,97,114,99,104,101,100,46,10,32,32,32,
+    32,8,2,97,2,120,4,108,111,4,104,105,4,24,98,105,115,101,99,116,95,114,105,103,
+    104,116,12,105,110,115,101,114,116,2,0,1,0,1,1,0,4,0,2,4,4,4,108,111,
+    3,0,6,4,104,105,0,1,1,0,1,0,24,98,105,115,101,99,116,95,114,105,103,104,
+    116,30,68,94,0,0,0,0,16,2,11,0,132,55,65,6,18,0,15,0,7,1,72,1,
+    100,0,16,3,8,0,61,0,65,6,18,1,15,0,16,0,72,1,24,3,130,2,16,3,
+    132,55,65,21,130,2,16,3,42,0,11,2,46,0,24,4,130,1,16,0,16,4,23,0,
+    132,55,65,4,16,4,24,3,63,5,16,4,134,1,42,0,24,2,63,233,255,3,16,2,
+    74,0,74,5,48,0,1,48,0,1,52,0,1,52,0,1,52,0,1,52,0,1,54,0,
+    1,54,0,1,54,0,1,54,0,1,54,0,1,56,0,1,56,0,1,56,0,1,56,0,
+    1,58,0,1,58,0,1,58,0,1,58,0,1,58,0,1,60,2,1,60,2,1,60,2,
+    1,60,2,1,62,2,1,62,2,1,62,2,1,62,2,1,62,2,1,62,2,1,64,2,
+    1,64,2,1,64,2,1,64,2,1,64,2,1,64,2,1,64,2,1,64,2,1,66,2,
+    1,66,2,1,66,2,1,66,2,1,66,2,1,66,2,1,68,0,1,68,0,1,68,0,
+    1,0,4,5,128,6,82,101,116,117,114,110,32,116,104,101,32,105,110,100,101,120,32,119,
+    104,101,114,101,32,116,111,32,105,110,115,101,114,116,32,105,116,101,109,32,120,32,105,110,
+    32,108,105,115,116,32,97,44,32,97,115,115,117,109,105,110,103,32,97,32,105,115,32,115,
+    111,114,116,101,100,46,10,10,32,32,32,32,84,104,101,32,114,101,116,117,114,110,32,118,
+    97,108,117,101,32,105,32,105,115,32,115,117,99,104,32,116,104,97,116,32,97,108,108,32,
+    101,32,105,110,32,97,91,58,105,93,32,104,97,118,101,32,101,32,60,61,32,120,44,32,
+    97,110,100,32,97,108,108,32,101,32,105,110,10,32,32,32,32,97,91,105,58,93,32,104,
+    97,118,101,32,101,32,62,32,120,46,32,32,83,111,32,105,102,32,120,32,97,108,114,101,
+    97,100,121,32,97,112,112,101,97,114,115,32,105,110,32,116,104,101,32,108,105,115,116,44,
+    32,97,46,105,110,115,101,114,116,40,120,41,32,119,105,108,108,10,32,32,32,32,105,110,
+    115,101,114,116,32,106,117,115,116,32,97,102,116,101,114,32,116,104,101,32,114,105,103,104,
+    116,109,111,115,116,32,120,32,97,108,114,101,97,100,121,32,116,104,101,114,101,46,10,10,
+    32,32,32,32,79,112,116,105,111,110,97,108,32,97,114,103,115,32,108,111,32,40,100,101,
+    102,97,117,108,116,32,48,41,32,97,110,100,32,104,105,32,40,100,101,102,97,117,108,116,
+    32,108,101,110,40,97,41,41,32,98,111,117,110,100,32,116,104,101,10,32,32,32,32,115,
+    108,105,99,101,32,111,102,32,97,32,116,111,32,98,101,32,115,101,97,114,99,104,101,100,
+    46,10,32,32,32,32,5,46,108,111,32,109,117,115,116,32,98,101,32,110,111,110,45,110,
+    101,103,97,116,105,118,101,10,2,97,2,120,4,108,111,4,104,105,6,109,105,100,4,20,
+    86,97,108,117,101,69,114,114,111,114,6,108,101,110,4,0,1,0,1,1,1,0,40,88,
+    1,0,4,0,2,4,4,4,108,111,3,0,6,4,104,105,0,1,1,0,1,0,22,105,
+    110,115,111,114,116,95,108,101,102,116,72,92,34,0,0,0,0,18,0,15,0,130,0,16,
+    1,130,2,16,3,72,4,24,2,16,0,22,1,130,2,16,1,72,2,1,0,74,5,86,
+    0,1,86,0,1,90,0,1,90,0,1,90,0,1,90,0,1,90,0,1,90,0,1,90,
+    0,1,90,0,1,92,0,1,92,0,0,92,0,1,92,0,1,92,0,1,92,0,1,92,
+    0,1,2,2,5,218,3,73,110,115,101,114,116,32,105,116,101,109,32,120,32,105,110,32,
+    108,105,115,116,32,97,44,32,97,110,100,32,107,101,101,112,32,105,116,32,115,111,114,116,
+    101,100,32,97,115,115,117,109,105,110,103,32,97,32,105,115,32,115,111,114,116,101,100,46,
+    10,10,32,32,32,32,73,102,32,120,32,105,115,32,97,108,114,101,97,100,121,32,105,110,
+    32,97,44,32,105,110,115,101,114,116,32,105,116,32,116,111,32,116,104,101,32,108,101,102,
+    116,32,111,102,32,116,104,101,32,108,101,102,116,109,111,115,116,32,120,46,10,10,32,32,
+    32,32,79,112,116,105,111,110,97,108,32,97,114,103,115,32,108,111,32,40,100,101,102,97,
+    117,108,116,32,48,41,32,97,110,100,32,104,105,32,40,100,101,102,97,117,108,116,32,108,
+    101,110,40,97,41,41,32,98,111,117,110,100,32,116,104,101,10,32,32,32,32,115,108,105,
+    99,101,32,111,102,32,97,32,116,111,32,98,101,32,115,101,97,114,99,104,101,100,46,10,
+    32,32,32,32,8,2,97,2,120,4,108,111,4,104,105,4,22,98,105,115,101,99,116,95,
+    108,101,102,116,12,105,110,115,101,114,116,2,0,1,0,1,1,0,4,0,2,4,4,4,
+    108,111,3,0,6,4,104,105,0,1,1,0,1,0,22,98,105,115,101,99,116,95,108,101,
+    102,116,98,136,1,94,0,0,0,0,16,2,11,0,132,55,65,6,18,0,15,0,7,1,
+    72,1,100,0,16,3,8,0,61,0,65,6,18,1,15,0,16,0,72,1,24,3,130,2,
+    16,3,132,55,65,21,130,2,16,3,42,0,11,2,46,0,24,4,130,0,16,4,23,0,
+    16,1,132,55,65,6,16,4,134,1,42,0,24,2,63,3,16,4,24,3,63,233,255,3,
+    16,2,74,0,74,5,116,0,1,116,0,1,120,0,1,120,0,1,120,0,1,120,0,1,
+    122,0,1,122,0,1,122,0,1,122,0,1,122,0,1,124,0,1,124,0,1,124,0,1,
+    124,0,1,126,0,1,126,0,1,126,0,1,126,0,1,126,0,1,128,1,2,1,128,1,
+    2,1,128,1,2,1,128,1,2,1,130,1,2,1,130,1,2,1,130,1,2,1,130,1,
+    2,1,130,1,2,1,130,1,2,1,132,1,2,1,132,1,2,1,132,1,2,1,132,1,
+    2,1,132,1,2,1,132,1,2,1,132,1,2,1,132,1,2,1,132,1,2,1,132,1,
+    2,1,134,1,2,1,134,1,2,1,134,1,2,1,134,1,2,1,136,1,0,1,136,1,
+    0,1,136,1,0,1,0,4,5,128,6,82,101,116,117,114,110,32,116,104,101,32,105,110,
+    100,101,120,32,119,104,101,114,101,32,116,111,32,105,110,115,101,114,116,32,105,116,101,109,
+    32,120,32,105,110,32,108,105,115,116,32,97,44,32,97,115,115,117,109,105,110,103,32,97,
+    32,105,115,32,115,111,114,116,101,100,46,10,10,32,32,32,32,84,104,101,32,114,101,116,
+    117,114,110,32,118,97,108,117,101,32,105,32,105,115,32,115,117,99,104,32,116,104,97,116,
+    32,97,108,108,32,101,32,105,110,32,97,91,58,105,93,32,104,97,118,101,32,101,32,60,
+    32,120,44,32,97,110,100,32,97,108,108,32,101,32,105,110,10,32,32,32,32,97,91,105,
+    58,93,32,104,97,118,101,32,101,32,62,61,32,120,46,32,32,83,111,32,105,102,32,120,
+    32,97,108,114,101,97,100,121,32,97,112,112,101,97,114,115,32,105,110,32,116,104,101,32,
+    108,105,115,116,44,32,97,46,105,110,115,101,114,116,40,120,41,32,119,105,108,108,10,32,
+    32,32,32,105,110,115,101,114,116,32,106,117,115,116,32,98,101,102,111,114,101,32,116,104,
+    101,32,108,101,102,116,109,111,115,116,32,120,32,97,108,114,101,97,100,121,32,116,104,101,
+    114,101,46,10,10,32,32,32,32,79,112,116,105,111,110,97,108,32,97,114,103,115,32,108,
+    111,32,40,100,101,102,97,117,108,116,32,48,41,32,97,110,100,32,104,105,32,40,100,101,
+    102,97,117,108,116,32,108,101,110,40,97,41,41,32,98,111,117,110,100,32,116,104,101,10,
+    32,32,32,32,115,108,105,99,101,32,111,102,32,97,32,116,111,32,98,101,32,115,101,97,
+    114,99,104,101,100,46,10,32,32,32,32,5,46,108,111,32,109,117,115,116,32,98,101,32,
+    110,111,110,45,110,101,103,97,116,105,118,101,10,2,97,2,120,4,108,111,4,104,105,6,
+    109,105,100,4,20,86,97,108,117,101,69,114,114,111,114,6,108,101,110,4,0,1,0,1,
+    1,1,0,40,88,1,0,4,0,2,4,4,4,108,111,3,0,6,4,104,105,0,1,1,
+    0,1,0,
+};
+static const unsigned char kPythonLibsBytecode_builtins[] = {
+    112,107,99,2,10,50,46,49,46,53,182,93,159,58,113,46,203,6,0,0,20,60,98,117,
+    105,108,116,105,110,115,62,115,1,120,69,22,152,235,132,130,12,20,60,98,117,105,108,116,
+    105,110,115,62,2,54,14,14,0,26,0,14,1,26,1,14,2,26,2,74,5,2,0,1,
+    2,0,1,16,0,1,16,0,1,24,0,1,24,0,1,24,0,1,0,0,0,6,8,104,
+    101,108,112,14,99,111,109,112,108,101,120,6,100,105,114,2,0,1,0,1,1,6,8,104,
+    101,108,112,2,12,38,18,0,15,0,16,0,7,0,72,2,65,4,131,0,20,1,24,0,
+    131,0,20,2,65,7,18,3,15,0,131,0,20,2,72,1,1,0,74,5,4,0,1,4,
+    0,1,4,0,1,4,0,1,4,0,1,4,0,1,6,0,1,6,0,0,6,0,1,10,
+    0,1,10,0,2,10,0,1,12,0,1,12,0,1,12,0,1,12,0,4,12,0,1,12,
+    0,1,12,0,1,6,2,5,16,95,95,102,117,110,99,95,95,2,6,111,98,106,8,14,
+    104,97,115,97,116,116,114,16,95,95,102,117,110,99,95,95,14,95,95,100,111,99,95,95,
+    10,112,114,105,110,116,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,14,99,111,
+    109,112,108,101,120,16,20,18,86,0,24,2,16,2,22,0,130,0,16,1,72,2,74,0,
+    74,5,18,0,1,18,0,1,20,0,1,20,0,0,20,0,1,20,0,1,20,0,1,20,
+    0,1,20,0,1,2,2,5,10,99,109,97,116,104,6,8,114,101,97,108,8,105,109,97,
+    103,10,99,109,97,116,104,2,14,99,111,109,112,108,101,120,2,0,1,0,1,1,0,2,
+    0,2,2,8,105,109,97,103,3,0,1,1,0,1,1,6,100,105,114,24,54,208,1,18,
+    0,15,0,18,1,15,0,7,0,72,1,72,1,24,1,18,2,15,0,130,0,16,1,72,
+    2,65,15,37,0,131,0,20,3,22,4,72,0,84,0,85,7,88,2,24,2,24,3,16,
+    3,77,0,63,250,255,3,74,0,18,5,15,0,72,0,24,4,18,2,15,0,16,0,18,
+    0,72,2,81,0,65,30,131,0,20,3,24,5,16,5,8,0,61,1,65,17,16,4,22,
+    6,37,0,16,5,22,4,72,0,84,0,85,7,88,2,24,2,24,3,16,3,77,0,63,
+    250,255,3,72,1,1,0,18,0,15,0,16,0,72,1,24,6,63,3,16,0,24,6,16,
+    6,8,0,61,1,65,22,16,4,22,6,37,0,131,6,20,3,22,4,72,0,84,0,85,
+    7,88,2,24,2,24,3,16,3,77,0,63,250,255,3,72,1,1,0,131,6,20,7,24,
+    6,63,232,255,3,18,8,15,0,18,9,15,0,16,4,72,1,72,1,74,0,74,5,26,
+    0,1,26,0,1,26,0,1,26,0,1,26,0,1,26,0,1,26,0,1,26,0,1,28,
+    0,1,28,0,1,28,0,1,28,0,1,28,0,1,28,0,1,30,0,1,30,0,1,30,
+    0,0,30,0,2,30,0,1,30,0,1,30,2,1,30,2,1,30,2,1,30,2,1,30,
+    2,1,30,2,1,30,2,1,30,0,1,32,0,1,32,0,1,32,0,1,32,0,1,34,
+    0,1,34,0,1,34,0,1,34,0,1,34,0,1,34,0,1,34,0,1,36,0,1,36,
+    0,4,36,0,1,38,0,1,38,0,1,38,0,1,38,0,1,40,0,1,40,0,6,40,
+    0,1,40,0,1,40,0,8,40,0,1,40,0,1,40,4,1,40,4,1,40,4,1,40,
+    4,1,40,4,1,40,4,1,40,4,1,40,0,1,40,0,1,42,0,1,42,0,1,42,
+    0,1,42,0,1,42,0,1,44,0,1,46,0,1,46,0,1,48,6,1,48,6,1,48,
+    6,1,48,6,1,50,6,1,50,6,10,50,6,1,50,6,1,50,6,12,50,6,14,50,
+    6,1,50,6,1,50,8,1,50,8,1,50,8,1,50,8,1,50,8,1,50,8,1,50,
+    8,1,50,6,1,50,6,1,52,6,1,52,6,16,52,6,1,52,6,1,54,0,1,54,
+    0,1,54,0,1,54,0,1,54,0,1,54,0,1,54,0,1,54,0,1,54,0,1,18,
+    2,5,8,109,97,116,104,14,6,111,98,106,18,116,112,95,109,111,100,117,108,101,2,95,
+    2,107,10,110,97,109,101,115,10,111,98,106,95,100,6,99,108,115,20,8,116,121,112,101,
+    20,95,95,105,109,112,111,114,116,95,95,20,105,115,105,110,115,116,97,110,99,101,16,95,
+    95,100,105,99,116,95,95,10,105,116,101,109,115,6,115,101,116,12,117,112,100,97,116,101,
+    16,95,95,98,97,115,101,95,95,12,115,111,114,116,101,100,8,108,105,115,116,10,0,1,
+    0,1,1,3,0,40,54,1,3,0,106,120,1,1,0,140,1,190,1,1,3,6,164,1,
+    178,1,1,0,2,0,0,1,1,0,2,1,
+};
+static const unsigned char kPythonLibsBytecode_cmath[] = {
+    112,107,99,2,10,50,46,49,46,53,182,93,159,58,113,46,203,6,0,0,16,99,109,97,
+    116,104,46,112,121,247,32,250,96,146,139,182,30,232,79,16,99,109,97,116,104,46,112,121,
+    2,246,2,252,1,86,0,26,0,8,0,90,1,14,0,92,2,14,1,21,3,4,0,15,
+    0,4,0,72,1,92,4,14,2,21,3,4,0,15,0,4,0,72,1,92,5,14,3,92,
+    6,14,4,92,7,14,5,92,8,14,6,92,9,14,7,92,10,14,8,92,11,14,9,92,
+    12,14,10,92,13,14,11,92,14,14,12,92,15,14,13,92,16,14,14,92,17,14,15,92,
+    18,14,16,92,19,14,17,92,20,91,1,14,18,26,21,14,19,26,22,14,20,26,23,14,
+    21,26,24,14,22,26,25,14,23,26,26,14,24,26,27,14,25,26,28,14,26,26,29,14,
+    27,26,30,14,28,26,31,14,29,26,32,14,30,26,33,14,31,26,34,14,32,26,35,14,
+    33,26,36,14,34,26,37,14,35,26,38,14,36,26,39,14,37,26,40,14,38,26,41,14,
+    39,26,42,14,40,26,43,19,0,20,44,26,44,19,0,20,45,26,45,11,2,19,44,44,
+    0,26,46,19,0,20,47,26,47,19,1,15,0,11,0,19,47,72,2,26,48,19,0,20,
+    49,26,49,19,1,15,0,11,0,19,49,72,2,26,50,74,5,2,0,1,2,0,1,6,
+    0,1,6,0,1,8,0,1,8,0,1,18,0,1,16,0,1,16,0,1,16,0,1,16,
+    0,1,16,0,1,18,0,1,26,0,1,24,0,1,24,0,1,24,0,1,24,0,1,24,
+    0,1,26,0,1,32,0,1,32,0,1,38,0,1,38,0,1,52,0,1,52,0,1,66,
+    0,1,66,0,1,78,0,1,78,0,1,92,0,1,92,0,1,98,0,1,98,0,1,112,
+    0,1,112,0,1,126,0,1,126,0,1,142,1,0,1,142,1,0,1,148,1,0,1,148,
+    1,0,1,168,1,0,1,168,1,0,1,180,1,0,1,180,1,0,1,186,1,0,1,186,
+    1,0,1,192,1,0,1,192,1,0,1,192,1,0,1,204,1,0,1,204,1,0,1,210,
+    1,0,1,210,1,0,1,216,1,0,1,216,1,0,1,226,1,0,1,226,1,0,1,232,
+    1,0,1,232,1,0,1,238,1,0,1,238,1,0,1,244,1,0,1,244,1,0,1,254,
+    1,0,1,254,1,0,1,132,2,0,1,132,2,0,1,138,2,0,1,138,2,0,1,144,
+    2,0,1,144,2,0,1,150,2,0,1,150,2,0,1,156,2,0,1,156,2,0,1,166,
+    2,0,1,166,2,0,1,172,2,0,1,172,2,0,1,178,2,0,1,178,2,0,1,184,
+    2,0,1,184,2,0,1,190,2,0,1,190,2,0,1,196,2,0,1,196,2,0,1,206,
+    2,0,1,206,2,0,1,212,2,0,1,212,2,0,1,218,2,0,1,218,2,0,1,224,
+    2,0,1,224,2,0,1,234,2,0,1,234,2,0,0,234,2,0,1,236,2,0,1,236,
+    2,0,2,236,2,0,1,238,2,0,1,238,2,0,1,238,2,0,1,238,2,0,1,240,
+    2,0,1,240,2,0,4,240,2,0,1,242,2,0,1,242,2,0,1,242,2,0,1,242,
+    2,0,1,242,2,0,1,242,2,0,1,244,2,0,1,244,2,0,6,244,2,0,1,246,
+    2,0,1,246,2,0,1,246,2,0,1,246,2,0,1,246,2,0,1,246,2,0,1,246,
+    2,0,1,8,2,5,8,109,97,116,104,0,102,8,109,97,116,104,14,99,111,109,112,108,
+    101,120,16,95,95,105,110,105,116,95,95,16,112,114,111,112,101,114,116,121,8,114,101,97,
+    108,8,105,109,97,103,18,99,111,110,106,117,103,97,116,101,16,95,95,114,101,112,114,95,
+    95,12,95,95,101,113,95,95,12,95,95,110,101,95,95,14,95,95,97,100,100,95,95,16,
+    95,95,114,97,100,100,95,95,14,95,95,115,117,98,95,95,16,95,95,114,115,117,98,95,
+    95,14,95,95,109,117,108,95,95,16,95,95,114,109,117,108,95,95,22,95,95,116,114,117,
+    101,100,105,118,95,95,14,95,95,112,111,119,95,95,14,95,95,97,98,115,95,95,14,95,
+    95,110,101,103,95,95,16,95,95,104,97,115,104,95,95,10,112,104,97,115,101,10,112,111,
+    108,97,114,8,114,101,99,116,6,101,120,112,6,108,111,103,10,108,111,103,49,48,8,115,
+    113,114,116,8,97,99,111,115,8,97,115,105,110,8,97,116,97,110,6,99,111,115,6,115,
+    105,110,6,116,97,110,10,97,99,111,115,104,10,97,115,105,110,104,10,97,116,97,110,104,
+    8,99,111,115,104,8,115,105,110,104,8,116,97,110,104,16,105,115,102,105,110,105,116,101,
+    10,105,115,105,110,102,10,105,115,110,97,110,14,105,115,99,108,111,115,101,4,112,105,2,
+    101,6,116,97,117,6,105,110,102,8,105,110,102,106,6,110,97,110,8,110,97,110,106,2,
+    0,1,0,1,1,82,16,95,95,105,110,105,116,95,95,8,12,26,18,0,15,0,16,1,
+    72,1,16,0,27,1,18,0,15,0,16,2,72,1,16,0,27,2,74,5,10,0,1,10,
+    0,1,10,0,1,10,0,1,10,0,1,10,0,0,12,0,1,12,0,1,12,0,1,12,
+    0,1,12,0,1,12,0,2,12,0,1,4,0,6,8,115,101,108,102,8,114,101,97,108,
+    8,105,109,97,103,6,10,102,108,111,97,116,10,95,114,101,97,108,10,95,105,109,97,103,
+    2,0,1,0,1,1,0,4,0,2,2,4,8,105,109,97,103,3,0,1,1,0,1,1,
+    8,114,101,97,108,18,20,8,131,0,20,0,74,0,74,5,20,0,1,20,0,0,20,0,
+    1,20,0,1,2,0,2,8,115,101,108,102,2,10,95,114,101,97,108,2,0,1,0,1,
+    1,0,2,0,0,1,1,0,2,1,8,105,109,97,103,26,28,8,131,0,20,0,74,0,
+    74,5,28,0,1,28,0,0,28,0,1,28,0,1,2,0,2,8,115,101,108,102,2,10,
+    95,105,109,97,103,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,18,99,111,110,
+    106,117,103,97,116,101,32,34,20,18,0,15,0,131,0,20,1,131,0,20,2,80,0,72,
+    2,74,0,74,5,34,0,1,34,0,1,34,0,1,34,0,0,34,0,1,34,0,2,34,
+    0,1,34,0,1,34,0,1,34,0,1,4,0,2,8,115,101,108,102,6,14,99,111,109,
+    112,108,101,120,8,114,101,97,108,8,105,109,97,103,2,0,1,0,1,1,0,2,0,0,
+    1,1,0,2,1,16,95,95,114,101,112,114,95,95,38,48,86,7,0,18,0,15,0,131,
+    0,20,1,72,1,37,2,24,1,16,1,22,2,131,0,20,3,11,0,132,55,65,3,7,
+    1,63,2,7,2,72,1,1,0,16,1,22,2,18,0,15,0,18,4,15,0,131,0,20,
+    3,72,1,72,1,72,1,1,0,16,1,22,2,7,3,72,1,1,0,7,4,22,5,16,
+    1,72,1,74,0,74,5,40,0,1,40,0,1,40,0,1,40,0,1,40,0,0,40,0,
+    1,40,0,1,40,0,1,42,0,1,42,0,2,42,0,1,42,0,4,42,0,1,42,0,
+    1,42,0,1,42,0,1,42,0,1,42,0,1,42,0,1,42,0,1,44,0,1,44,0,
+    6,44,0,1,44,0,1,44,0,1,44,0,1,44,0,1,44,0,8,44,0,1,44,0,
+    1,44,0,1,44,0,1,46,0,1,46,0,10,46,0,1,46,0,1,46,0,1,48,0,
+    1,48,0,12,48,0,1,48,0,1,48,0,1,48,0,1,14,10,5,2,40,5,2,45,
+    5,2,43,5,4,106,41,5,0,4,8,115,101,108,102,2,115,12,6,115,116,114,8,114,
+    101,97,108,12,97,112,112,101,110,100,8,105,109,97,103,6,97,98,115,8,106,111,105,110,
+    2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,12,95,95,101,113,95,95,52,62,
+    82,18,0,15,0,16,1,72,1,18,1,61,0,65,13,131,0,20,2,131,1,20,2,57,
+    0,68,6,131,0,20,3,131,1,20,3,57,0,74,0,18,4,18,5,36,2,18,0,15,
+    0,16,1,72,1,62,0,65,11,131,0,20,2,16,1,57,0,68,5,131,0,20,3,11,
+    0,57,0,74,0,18,6,74,0,74,5,54,0,1,54,0,1,54,0,1,54,0,1,54,
+    0,1,54,0,1,54,0,1,56,0,1,56,0,0,56,0,1,56,0,2,56,0,1,56,
+    0,1,56,0,1,56,0,4,56,0,1,56,0,6,56,0,1,56,0,1,58,0,1,58,
+    0,1,58,0,1,58,0,1,58,0,1,58,0,1,58,0,1,58,0,1,58,0,1,60,
+    0,1,60,0,8,60,0,1,60,0,1,60,0,1,60,0,1,60,0,10,60,0,1,60,
+    0,1,60,0,1,62,0,1,62,0,1,62,0,1,12,0,4,8,115,101,108,102,10,111,
+    116,104,101,114,14,8,116,121,112,101,14,99,111,109,112,108,101,120,8,114,101,97,108,8,
+    105,109,97,103,6,105,110,116,10,102,108,111,97,116,28,78,111,116,73,109,112,108,101,109,
+    101,110,116,101,100,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,12,95,95,
+    110,101,95,95,66,74,28,130,0,16,1,57,0,24,2,16,2,18,0,61,0,65,3,16,
+    2,74,0,16,2,81,0,74,0,74,5,68,0,1,68,0,1,68,0,1,68,0,1,70,
+    0,1,70,0,1,70,0,1,70,0,1,72,0,1,72,0,1,74,0,1,74,0,1,74,
+    0,1,74,0,1,0,0,6,8,115,101,108,102,10,111,116,104,101,114,6,114,101,115,2,
+    28,78,111,116,73,109,112,108,101,109,101,110,116,101,100,2,0,1,0,1,1,0,4,0,
+    2,0,1,1,0,2,1,14,95,95,97,100,100,95,95,78,88,86,18,0,15,0,16,1,
+    72,1,18,1,61,0,65,15,18,1,15,0,131,0,20,2,131,1,20,2,42,0,131,0,
+    20,3,131,1,20,3,42,0,72,2,74,0,18,4,18,5,36,2,18,0,15,0,16,1,
+    72,1,62,0,65,11,18,1,15,0,131,0,20,2,16,1,42,0,131,0,20,3,72,2,
+    74,0,18,6,74,0,74,5,80,0,1,80,0,1,80,0,1,80,0,1,80,0,1,80,
+    0,1,80,0,1,82,0,1,82,0,1,82,0,1,82,0,0,82,0,1,82,0,2,82,
+    0,1,82,0,1,82,0,4,82,0,1,82,0,6,82,0,1,82,0,1,82,0,1,84,
+    0,1,84,0,1,84,0,1,84,0,1,84,0,1,84,0,1,84,0,1,84,0,1,84,
+    0,1,86,0,1,86,0,1,86,0,1,86,0,8,86,0,1,86,0,1,86,0,1,86,
+    0,10,86,0,1,86,0,1,88,0,1,88,0,1,88,0,1,12,0,4,8,115,101,108,
+    102,10,111,116,104,101,114,14,8,116,121,112,101,14,99,111,109,112,108,101,120,8,114,101,
+    97,108,8,105,109,97,103,6,105,110,116,10,102,108,111,97,116,28,78,111,116,73,109,112,
+    108,101,109,101,110,116,101,100,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,
+    16,95,95,114,97,100,100,95,95,92,94,12,16,0,22,0,16,1,72,1,74,0,74,5,
+    94,0,1,94,0,0,94,0,1,94,0,1,94,0,1,94,0,1,2,0,4,8,115,101,
+    108,102,10,111,116,104,101,114,2,14,95,95,97,100,100,95,95,2,0,1,0,1,1,0,
+    4,0,2,0,1,1,0,2,1,14,95,95,115,117,98,95,95,98,108,86,18,0,15,0,
+    16,1,72,1,18,1,61,0,65,15,18,1,15,0,131,0,20,2,131,1,20,2,43,0,
+    131,0,20,3,131,1,20,3,43,0,72,2,74,0,18,4,18,5,36,2,18,0,15,0,
+    16,1,72,1,62,0,65,11,18,1,15,0,131,0,20,2,16,1,43,0,131,0,20,3,
+    72,2,74,0,18,6,74,0,74,5,100,0,1,100,0,1,100,0,1,100,0,1,100,0,
+    1,100,0,1,100,0,1,102,0,1,102,0,1,102,0,1,102,0,0,102,0,1,102,0,
+    2,102,0,1,102,0,1,102,0,4,102,0,1,102,0,6,102,0,1,102,0,1,102,0,
+    1,104,0,1,104,0,1,104,0,1,104,0,1,104,0,1,104,0,1,104,0,1,104,0,
+    1,104,0,1,106,0,1,106,0,1,106,0,1,106,0,8,106,0,1,106,0,1,106,0,
+    1,106,0,10,106,0,1,106,0,1,108,0,1,108,0,1,108,0,1,12,0,4,8,115,
+    101,108,102,10,111,116,104,101,114,14,8,116,121,112,101,14,99,111,109,112,108,101,120,8,
+    114,101,97,108,8,105,109,97,103,6,105,110,116,10,102,108,111,97,116,28,78,111,116,73,
+    109,112,108,101,109,101,110,116,101,100,2,0,1,0,1,1,0,4,0,2,0,1,1,0,
+    2,1,16,95,95,114,115,117,98,95,95,112,122,88,18,0,15,0,16,1,72,1,18,1,
+    61,0,65,15,18,1,15,0,131,1,20,2,131,0,20,2,43,0,131,1,20,3,131,0,
+    20,3,43,0,72,2,74,0,18,4,18,5,36,2,18,0,15,0,16,1,72,1,62,0,
+    65,12,18,1,15,0,130,1,16,0,20,2,43,0,131,0,20,3,80,0,72,2,74,0,
+    18,6,74,0,74,5,114,0,1,114,0,1,114,0,1,114,0,1,114,0,1,114,0,1,
+    114,0,1,116,0,1,116,0,1,116,0,1,116,0,0,116,0,1,116,0,2,116,0,1,
+    116,0,1,116,0,4,116,0,1,116,0,6,116,0,1,116,0,1,116,0,1,118,0,1,
+    118,0,1,118,0,1,118,0,1,118,0,1,118,0,1,118,0,1,118,0,1,118,0,1,
+    120,0,1,120,0,1,120,0,1,120,0,1,120,0,8,120,0,1,120,0,1,120,0,10,
+    120,0,1,120,0,1,120,0,1,122,0,1,122,0,1,122,0,1,12,0,4,8,115,101,
+    108,102,10,111,116,104,101,114,14,8,116,121,112,101,14,99,111,109,112,108,101,120,8,114,
+    101,97,108,8,105,109,97,103,6,105,110,116,10,102,108,111,97,116,28,78,111,116,73,109,
+    112,108,101,109,101,110,116,101,100,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,
+    1,14,95,95,109,117,108,95,95,126,138,1,114,18,0,15,0,16,1,72,1,18,1,61,
+    0,65,27,18,1,15,0,131,0,20,2,131,1,20,2,44,0,131,0,20,3,131,1,20,
+    3,44,0,43,0,131,0,20,2,131,1,20,3,44,0,131,0,20,3,131,1,20,2,44,
+    0,42,0,72,2,74,0,18,4,18,5,36,2,18,0,15,0,16,1,72,1,62,0,65,
+    13,18,1,15,0,131,0,20,2,16,1,44,0,131,0,20,3,16,1,44,0,72,2,74,
+    0,18,6,74,0,74,5,128,1,0,1,128,1,0,1,128,1,0,1,128,1,0,1,128,
+    1,0,1,128,1,0,1,128,1,0,1,130,1,0,1,130,1,0,1,130,1,0,1,130,
+    1,0,0,130,1,0,1,130,1,0,2,130,1,0,1,130,1,0,1,130,1,0,4,130,
+    1,0,1,130,1,0,6,130,1,0,1,130,1,0,1,132,1,0,1,132,1,0,8,132,
+    1,0,1,132,1,0,10,132,1,0,1,132,1,0,1,132,1,0,12,132,1,0,1,132,
+    1,0,14,132,1,0,1,132,1,0,1,130,1,0,1,130,1,0,1,134,1,0,1,134,
+    1,0,1,134,1,0,1,134,1,0,1,134,1,0,1,134,1,0,1,134,1,0,1,134,
+    1,0,1,134,1,0,1,136,1,0,1,136,1,0,1,136,1,0,1,136,1,0,16,136,
+    1,0,1,136,1,0,1,136,1,0,1,136,1,0,18,136,1,0,1,136,1,0,1,136,
+    1,0,1,136,1,0,1,138,1,0,1,138,1,0,1,138,1,0,1,20,0,4,8,115,
+    101,108,102,10,111,116,104,101,114,14,8,116,121,112,101,14,99,111,109,112,108,101,120,8,
+    114,101,97,108,8,105,109,97,103,6,105,110,116,10,102,108,111,97,116,28,78,111,116,73,
+    109,112,108,101,109,101,110,116,101,100,2,0,1,0,1,1,0,4,0,2,0,1,1,0,
+    2,1,16,95,95,114,109,117,108,95,95,142,1,144,1,12,16,0,22,0,16,1,72,1,
+    74,0,74,5,144,1,0,1,144,1,0,0,144,1,0,1,144,1,0,1,144,1,0,1,
+    144,1,0,1,2,0,4,8,115,101,108,102,10,111,116,104,101,114,2,14,95,95,109,117,
+    108,95,95,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,22,95,95,116,114,
+    117,101,100,105,118,95,95,148,1,164,1,150,1,18,0,15,0,16,1,72,1,18,1,61,
+    0,65,45,131,1,20,2,11,2,48,0,131,1,20,3,11,2,48,0,42,0,24,2,131,
+    0,20,2,131,1,20,2,44,0,131,0,20,3,131,1,20,3,44,0,42,0,16,2,45,
+    0,24,3,131,0,20,3,131,1,20,2,44,0,131,0,20,2,131,1,20,3,44,0,43,
+    0,16,2,45,0,24,4,18,1,15,0,130,3,16,4,72,2,74,0,18,4,18,5,36,
+    2,18,0,15,0,16,1,72,1,62,0,65,13,18,1,15,0,131,0,20,2,16,1,45,
+    0,131,0,20,3,16,1,45,0,72,2,74,0,18,6,74,0,74,5,150,1,0,1,150,
+    1,0,1,150,1,0,1,150,1,0,1,150,1,0,1,150,1,0,1,150,1,0,1,152,
+    1,0,1,152,1,0,0,152,1,0,1,152,1,0,1,152,1,0,1,152,1,0,2,152,
+    1,0,1,152,1,0,1,152,1,0,1,152,1,0,1,154,1,0,1,154,1,0,4,154,
+    1,0,1,154,1,0,6,154,1,0,1,154,1,0,1,154,1,0,8,154,1,0,1,154,
+    1,0,10,154,1,0,1,154,1,0,1,154,1,0,1,154,1,0,1,154,1,0,1,156,
+    1,0,1,156,1,0,12,156,1,0,1,156,1,0,14,156,1,0,1,156,1,0,1,156,
+    1,0,16,156,1,0,1,156,1,0,18,156,1,0,1,156,1,0,1,156,1,0,1,156,
+    1,0,1,156,1,0,1,158,1,0,1,158,1,0,1,158,1,0,1,158,1,0,1,158,
+    1,0,1,158,1,0,1,160,1,0,1,160,1,0,1,160,1,0,1,160,1,0,1,160,
+    1,0,1,160,1,0,1,160,1,0,1,160,1,0,1,160,1,0,1,162,1,0,1,162,
+    1,0,1,162,1,0,1,162,1,0,20,162,1,0,1,162,1,0,1,162,1,0,1,162,
+    1,0,22,162,1,0,1,162,1,0,1,162,1,0,1,162,1,0,1,164,1,0,1,164,
+    1,0,1,164,1,0,1,24,0,10,8,115,101,108,102,10,111,116,104,101,114,22,100,101,
+    110,111,109,105,110,97,116,111,114,18,114,101,97,108,95,112,97,114,116,18,105,109,97,103,
+    95,112,97,114,116,14,8,116,121,112,101,14,99,111,109,112,108,101,120,8,114,101,97,108,
+    8,105,109,97,103,6,105,110,116,10,102,108,111,97,116,28,78,111,116,73,109,112,108,101,
+    109,101,110,116,101,100,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,14,95,
+    95,112,111,119,95,95,168,1,176,1,92,18,0,18,1,36,2,18,2,15,0,16,1,72,
+    1,62,0,65,35,18,3,15,0,16,0,22,4,72,0,16,1,48,0,18,5,22,6,16,
+    1,18,7,15,0,16,0,72,1,44,0,72,1,44,0,16,0,22,4,72,0,16,1,48,
+    0,18,5,22,8,16,1,18,7,15,0,16,0,72,1,44,0,72,1,44,0,72,2,74,
+    0,18,9,74,0,74,5,170,1,0,1,170,1,0,1,170,1,0,1,170,1,0,1,170,
+    1,0,1,170,1,0,1,170,1,0,1,170,1,0,1,170,1,0,1,172,1,0,1,172,
+    1,0,1,172,1,0,1,172,1,0,0,172,1,0,1,172,1,0,1,172,1,0,1,172,
+    1,0,1,172,1,0,2,172,1,0,1,172,1,0,1,172,1,0,1,172,1,0,1,172,
+    1,0,1,172,1,0,1,172,1,0,1,172,1,0,1,174,1,0,1,174,1,0,4,174,
+    1,0,1,174,1,0,1,174,1,0,1,174,1,0,1,174,1,0,6,174,1,0,1,174,
+    1,0,1,174,1,0,1,174,1,0,1,174,1,0,1,174,1,0,1,174,1,0,1,174,
+    1,0,1,172,1,0,1,172,1,0,1,176,1,0,1,176,1,0,1,176,1,0,1,8,
+    0,4,8,115,101,108,102,10,111,116,104,101,114,20,6,105,110,116,10,102,108,111,97,116,
+    8,116,121,112,101,14,99,111,109,112,108,101,120,14,95,95,97,98,115,95,95,8,109,97,
+    116,104,6,99,111,115,10,112,104,97,115,101,6,115,105,110,28,78,111,116,73,109,112,108,
+    101,109,101,110,116,101,100,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,14,
+    95,95,97,98,115,95,95,180,1,182,1,28,18,0,22,1,131,0,20,2,11,2,48,0,
+    131,0,20,3,11,2,48,0,42,0,72,1,74,0,74,5,182,1,0,1,182,1,0,0,
+    182,1,0,1,182,1,0,2,182,1,0,1,182,1,0,1,182,1,0,1,182,1,0,4,
+    182,1,0,1,182,1,0,1,182,1,0,1,182,1,0,1,182,1,0,1,182,1,0,1,
+    6,0,2,8,115,101,108,102,8,8,109,97,116,104,8,115,113,114,116,8,114,101,97,108,
+    8,105,109,97,103,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,14,95,95,110,
+    101,103,95,95,186,1,188,1,22,18,0,15,0,131,0,20,1,80,0,131,0,20,2,80,
+    0,72,2,74,0,74,5,188,1,0,1,188,1,0,1,188,1,0,1,188,1,0,0,188,
+    1,0,1,188,1,0,1,188,1,0,2,188,1,0,1,188,1,0,1,188,1,0,1,188,
+    1,0,1,4,0,2,8,115,101,108,102,6,14,99,111,109,112,108,101,120,8,114,101,97,
+    108,8,105,109,97,103,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,16,95,95,
+    104,97,115,104,95,95,192,1,194,1,20,18,0,15,0,131,0,20,1,131,0,20,2,36,
+    2,72,1,74,0,74,5,194,1,0,1,194,1,0,1,194,1,0,1,194,1,0,0,194,
+    1,0,1,194,1,0,2,194,1,0,1,194,1,0,1,194,1,0,1,194,1,0,1,4,
+    0,2,8,115,101,108,102,6,8,104,97,115,104,8,114,101,97,108,8,105,109,97,103,2,
+    0,1,0,1,1,0,2,0,0,1,1,0,2,1,10,112,104,97,115,101,204,1,206,1,
+    18,18,0,22,1,131,0,20,2,131,0,20,3,72,2,74,0,74,5,206,1,0,1,206,
+    1,0,0,206,1,0,1,206,1,0,2,206,1,0,1,206,1,0,4,206,1,0,1,206,
+    1,0,1,206,1,0,1,6,0,2,2,122,8,8,109,97,116,104,10,97,116,97,110,50,
+    8,105,109,97,103,8,114,101,97,108,2,0,1,0,1,1,0,2,0,0,1,1,0,2,
+    1,10,112,111,108,97,114,210,1,212,1,20,16,0,22,0,72,0,18,1,15,0,16,0,
+    72,1,36,2,74,0,74,5,212,1,0,1,212,1,0,0,212,1,0,1,212,1,0,1,
+    212,1,0,1,212,1,0,1,212,1,0,1,212,1,0,1,212,1,0,1,212,1,0,1,
+    2,0,2,2,122,4,14,95,95,97,98,115,95,95,10,112,104,97,115,101,2,0,1,0,
+    1,1,0,2,0,0,1,1,0,2,1,8,114,101,99,116,216,1,218,1,36,16,0,18,
+    0,22,1,16,1,72,1,44,0,16,0,18,0,22,2,16,1,72,1,44,0,7,0,34,
+    0,44,0,42,0,74,0,74,5,218,1,0,1,218,1,0,1,218,1,0,0,218,1,0,
+    1,218,1,0,1,218,1,0,1,218,1,0,1,218,1,0,1,218,1,0,2,218,1,0,
+    1,218,1,0,1,218,1,0,1,218,1,0,1,218,1,0,1,218,1,0,1,218,1,0,
+    1,218,1,0,1,218,1,0,1,4,2,4,0,0,0,0,0,0,240,63,4,2,114,6,
+    112,104,105,6,8,109,97,116,104,6,99,111,115,6,115,105,110,2,0,1,0,1,1,0,
+    4,0,2,0,1,1,0,2,1,6,101,120,112,226,1,228,1,28,18,0,22,1,131,0,
+    20,2,72,1,18,3,15,0,11,1,131,0,20,4,72,2,44,0,74,0,74,5,228,1,
+    0,1,228,1,0,0,228,1,0,1,228,1,0,2,228,1,0,1,228,1,0,1,228,1,
+    0,1,228,1,0,1,228,1,0,1,228,1,0,4,228,1,0,1,228,1,0,1,228,1,
+    0,1,228,1,0,1,6,0,2,2,122,10,8,109,97,116,104,6,101,120,112,8,114,101,
+    97,108,8,114,101,99,116,8,105,109,97,103,2,0,1,0,1,1,0,2,0,0,1,1,
+    0,2,1,6,108,111,103,232,1,234,1,34,18,0,22,1,16,0,22,2,72,0,16,1,
+    72,2,18,3,15,0,16,0,72,1,7,0,34,0,44,0,42,0,74,0,74,5,234,1,
+    0,1,234,1,0,0,234,1,0,1,234,1,0,2,234,1,0,1,234,1,0,1,234,1,
+    0,1,234,1,0,1,234,1,0,1,234,1,0,1,234,1,0,1,234,1,0,1,234,1,
+    0,1,234,1,0,1,234,1,0,1,234,1,0,1,234,1,0,1,4,2,4,0,0,0,
+    0,0,0,240,63,4,2,122,8,98,97,115,101,8,8,109,97,116,104,6,108,111,103,14,
+    95,95,97,98,115,95,95,10,112,104,97,115,101,2,0,1,0,1,1,0,2,0,2,2,
+    8,98,97,115,101,4,105,87,20,139,10,191,5,64,1,1,0,1,1,10,108,111,103,49,
+    48,238,1,240,1,14,18,0,15,0,16,0,11,10,72,2,74,0,74,5,240,1,0,1,
+    240,1,0,1,240,1,0,1,240,1,0,1,240,1,0,1,240,1,0,1,240,1,0,1,
+    0,0,2,2,122,2,6,108,111,103,2,0,1,0,1,1,0,2,0,0,1,1,0,2,
+    1,8,115,113,114,116,244,1,246,1,10,16,0,7,0,48,0,74,0,74,5,246,1,0,
+    1,246,1,0,1,246,1,0,1,246,1,0,1,246,1,0,1,0,2,4,0,0,0,0,
+    0,0,224,63,2,2,122,0,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,8,
+    97,99,111,115,254,1,128,2,38,7,0,34,0,80,0,18,0,15,0,16,0,18,1,15,
+    0,130,0,16,0,44,0,11,1,43,0,72,1,42,0,72,1,44,0,74,0,74,5,128,
+    2,0,1,128,2,0,1,128,2,0,1,128,2,0,1,128,2,0,1,128,2,0,1,128,
+    2,0,1,128,2,0,1,128,2,0,1,128,2,0,1,128,2,0,1,128,2,0,1,128,
+    2,0,1,128,2,0,1,128,2,0,1,128,2,0,1,128,2,0,1,128,2,0,1,128,
+    2,0,1,0,2,4,0,0,0,0,0,0,240,63,2,2,122,4,6,108,111,103,8,115,
+    113,114,116,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,8,97,115,105,110,132,
+    2,134,2,44,7,0,34,0,80,0,18,0,15,0,7,1,34,0,16,0,44,0,18,1,
+    15,0,11,1,130,0,16,0,44,0,43,0,72,1,42,0,72,1,44,0,74,0,74,5,
+    134,2,0,1,134,2,0,1,134,2,0,1,134,2,0,1,134,2,0,1,134,2,0,1,
+    134,2,0,1,134,2,0,1,134,2,0,1,134,2,0,1,134,2,0,1,134,2,0,1,
+    134,2,0,1,134,2,0,1,134,2,0,1,134,2,0,1,134,2,0,1,134,2,0,1,
+    134,2,0,1,134,2,0,1,134,2,0,1,134,2,0,1,0,4,4,0,0,0,0,0,
+    0,240,63,4,0,0,0,0,0,0,240,63,2,2,122,4,6,108,111,103,8,115,113,114,
+    116,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,8,97,116,97,110,138,2,140,
+    2,46,7,0,34,0,11,2,45,0,18,0,15,0,11,1,7,1,34,0,16,0,44,0,
+    43,0,11,1,7,2,34,0,16,0,44,0,42,0,45,0,72,1,44,0,74,0,74,5,
+    140,2,0,1,140,2,0,1,140,2,0,1,140,2,0,1,140,2,0,1,140,2,0,1,
+    140,2,0,1,140,2,0,1,140,2,0,1,140,2,0,1,140,2,0,1,140,2,0,1,
+    140,2,0,1,140,2,0,1,140,2,0,1,140,2,0,1,140,2,0,1,140,2,0,1,
+    140,2,0,1,140,2,0,1,140,2,0,1,140,2,0,1,140,2,0,1,0,6,4,0,
+    0,0,0,0,0,240,63,4,0,0,0,0,0,0,240,63,4,0,0,0,0,0,0,240,
+    63,2,2,122,2,6,108,111,103,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,
+    6,99,111,115,144,2,146,2,28,18,0,15,0,16,0,72,1,18,0,15,0,16,0,80,
+    0,72,1,42,0,11,2,45,0,74,0,74,5,146,2,0,1,146,2,0,1,146,2,0,
+    1,146,2,0,1,146,2,0,1,146,2,0,1,146,2,0,1,146,2,0,1,146,2,0,
+    1,146,2,0,1,146,2,0,1,146,2,0,1,146,2,0,1,146,2,0,1,0,0,2,
+    2,122,2,6,101,120,112,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,6,115,
+    105,110,150,2,152,2,34,18,0,15,0,16,0,72,1,18,0,15,0,16,0,80,0,72,
+    1,43,0,11,2,7,0,34,0,44,0,45,0,74,0,74,5,152,2,0,1,152,2,0,
+    1,152,2,0,1,152,2,0,1,152,2,0,1,152,2,0,1,152,2,0,1,152,2,0,
+    1,152,2,0,1,152,2,0,1,152,2,0,1,152,2,0,1,152,2,0,1,152,2,0,
+    1,152,2,0,1,152,2,0,1,152,2,0,1,0,2,4,0,0,0,0,0,0,240,63,
+    2,2,122,2,6,101,120,112,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,6,
+    116,97,110,156,2,158,2,22,18,0,15,0,16,0,72,1,18,1,15,0,16,0,72,1,
+    45,0,74,0,74,5,158,2,0,1,158,2,0,1,158,2,0,1,158,2,0,1,158,2,
+    0,1,158,2,0,1,158,2,0,1,158,2,0,1,158,2,0,1,158,2,0,1,158,2,
+    0,1,0,0,2,2,122,4,6,115,105,110,6,99,111,115,2,0,1,0,1,1,0,2,
+    0,0,1,1,0,2,1,10,97,99,111,115,104,166,2,168,2,30,18,0,15,0,16,0,
+    18,1,15,0,130,0,16,0,44,0,11,1,43,0,72,1,42,0,72,1,74,0,74,5,
+    168,2,0,1,168,2,0,1,168,2,0,1,168,2,0,1,168,2,0,1,168,2,0,1,
+    168,2,0,1,168,2,0,1,168,2,0,1,168,2,0,1,168,2,0,1,168,2,0,1,
+    168,2,0,1,168,2,0,1,168,2,0,1,0,0,2,2,122,4,6,108,111,103,8,115,
+    113,114,116,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,10,97,115,105,110,104,
+    172,2,174,2,30,18,0,15,0,16,0,18,1,15,0,130,0,16,0,44,0,134,1,42,
+    0,72,1,42,0,72,1,74,0,74,5,174,2,0,1,174,2,0,1,174,2,0,1,174,
+    2,0,1,174,2,0,1,174,2,0,1,174,2,0,1,174,2,0,1,174,2,0,1,174,
+    2,0,1,174,2,0,1,174,2,0,1,174,2,0,1,174,2,0,1,174,2,0,1,0,
+    0,2,2,122,4,6,108,111,103,8,115,113,114,116,2,0,1,0,1,1,0,2,0,0,
+    1,1,0,2,1,10,97,116,97,110,104,178,2,180,2,32,11,1,11,2,45,0,18,0,
+    15,0,11,1,16,0,42,0,11,1,16,0,43,0,45,0,72,1,44,0,74,0,74,5,
+    180,2,0,1,180,2,0,1,180,2,0,1,180,2,0,1,180,2,0,1,180,2,0,1,
+    180,2,0,1,180,2,0,1,180,2,0,1,180,2,0,1,180,2,0,1,180,2,0,1,
+    180,2,0,1,180,2,0,1,180,2,0,1,180,2,0,1,0,0,2,2,122,2,6,108,
+    111,103,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,8,99,111,115,104,184,2,
+    186,2,28,18,0,15,0,16,0,72,1,18,0,15,0,16,0,80,0,72,1,42,0,11,
+    2,45,0,74,0,74,5,186,2,0,1,186,2,0,1,186,2,0,1,186,2,0,1,186,
+    2,0,1,186,2,0,1,186,2,0,1,186,2,0,1,186,2,0,1,186,2,0,1,186,
+    2,0,1,186,2,0,1,186,2,0,1,186,2,0,1,0,0,2,2,122,2,6,101,120,
+    112,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,8,115,105,110,104,190,2,192,
+    2,28,18,0,15,0,16,0,72,1,18,0,15,0,16,0,80,0,72,1,43,0,11,2,
+    45,0,74,0,74,5,192,2,0,1,192,2,0,1,192,2,0,1,192,2,0,1,192,2,
+    0,1,192,2,0,1,192,2,0,1,192,2,0,1,192,2,0,1,192,2,0,1,192,2,
+    0,1,192,2,0,1,192,2,0,1,192,2,0,1,0,0,2,2,122,2,6,101,120,112,
+    2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,8,116,97,110,104,196,2,198,2,
+    22,18,0,15,0,16,0,72,1,18,1,15,0,16,0,72,1,45,0,74,0,74,5,198,
+    2,0,1,198,2,0,1,198,2,0,1,198,2,0,1,198,2,0,1,198,2,0,1,198,
+    2,0,1,198,2,0,1,198,2,0,1,198,2,0,1,198,2,0,1,0,0,2,2,122,
+    4,8,115,105,110,104,8,99,111,115,104,2,0,1,0,1,1,0,2,0,0,1,1,0,
+    2,1,16,105,115,102,105,110,105,116,101,206,2,208,2,26,18,0,22,1,131,0,20,2,
+    72,1,68,6,18,0,22,1,131,0,20,3,72,1,74,0,74,5,208,2,0,1,208,2,
+    0,0,208,2,0,1,208,2,0,2,208,2,0,1,208,2,0,1,208,2,0,1,208,2,
+    0,4,208,2,0,1,208,2,0,6,208,2,0,1,208,2,0,1,208,2,0,1,8,0,
+    2,2,122,8,8,109,97,116,104,16,105,115,102,105,110,105,116,101,8,114,101,97,108,8,
+    105,109,97,103,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,10,105,115,105,110,
+    102,212,2,214,2,26,18,0,22,1,131,0,20,2,72,1,67,6,18,0,22,1,131,0,
+    20,3,72,1,74,0,74,5,214,2,0,1,214,2,0,0,214,2,0,1,214,2,0,2,
+    214,2,0,1,214,2,0,1,214,2,0,1,214,2,0,4,214,2,0,1,214,2,0,6,
+    214,2,0,1,214,2,0,1,214,2,0,1,8,0,2,2,122,8,8,109,97,116,104,10,
+    105,115,105,110,102,8,114,101,97,108,8,105,109,97,103,2,0,1,0,1,1,0,2,0,
+    0,1,1,0,2,1,10,105,115,110,97,110,218,2,220,2,26,18,0,22,1,131,0,20,
+    2,72,1,67,6,18,0,22,1,131,0,20,3,72,1,74,0,74,5,220,2,0,1,220,
+    2,0,0,220,2,0,1,220,2,0,2,220,2,0,1,220,2,0,1,220,2,0,1,220,
+    2,0,4,220,2,0,1,220,2,0,6,220,2,0,1,220,2,0,1,220,2,0,1,8,
+    0,2,2,122,8,8,109,97,116,104,10,105,115,110,97,110,8,114,101,97,108,8,105,109,
+    97,103,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,14,105,115,99,108,111,115,
+    101,224,2,226,2,34,18,0,22,1,131,0,20,2,131,1,20,2,72,2,68,8,18,0,
+    22,1,131,0,20,3,131,1,20,3,72,2,74,0,74,5,226,2,0,1,226,2,0,0,
+    226,2,0,1,226,2,0,2,226,2,0,1,226,2,0,4,226,2,0,1,226,2,0,1,
+    226,2,0,1,226,2,0,6,226,2,0,1,226,2,0,8,226,2,0,1,226,2,0,10,
+    226,2,0,1,226,2,0,1,226,2,0,1,12,0,4,2,97,2,98,8,8,109,97,116,
+    104,14,105,115,99,108,111,115,101,8,114,101,97,108,8,105,109,97,103,2,0,1,0,1,
+    1,0,4,0,2,0,1,1,0,2,1,
+};
+static const unsigned char kPythonLibsBytecode_dataclasses[] = {
+    112,107,99,2,10,50,46,49,46,53,182,93,159,58,113,46,203,6,0,0,28,100,97,116,
+    97,99,108,97,115,115,101,115,46,112,121,63,87,180,210,4,41,252,159,216,40,28,100,97,
+    116,97,99,108,97,115,115,101,115,46,112,121,2,154,1,34,14,0,26,0,14,1,26,1,
+    14,2,26,2,14,3,26,3,14,4,26,4,14,5,26,5,14,6,26,6,14,7,26,7,
+    74,5,2,0,1,2,0,1,24,0,1,24,0,1,32,0,1,32,0,1,74,0,1,74,
+    0,1,84,0,1,84,0,1,102,0,1,102,0,1,108,0,1,108,0,1,150,1,0,1,
+    150,1,0,1,150,1,0,1,0,0,0,16,32,95,103,101,116,95,97,110,110,111,116,97,
+    116,105,111,110,115,24,95,104,97,115,95,100,101,102,97,117,108,116,32,95,119,114,97,112,
+    112,101,100,95,95,105,110,105,116,95,95,32,95,119,114,97,112,112,101,100,95,95,114,101,
+    112,114,95,95,28,95,119,114,97,112,112,101,100,95,95,101,113,95,95,28,95,119,114,97,
+    112,112,101,100,95,95,110,101,95,95,18,100,97,116,97,99,108,97,115,115,12,97,115,100,
+    105,99,116,2,0,1,0,1,1,16,32,95,103,101,116,95,97,110,110,111,116,97,116,105,
+    111,110,115,2,20,74,37,0,24,1,16,0,18,0,61,1,65,10,16,1,22,1,16,0,
+    72,1,1,0,131,0,20,2,24,0,63,244,255,3,16,1,22,3,72,0,1,0,38,0,
+    24,2,16,1,84,0,85,9,24,0,16,2,22,4,131,0,20,5,72,1,1,0,63,248,
+    255,3,16,2,22,6,72,0,74,0,74,5,4,0,1,4,0,1,6,2,1,6,2,1,
+    6,2,1,6,2,1,8,2,1,8,2,0,8,2,1,8,2,1,8,2,1,10,2,1,
+    10,2,2,10,2,1,10,2,1,12,0,1,12,0,4,12,0,1,12,0,1,14,0,1,
+    14,0,1,16,0,1,16,0,1,16,4,1,16,4,1,18,4,1,18,4,6,18,4,1,
+    18,4,8,18,4,1,18,4,1,18,4,1,20,0,1,20,0,10,20,0,1,20,0,1,
+    20,0,1,12,0,6,6,99,108,115,16,105,110,104,101,114,105,116,115,6,114,101,115,14,
+    12,111,98,106,101,99,116,12,97,112,112,101,110,100,16,95,95,98,97,115,101,95,95,14,
+    114,101,118,101,114,115,101,12,117,112,100,97,116,101,30,95,95,97,110,110,111,116,97,116,
+    105,111,110,115,95,95,8,107,101,121,115,6,0,1,0,1,1,1,0,4,30,1,3,0,
+    46,64,1,0,2,0,0,1,1,0,2,1,24,95,104,97,115,95,100,101,102,97,117,108,
+    116,24,28,30,130,0,16,1,62,0,68,10,18,0,15,0,130,0,16,1,23,0,72,1,
+    20,1,7,0,58,0,74,0,74,5,28,0,1,28,0,1,28,0,1,28,0,1,28,0,
+    1,28,0,1,28,0,1,28,0,1,28,0,1,28,0,1,28,0,0,28,0,1,28,0,
+    1,28,0,1,28,0,1,2,2,5,34,109,101,109,98,101,114,95,100,101,115,99,114,105,
+    112,116,111,114,4,10,99,108,115,95,100,10,102,105,101,108,100,4,8,116,121,112,101,16,
+    95,95,110,97,109,101,95,95,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,
+    32,95,119,114,97,112,112,101,100,95,95,105,110,105,116,95,95,32,70,134,2,18,0,15,
+    0,16,0,72,1,24,3,131,3,20,1,24,4,18,2,15,0,16,3,72,1,24,5,11,
+    0,24,6,16,5,84,0,85,65,24,7,130,2,16,7,62,0,65,12,18,3,15,0,130,
+    0,16,7,16,2,22,4,16,7,72,1,72,3,1,0,63,48,16,6,18,5,15,0,16,
+    1,72,1,132,55,65,15,18,3,15,0,130,0,16,7,130,1,16,6,23,0,72,3,1,
+    0,16,6,134,1,42,0,24,6,63,27,18,6,15,0,130,4,16,7,72,2,65,11,18,
+    3,15,0,130,0,16,7,130,4,16,7,23,0,72,3,1,0,63,11,18,7,15,0,131,
+    3,20,8,7,0,16,7,104,1,41,3,72,1,100,0,63,192,255,3,18,5,15,0,16,
+    1,72,1,16,6,132,59,65,19,18,7,15,0,131,3,20,8,7,2,18,5,15,0,16,
+    5,72,1,7,3,18,5,15,0,16,1,72,1,7,4,41,6,72,1,100,0,18,5,15,
+    0,16,2,72,1,11,0,132,59,65,17,18,7,15,0,131,3,20,8,7,5,18,9,15,
+    0,18,10,15,0,16,2,72,1,72,1,104,1,41,3,72,1,100,0,74,5,34,0,1,
+    34,0,1,34,0,1,34,0,1,34,0,1,36,0,1,36,0,0,36,0,1,38,0,1,
+    38,0,1,38,0,1,38,0,1,38,0,1,40,0,1,40,0,1,42,0,1,42,0,1,
+    42,2,1,42,2,1,44,2,1,44,2,1,44,2,1,44,2,1,46,2,1,46,2,1,
+    46,2,1,46,2,1,46,2,1,46,2,2,46,2,1,46,2,1,46,2,1,46,2,1,
+    48,2,1,50,2,1,50,2,1,50,2,1,50,2,1,50,2,1,50,2,1,50,2,1,
+    52,2,1,52,2,1,52,2,1,52,2,1,52,2,1,52,2,1,52,2,1,52,2,1,
+    52,2,1,54,2,1,54,2,1,54,2,1,54,2,1,56,2,1,56,2,1,56,2,1,
+    56,2,1,56,2,1,56,2,1,56,2,1,58,2,1,58,2,1,58,2,1,58,2,1,
+    58,2,1,58,2,1,58,2,1,58,2,1,58,2,1,60,2,1,62,2,1,62,2,1,
+    62,2,1,62,2,4,62,2,1,62,2,1,62,2,1,62,2,1,62,2,1,62,2,1,
+    62,2,1,64,0,1,64,0,1,64,0,1,64,0,1,64,0,1,64,0,1,64,0,1,
+    66,0,1,66,0,1,66,0,1,66,0,6,66,0,1,66,0,1,66,0,1,66,0,1,
+    66,0,1,66,0,1,66,0,1,66,0,1,66,0,1,66,0,1,66,0,1,66,0,1,
+    66,0,1,66,0,1,68,0,1,68,0,1,68,0,1,68,0,1,68,0,1,68,0,1,
+    68,0,1,70,0,1,70,0,1,70,0,1,70,0,8,70,0,1,70,0,1,70,0,1,
+    70,0,1,70,0,1,70,0,1,70,0,1,70,0,1,70,0,1,70,0,1,70,0,1,
+    70,0,1,70,0,1,10,12,5,54,32,109,105,115,115,105,110,103,32,114,101,113,117,105,
+    114,101,100,32,97,114,103,117,109,101,110,116,32,5,4,33,114,5,14,32,116,97,107,101,
+    115,32,5,52,32,112,111,115,105,116,105,111,110,97,108,32,97,114,103,117,109,101,110,116,
+    115,32,98,117,116,32,5,22,32,119,101,114,101,32,103,105,118,101,110,5,72,32,103,111,
+    116,32,97,110,32,117,110,101,120,112,101,99,116,101,100,32,107,101,121,119,111,114,100,32,
+    97,114,103,117,109,101,110,116,32,16,8,115,101,108,102,8,97,114,103,115,12,107,119,97,
+    114,103,115,6,99,108,115,10,99,108,115,95,100,12,102,105,101,108,100,115,2,105,10,102,
+    105,101,108,100,22,8,116,121,112,101,16,95,95,100,105,99,116,95,95,32,95,103,101,116,
+    95,97,110,110,111,116,97,116,105,111,110,115,14,115,101,116,97,116,116,114,6,112,111,112,
+    6,108,101,110,24,95,104,97,115,95,100,101,102,97,117,108,116,18,84,121,112,101,69,114,
+    114,111,114,16,95,95,110,97,109,101,95,95,8,110,101,120,116,8,105,116,101,114,4,0,
+    1,0,1,1,3,0,34,164,1,1,0,2,0,0,2,4,0,1,1,32,95,119,114,97,
+    112,112,101,100,95,95,114,101,112,114,95,95,74,80,78,18,0,15,0,18,1,15,0,16,
+    0,72,1,72,1,24,1,37,0,16,1,84,0,85,13,24,2,16,2,7,0,18,2,15,
+    0,130,0,16,2,72,2,104,1,41,3,77,0,63,244,255,3,24,3,18,1,15,0,16,
+    0,72,1,20,3,7,2,7,3,22,4,16,3,72,1,7,4,41,4,74,0,74,5,76,
+    0,1,76,0,1,76,0,1,76,0,1,76,0,1,76,0,1,76,0,1,76,0,1,78,
+    0,1,78,0,1,78,0,1,78,2,1,78,2,1,78,2,1,78,2,1,78,2,1,78,
+    2,1,78,2,1,78,2,1,78,2,1,78,2,1,78,2,1,78,2,1,78,2,1,78,
+    0,1,80,0,1,80,0,1,80,0,1,80,0,1,80,0,0,80,0,1,80,0,1,80,
+    0,2,80,0,1,80,0,1,80,0,1,80,0,1,80,0,1,80,0,1,4,10,5,2,
+    61,5,4,33,114,5,2,40,5,4,44,32,5,2,41,8,8,115,101,108,102,12,102,105,
+    101,108,100,115,10,102,105,101,108,100,8,97,114,103,115,10,32,95,103,101,116,95,97,110,
+    110,111,116,97,116,105,111,110,115,8,116,121,112,101,14,103,101,116,97,116,116,114,16,95,
+    95,110,97,109,101,95,95,8,106,111,105,110,4,0,1,0,1,1,3,0,22,48,1,0,
+    2,0,0,1,1,0,2,1,28,95,119,114,97,112,112,101,100,95,95,101,113,95,95,84,
+    98,84,18,0,15,0,16,0,72,1,18,0,15,0,16,1,72,1,61,1,65,3,10,0,
+    74,0,18,1,15,0,18,0,15,0,16,0,72,1,72,1,24,2,16,2,84,0,85,17,
+    24,3,18,2,15,0,130,0,16,3,72,2,18,2,15,0,130,1,16,3,72,2,132,58,
+    65,3,10,0,74,0,63,240,255,3,9,0,74,0,74,5,86,0,1,86,0,1,86,0,
+    1,86,0,1,86,0,1,86,0,1,86,0,1,86,0,1,86,0,1,86,0,1,88,0,
+    1,88,0,1,90,0,1,90,0,1,90,0,1,90,0,1,90,0,1,90,0,1,90,0,
+    1,90,0,1,92,0,1,92,0,1,92,2,1,92,2,1,94,2,1,94,2,1,94,2,
+    1,94,2,1,94,2,1,94,2,1,94,2,1,94,2,1,94,2,1,94,2,1,94,2,
+    1,94,2,1,96,2,1,96,2,1,96,2,1,98,0,1,98,0,1,98,0,1,0,0,
+    8,8,115,101,108,102,10,111,116,104,101,114,12,102,105,101,108,100,115,10,102,105,101,108,
+    100,6,8,116,121,112,101,32,95,103,101,116,95,97,110,110,111,116,97,116,105,111,110,115,
+    14,103,101,116,97,116,116,114,4,0,1,0,1,1,3,0,44,78,1,0,4,0,2,0,
+    1,1,0,2,1,28,95,119,114,97,112,112,101,100,95,95,110,101,95,95,102,104,14,16,
+    0,22,0,16,1,72,1,81,0,74,0,74,5,104,0,1,104,0,0,104,0,1,104,0,
+    1,104,0,1,104,0,1,104,0,1,2,0,4,8,115,101,108,102,10,111,116,104,101,114,
+    2,12,95,95,101,113,95,95,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,
+    18,100,97,116,97,99,108,97,115,115,108,146,1,148,1,18,0,15,0,16,0,72,1,18,
+    0,61,0,66,2,101,0,131,0,20,1,24,1,16,1,7,0,62,1,65,4,18,2,16,
+    0,27,3,16,1,7,1,62,1,65,4,18,4,16,0,27,5,16,1,7,2,62,1,65,
+    4,18,6,16,0,27,7,16,1,7,3,62,1,65,4,18,8,16,0,27,9,18,10,15,
+    0,16,0,72,1,24,2,10,0,24,3,16,2,84,0,85,23,24,4,18,11,15,0,130,
+    1,16,4,72,2,65,4,9,0,24,3,63,12,16,3,65,10,18,12,15,0,7,4,16,
+    4,104,5,7,6,41,3,72,1,100,0,63,234,255,3,16,0,74,0,74,5,110,0,1,
+    110,0,1,110,0,1,110,0,1,110,0,1,110,0,1,110,0,1,110,0,1,112,0,1,
+    112,0,0,112,0,1,114,0,1,114,0,1,114,0,1,114,0,1,116,0,1,116,0,1,
+    116,0,2,118,0,1,118,0,1,118,0,1,118,0,1,120,0,1,120,0,1,120,0,4,
+    122,0,1,122,0,1,122,0,1,122,0,1,124,0,1,124,0,1,124,0,6,126,0,1,
+    126,0,1,126,0,1,126,0,1,128,1,0,1,128,1,0,1,128,1,0,8,130,1,0,
+    1,130,1,0,1,130,1,0,1,130,1,0,1,130,1,0,1,132,1,0,1,132,1,0,
+    1,134,1,0,1,134,1,0,1,134,1,2,1,134,1,2,1,136,1,2,1,136,1,2,
+    1,136,1,2,1,136,1,2,1,136,1,2,1,136,1,2,1,138,1,2,1,138,1,2,
+    1,140,1,2,1,142,1,2,1,142,1,2,1,144,1,2,1,144,1,2,1,144,1,2,
+    1,144,1,2,1,144,1,2,1,144,1,2,1,144,1,2,1,144,1,2,1,144,1,2,
+    1,144,1,2,1,146,1,0,1,146,1,0,1,146,1,0,1,10,14,5,16,95,95,105,
+    110,105,116,95,95,5,16,95,95,114,101,112,114,95,95,5,12,95,95,101,113,95,95,5,
+    12,95,95,110,101,95,95,5,42,110,111,110,45,100,101,102,97,117,108,116,32,97,114,103,
+    117,109,101,110,116,32,5,4,33,114,5,50,32,102,111,108,108,111,119,115,32,100,101,102,
+    97,117,108,116,32,97,114,103,117,109,101,110,116,10,6,99,108,115,10,99,108,115,95,100,
+    12,102,105,101,108,100,115,22,104,97,115,95,100,101,102,97,117,108,116,10,102,105,101,108,
+    100,26,8,116,121,112,101,16,95,95,100,105,99,116,95,95,32,95,119,114,97,112,112,101,
+    100,95,95,105,110,105,116,95,95,16,95,95,105,110,105,116,95,95,32,95,119,114,97,112,
+    112,101,100,95,95,114,101,112,114,95,95,16,95,95,114,101,112,114,95,95,28,95,119,114,
+    97,112,112,101,100,95,95,101,113,95,95,12,95,95,101,113,95,95,28,95,119,114,97,112,
+    112,101,100,95,95,110,101,95,95,12,95,95,110,101,95,95,32,95,103,101,116,95,97,110,
+    110,111,116,97,116,105,111,110,115,24,95,104,97,115,95,100,101,102,97,117,108,116,18,84,
+    121,112,101,69,114,114,111,114,4,0,1,0,1,1,3,0,96,142,1,1,0,2,0,0,
+    1,1,0,2,1,12,97,115,100,105,99,116,150,1,154,1,46,18,0,15,0,18,1,15,
+    0,16,0,72,1,72,1,24,1,38,0,16,1,84,0,85,10,24,2,16,2,18,2,15,
+    0,130,0,16,2,72,2,78,0,63,247,255,3,74,0,74,5,152,1,0,1,152,1,0,
+    1,152,1,0,1,152,1,0,1,152,1,0,1,152,1,0,1,152,1,0,1,152,1,0,
+    1,154,1,0,1,154,1,0,1,154,1,0,1,154,1,2,1,154,1,2,1,154,1,2,
+    1,154,1,2,1,154,1,2,1,154,1,2,1,154,1,2,1,154,1,2,1,154,1,2,
+    1,154,1,2,1,154,1,0,1,154,1,0,1,0,0,6,6,111,98,106,12,102,105,101,
+    108,100,115,10,102,105,101,108,100,6,32,95,103,101,116,95,97,110,110,111,116,97,116,105,
+    111,110,115,8,116,121,112,101,14,103,101,116,97,116,116,114,4,0,1,0,1,1,3,0,
+    22,42,1,0,2,0,0,1,1,0,2,1,
+};
+static const unsigned char kPythonLibsBytecode_datetime[] = {
+    112,107,99,2,10,50,46,49,46,53,182,93,159,58,113,46,203,6,0,0,22,100,97,116,
+    101,116,105,109,101,46,112,121,78,16,166,176,42,34,49,147,194,65,22,100,97,116,101,116,
+    105,109,101,46,112,121,2,132,2,162,1,86,0,2,0,20,0,26,0,1,0,86,1,26,
+    1,8,0,90,2,14,0,92,3,14,1,92,4,14,2,92,5,14,3,92,6,91,2,8,
+    0,90,7,14,4,92,3,14,5,21,8,4,0,15,0,4,0,72,1,92,9,14,6,92,
+    10,14,7,92,5,14,8,92,6,14,9,92,11,14,10,92,12,14,11,92,13,14,12,92,
+    14,14,13,92,15,14,14,92,4,91,7,19,7,90,16,14,15,92,3,14,16,92,7,14,
+    17,21,8,4,0,15,0,4,0,72,1,92,17,14,18,92,15,14,19,92,4,14,20,92,
+    10,14,21,92,5,14,22,92,6,14,23,92,11,14,24,92,12,14,25,92,13,14,26,92,
+    14,91,16,74,5,2,0,1,2,0,1,2,0,0,2,0,1,2,0,1,4,0,1,4,
+    0,1,8,0,1,8,0,1,10,0,1,10,0,1,18,0,1,18,0,1,24,0,1,24,
+    0,1,34,0,1,34,0,1,34,0,1,46,0,1,46,0,1,48,0,1,48,0,1,60,
+    0,1,58,0,1,58,0,1,58,0,1,58,0,1,58,0,1,60,0,1,68,0,1,68,
+    0,1,86,0,1,86,0,1,92,0,1,92,0,1,98,0,1,98,0,1,104,0,1,104,
+    0,1,110,0,1,110,0,1,116,0,1,116,0,1,122,0,1,122,0,1,128,1,0,1,
+    128,1,0,1,128,1,0,1,136,1,0,1,136,1,0,1,138,1,0,1,138,1,0,1,
+    164,1,0,1,164,1,0,1,172,1,0,1,170,1,0,1,170,1,0,1,170,1,0,1,
+    170,1,0,1,170,1,0,1,172,1,0,1,186,1,0,1,186,1,0,1,192,1,0,1,
+    192,1,0,1,198,1,0,1,198,1,0,1,228,1,0,1,228,1,0,1,234,1,0,1,
+    234,1,0,1,240,1,0,1,240,1,0,1,246,1,0,1,246,1,0,1,252,1,0,1,
+    252,1,0,1,130,2,0,1,130,2,0,1,130,2,0,1,130,2,0,1,2,4,5,8,
+    116,105,109,101,5,16,111,112,101,114,97,116,111,114,0,36,18,108,111,99,97,108,116,105,
+    109,101,16,111,112,101,114,97,116,111,114,18,116,105,109,101,100,101,108,116,97,16,95,95,
+    105,110,105,116,95,95,16,95,95,114,101,112,114,95,95,12,95,95,101,113,95,95,12,95,
+    95,110,101,95,95,8,100,97,116,101,24,115,116,97,116,105,99,109,101,116,104,111,100,10,
+    116,111,100,97,121,10,95,95,99,109,112,12,95,95,108,116,95,95,12,95,95,108,101,95,
+    95,12,95,95,103,116,95,95,12,95,95,103,101,95,95,14,95,95,115,116,114,95,95,16,
+    100,97,116,101,116,105,109,101,6,110,111,119,2,0,1,0,1,1,54,16,95,95,105,110,
+    105,116,95,95,10,14,14,130,1,16,0,27,0,130,2,16,0,27,1,74,5,12,0,1,
+    12,0,1,12,0,0,14,0,1,14,0,1,14,0,2,14,0,1,4,0,6,8,115,101,
+    108,102,8,100,97,121,115,14,115,101,99,111,110,100,115,4,8,100,97,121,115,14,115,101,
+    99,111,110,100,115,2,0,1,0,1,1,0,2,0,4,2,8,100,97,121,115,3,0,4,
+    14,115,101,99,111,110,100,115,3,0,1,1,0,1,1,16,95,95,114,101,112,114,95,95,
+    18,20,20,7,0,131,0,20,0,7,1,131,0,20,1,7,2,41,5,74,0,74,5,20,
+    0,1,20,0,1,20,0,0,20,0,1,20,0,1,20,0,2,20,0,1,20,0,1,20,
+    0,1,20,0,1,4,6,5,48,100,97,116,101,116,105,109,101,46,116,105,109,101,100,101,
+    108,116,97,40,100,97,121,115,61,5,20,44,32,115,101,99,111,110,100,115,61,5,2,41,
+    2,8,115,101,108,102,4,8,100,97,121,115,14,115,101,99,111,110,100,115,2,0,1,0,
+    1,1,0,2,0,0,1,1,0,2,1,12,95,95,101,113,95,95,24,30,44,18,0,15,
+    0,16,1,18,1,72,2,81,0,65,3,18,2,74,0,131,0,20,3,131,0,20,4,36,
+    2,131,1,20,3,131,1,20,4,36,2,57,0,74,0,74,5,26,0,1,26,0,1,26,
+    0,1,26,0,1,26,0,1,26,0,1,26,0,1,28,0,1,28,0,1,30,0,1,30,
+    0,0,30,0,1,30,0,2,30,0,1,30,0,1,30,0,4,30,0,1,30,0,6,30,
+    0,1,30,0,1,30,0,1,30,0,1,8,0,4,8,115,101,108,102,10,111,116,104,101,
+    114,10,20,105,115,105,110,115,116,97,110,99,101,18,116,105,109,101,100,101,108,116,97,28,
+    78,111,116,73,109,112,108,101,109,101,110,116,101,100,8,100,97,121,115,14,115,101,99,111,
+    110,100,115,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,12,95,95,110,101,
+    95,95,34,40,44,18,0,15,0,16,1,18,1,72,2,81,0,65,3,18,2,74,0,131,
+    0,20,3,131,0,20,4,36,2,131,1,20,3,131,1,20,4,36,2,58,0,74,0,74,
+    5,36,0,1,36,0,1,36,0,1,36,0,1,36,0,1,36,0,1,36,0,1,38,0,
+    1,38,0,1,40,0,1,40,0,0,40,0,1,40,0,2,40,0,1,40,0,1,40,0,
+    4,40,0,1,40,0,6,40,0,1,40,0,1,40,0,1,40,0,1,8,0,4,8,115,
+    101,108,102,10,111,116,104,101,114,10,20,105,115,105,110,115,116,97,110,99,101,18,116,105,
+    109,101,100,101,108,116,97,28,78,111,116,73,109,112,108,101,109,101,110,116,101,100,8,100,
+    97,121,115,14,115,101,99,111,110,100,115,2,0,1,0,1,1,0,4,0,2,0,1,1,
+    0,2,1,16,95,95,105,110,105,116,95,95,48,54,20,130,1,16,0,27,0,130,2,16,
+    0,27,1,130,3,16,0,27,2,74,5,50,0,1,50,0,1,50,0,0,52,0,1,52,
+    0,1,52,0,2,54,0,1,54,0,1,54,0,4,54,0,1,6,0,8,8,115,101,108,
+    102,8,121,101,97,114,10,109,111,110,116,104,6,100,97,121,6,8,121,101,97,114,10,109,
+    111,110,116,104,6,100,97,121,2,0,1,0,1,1,0,8,0,2,4,6,0,1,1,0,
+    2,1,10,116,111,100,97,121,60,64,30,18,0,15,0,72,0,24,0,18,1,15,0,131,
+    0,20,2,131,0,20,3,131,0,20,4,72,3,74,0,74,5,62,0,1,62,0,1,62,
+    0,1,62,0,1,64,0,1,64,0,1,64,0,1,64,0,0,64,0,1,64,0,2,64,
+    0,1,64,0,4,64,0,1,64,0,1,64,0,1,6,0,2,2,116,10,18,108,111,99,
+    97,108,116,105,109,101,8,100,97,116,101,14,116,109,95,121,101,97,114,12,116,109,95,109,
+    111,110,14,116,109,95,109,100,97,121,2,0,1,0,1,1,0,0,0,1,1,0,2,1,
+    10,95,95,99,109,112,68,82,92,18,0,15,0,16,1,18,1,72,2,81,0,65,3,18,
+    2,74,0,131,0,20,3,131,1,20,3,132,58,65,9,16,2,15,0,131,0,20,3,131,
+    1,20,3,72,2,74,0,131,0,20,4,131,1,20,4,132,58,65,9,16,2,15,0,131,
+    0,20,4,131,1,20,4,72,2,74,0,16,2,15,0,131,0,20,5,131,1,20,5,72,
+    2,74,0,74,5,70,0,1,70,0,1,70,0,1,70,0,1,70,0,1,70,0,1,70,
+    0,1,72,0,1,72,0,1,74,0,1,74,0,0,74,0,1,74,0,2,74,0,1,74,
+    0,1,76,0,1,76,0,1,76,0,1,76,0,4,76,0,1,76,0,6,76,0,1,76,
+    0,1,78,0,1,78,0,8,78,0,1,78,0,10,78,0,1,78,0,1,80,0,1,80,
+    0,1,80,0,1,80,0,12,80,0,1,80,0,14,80,0,1,80,0,1,82,0,1,82,
+    0,1,82,0,1,82,0,16,82,0,1,82,0,18,82,0,1,82,0,1,82,0,1,20,
+    0,6,8,115,101,108,102,10,111,116,104,101,114,4,111,112,12,20,105,115,105,110,115,116,
+    97,110,99,101,8,100,97,116,101,28,78,111,116,73,109,112,108,101,109,101,110,116,101,100,
+    8,121,101,97,114,10,109,111,110,116,104,6,100,97,121,2,0,1,0,1,1,0,6,0,
+    2,4,0,1,1,0,2,1,12,95,95,101,113,95,95,86,88,16,16,0,22,0,16,1,
+    18,1,20,2,72,2,74,0,74,5,88,0,1,88,0,0,88,0,1,88,0,1,88,0,
+    2,88,0,1,88,0,1,88,0,1,4,0,4,8,115,101,108,102,10,111,116,104,101,114,
+    6,10,95,95,99,109,112,16,111,112,101,114,97,116,111,114,4,101,113,2,0,1,0,1,
+    1,0,4,0,2,0,1,1,0,2,1,12,95,95,110,101,95,95,92,94,16,16,0,22,
+    0,16,1,18,1,20,2,72,2,74,0,74,5,94,0,1,94,0,0,94,0,1,94,0,
+    1,94,0,2,94,0,1,94,0,1,94,0,1,4,0,4,8,115,101,108,102,10,111,116,
+    104,101,114,6,10,95,95,99,109,112,16,111,112,101,114,97,116,111,114,4,110,101,2,0,
+    1,0,1,1,0,4,0,2,0,1,1,0,2,1,12,95,95,108,116,95,95,98,100,16,
+    16,0,22,0,16,1,18,1,20,2,72,2,74,0,74,5,100,0,1,100,0,0,100,0,
+    1,100,0,1,100,0,2,100,0,1,100,0,1,100,0,1,4,0,4,8,115,101,108,102,
+    10,111,116,104,101,114,6,10,95,95,99,109,112,16,111,112,101,114,97,116,111,114,4,108,
+    116,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,12,95,95,108,101,95,95,
+    104,106,16,16,0,22,0,16,1,18,1,20,2,72,2,74,0,74,5,106,0,1,106,0,
+    0,106,0,1,106,0,1,106,0,2,106,0,1,106,0,1,106,0,1,4,0,4,8,115,
+    101,108,102,10,111,116,104,101,114,6,10,95,95,99,109,112,16,111,112,101,114,97,116,111,
+    114,4,108,101,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,12,95,95,103,
+    116,95,95,110,112,16,16,0,22,0,16,1,18,1,20,2,72,2,74,0,74,5,112,0,
+    1,112,0,0,112,0,1,112,0,1,112,0,2,112,0,1,112,0,1,112,0,1,4,0,
+    4,8,115,101,108,102,10,111,116,104,101,114,6,10,95,95,99,109,112,16,111,112,101,114,
+    97,116,111,114,4,103,116,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,12,
+    95,95,103,101,95,95,116,118,16,16,0,22,0,16,1,18,1,20,2,72,2,74,0,74,
+    5,118,0,1,118,0,0,118,0,1,118,0,1,118,0,2,118,0,1,118,0,1,118,0,
+    1,4,0,4,8,115,101,108,102,10,111,116,104,101,114,6,10,95,95,99,109,112,16,111,
+    112,101,114,97,116,111,114,4,103,101,2,0,1,0,1,1,0,4,0,2,0,1,1,0,
+    2,1,14,95,95,115,116,114,95,95,122,124,26,131,0,20,0,7,0,131,0,20,1,104,
+    1,7,0,131,0,20,2,104,1,41,5,74,0,74,5,124,0,1,124,0,0,124,0,1,
+    124,0,1,124,0,2,124,0,1,124,0,1,124,0,1,124,0,4,124,0,1,124,0,1,
+    124,0,1,124,0,1,6,4,5,2,45,5,6,58,48,50,2,8,115,101,108,102,6,8,
+    121,101,97,114,10,109,111,110,116,104,6,100,97,121,2,0,1,0,1,1,0,2,0,0,
+    1,1,0,2,1,16,95,95,114,101,112,114,95,95,128,1,130,1,26,7,0,131,0,20,
+    0,7,1,131,0,20,1,7,1,131,0,20,2,7,2,41,7,74,0,74,5,130,1,0,
+    1,130,1,0,1,130,1,0,0,130,1,0,1,130,1,0,1,130,1,0,2,130,1,0,
+    1,130,1,0,1,130,1,0,4,130,1,0,1,130,1,0,1,130,1,0,1,130,1,0,
+    1,6,6,5,28,100,97,116,101,116,105,109,101,46,100,97,116,101,40,5,4,44,32,5,
+    2,41,2,8,115,101,108,102,6,8,121,101,97,114,10,109,111,110,116,104,6,100,97,121,
+    2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,16,95,95,105,110,105,116,95,95,
+    138,1,160,1,128,1,18,0,15,0,72,0,22,1,130,1,16,2,16,3,72,3,1,0,
+    11,0,16,4,2,0,5,0,56,0,69,3,11,23,56,0,81,0,65,6,18,2,15,0,
+    7,0,72,1,100,0,130,4,16,0,27,3,11,0,16,5,2,0,5,0,56,0,69,3,
+    11,59,56,0,81,0,65,6,18,2,15,0,7,1,72,1,100,0,130,5,16,0,27,4,
+    11,0,16,6,2,0,5,0,56,0,69,3,11,59,56,0,81,0,65,6,18,2,15,0,
+    7,2,72,1,100,0,130,6,16,0,27,5,74,5,140,1,0,1,140,1,0,1,140,1,
+    0,1,140,1,0,0,140,1,0,1,140,1,0,1,140,1,0,1,140,1,0,1,140,1,
+    0,1,144,1,0,1,144,1,0,1,144,1,0,1,144,1,0,1,144,1,0,1,144,1,
+    0,1,144,1,0,1,144,1,0,1,144,1,0,1,144,1,0,1,146,1,0,1,146,1,
+    0,1,146,1,0,1,146,1,0,1,146,1,0,1,148,1,0,1,148,1,0,1,148,1,
+    0,2,150,1,0,1,150,1,0,1,150,1,0,1,150,1,0,1,150,1,0,1,150,1,
+    0,1,150,1,0,1,150,1,0,1,150,1,0,1,150,1,0,1,152,1,0,1,152,1,
+    0,1,152,1,0,1,152,1,0,1,152,1,0,1,154,1,0,1,154,1,0,1,154,1,
+    0,4,156,1,0,1,156,1,0,1,156,1,0,1,156,1,0,1,156,1,0,1,156,1,
+    0,1,156,1,0,1,156,1,0,1,156,1,0,1,156,1,0,1,158,1,0,1,158,1,
+    0,1,158,1,0,1,158,1,0,1,158,1,0,1,160,1,0,1,160,1,0,1,160,1,
+    0,6,160,1,0,1,8,6,5,58,72,111,117,114,32,109,117,115,116,32,98,101,32,98,
+    101,116,119,101,101,110,32,48,32,97,110,100,32,50,51,5,62,77,105,110,117,116,101,32,
+    109,117,115,116,32,98,101,32,98,101,116,119,101,101,110,32,48,32,97,110,100,32,53,57,
+    5,62,83,101,99,111,110,100,32,109,117,115,116,32,98,101,32,98,101,116,119,101,101,110,
+    32,48,32,97,110,100,32,53,57,14,8,115,101,108,102,8,121,101,97,114,10,109,111,110,
+    116,104,6,100,97,121,8,104,111,117,114,12,109,105,110,117,116,101,12,115,101,99,111,110,
+    100,12,10,115,117,112,101,114,16,95,95,105,110,105,116,95,95,20,86,97,108,117,101,69,
+    114,114,111,114,8,104,111,117,114,12,109,105,110,117,116,101,12,115,101,99,111,110,100,2,
+    0,1,0,1,1,0,14,0,2,4,6,8,10,12,0,1,1,0,2,1,8,100,97,116,
+    101,164,1,166,1,22,18,0,15,0,131,0,20,1,131,0,20,2,131,0,20,3,72,3,
+    74,0,74,5,166,1,0,1,166,1,0,1,166,1,0,1,166,1,0,0,166,1,0,1,
+    166,1,0,2,166,1,0,1,166,1,0,4,166,1,0,1,166,1,0,1,166,1,0,1,
+    6,0,2,8,115,101,108,102,8,8,100,97,116,101,8,121,101,97,114,10,109,111,110,116,
+    104,6,100,97,121,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,6,110,111,119,
+    172,1,182,1,58,18,0,15,0,72,0,24,0,131,0,20,1,24,1,16,1,11,60,132,
+    57,65,3,11,59,24,1,18,2,15,0,131,0,20,3,131,0,20,4,131,0,20,5,131,
+    0,20,6,131,0,20,7,16,1,72,6,74,0,74,5,174,1,0,1,174,1,0,1,174,
+    1,0,1,174,1,0,1,176,1,0,1,176,1,0,0,176,1,0,1,178,1,0,1,178,
+    1,0,1,178,1,0,1,178,1,0,1,180,1,0,1,180,1,0,1,182,1,0,1,182,
+    1,0,1,182,1,0,1,182,1,0,2,182,1,0,1,182,1,0,4,182,1,0,1,182,
+    1,0,6,182,1,0,1,182,1,0,8,182,1,0,1,182,1,0,10,182,1,0,1,182,
+    1,0,1,182,1,0,1,182,1,0,1,12,0,4,2,116,12,116,109,95,115,101,99,16,
+    18,108,111,99,97,108,116,105,109,101,12,116,109,95,115,101,99,16,100,97,116,101,116,105,
+    109,101,14,116,109,95,121,101,97,114,12,116,109,95,109,111,110,14,116,109,95,109,100,97,
+    121,14,116,109,95,104,111,117,114,12,116,109,95,109,105,110,2,0,1,0,1,1,0,0,
+    0,1,1,0,2,1,14,95,95,115,116,114,95,95,186,1,188,1,50,131,0,20,0,7,
+    0,131,0,20,1,104,1,7,0,131,0,20,2,104,1,7,2,131,0,20,3,104,1,7,
+    3,131,0,20,4,104,1,7,3,131,0,20,5,104,1,41,11,74,0,74,5,188,1,0,
+    1,188,1,0,0,188,1,0,1,188,1,0,1,188,1,0,2,188,1,0,1,188,1,0,
+    1,188,1,0,1,188,1,0,4,188,1,0,1,188,1,0,1,188,1,0,1,188,1,0,
+    6,188,1,0,1,188,1,0,1,188,1,0,1,188,1,0,8,188,1,0,1,188,1,0,
+    1,188,1,0,1,188,1,0,10,188,1,0,1,188,1,0,1,188,1,0,1,188,1,0,
+    1,12,8,5,2,45,5,6,58,48,50,5,2,32,5,2,58,2,8,115,101,108,102,12,
+    8,121,101,97,114,10,109,111,110,116,104,6,100,97,121,8,104,111,117,114,12,109,105,110,
+    117,116,101,12,115,101,99,111,110,100,2,0,1,0,1,1,0,2,0,0,1,1,0,2,
+    1,16,95,95,114,101,112,114,95,95,192,1,194,1,44,7,0,131,0,20,0,7,1,131,
+    0,20,1,7,1,131,0,20,2,7,1,131,0,20,3,7,1,131,0,20,4,7,1,131,
+    0,20,5,7,2,41,13,74,0,74,5,194,1,0,1,194,1,0,1,194,1,0,0,194,
+    1,0,1,194,1,0,1,194,1,0,2,194,1,0,1,194,1,0,1,194,1,0,4,194,
+    1,0,1,194,1,0,1,194,1,0,6,194,1,0,1,194,1,0,1,194,1,0,8,194,
+    1,0,1,194,1,0,1,194,1,0,10,194,1,0,1,194,1,0,1,194,1,0,1,194,
+    1,0,1,12,6,5,36,100,97,116,101,116,105,109,101,46,100,97,116,101,116,105,109,101,
+    40,5,4,44,32,5,2,41,2,8,115,101,108,102,12,8,121,101,97,114,10,109,111,110,
+    116,104,6,100,97,121,8,104,111,117,114,12,109,105,110,117,116,101,12,115,101,99,111,110,
+    100,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,10,95,95,99,109,112,198,1,
+    224,1,176,1,18,0,15,0,16,1,18,1,72,2,81,0,65,3,18,2,74,0,131,0,
+    20,3,131,1,20,3,132,58,65,9,16,2,15,0,131,0,20,3,131,1,20,3,72,2,
+    74,0,131,0,20,4,131,1,20,4,132,58,65,9,16,2,15,0,131,0,20,4,131,1,
+    20,4,72,2,74,0,131,0,20,5,131,1,20,5,132,58,65,9,16,2,15,0,131,0,
+    20,5,131,1,20,5,72,2,74,0,131,0,20,6,131,1,20,6,132,58,65,9,16,2,
+    15,0,131,0,20,6,131,1,20,6,72,2,74,0,131,0,20,7,131,1,20,7,132,58,
+    65,9,16,2,15,0,131,0,20,7,131,1,20,7,72,2,74,0,16,2,15,0,131,0,
+    20,8,131,1,20,8,72,2,74,0,74,5,200,1,0,1,200,1,0,1,200,1,0,1,
+    200,1,0,1,200,1,0,1,200,1,0,1,200,1,0,1,202,1,0,1,202,1,0,1,
+    204,1,0,1,204,1,0,0,204,1,0,1,204,1,0,2,204,1,0,1,204,1,0,1,
+    206,1,0,1,206,1,0,1,206,1,0,1,206,1,0,4,206,1,0,1,206,1,0,6,
+    206,1,0,1,206,1,0,1,208,1,0,1,208,1,0,8,208,1,0,1,208,1,0,10,
+    208,1,0,1,208,1,0,1,210,1,0,1,210,1,0,1,210,1,0,1,210,1,0,12,
+    210,1,0,1,210,1,0,14,210,1,0,1,210,1,0,1,212,1,0,1,212,1,0,16,
+    212,1,0,1,212,1,0,18,212,1,0,1,212,1,0,1,214,1,0,1,214,1,0,1,
+    214,1,0,1,214,1,0,20,214,1,0,1,214,1,0,22,214,1,0,1,214,1,0,1,
+    216,1,0,1,216,1,0,24,216,1,0,1,216,1,0,26,216,1,0,1,216,1,0,1,
+    218,1,0,1,218,1,0,1,218,1,0,1,218,1,0,28,218,1,0,1,218,1,0,30,
+    218,1,0,1,218,1,0,1,220,1,0,1,220,1,0,32,220,1,0,1,220,1,0,34,
+    220,1,0,1,220,1,0,1,222,1,0,1,222,1,0,1,222,1,0,1,222,1,0,36,
+    222,1,0,1,222,1,0,38,222,1,0,1,222,1,0,1,224,1,0,1,224,1,0,1,
+    224,1,0,1,224,1,0,40,224,1,0,1,224,1,0,42,224,1,0,1,224,1,0,1,
+    224,1,0,1,44,0,6,8,115,101,108,102,10,111,116,104,101,114,4,111,112,18,20,105,
+    115,105,110,115,116,97,110,99,101,16,100,97,116,101,116,105,109,101,28,78,111,116,73,109,
+    112,108,101,109,101,110,116,101,100,8,121,101,97,114,10,109,111,110,116,104,6,100,97,121,
+    8,104,111,117,114,12,109,105,110,117,116,101,12,115,101,99,111,110,100,2,0,1,0,1,
+    1,0,6,0,2,4,0,1,1,0,2,1,12,95,95,101,113,95,95,228,1,230,1,16,
+    16,0,22,0,16,1,18,1,20,2,72,2,74,0,74,5,230,1,0,1,230,1,0,0,
+    230,1,0,1,230,1,0,1,230,1,0,2,230,1,0,1,230,1,0,1,230,1,0,1,
+    4,0,4,8,115,101,108,102,10,111,116,104,101,114,6,10,95,95,99,109,112,16,111,112,
+    101,114,97,116,111,114,4,101,113,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,
+    1,12,95,95,110,101,95,95,234,1,236,1,16,16,0,22,0,16,1,18,1,20,2,72,
+    2,74,0,74,5,236,1,0,1,236,1,0,0,236,1,0,1,236,1,0,1,236,1,0,
+    2,236,1,0,1,236,1,0,1,236,1,0,1,4,0,4,8,115,101,108,102,10,111,116,
+    104,101,114,6,10,95,95,99,109,112,16,111,112,101,114,97,116,111,114,4,110,101,2,0,
+    1,0,1,1,0,4,0,2,0,1,1,0,2,1,12,95,95,108,116,95,95,240,1,242,
+    1,16,16,0,22,0,16,1,18,1,20,2,72,2,74,0,74,5,242,1,0,1,242,1,
+    0,0,242,1,0,1,242,1,0,1,242,1,0,2,242,1,0,1,242,1,0,1,242,1,
+    0,1,4,0,4,8,115,101,108,102,10,111,116,104,101,114,6,10,95,95,99,109,112,16,
+    111,112,101,114,97,116,111,114,4,108,116,2,0,1,0,1,1,0,4,0,2,0,1,1,
+    0,2,1,12,95,95,108,101,95,95,246,1,248,1,16,16,0,22,0,16,1,18,1,20,
+    2,72,2,74,0,74,5,248,1,0,1,248,1,0,0,248,1,0,1,248,1,0,1,248,
+    1,0,2,248,1,0,1,248,1,0,1,248,1,0,1,4,0,4,8,115,101,108,102,10,
+    111,116,104,101,114,6,10,95,95,99,109,112,16,111,112,101,114,97,116,111,114,4,108,101,
+    2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,12,95,95,103,116,95,95,252,
+    1,254,1,16,16,0,22,0,16,1,18,1,20,2,72,2,74,0,74,5,254,1,0,1,
+    254,1,0,0,254,1,0,1,254,1,0,1,254,1,0,2,254,1,0,1,254,1,0,1,
+    254,1,0,1,4,0,4,8,115,101,108,102,10,111,116,104,101,114,6,10,95,95,99,109,
+    112,16,111,112,101,114,97,116,111,114,4,103,116,2,0,1,0,1,1,0,4,0,2,0,
+    1,1,0,2,1,12,95,95,103,101,95,95,130,2,132,2,16,16,0,22,0,16,1,18,
+    1,20,2,72,2,74,0,74,5,132,2,0,1,132,2,0,0,132,2,0,1,132,2,0,
+    1,132,2,0,2,132,2,0,1,132,2,0,1,132,2,0,1,4,0,4,8,115,101,108,
+    102,10,111,116,104,101,114,6,10,95,95,99,109,112,16,111,112,101,114,97,116,111,114,4,
+    103,101,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,
+};
+static const unsigned char kPythonLibsBytecode_functools[] = {
+    112,107,99,2,10,50,46,49,46,53,182,93,159,58,113,46,203,6,0,0,24,102,117,110,
+    99,116,111,111,108,115,46,112,121,75,15,6,168,20,32,57,17,232,23,24,102,117,110,99,
+    116,111,111,108,115,46,112,121,2,108,48,8,0,90,0,14,0,92,1,14,1,92,2,91,
+    0,8,0,90,3,14,2,92,1,14,3,92,2,91,3,14,4,26,4,8,0,90,5,14,
+    5,92,1,14,6,92,2,91,5,74,5,2,0,1,2,0,1,4,0,1,4,0,1,12,
+    0,1,12,0,1,12,0,1,22,0,1,22,0,1,24,0,1,24,0,1,32,0,1,32,
+    0,1,32,0,1,62,0,1,62,0,1,88,0,1,88,0,1,90,0,1,90,0,1,104,
+    0,1,104,0,1,104,0,1,104,0,1,0,0,0,12,10,99,97,99,104,101,16,95,95,
+    105,110,105,116,95,95,16,95,95,99,97,108,108,95,95,18,108,114,117,95,99,97,99,104,
+    101,12,114,101,100,117,99,101,14,112,97,114,116,105,97,108,2,0,1,0,1,1,14,16,
+    95,95,105,110,105,116,95,95,4,8,14,130,1,16,0,27,0,38,0,16,0,27,1,74,
+    5,6,0,1,6,0,1,6,0,0,8,0,1,8,0,1,8,0,2,8,0,1,4,0,
+    4,8,115,101,108,102,2,102,4,2,102,10,99,97,99,104,101,2,0,1,0,1,1,0,
+    4,0,2,0,1,1,0,2,1,16,95,95,99,97,108,108,95,95,12,18,40,131,0,20,
+    0,16,1,62,1,65,10,16,0,22,1,16,1,82,1,73,1,131,0,20,0,16,1,28,
+    0,131,0,20,0,16,1,23,0,74,0,74,5,14,0,1,14,0,0,14,0,1,14,0,
+    1,14,0,1,16,0,1,16,0,2,16,0,1,16,0,1,16,0,1,16,0,1,16,0,
+    4,16,0,1,16,0,1,18,0,1,18,0,6,18,0,1,18,0,1,18,0,1,18,0,
+    1,8,0,4,8,115,101,108,102,8,97,114,103,115,4,10,99,97,99,104,101,2,102,2,
+    0,1,0,1,1,0,2,0,0,2,1,0,1,1,16,95,95,105,110,105,116,95,95,24,
+    28,14,130,1,16,0,27,0,38,0,16,0,27,1,74,5,26,0,1,26,0,1,26,0,
+    0,28,0,1,28,0,1,28,0,2,28,0,1,4,0,4,8,115,101,108,102,14,109,97,
+    120,115,105,122,101,4,14,109,97,120,115,105,122,101,10,99,97,99,104,101,2,0,1,0,
+    1,1,0,2,0,2,2,14,109,97,120,115,105,122,101,3,128,2,1,1,0,1,1,16,
+    95,95,99,97,108,108,95,95,32,58,10,14,0,24,2,16,2,74,0,74,5,34,0,1,
+    34,0,1,58,0,1,58,0,1,58,0,1,0,0,6,8,115,101,108,102,2,102,14,119,
+    114,97,112,112,101,100,0,2,0,1,0,1,1,2,14,119,114,97,112,112,101,100,34,56,
+    112,18,0,20,1,16,0,62,0,65,14,18,0,20,1,22,2,16,0,72,1,24,1,16,
+    1,18,0,20,1,16,0,28,0,16,1,74,0,18,3,15,0,16,0,82,1,73,1,24,
+    1,18,4,15,0,18,0,20,1,72,1,18,0,20,5,132,60,65,16,18,6,15,0,18,
+    7,15,0,18,0,20,1,72,1,72,1,24,2,18,0,20,1,22,2,16,2,72,1,1,
+    0,16,1,18,0,20,1,16,0,28,0,16,1,74,0,74,5,36,0,1,36,0,0,36,
+    0,1,36,0,1,36,0,1,38,0,1,38,0,2,38,0,4,38,0,1,38,0,1,38,
+    0,1,40,0,1,40,0,1,40,0,6,40,0,1,40,0,1,42,0,1,42,0,1,46,
+    0,1,46,0,1,46,0,1,46,0,1,46,0,1,46,0,1,48,0,1,48,0,1,48,
+    0,1,48,0,8,48,0,1,48,0,1,48,0,10,48,0,1,48,0,1,50,0,1,50,
+    0,1,50,0,1,50,0,1,50,0,1,50,0,12,50,0,1,50,0,1,50,0,1,52,
+    0,1,52,0,14,52,0,16,52,0,1,52,0,1,52,0,1,54,0,1,54,0,1,54,
+    0,18,54,0,1,54,0,1,56,0,1,56,0,1,56,0,1,20,0,6,8,97,114,103,
+    115,6,114,101,115,18,102,105,114,115,116,95,107,101,121,16,8,115,101,108,102,10,99,97,
+    99,104,101,6,112,111,112,2,102,6,108,101,110,14,109,97,120,115,105,122,101,8,110,101,
+    120,116,8,105,116,101,114,2,0,1,0,1,1,0,0,0,0,1,1,1,1,4,0,2,
+    0,1,1,0,2,1,12,114,101,100,117,99,101,62,84,92,18,0,15,0,16,1,72,1,
+    24,3,16,2,13,0,61,0,65,22,96,0,18,1,15,0,16,3,72,1,24,4,97,0,
+    63,13,18,2,98,0,65,9,99,0,18,3,15,0,7,0,72,1,100,0,97,0,63,2,
+    102,0,63,3,16,2,24,4,16,3,84,0,85,9,24,5,16,0,15,0,130,4,16,5,
+    72,2,24,4,63,248,255,3,16,4,74,0,74,5,64,0,1,64,0,1,64,0,1,64,
+    0,1,64,0,1,66,0,1,66,0,1,66,0,1,66,0,1,68,2,1,70,2,1,70,
+    2,1,70,2,1,70,2,1,70,2,1,70,2,1,70,2,1,72,0,1,72,0,1,72,
+    0,1,72,0,1,74,4,1,74,4,1,74,4,1,74,4,1,74,4,1,74,0,1,74,
+    0,1,74,0,1,76,0,1,78,0,1,78,0,1,80,0,1,80,0,1,80,6,1,80,
+    6,1,82,6,1,82,6,1,82,6,1,82,6,1,82,6,1,82,6,1,82,6,1,84,
+    0,1,84,0,1,84,0,1,0,2,5,96,114,101,100,117,99,101,40,41,32,111,102,32,
+    101,109,112,116,121,32,115,101,113,117,101,110,99,101,32,119,105,116,104,32,110,111,32,105,
+    110,105,116,105,97,108,32,118,97,108,117,101,12,16,102,117,110,99,116,105,111,110,16,115,
+    101,113,117,101,110,99,101,14,105,110,105,116,105,97,108,4,105,116,10,118,97,108,117,101,
+    14,101,108,101,109,101,110,116,8,8,105,116,101,114,8,110,101,120,116,26,83,116,111,112,
+    73,116,101,114,97,116,105,111,110,18,84,121,112,101,69,114,114,111,114,8,0,1,0,1,
+    1,2,0,18,34,1,5,0,42,52,1,3,0,68,86,1,0,4,0,2,2,4,14,105,
+    110,105,116,105,97,108,8,1,1,0,1,1,16,95,95,105,110,105,116,95,95,90,100,42,
+    130,1,16,0,27,0,18,1,15,0,16,1,72,1,81,0,65,6,18,2,15,0,7,0,
+    72,1,100,0,130,2,16,0,27,3,130,3,16,0,27,4,74,5,92,0,1,92,0,1,
+    92,0,0,94,0,1,94,0,1,94,0,1,94,0,1,94,0,1,94,0,1,96,0,1,
+    96,0,1,96,0,1,96,0,1,96,0,1,98,0,1,98,0,1,98,0,2,100,0,1,
+    100,0,1,100,0,4,100,0,1,6,2,5,70,116,104,101,32,102,105,114,115,116,32,97,
+    114,103,117,109,101,110,116,32,109,117,115,116,32,98,101,32,99,97,108,108,97,98,108,101,
+    8,8,115,101,108,102,2,102,8,97,114,103,115,12,107,119,97,114,103,115,10,2,102,16,
+    99,97,108,108,97,98,108,101,18,84,121,112,101,69,114,114,111,114,8,97,114,103,115,12,
+    107,119,97,114,103,115,2,0,1,0,1,1,0,4,0,2,0,4,6,0,1,1,16,95,
+    95,99,97,108,108,95,95,104,108,38,16,2,22,0,131,0,20,1,72,1,1,0,16,0,
+    22,2,131,0,20,3,82,1,16,1,82,1,11,0,16,2,82,2,73,130,2,74,0,74,
+    5,106,0,1,106,0,0,106,0,1,106,0,2,106,0,1,106,0,1,108,0,1,108,0,
+    4,108,0,1,108,0,6,108,0,1,108,0,1,108,0,1,108,0,1,108,0,1,108,0,
+    1,108,0,1,108,0,1,108,0,1,8,0,6,8,115,101,108,102,8,97,114,103,115,12,
+    107,119,97,114,103,115,8,12,117,112,100,97,116,101,12,107,119,97,114,103,115,2,102,8,
+    97,114,103,115,2,0,1,0,1,1,0,2,0,0,2,4,0,1,1,
+};
+static const unsigned char kPythonLibsBytecode_heapq[] = {
+    112,107,99,2,10,50,46,49,46,53,182,93,159,58,113,46,203,6,0,0,16,104,101,97,
+    112,113,46,112,121,23,220,75,174,206,199,172,206,158,49,16,104,101,97,112,113,46,112,121,
+    2,172,1,30,14,0,26,0,14,1,26,1,14,2,26,2,14,3,26,3,14,4,26,4,
+    14,5,26,5,14,6,26,6,74,5,4,0,1,4,0,1,14,0,1,14,0,1,34,0,
+    1,34,0,1,66,0,1,66,0,1,80,0,1,80,0,1,108,0,1,108,0,1,136,1,
+    0,1,136,1,0,1,136,1,0,1,0,0,0,14,16,104,101,97,112,112,117,115,104,14,
+    104,101,97,112,112,111,112,22,104,101,97,112,114,101,112,108,97,99,101,22,104,101,97,112,
+    112,117,115,104,112,111,112,14,104,101,97,112,105,102,121,18,95,115,105,102,116,100,111,119,
+    110,14,95,115,105,102,116,117,112,2,0,1,0,1,1,14,16,104,101,97,112,112,117,115,
+    104,4,10,40,0,0,0,0,16,0,22,0,16,1,72,1,1,0,18,1,15,0,16,0,
+    11,0,18,2,15,0,16,0,72,1,11,1,43,0,72,3,1,0,74,5,6,0,1,6,
+    0,1,8,0,1,8,0,0,8,0,1,8,0,1,8,0,1,10,0,1,10,0,1,10,
+    0,1,10,0,1,10,0,1,10,0,1,10,0,1,10,0,1,10,0,1,10,0,1,10,
+    0,1,10,0,1,10,0,1,2,2,5,104,80,117,115,104,32,105,116,101,109,32,111,110,
+    116,111,32,104,101,97,112,44,32,109,97,105,110,116,97,105,110,105,110,103,32,116,104,101,
+    32,104,101,97,112,32,105,110,118,97,114,105,97,110,116,46,4,8,104,101,97,112,8,105,
+    116,101,109,6,12,97,112,112,101,110,100,18,95,115,105,102,116,100,111,119,110,6,108,101,
+    110,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,0,14,104,101,97,112,112,111,
+    112,14,30,54,0,0,0,0,16,0,22,0,72,0,24,1,16,0,65,17,16,0,11,0,
+    23,0,24,2,130,1,16,0,11,0,28,0,18,1,15,0,16,0,11,0,72,2,1,0,
+    16,2,74,0,16,1,74,0,74,5,16,0,1,16,0,1,18,0,1,18,0,0,18,0,
+    1,18,0,1,20,0,1,20,0,1,22,0,1,22,0,1,22,0,1,22,0,1,24,0,
+    1,24,0,1,24,0,1,24,0,1,26,0,1,26,0,1,26,0,1,26,0,1,26,0,
+    1,26,0,1,28,0,1,28,0,1,30,0,1,30,0,1,30,0,1,2,2,5,134,1,
+    80,111,112,32,116,104,101,32,115,109,97,108,108,101,115,116,32,105,116,101,109,32,111,102,
+    102,32,116,104,101,32,104,101,97,112,44,32,109,97,105,110,116,97,105,110,105,110,103,32,
+    116,104,101,32,104,101,97,112,32,105,110,118,97,114,105,97,110,116,46,6,8,104,101,97,
+    112,14,108,97,115,116,101,108,116,20,114,101,116,117,114,110,105,116,101,109,4,6,112,111,
+    112,14,95,115,105,102,116,117,112,2,0,1,0,1,1,0,2,0,0,1,1,0,2,0,
+    22,104,101,97,112,114,101,112,108,97,99,101,34,62,38,0,0,0,0,16,0,11,0,23,
+    0,24,2,130,1,16,0,11,0,28,0,18,0,15,0,16,0,11,0,72,2,1,0,16,
+    2,74,0,74,5,54,0,1,54,0,1,56,0,1,56,0,1,56,0,1,56,0,1,58,
+    0,1,58,0,1,58,0,1,58,0,1,60,0,1,60,0,1,60,0,1,60,0,1,60,
+    0,1,60,0,1,62,0,1,62,0,1,62,0,1,0,2,5,228,6,80,111,112,32,97,
+    110,100,32,114,101,116,117,114,110,32,116,104,101,32,99,117,114,114,101,110,116,32,115,109,
+    97,108,108,101,115,116,32,118,97,108,117,101,44,32,97,110,100,32,97,100,100,32,116,104,
+    101,32,110,101,119,32,105,116,101,109,46,10,10,32,32,32,32,84,104,105,115,32,105,115,
+    32,109,111,114,101,32,101,102,102,105,99,105,101,110,116,32,116,104,97,110,32,104,101,97,
+    112,112,111,112,40,41,32,102,111,108,108,111,119,101,100,32,98,121,32,104,101,97,112,112,
+    117,115,104,40,41,44,32,97,110,100,32,99,97,110,32,98,101,10,32,32,32,32,109,111,
+    114,101,32,97,112,112,114,111,112,114,105,97,116,101,32,119,104,101,110,32,117,115,105,110,
+    103,32,97,32,102,105,120,101,100,45,115,105,122,101,32,104,101,97,112,46,32,32,78,111,
+    116,101,32,116,104,97,116,32,116,104,101,32,118,97,108,117,101,10,32,32,32,32,114,101,
+    116,117,114,110,101,100,32,109,97,121,32,98,101,32,108,97,114,103,101,114,32,116,104,97,
+    110,32,105,116,101,109,33,32,32,84,104,97,116,32,99,111,110,115,116,114,97,105,110,115,
+    32,114,101,97,115,111,110,97,98,108,101,32,117,115,101,115,32,111,102,10,32,32,32,32,
+    116,104,105,115,32,114,111,117,116,105,110,101,32,117,110,108,101,115,115,32,119,114,105,116,
+    116,101,110,32,97,115,32,112,97,114,116,32,111,102,32,97,32,99,111,110,100,105,116,105,
+    111,110,97,108,32,114,101,112,108,97,99,101,109,101,110,116,58,10,10,32,32,32,32,32,
+    32,32,32,105,102,32,105,116,101,109,32,62,32,104,101,97,112,91,48,93,58,10,32,32,
+    32,32,32,32,32,32,32,32,32,32,105,116,101,109,32,61,32,104,101,97,112,114,101,112,
+    108,97,99,101,40,104,101,97,112,44,32,105,116,101,109,41,10,32,32,32,32,6,8,104,
+    101,97,112,8,105,116,101,109,20,114,101,116,117,114,110,105,116,101,109,2,14,95,115,105,
+    102,116,117,112,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,0,22,104,101,97,
+    112,112,117,115,104,112,111,112,66,76,58,0,0,0,0,16,0,68,6,16,0,11,0,23,
+    0,16,1,132,55,65,17,16,0,11,0,23,0,16,1,36,2,88,2,16,0,11,0,28,
+    0,24,1,18,0,15,0,16,0,11,0,72,2,1,0,16,1,74,0,74,5,68,0,1,
+    68,0,1,70,0,1,70,0,1,70,0,1,70,0,1,70,0,1,70,0,1,70,0,1,
+    70,0,1,72,0,1,72,0,1,72,0,1,72,0,1,72,0,1,72,0,1,72,0,1,
+    72,0,1,72,0,1,72,0,1,74,0,1,74,0,1,74,0,1,74,0,1,74,0,1,
+    74,0,1,76,0,1,76,0,1,76,0,1,0,2,5,98,70,97,115,116,32,118,101,114,
+    115,105,111,110,32,111,102,32,97,32,104,101,97,112,112,117,115,104,32,102,111,108,108,111,
+    119,101,100,32,98,121,32,97,32,104,101,97,112,112,111,112,46,4,8,104,101,97,112,8,
+    105,116,101,109,2,14,95,115,105,102,116,117,112,2,0,1,0,1,1,0,4,0,2,0,
+    1,1,0,2,0,14,104,101,97,112,105,102,121,80,98,54,0,0,0,0,18,0,15,0,
+    16,0,72,1,24,1,18,1,15,0,18,2,15,0,16,1,11,2,46,0,72,1,72,1,
+    84,0,85,9,24,2,18,3,15,0,130,0,16,2,72,2,1,0,63,248,255,3,74,5,
+    82,0,1,82,0,1,84,0,1,84,0,1,84,0,1,84,0,1,84,0,1,96,0,1,
+    96,0,1,96,0,1,96,0,1,96,0,1,96,0,1,96,0,1,96,0,1,96,0,1,
+    96,0,1,96,2,1,96,2,1,98,2,1,98,2,1,98,2,1,98,2,1,98,2,1,
+    98,2,1,98,2,1,98,0,1,0,2,5,112,84,114,97,110,115,102,111,114,109,32,108,
+    105,115,116,32,105,110,116,111,32,97,32,104,101,97,112,44,32,105,110,45,112,108,97,99,
+    101,44,32,105,110,32,79,40,108,101,110,40,120,41,41,32,116,105,109,101,46,6,2,120,
+    2,110,2,105,8,6,108,101,110,16,114,101,118,101,114,115,101,100,10,114,97,110,103,101,
+    14,95,115,105,102,116,117,112,4,0,1,0,1,1,3,0,34,52,1,0,2,0,0,1,
+    1,0,2,0,18,95,115,105,102,116,100,111,119,110,108,132,1,72,130,0,16,2,23,0,
+    24,3,130,2,16,1,132,59,65,24,16,2,11,1,43,0,11,1,50,0,24,4,130,0,
+    16,4,23,0,24,5,130,3,16,5,132,55,65,8,130,5,16,0,16,2,28,0,16,4,
+    24,2,70,232,255,3,71,2,63,230,255,3,130,3,16,0,16,2,28,0,74,5,110,0,
+    1,110,0,1,110,0,1,110,0,1,116,2,1,116,2,1,116,2,1,116,2,1,118,2,
+    1,118,2,1,118,2,1,118,2,1,118,2,1,118,2,1,120,2,1,120,2,1,120,2,
+    1,120,2,1,122,2,1,122,2,1,122,2,1,122,2,1,124,2,1,124,2,1,124,2,
+    1,124,2,1,126,2,1,126,2,1,128,1,2,1,130,1,2,1,130,1,2,1,132,1,
+    0,1,132,1,0,1,132,1,0,1,132,1,0,1,132,1,0,1,0,0,12,8,104,101,
+    97,112,16,115,116,97,114,116,112,111,115,6,112,111,115,14,110,101,119,105,116,101,109,18,
+    112,97,114,101,110,116,112,111,115,12,112,97,114,101,110,116,0,4,0,1,0,1,1,1,
+    0,8,62,1,0,6,0,2,4,0,1,1,0,2,1,14,95,115,105,102,116,117,112,136,
+    1,172,1,134,1,18,0,15,0,16,0,72,1,24,2,16,1,24,3,130,0,16,1,23,
+    0,24,4,11,2,16,1,44,0,134,1,42,0,24,5,130,5,16,2,132,55,65,35,16,
+    5,134,1,42,0,24,6,130,6,16,2,55,0,68,9,130,0,16,5,23,0,130,0,16,
+    6,23,0,55,0,81,0,65,3,16,6,24,5,130,0,16,5,23,0,130,0,16,1,28,
+    0,16,5,24,1,11,2,16,1,44,0,134,1,42,0,24,5,63,219,255,3,130,4,16,
+    0,16,1,28,0,18,1,15,0,130,0,16,3,16,1,72,3,1,0,74,5,138,1,0,
+    1,138,1,0,1,138,1,0,1,138,1,0,1,138,1,0,1,140,1,0,1,140,1,0,
+    1,142,1,0,1,142,1,0,1,142,1,0,1,142,1,0,1,146,1,0,1,146,1,0,
+    1,146,1,0,1,146,1,0,1,146,1,0,1,146,1,0,1,148,1,2,1,148,1,2,
+    1,148,1,2,1,148,1,2,1,152,1,2,1,152,1,2,1,152,1,2,1,152,1,2,
+    1,154,1,2,1,154,1,2,1,154,1,2,1,154,1,2,1,154,1,2,1,154,1,2,
+    1,154,1,2,1,154,1,2,1,154,1,2,1,154,1,2,1,154,1,2,1,154,1,2,
+    1,154,1,2,1,156,1,2,1,156,1,2,1,160,1,2,1,160,1,2,1,160,1,2,
+    1,160,1,2,1,160,1,2,1,160,1,2,1,162,1,2,1,162,1,2,1,164,1,2,
+    1,164,1,2,1,164,1,2,1,164,1,2,1,164,1,2,1,164,1,2,1,164,1,2,
+    1,170,1,0,1,170,1,0,1,170,1,0,1,170,1,0,1,172,1,0,1,172,1,0,
+    1,172,1,0,1,172,1,0,1,172,1,0,1,172,1,0,1,172,1,0,1,172,1,0,
+    1,0,0,14,8,104,101,97,112,6,112,111,115,12,101,110,100,112,111,115,16,115,116,97,
+    114,116,112,111,115,14,110,101,119,105,116,101,109,16,99,104,105,108,100,112,111,115,16,114,
+    105,103,104,116,112,111,115,4,6,108,101,110,18,95,115,105,102,116,100,111,119,110,4,0,
+    1,0,1,1,1,0,34,110,1,0,4,0,2,0,1,1,0,2,1,
+};
+static const unsigned char kPythonLibsBytecode_linalg[] = {
+    112,107,99,2,10,50,46,49,46,53,182,93,159,58,113,46,203,6,0,0,18,108,105,110,
+    97,108,103,46,112,121,202,205,2,16,151,158,22,156,38,18,108,105,110,97,108,103,46,112,
+    121,2,2,6,86,0,87,0,74,5,2,0,1,2,0,1,2,0,1,0,2,5,10,118,
+    109,97,116,104,0,0,2,0,1,0,1,1,0,
+};
+static const unsigned char kPythonLibsBytecode_operator[] = {
+    112,107,99,2,10,50,46,49,46,53,182,93,159,58,113,46,203,6,0,0,22,111,112,101,
+    114,97,116,111,114,46,112,121,82,243,237,107,24,69,136,35,210,21,22,111,112,101,114,97,
+    116,111,114,46,112,121,2,98,162,1,14,0,26,0,14,1,26,1,14,2,26,2,14,3,
+    26,3,14,4,26,4,14,5,26,5,14,6,26,6,14,7,26,7,14,8,26,8,14,9,
+    26,9,14,10,26,10,14,11,26,11,14,12,26,12,14,13,26,13,14,14,26,14,14,15,
+    26,15,14,16,26,16,14,17,26,17,14,18,26,18,14,19,26,19,14,20,26,20,14,21,
+    26,21,14,22,26,22,14,23,26,23,14,24,26,24,14,25,26,25,14,26,26,26,14,27,
+    26,27,14,28,26,28,14,29,26,29,14,30,26,30,14,31,26,31,14,32,26,32,14,33,
+    26,33,14,34,26,34,14,35,26,35,14,36,26,36,14,37,26,37,14,38,26,38,14,39,
+    26,39,74,5,6,0,1,6,0,1,8,0,1,8,0,1,10,0,1,10,0,1,12,0,
+    1,12,0,1,14,0,1,14,0,1,16,0,1,16,0,1,20,0,1,20,0,1,22,0,
+    1,22,0,1,24,0,1,24,0,1,26,0,1,26,0,1,28,0,1,28,0,1,30,0,
+    1,30,0,1,34,0,1,34,0,1,36,0,1,36,0,1,38,0,1,38,0,1,40,0,
+    1,40,0,1,42,0,1,42,0,1,46,0,1,46,0,1,48,0,1,48,0,1,50,0,
+    1,50,0,1,52,0,1,52,0,1,54,0,1,54,0,1,56,0,1,56,0,1,58,0,
+    1,58,0,1,60,0,1,60,0,1,62,0,1,62,0,1,66,0,1,66,0,1,68,0,
+    1,68,0,1,70,0,1,70,0,1,74,0,1,74,0,1,76,0,1,76,0,1,78,0,
+    1,78,0,1,80,0,1,80,0,1,82,0,1,82,0,1,84,0,1,84,0,1,90,0,
+    1,90,0,1,92,0,1,92,0,1,94,0,1,94,0,1,96,0,1,96,0,1,98,0,
+    1,98,0,1,98,0,1,0,0,0,80,4,108,101,4,108,116,4,103,101,4,103,116,4,
+    101,113,4,110,101,8,97,110,100,95,6,111,114,95,6,120,111,114,12,105,110,118,101,114,
+    116,12,108,115,104,105,102,116,12,114,115,104,105,102,116,6,105,115,95,12,105,115,95,110,
+    111,116,8,110,111,116,95,10,116,114,117,116,104,16,99,111,110,116,97,105,110,115,6,97,
+    100,100,6,115,117,98,6,109,117,108,14,116,114,117,101,100,105,118,16,102,108,111,111,114,
+    100,105,118,6,109,111,100,6,112,111,119,6,110,101,103,12,109,97,116,109,117,108,14,103,
+    101,116,105,116,101,109,14,115,101,116,105,116,101,109,14,100,101,108,105,116,101,109,8,105,
+    97,100,100,8,105,115,117,98,8,105,109,117,108,16,105,116,114,117,101,100,105,118,18,105,
+    102,108,111,111,114,100,105,118,8,105,109,111,100,8,105,97,110,100,6,105,111,114,8,105,
+    120,111,114,14,105,108,115,104,105,102,116,14,105,114,115,104,105,102,116,2,0,1,0,1,
+    1,80,4,108,101,6,6,10,130,0,16,1,56,0,74,0,74,5,6,0,1,6,0,1,
+    6,0,1,6,0,1,6,0,1,0,0,4,2,97,2,98,0,2,0,1,0,1,1,0,
+    4,0,2,0,1,1,0,2,1,4,108,116,8,8,10,130,0,16,1,55,0,74,0,74,
+    5,8,0,1,8,0,1,8,0,1,8,0,1,8,0,1,0,0,4,2,97,2,98,0,
+    2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,4,103,101,10,10,10,130,0,
+    16,1,60,0,74,0,74,5,10,0,1,10,0,1,10,0,1,10,0,1,10,0,1,0,
+    0,4,2,97,2,98,0,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,4,
+    103,116,12,12,10,130,0,16,1,59,0,74,0,74,5,12,0,1,12,0,1,12,0,1,
+    12,0,1,12,0,1,0,0,4,2,97,2,98,0,2,0,1,0,1,1,0,4,0,2,
+    0,1,1,0,2,1,4,101,113,14,14,10,130,0,16,1,57,0,74,0,74,5,14,0,
+    1,14,0,1,14,0,1,14,0,1,14,0,1,0,0,4,2,97,2,98,0,2,0,1,
+    0,1,1,0,4,0,2,0,1,1,0,2,1,4,110,101,16,16,10,130,0,16,1,58,
+    0,74,0,74,5,16,0,1,16,0,1,16,0,1,16,0,1,16,0,1,0,0,4,2,
+    97,2,98,0,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,8,97,110,100,
+    95,20,20,10,130,0,16,1,51,0,74,0,74,5,20,0,1,20,0,1,20,0,1,20,
+    0,1,20,0,1,0,0,4,2,97,2,98,0,2,0,1,0,1,1,0,4,0,2,0,
+    1,1,0,2,1,6,111,114,95,22,22,10,130,0,16,1,52,0,74,0,74,5,22,0,
+    1,22,0,1,22,0,1,22,0,1,22,0,1,0,0,4,2,97,2,98,0,2,0,1,
+    0,1,1,0,4,0,2,0,1,1,0,2,1,6,120,111,114,24,24,10,130,0,16,1,
+    53,0,74,0,74,5,24,0,1,24,0,1,24,0,1,24,0,1,24,0,1,0,0,4,
+    2,97,2,98,0,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,12,105,110,
+    118,101,114,116,26,26,8,16,0,83,0,74,0,74,5,26,0,1,26,0,1,26,0,1,
+    26,0,1,0,0,2,2,97,0,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,
+    12,108,115,104,105,102,116,28,28,10,130,0,16,1,49,0,74,0,74,5,28,0,1,28,
+    0,1,28,0,1,28,0,1,28,0,1,0,0,4,2,97,2,98,0,2,0,1,0,1,
+    1,0,4,0,2,0,1,1,0,2,1,12,114,115,104,105,102,116,30,30,10,130,0,16,
+    1,50,0,74,0,74,5,30,0,1,30,0,1,30,0,1,30,0,1,30,0,1,0,0,
+    4,2,97,2,98,0,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,6,105,
+    115,95,34,34,10,130,0,16,1,61,0,74,0,74,5,34,0,1,34,0,1,34,0,1,
+    34,0,1,34,0,1,0,0,4,2,97,2,98,0,2,0,1,0,1,1,0,4,0,2,
+    0,1,1,0,2,1,12,105,115,95,110,111,116,36,36,10,130,0,16,1,61,1,74,0,
+    74,5,36,0,1,36,0,1,36,0,1,36,0,1,36,0,1,0,0,4,2,97,2,98,
+    0,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,8,110,111,116,95,38,38,
+    8,16,0,81,0,74,0,74,5,38,0,1,38,0,1,38,0,1,38,0,1,0,0,2,
+    2,97,0,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,10,116,114,117,116,104,
+    40,40,12,18,0,15,0,16,0,72,1,74,0,74,5,40,0,1,40,0,1,40,0,1,
+    40,0,1,40,0,1,40,0,1,0,0,2,2,97,2,8,98,111,111,108,2,0,1,0,
+    1,1,0,2,0,0,1,1,0,2,1,16,99,111,110,116,97,105,110,115,42,42,10,130,
+    0,16,1,62,0,74,0,74,5,42,0,1,42,0,1,42,0,1,42,0,1,42,0,1,
+    0,0,4,2,97,2,98,0,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,
+    6,97,100,100,46,46,10,130,0,16,1,42,0,74,0,74,5,46,0,1,46,0,1,46,
+    0,1,46,0,1,46,0,1,0,0,4,2,97,2,98,0,2,0,1,0,1,1,0,4,
+    0,2,0,1,1,0,2,1,6,115,117,98,48,48,10,130,0,16,1,43,0,74,0,74,
+    5,48,0,1,48,0,1,48,0,1,48,0,1,48,0,1,0,0,4,2,97,2,98,0,
+    2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,6,109,117,108,50,50,10,130,
+    0,16,1,44,0,74,0,74,5,50,0,1,50,0,1,50,0,1,50,0,1,50,0,1,
+    0,0,4,2,97,2,98,0,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,
+    14,116,114,117,101,100,105,118,52,52,10,130,0,16,1,45,0,74,0,74,5,52,0,1,
+    52,0,1,52,0,1,52,0,1,52,0,1,0,0,4,2,97,2,98,0,2,0,1,0,
+    1,1,0,4,0,2,0,1,1,0,2,1,16,102,108,111,111,114,100,105,118,54,54,10,
+    130,0,16,1,46,0,74,0,74,5,54,0,1,54,0,1,54,0,1,54,0,1,54,0,
+    1,0,0,4,2,97,2,98,0,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,
+    1,6,109,111,100,56,56,10,130,0,16,1,47,0,74,0,74,5,56,0,1,56,0,1,
+    56,0,1,56,0,1,56,0,1,0,0,4,2,97,2,98,0,2,0,1,0,1,1,0,
+    4,0,2,0,1,1,0,2,1,6,112,111,119,58,58,10,130,0,16,1,48,0,74,0,
+    74,5,58,0,1,58,0,1,58,0,1,58,0,1,58,0,1,0,0,4,2,97,2,98,
+    0,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,6,110,101,103,60,60,8,
+    16,0,80,0,74,0,74,5,60,0,1,60,0,1,60,0,1,60,0,1,0,0,2,2,
+    97,0,2,0,1,0,1,1,0,2,0,0,1,1,0,2,1,12,109,97,116,109,117,108,
+    62,62,10,130,0,16,1,54,0,74,0,74,5,62,0,1,62,0,1,62,0,1,62,0,
+    1,62,0,1,0,0,4,2,97,2,98,0,2,0,1,0,1,1,0,4,0,2,0,1,
+    1,0,2,1,14,103,101,116,105,116,101,109,66,66,10,130,0,16,1,23,0,74,0,74,
+    5,66,0,1,66,0,1,66,0,1,66,0,1,66,0,1,0,0,4,2,97,2,98,0,
+    2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,14,115,101,116,105,116,101,109,
+    68,68,10,130,2,16,0,16,1,28,0,74,5,68,0,1,68,0,1,68,0,1,68,0,
+    1,68,0,1,0,0,6,2,97,2,98,2,99,0,2,0,1,0,1,1,0,6,0,2,
+    4,0,1,1,0,2,1,14,100,101,108,105,116,101,109,70,70,8,130,0,16,1,33,0,
+    74,5,70,0,1,70,0,1,70,0,1,70,0,1,0,0,4,2,97,2,98,0,2,0,
+    1,0,1,1,0,4,0,2,0,1,1,0,2,1,8,105,97,100,100,74,74,14,130,0,
+    16,1,42,0,24,0,16,0,74,0,74,5,74,0,1,74,0,1,74,0,1,74,0,1,
+    74,0,1,74,0,1,74,0,1,0,0,4,2,97,2,98,0,2,0,1,0,1,1,0,
+    4,0,2,0,1,1,0,2,1,8,105,115,117,98,76,76,14,130,0,16,1,43,0,24,
+    0,16,0,74,0,74,5,76,0,1,76,0,1,76,0,1,76,0,1,76,0,1,76,0,
+    1,76,0,1,0,0,4,2,97,2,98,0,2,0,1,0,1,1,0,4,0,2,0,1,
+    1,0,2,1,8,105,109,117,108,78,78,14,130,0,16,1,44,0,24,0,16,0,74,0,
+    74,5,78,0,1,78,0,1,78,0,1,78,0,1,78,0,1,78,0,1,78,0,1,0,
+    0,4,2,97,2,98,0,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,16,
+    105,116,114,117,101,100,105,118,80,80,14,130,0,16,1,45,0,24,0,16,0,74,0,74,
+    5,80,0,1,80,0,1,80,0,1,80,0,1,80,0,1,80,0,1,80,0,1,0,0,
+    4,2,97,2,98,0,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,18,105,
+    102,108,111,111,114,100,105,118,82,82,14,130,0,16,1,46,0,24,0,16,0,74,0,74,
+    5,82,0,1,82,0,1,82,0,1,82,0,1,82,0,1,82,0,1,82,0,1,0,0,
+    4,2,97,2,98,0,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,8,105,
+    109,111,100,84,84,14,130,0,16,1,47,0,24,0,16,0,74,0,74,5,84,0,1,84,
+    0,1,84,0,1,84,0,1,84,0,1,84,0,1,84,0,1,0,0,4,2,97,2,98,
+    0,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,8,105,97,110,100,90,90,
+    14,130,0,16,1,51,0,24,0,16,0,74,0,74,5,90,0,1,90,0,1,90,0,1,
+    90,0,1,90,0,1,90,0,1,90,0,1,0,0,4,2,97,2,98,0,2,0,1,0,
+    1,1,0,4,0,2,0,1,1,0,2,1,6,105,111,114,92,92,14,130,0,16,1,52,
+    0,24,0,16,0,74,0,74,5,92,0,1,92,0,1,92,0,1,92,0,1,92,0,1,
+    92,0,1,92,0,1,0,0,4,2,97,2,98,0,2,0,1,0,1,1,0,4,0,2,
+    0,1,1,0,2,1,8,105,120,111,114,94,94,14,130,0,16,1,53,0,24,0,16,0,
+    74,0,74,5,94,0,1,94,0,1,94,0,1,94,0,1,94,0,1,94,0,1,94,0,
+    1,0,0,4,2,97,2,98,0,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,
+    1,14,105,108,115,104,105,102,116,96,96,14,130,0,16,1,49,0,24,0,16,0,74,0,
+    74,5,96,0,1,96,0,1,96,0,1,96,0,1,96,0,1,96,0,1,96,0,1,0,
+    0,4,2,97,2,98,0,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,14,
+    105,114,115,104,105,102,116,98,98,14,130,0,16,1,50,0,24,0,16,0,74,0,74,5,
+    98,0,1,98,0,1,98,0,1,98,0,1,98,0,1,98,0,1,98,0,1,0,0,4,
+    2,97,2,98,0,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,
+};
+static const unsigned char kPythonLibsBytecode_typing[] = {
+    112,107,99,2,10,50,46,49,46,53,182,93,159,58,113,46,203,6,0,0,18,116,121,112,
+    105,110,103,46,112,121,234,104,246,26,20,11,202,22,194,16,18,116,121,112,105,110,103,46,
+    112,121,2,114,156,1,8,0,90,0,14,0,92,1,14,1,92,2,14,2,92,3,14,3,
+    92,4,14,4,92,5,14,5,92,6,91,0,19,0,15,0,72,0,26,7,19,7,26,8,
+    19,7,26,9,19,7,26,10,19,7,26,11,19,7,26,12,19,7,26,13,19,7,26,14,
+    19,7,26,15,19,7,26,16,19,7,26,17,19,7,26,18,19,7,26,19,19,7,26,20,
+    19,7,26,21,19,7,26,22,19,7,26,23,19,7,26,24,19,7,26,25,19,7,26,26,
+    19,7,26,27,19,28,26,29,19,28,26,30,19,28,26,31,10,0,26,32,14,6,26,33,
+    14,7,26,34,14,8,26,35,19,36,26,37,19,7,26,38,74,5,2,0,1,2,0,1,
+    4,0,1,4,0,1,8,0,1,8,0,1,12,0,1,12,0,1,16,0,1,16,0,1,
+    20,0,1,20,0,1,24,0,1,24,0,1,24,0,1,32,0,1,32,0,1,32,0,1,
+    32,0,1,36,0,1,36,0,1,38,0,1,38,0,1,40,0,1,40,0,1,42,0,1,
+    42,0,1,44,0,1,44,0,1,46,0,1,46,0,1,48,0,1,48,0,1,50,0,1,
+    50,0,1,52,0,1,52,0,1,54,0,1,54,0,1,56,0,1,56,0,1,58,0,1,
+    58,0,1,62,0,1,62,0,1,64,0,1,64,0,1,68,0,1,68,0,1,70,0,1,
+    70,0,1,72,0,1,72,0,1,76,0,1,76,0,1,80,0,1,80,0,1,82,0,1,
+    82,0,1,86,0,1,86,0,1,88,0,1,88,0,1,90,0,1,90,0,1,94,0,1,
+    94,0,1,100,0,1,100,0,1,102,0,1,102,0,1,108,0,1,108,0,1,112,0,1,
+    112,0,1,114,0,1,114,0,1,114,0,1,0,0,0,78,24,95,80,108,97,99,101,104,
+    111,108,100,101,114,16,95,95,105,110,105,116,95,95,22,95,95,103,101,116,105,116,101,109,
+    95,95,16,95,95,99,97,108,108,95,95,14,95,95,97,110,100,95,95,12,95,95,111,114,
+    95,95,14,95,95,120,111,114,95,95,24,95,80,76,65,67,69,72,79,76,68,69,82,16,
+    83,101,113,117,101,110,99,101,8,76,105,115,116,8,68,105,99,116,10,84,117,112,108,101,
+    6,83,101,116,6,65,110,121,10,85,110,105,111,110,16,79,112,116,105,111,110,97,108,16,
+    67,97,108,108,97,98,108,101,8,84,121,112,101,18,84,121,112,101,65,108,105,97,115,14,
+    78,101,119,84,121,112,101,14,76,105,116,101,114,97,108,26,76,105,116,101,114,97,108,83,
+    116,114,105,110,103,16,73,116,101,114,97,98,108,101,18,71,101,110,101,114,97,116,111,114,
+    16,73,116,101,114,97,116,111,114,16,72,97,115,104,97,98,108,101,14,84,121,112,101,86,
+    97,114,8,83,101,108,102,12,111,98,106,101,99,116,16,80,114,111,116,111,99,111,108,14,
+    71,101,110,101,114,105,99,10,78,101,118,101,114,26,84,89,80,69,95,67,72,69,67,75,
+    73,78,71,16,111,118,101,114,108,111,97,100,10,102,105,110,97,108,24,97,115,115,101,114,
+    116,95,110,101,118,101,114,8,100,105,99,116,18,84,121,112,101,100,68,105,99,116,22,78,
+    111,116,82,101,113,117,105,114,101,100,2,0,1,0,1,1,18,16,95,95,105,110,105,116,
+    95,95,4,6,2,74,5,2,0,1,0,0,6,8,115,101,108,102,8,97,114,103,115,12,
+    107,119,97,114,103,115,0,2,0,1,0,1,1,0,2,0,0,2,4,0,1,1,22,95,
+    95,103,101,116,105,116,101,109,95,95,8,10,6,16,0,74,0,74,5,10,0,1,10,0,
+    1,10,0,1,0,0,4,8,115,101,108,102,8,97,114,103,115,0,2,0,1,0,1,1,
+    0,2,0,0,2,1,0,1,1,16,95,95,99,97,108,108,95,95,12,14,6,16,0,74,
+    0,74,5,14,0,1,14,0,1,14,0,1,0,0,6,8,115,101,108,102,8,97,114,103,
+    115,12,107,119,97,114,103,115,0,2,0,1,0,1,1,0,2,0,0,2,4,0,1,1,
+    14,95,95,97,110,100,95,95,16,18,6,16,0,74,0,74,5,18,0,1,18,0,1,18,
+    0,1,0,0,4,8,115,101,108,102,10,111,116,104,101,114,0,2,0,1,0,1,1,0,
+    4,0,2,0,1,1,0,2,1,12,95,95,111,114,95,95,20,22,6,16,0,74,0,74,
+    5,22,0,1,22,0,1,22,0,1,0,0,4,8,115,101,108,102,10,111,116,104,101,114,
+    0,2,0,1,0,1,1,0,4,0,2,0,1,1,0,2,1,14,95,95,120,111,114,95,
+    95,24,26,6,16,0,74,0,74,5,26,0,1,26,0,1,26,0,1,0,0,4,8,115,
+    101,108,102,10,111,116,104,101,114,0,2,0,1,0,1,1,0,4,0,2,0,1,1,0,
+    2,1,16,60,108,97,109,98,100,97,62,100,100,6,16,0,74,0,74,5,100,0,1,100,
+    0,1,100,0,1,0,0,2,2,120,0,2,0,1,0,1,1,0,2,0,0,1,1,0,
+    2,1,16,60,108,97,109,98,100,97,62,102,102,6,16,0,74,0,74,5,102,0,1,102,
+    0,1,102,0,1,0,0,2,2,120,0,2,0,1,0,1,1,0,2,0,0,1,1,0,
+    2,1,16,60,108,97,109,98,100,97,62,108,108,6,16,0,74,0,74,5,108,0,1,108,
+    0,1,108,0,1,0,0,2,2,120,0,2,0,1,0,1,1,0,2,0,0,1,1,0,
+    2,1,
+};
 
 const char* load_kPythonLib(const char* name) {
     if (strchr(name, '.') != NULL) return NULL;
     if (strcmp(name, "bisect") == 0) return kPythonLibs_bisect;
     if (strcmp(name, "builtins") == 0) return kPythonLibs_builtins;
     if (strcmp(name, "cmath") == 0) return kPythonLibs_cmath;
-    if (strcmp(name, "collections") == 0) return kPythonLibs_collections;
     if (strcmp(name, "dataclasses") == 0) return kPythonLibs_dataclasses;
     if (strcmp(name, "datetime") == 0) return kPythonLibs_datetime;
     if (strcmp(name, "functools") == 0) return kPythonLibs_functools;
@@ -28,3 +1280,48 @@ const char* load_kPythonLib(const char* name) {
     if (strcmp(name, "typing") == 0) return kPythonLibs_typing;
     return NULL;
 }
+
+const unsigned char* load_kPythonLibBytecode(const char* name, int* size) {
+    if (strchr(name, '.') != NULL) return NULL;
+    if (strcmp(name, "bisect") == 0) {
+        *size = (int)sizeof(kPythonLibsBytecode_bisect);
+        return kPythonLibsBytecode_bisect;
+    }
+    if (strcmp(name, "builtins") == 0) {
+        *size = (int)sizeof(kPythonLibsBytecode_builtins);
+        return kPythonLibsBytecode_builtins;
+    }
+    if (strcmp(name, "cmath") == 0) {
+        *size = (int)sizeof(kPythonLibsBytecode_cmath);
+        return kPythonLibsBytecode_cmath;
+    }
+    if (strcmp(name, "dataclasses") == 0) {
+        *size = (int)sizeof(kPythonLibsBytecode_dataclasses);
+        return kPythonLibsBytecode_dataclasses;
+    }
+    if (strcmp(name, "datetime") == 0) {
+        *size = (int)sizeof(kPythonLibsBytecode_datetime);
+        return kPythonLibsBytecode_datetime;
+    }
+    if (strcmp(name, "functools") == 0) {
+        *size = (int)sizeof(kPythonLibsBytecode_functools);
+        return kPythonLibsBytecode_functools;
+    }
+    if (strcmp(name, "heapq") == 0) {
+        *size = (int)sizeof(kPythonLibsBytecode_heapq);
+        return kPythonLibsBytecode_heapq;
+    }
+    if (strcmp(name, "linalg") == 0) {
+        *size = (int)sizeof(kPythonLibsBytecode_linalg);
+        return kPythonLibsBytecode_linalg;
+    }
+    if (strcmp(name, "operator") == 0) {
+        *size = (int)sizeof(kPythonLibsBytecode_operator);
+        return kPythonLibsBytecode_operator;
+    }
+    if (strcmp(name, "typing") == 0) {
+        *size = (int)sizeof(kPythonLibsBytecode_typing);
+        return kPythonLibsBytecode_typing;
+    }
+    return NULL;
+}
@@ -1,56 +1,279 @@
 #include "pocketpy/common/algorithm.h"
 #include "pocketpy/config.h"
+#include "pocketpy/common/utils.h"
 #include <string.h>
 
-static bool _stable_sort_merge(char* a,
-                  char* a_end,
-                  char* b,
-                  char* b_end,
-                  char* r,
-                  int elem_size,
-                  int (*f_lt)(const void* a, const void* b, void* extra),
-                  void* extra) {
-    while(a < a_end && b < b_end) {
-        int res = f_lt(b, a, extra);
-        // check error
-        if(res == -1) return false;
-        if(res == 0) {  // !(b<a) -> (b>=a) -> (a<=b)
-            memcpy(r, a, elem_size);
-            a += elem_size;
+/* timsort: natural runs are extended to `minrun` by binary insertion, then merged
+ * pairwise so that the pending runs on the stack keep the invariants of
+ * https://github.com/python/cpython/blob/main/Objects/listsort.txt */
+
+#define TIMSORT_MAX_PENDING 64
+
+typedef struct {
+    char* base;
+    int elem_size;
+    int (*f_lt)(const void* a, const void* b, void* extra);
+    void* extra;
+    char* tmp;
+    int n_pending;
+    int pending_base[TIMSORT_MAX_PENDING];
+    int pending_len[TIMSORT_MAX_PENDING];
+} c11_timsort;
+
+#define AT(i) (self->base + (size_t)(i) * self->elem_size)
+#define LT(a, b) self->f_lt((a), (b), self->extra)
+
+static void _timsort_reverse(c11_timsort* self, int lo, int hi) {
+    char swap[64];
+    int size = self->elem_size;
+    for(hi--; lo < hi; lo++, hi--) {
+        char *a = AT(lo), *b = AT(hi);
+        for(int k = 0; k < size; k += sizeof(swap)) {
+            int n = c11__min(size - k, (int)sizeof(swap));
+            memcpy(swap, a + k, n);
+            memcpy(a + k, b + k, n);
+            memcpy(b + k, swap, n);
+        }
+    }
+}
+
+// length of the run starting at `lo`, a strictly descending run is reversed in place
+static int _timsort_count_run(c11_timsort* self, int lo, int hi) {
+    if(lo + 1 == hi) return 1;
+    int i = lo + 1;
+    int res = LT(AT(i), AT(lo));
+    if(res == -1) return -1;
+    if(res) {
+        for(i++; i < hi; i++) {
+            res = LT(AT(i), AT(i - 1));
+            if(res == -1) return -1;
+            if(!res) break;
+        }
+        _timsort_reverse(self, lo, i);
+    } else {
+        for(i++; i < hi; i++) {
+            res = LT(AT(i), AT(i - 1));
+            if(res == -1) return -1;
+            if(res) break;
+        }
+    }
+    return i - lo;
+}
+
+// sorts [lo, hi) whose prefix [lo, start) is already sorted
+static bool _timsort_binary_insertion(c11_timsort* self, int lo, int hi, int start) {
+    for(; start < hi; start++) {
+        // the pivot stays in the array during comparisons
+        int l = lo, r = start;
+        while(l < r) {
+            int m = l + (r - l) / 2;
+            int res = LT(AT(start), AT(m));
+            if(res == -1) return false;
+            if(res) {
+                r = m;
+            } else {
+                l = m + 1;
+            }
+        }
+        if(l == start) continue;
+        memcpy(self->tmp, AT(start), self->elem_size);
+        memmove(AT(l + 1), AT(l), (size_t)(start - l) * self->elem_size);
+        memcpy(AT(l), self->tmp, self->elem_size);
+    }
+    return true;
+}
+
+// number of leading elements in `p[0:n]` that are `<= key`
+static int _timsort_upper_bound(c11_timsort* self, const char* key, char* p, int n) {
+    int l = 0, r = n;
+    while(l < r) {
+        int m = l + (r - l) / 2;
+        int res = LT(key, p + (size_t)m * self->elem_size);
+        if(res == -1) return -1;
+        if(res) {
+            r = m;
+        } else {
+            l = m + 1;
+        }
+    }
+    return l;
+}
+
+// number of leading elements in `p[0:n]` that are `< key`
+static int _timsort_lower_bound(c11_timsort* self, const char* key, char* p, int n) {
+    int l = 0, r = n;
+    while(l < r) {
+        int m = l + (r - l) / 2;
+        int res = LT(p + (size_t)m * self->elem_size, key);
+        if(res == -1) return -1;
+        if(res) {
+            l = m + 1;
+        } else {
+            r = m;
+        }
+    }
+    return l;
+}
+
+// `a` is copied to `tmp`, the array stays a permutation of its elements even on errors
+static bool _timsort_merge_lo(c11_timsort* self, char* a, int na, char* b, int nb) {
+    int size = self->elem_size;
+    memcpy(self->tmp, a, (size_t)na * size);
+    char *pa = self->tmp, *pa_end = self->tmp + (size_t)na * size;
+    char *pb = b, *pb_end = b + (size_t)nb * size;
+    char* dst = a;
+    bool ok = true;
+    while(pa < pa_end && pb < pb_end) {
+        int res = LT(pb, pa);
+        if(res == -1) {
+            ok = false;
+            break;
+        }
+        if(res) {
+            memcpy(dst, pb, size);
+            pb += size;
         } else {
-            memcpy(r, b, elem_size);
-            b += elem_size;
+            memcpy(dst, pa, size);
+            pa += size;
         }
-        r += elem_size;
+        dst += size;
     }
+    memcpy(dst, pa, pa_end - pa);
+    return ok;
+}
+
+// `b` is copied to `tmp` and merged from the right
+static bool _timsort_merge_hi(c11_timsort* self, char* a, int na, char* b, int nb) {
+    int size = self->elem_size;
+    memcpy(self->tmp, b, (size_t)nb * size);
+    char *pa = a + (size_t)na * size, *pb = self->tmp + (size_t)nb * size;
+    char* dst = b + (size_t)nb * size;
+    bool ok = true;
+    while(pa > a && pb > self->tmp) {
+        int res = LT(pb - size, pa - size);
+        if(res == -1) {
+            ok = false;
+            break;
+        }
+        dst -= size;
+        if(res) {
+            pa -= size;
+            memcpy(dst, pa, size);
+        } else {
+            pb -= size;
+            memcpy(dst, pb, size);
+        }
+    }
+    memcpy(dst - (pb - self->tmp), self->tmp, pb - self->tmp);
+    return ok;
+}
+
+static bool _timsort_merge_at(c11_timsort* self, int i) {
+    int base_a = self->pending_base[i], na = self->pending_len[i];
+    int base_b = self->pending_base[i + 1], nb = self->pending_len[i + 1];
+    self->pending_len[i] = na + nb;
+    if(i == self->n_pending - 3) {
+        self->pending_base[i + 1] = self->pending_base[i + 2];
+        self->pending_len[i + 1] = self->pending_len[i + 2];
+    }
+    self->n_pending--;
+
+    // elements of `a` not greater than b[0] are already in place
+    int k = _timsort_upper_bound(self, AT(base_b), AT(base_a), na);
+    if(k == -1) return false;
+    base_a += k;
+    na -= k;
+    if(na == 0) return true;
+    // so are elements of `b` not less than a[-1]
+    nb = _timsort_lower_bound(self, AT(base_a + na - 1), AT(base_b), nb);
+    if(nb == -1) return false;
+    if(nb == 0) return true;
+
+    if(na <= nb) return _timsort_merge_lo(self, AT(base_a), na, AT(base_b), nb);
+    return _timsort_merge_hi(self, AT(base_a), na, AT(base_b), nb);
+}
 
-    // one of the arrays is empty
-    for(; a < a_end; a += elem_size, r += elem_size)
-        memcpy(r, a, elem_size);
-    for(; b < b_end; b += elem_size, r += elem_size)
-        memcpy(r, b, elem_size);
+static bool _timsort_merge_collapse(c11_timsort* self) {
+    int* len = self->pending_len;
+    while(self->n_pending > 1) {
+        int n = self->n_pending - 2;
+        if((n > 0 && len[n - 1] <= len[n] + len[n + 1]) ||
+           (n > 1 && len[n - 2] <= len[n - 1] + len[n])) {
+            if(len[n - 1] < len[n + 1]) n--;
+        } else if(len[n] > len[n + 1]) {
+            break;
+        }
+        if(!_timsort_merge_at(self, n)) return false;
+    }
     return true;
 }
 
-bool c11__stable_sort(void* ptr_,
+static int _timsort_minrun(int n) {
+    int r = 0;
+    while(n >= 64) {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+bool c11__timsort(void* ptr,
+                  int length,
+                  int elem_size,
+                  int (*f_lt)(const void* a, const void* b, void* extra),
+                  void* extra,
+                  void* buffer) {
+    if(length < 2) return true;
+    c11_timsort self_ = {
+        .base = ptr,
+        .elem_size = elem_size,
+        .f_lt = f_lt,
+        .extra = extra,
+        .tmp = buffer ? buffer : PK_MALLOC((size_t)(length / 2 + 1) * elem_size),
+        .n_pending = 0,
+    };
+    c11_timsort* self = &self_;
+    int minrun = _timsort_minrun(length);
+    bool ok = true;
+    for(int lo = 0; lo < length;) {
+        int n = _timsort_count_run(self, lo, length);
+        if(n == -1) {
+            ok = false;
+            break;
+        }
+        if(n < minrun) {
+            int forced = c11__min(minrun, length - lo);
+            if(!_timsort_binary_insertion(self, lo, lo + forced, lo + n)) {
+                ok = false;
+                break;
+            }
+            n = forced;
+        }
+        self->pending_base[self->n_pending] = lo;
+        self->pending_len[self->n_pending] = n;
+        self->n_pending++;
+        if(!_timsort_merge_collapse(self)) {
+            ok = false;
+            break;
+        }
+        lo += n;
+    }
+    while(ok && self->n_pending > 1) {
+        int n = self->n_pending - 2;
+        if(n > 0 && self->pending_len[n - 1] < self->pending_len[n + 1]) n--;
+        ok = _timsort_merge_at(self, n);
+    }
+    if(!buffer) PK_FREE(self->tmp);
+    return ok;
+}
+
+#undef AT
+#undef LT
+
+bool c11__stable_sort(void* ptr,
                       int length,
                       int elem_size,
                       int (*f_lt)(const void* a, const void* b, void* extra),
                       void* extra) {
-    // merge sort
-    char *ptr = ptr_, *tmp = PK_MALLOC(length * elem_size);
-    for(int seg = 1; seg < length; seg *= 2) {
-        for(char* a = ptr; a < ptr + (length - seg) * elem_size; a += 2 * seg * elem_size) {
-            char *b = a + seg * elem_size, *a_end = b, *b_end = b + seg * elem_size;
-            if(b_end > ptr + length * elem_size) b_end = ptr + length * elem_size;
-            bool ok = _stable_sort_merge(a, a_end, b, b_end, tmp, elem_size, f_lt, extra);
-            if(!ok) {
-                PK_FREE(tmp);
-                return false;
-            }
-            memcpy(a, tmp, b_end - a);
-        }
-    }
-    PK_FREE(tmp);
-    return true;
+    return c11__timsort(ptr, length, elem_size, f_lt, extra, NULL);
 }
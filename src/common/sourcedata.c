@@ -62,6 +62,7 @@ bool SourceData__get_line(const struct SourceData* self,
     if(lineno < 0) return false;
     lineno -= 1;
     if(lineno < 0) lineno = 0;
+    if(lineno >= self->line_starts.length) return false;
     const char* _start = c11__getitem(const char*, &self->line_starts, lineno);
     const char* i = _start;
     // max 300 chars
@@ -7,6 +7,10 @@
 #include <stdio.h>
 #include <assert.h>
 
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
 c11_string* c11_string__new(const char* data) { return c11_string__new2(data, strlen(data)); }
 
 c11_string* c11_string__new2(const char* data, int size) {
@@ -180,13 +184,99 @@ bool c11_sv__endswith(c11_sv self, c11_sv suffix) {
     return memcmp(self.data + self.size - suffix.size, suffix.data, suffix.size) == 0;
 }
 
+/* wyhash by Wang Yi, public domain: https://github.com/wangyi-fudan/wyhash */
+static const uint64_t kWyhashSecret[4] = {
+    0xa0761d6478bd642full,
+    0xe7037ed1a0b428dbull,
+    0x8ebc6af09c88c6e3ull,
+    0x589965cc75374cc3ull,
+};
+
+// c11__wymix(kWyhashSecret[0], kWyhashSecret[1]), the seed of a zero key
+#define kWyhashSeed 0x1ff5c2923a788d2cull
+
+// the 128-bit product of `a` and `b`, low half in `a` and high half in `b`
+static void c11__wymum(uint64_t* a, uint64_t* b) {
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = (__uint128_t)*a * *b;
+    *a = (uint64_t)r;
+    *b = (uint64_t)(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    *a = _umul128(*a, *b, b);
+#else
+    uint64_t ha = *a >> 32, hb = *b >> 32, la = (uint32_t)*a, lb = (uint32_t)*b;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    uint64_t t = rl + (rm0 << 32);
+    uint64_t c = t < rl;
+    uint64_t lo = t + (rm1 << 32);
+    c += lo < t;
+    uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    *a = lo;
+    *b = hi;
+#endif
+}
+
+static uint64_t c11__wymix(uint64_t a, uint64_t b) {
+    c11__wymum(&a, &b);
+    return a ^ b;
+}
+
+// little-endian reads, so that hashes do not depend on the host
+static uint64_t c11__wyr8(const uint8_t* p) {
+    return (uint64_t)p[0] | (uint64_t)p[1] << 8 | (uint64_t)p[2] << 16 | (uint64_t)p[3] << 24 |
+           (uint64_t)p[4] << 32 | (uint64_t)p[5] << 40 | (uint64_t)p[6] << 48 |
+           (uint64_t)p[7] << 56;
+}
+
+static uint64_t c11__wyr4(const uint8_t* p) {
+    return (uint64_t)p[0] | (uint64_t)p[1] << 8 | (uint64_t)p[2] << 16 | (uint64_t)p[3] << 24;
+}
+
+static uint64_t c11__wyr3(const uint8_t* p, size_t k) {
+    return ((uint64_t)p[0] << 16) | ((uint64_t)p[k >> 1] << 8) | p[k - 1];
+}
+
 uint64_t c11_sv__hash(c11_sv self) {
-    uint64_t hash = 5381;
-    for(int i = 0; i < self.size; i++) {
-        // hash * 33 + c
-        hash = ((hash << 5) + hash) + (unsigned char)self.data[i];
+    const uint8_t* p = (const uint8_t*)self.data;
+    size_t len = (size_t)self.size;
+    uint64_t seed = kWyhashSeed;
+    uint64_t a, b;
+    if(len <= 16) {
+        if(len >= 4) {
+            size_t k = (len >> 3) << 2;
+            a = (c11__wyr4(p) << 32) | c11__wyr4(p + k);
+            b = (c11__wyr4(p + len - 4) << 32) | c11__wyr4(p + len - 4 - k);
+        } else if(len > 0) {
+            a = c11__wyr3(p, len);
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t i = len;
+        if(i > 48) {
+            uint64_t see1 = seed, see2 = seed;
+            do {
+                seed = c11__wymix(c11__wyr8(p) ^ kWyhashSecret[1], c11__wyr8(p + 8) ^ seed);
+                see1 = c11__wymix(c11__wyr8(p + 16) ^ kWyhashSecret[2], c11__wyr8(p + 24) ^ see1);
+                see2 = c11__wymix(c11__wyr8(p + 32) ^ kWyhashSecret[3], c11__wyr8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while(i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while(i > 16) {
+            seed = c11__wymix(c11__wyr8(p) ^ kWyhashSecret[1], c11__wyr8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = c11__wyr8(p + i - 16);
+        b = c11__wyr8(p + i - 8);
     }
-    return hash;
+    a ^= kWyhashSecret[1];
+    b ^= seed;
+    c11__wymum(&a, &b);
+    return c11__wymix(a ^ kWyhashSecret[0] ^ len, b ^ kWyhashSecret[1]);
 }
 
 c11_vector /* T=c11_sv */ c11_sv__splitwhitespace(c11_sv self) {
@@ -1071,7 +1071,12 @@ void CallExpr__emit_(Expr* self_, Ctx* ctx) {
 
     c11__foreach(Expr*, &self->args, e) { vtemit_(*e, ctx); }
     c11__foreach(CallExprKwArg, &self->kwargs, e) {
-        Ctx__emit_int(ctx, (uintptr_t)e->key, self->line);
+        if(e->key == NULL) {
+            // **a
+            Ctx__emit_int(ctx, 0, self->line);
+        } else {
+            Ctx__emit_(ctx, OP_LOAD_KWARG_KEY, Ctx__add_name(ctx, e->key), self->line);
+        }
         vtemit_(e->val, ctx);
     }
     int KWARGC = self->kwargs.length;
@@ -1177,8 +1182,9 @@ static void Ctx__s_emit_decorators(Ctx* self, int count) {
 }
 
 static int Ctx__emit_(Ctx* self, Opcode opcode, uint16_t arg, int line) {
-    Bytecode bc = {(uint8_t)opcode, arg};
-    BytecodeEx bcx = {line, self->curr_iblock};
+    Bytecode bc = {(uint8_t)opcode, 0, arg};
+    int icache = Opcode__has_inline_cache(opcode) ? CodeObject__add_inline_cache(self->co) : -1;
+    BytecodeEx bcx = {line, self->curr_iblock, icache};
     c11_vector__push(Bytecode, &self->co->codes, bc);
     c11_vector__push(BytecodeEx, &self->co->codes_ex, bcx);
     int i = self->co->codes.length - 1;
@@ -1538,6 +1544,12 @@ static Error* pop_context(Compiler* self) {
             Bytecode__set_signed_arg(bc, block->end - i);
         }
     }
+    // peephole pass, fuse common pairs into superinstructions
+    // the second instruction stays in place so jump targets and line numbers are not affected
+    for(int i = 0; i + 1 < codes->length; i++) {
+        Bytecode* bc = c11__at(Bytecode, codes, i);
+        if(Bytecode__fuse(bc, bc + 1)) i++;
+    }
     // pre-compute func->is_simple
     FuncDecl* func = ctx()->func;
     if(func) {
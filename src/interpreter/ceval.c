@@ -5,27 +5,18 @@
 #include "pocketpy/common/sstream.h"
 #include "pocketpy/objects/codeobject.h"
 #include "pocketpy/objects/exception.h"
+#include "pocketpy/objects/iterator.h"
+#include "pocketpy/interpreter/bindings.h"
 #include "pocketpy/pocketpy.h"
 #include "pocketpy/objects/error.h"
 #include <stdbool.h>
 #include <assert.h>
 #include <time.h>
 
-#define DISPATCH()                                                                                 \
-    do {                                                                                           \
-        frame->ip++;                                                                               \
-        goto __NEXT_STEP;                                                                          \
-    } while(0)
-#define DISPATCH_JUMP(__offset)                                                                    \
-    do {                                                                                           \
-        frame->ip += __offset;                                                                     \
-        goto __NEXT_STEP;                                                                          \
-    } while(0)
-#define DISPATCH_JUMP_ABSOLUTE(__target)                                                           \
-    do {                                                                                           \
-        frame->ip = __target;                                                                      \
-        goto __NEXT_STEP;                                                                          \
-    } while(0)
+#define INLINE_CACHE()                                                                             \
+    c11__at(InlineCache,                                                                           \
+            &frame->co->caches,                                                                    \
+            c11__getitem(BytecodeEx, &frame->co->codes_ex, frame->ip).icache)
 
 #define RESET_CO_CACHE()                                                                           \
     do {                                                                                           \
@@ -81,1156 +72,293 @@ static bool unpack_dict_to_buffer(py_Ref key, py_Ref val, void* ctx) {
     return TypeError("keywords must be strings, not '%t'", key->type);
 }
 
-FrameResult VM__run_top_frame(VM* self) {
-    py_Frame* frame = self->top_frame;
-    Bytecode* co_codes;
-    py_Name* co_names;
-    Bytecode byte;
+/* The low bits of `Bytecode.counter` count numeric runs in a row, the high bits count
+ * de-optimizations. A site is quickened after `kQuickenWarmup` numeric runs, each
+ * de-optimization doubles that, so sites with mixed operand types stay generic. */
+#define kQuickenWarmup 4
+#define kQuickenRunBits 5
+#define kQuickenRunMask ((1 << kQuickenRunBits) - 1)
+
+static void Bytecode__quicken_binary(Bytecode* bc, py_Ref lhs, py_Ref rhs) {
+    Opcode op = Opcode__quicken_binary(bc->op, lhs->type, rhs->type);
+    if(op == bc->op) {
+        bc->counter &= ~kQuickenRunMask;
+        return;
+    }
+    int deopts = bc->counter >> kQuickenRunBits;
+    int warmup = c11__min(kQuickenWarmup << deopts, kQuickenRunMask);
+    if((bc->counter & kQuickenRunMask) + 1 < warmup) {
+        bc->counter++;
+        return;
+    }
+    bc->op = op;
+    bc->counter &= ~kQuickenRunMask;
+}
 
-    const py_Frame* base_frame = frame;
+static void Bytecode__deopt_binary(Bytecode* bc) {
+    int deopts = c11__min((bc->counter >> kQuickenRunBits) + 1, 255 >> kQuickenRunBits);
+    bc->op = Opcode__generic(bc->op);
+    bc->counter = (uint8_t)(deopts << kQuickenRunBits);
+}
 
-__NEXT_FRAME:
-    if(self->recursion_depth >= self->max_recursion_depth) {
-        py_exception(tp_RecursionError, "maximum recursion depth exceeded");
-        goto __ERROR;
+// [a, b] -> [], returns the truth value of `a <op> b`, or -1 on error
+static int pk_stack_compare(VM* self, Opcode op) {
+    py_Ref a = SECOND();
+    py_Ref b = TOP();
+#define COMPARE_AND_RETURN(lhs, rhs)                                                               \
+    do {                                                                                           \
+        STACK_SHRINK(2);                                                                           \
+        switch(op) {                                                                               \
+            case OP_COMPARE_LT: return lhs < rhs;                                                  \
+            case OP_COMPARE_LE: return lhs <= rhs;                                                 \
+            case OP_COMPARE_EQ: return lhs == rhs;                                                 \
+            case OP_COMPARE_NE: return lhs != rhs;                                                 \
+            case OP_COMPARE_GT: return lhs > rhs;                                                  \
+            case OP_COMPARE_GE: return lhs >= rhs;                                                 \
+            default: c11__unreachable();                                                           \
+        }                                                                                          \
+    } while(0)
+    if(a->type == tp_int && b->type == tp_int) {
+        py_i64 lhs = a->_i64;
+        py_i64 rhs = b->_i64;
+        COMPARE_AND_RETURN(lhs, rhs);
+    }
+    if((a->type == tp_int || a->type == tp_float) && (b->type == tp_int || b->type == tp_float)) {
+        py_f64 lhs = a->type == tp_float ? a->_f64 : (py_f64)a->_i64;
+        py_f64 rhs = b->type == tp_float ? b->_f64 : (py_f64)b->_i64;
+        COMPARE_AND_RETURN(lhs, rhs);
     }
-    RESET_CO_CACHE();
-    frame->ip++;
+#undef COMPARE_AND_RETURN
+    bool ok;
+    switch(op) {
+        case OP_COMPARE_LT: ok = pk_stack_binaryop(self, __lt__, __gt__); break;
+        case OP_COMPARE_LE: ok = pk_stack_binaryop(self, __le__, __ge__); break;
+        case OP_COMPARE_EQ: ok = pk_stack_binaryop(self, __eq__, __eq__); break;
+        case OP_COMPARE_NE: ok = pk_stack_binaryop(self, __ne__, __ne__); break;
+        case OP_COMPARE_GT: ok = pk_stack_binaryop(self, __gt__, __lt__); break;
+        case OP_COMPARE_GE: ok = pk_stack_binaryop(self, __ge__, __le__); break;
+        default: c11__unreachable();
+    }
+    if(!ok) return -1;
+    // [a, b] -> [retval]
+    POP();
+    *TOP() = self->last_retval;
+    int res = py_bool(TOP());
+    if(res < 0) return -1;
+    POP();
+    return res;
+}
 
-__NEXT_STEP:
-    byte = co_codes[frame->ip];
+static void InlineCache__fill(InlineCache* ic, py_Type type, py_Name name, Opcode op) {
+    ic->type = 0;
+    if(type == tp_type || type == tp_super || name == __new__) return;
+    py_TypeInfo* ti = pk_typeinfo(type);
+    if(ti->getattribute || ti->setattribute || ti->getunboundmethod) return;
 
-    if(self->trace_info.func) {
-        bool is_virtual = byte.op == OP_RETURN_VALUE && byte.arg == BC_RETURN_VIRTUAL;
-        if(!is_virtual) {
-            SourceLocation loc = Frame__source_location(frame);
-            SourceLocation prev_loc = self->trace_info.prev_loc;
-            if(loc.lineno != prev_loc.lineno || loc.src != prev_loc.src) {
-                if(prev_loc.src) PK_DECREF(prev_loc.src);
-                PK_INCREF(loc.src);
-                self->trace_info.prev_loc = loc;
-                self->trace_info.func(frame, TRACE_EVENT_LINE);
-            }
+    InlineCacheKind kind;
+    py_Ref cls_var = pk_tpfindname(ti, name);
+    if(cls_var == NULL) {
+        kind = InlineCacheKind_INSTANCE_DICT;
+    } else {
+        switch(cls_var->type) {
+            case tp_function:
+            case tp_nativefunc: kind = InlineCacheKind_METHOD; break;
+            case tp_staticmethod: kind = InlineCacheKind_STATICMETHOD; break;
+            case tp_classmethod: kind = InlineCacheKind_CLASSMETHOD; break;
+            case tp_property: kind = InlineCacheKind_PROPERTY; break;
+            case tp_member_descriptor: kind = InlineCacheKind_MEMBER; break;
+            default: kind = InlineCacheKind_CLASS_VALUE; break;
         }
     }
+    if(op == OP_STORE_ATTR) {
+        // properties may have a setter, leave them to `py_setattr`
+        if(kind == InlineCacheKind_PROPERTY) return;
+        if(kind != InlineCacheKind_MEMBER) kind = InlineCacheKind_INSTANCE_DICT;
+    }
 
-#if PK_ENABLE_WATCHDOG
-    if(self->watchdog_info.max_reset_time > 0) {
-        if(py_debugger_status() == 0 && clock() > self->watchdog_info.max_reset_time) {
-            self->watchdog_info.max_reset_time = 0;
-            TimeoutError("watchdog timeout");
-            goto __ERROR;
-        }
+    switch(kind) {
+        case InlineCacheKind_STATICMETHOD:
+        case InlineCacheKind_CLASSMETHOD: ic->value = *py_getslot(cls_var, 0); break;
+        case InlineCacheKind_INSTANCE_DICT: ic->value = *py_NIL(); break;
+        default: ic->value = *cls_var; break;
     }
-#endif
+    ic->kind = kind;
+    ic->version = pk_tpversion(ti);
+    ic->type = type;
+}
 
-#ifndef NDEBUG
-    pk_print_stack(self, frame, byte);
+static bool InlineCache__check(VM* self, InlineCache* ic, py_Type type) {
+    if(ic->type == type && ic->version == pk_typeinfo(type)->version) {
+#if PK_ENABLE_IC_STATS
+        self->ic_stats.hits++;
 #endif
+        return true;
+    }
+#if PK_ENABLE_IC_STATS
+    self->ic_stats.misses++;
+#endif
+    return false;
+}
 
-    switch((Opcode)byte.op) {
-        case OP_NO_OP: DISPATCH();
-        /*****************************************/
-        case OP_POP_TOP: POP(); DISPATCH();
-        case OP_DUP_TOP: PUSH(TOP()); DISPATCH();
-        case OP_DUP_TOP_TWO:
-            // [a, b]
-            PUSH(SECOND());  // [a, b, a]
-            PUSH(SECOND());  // [a, b, a, b]
-            DISPATCH();
-        case OP_ROT_TWO: {
-            py_TValue tmp = *TOP();
-            *TOP() = *SECOND();
-            *SECOND() = tmp;
-            DISPATCH();
-        }
-        case OP_ROT_THREE: {
-            // [a, b, c] -> [c, a, b]
-            py_TValue tmp = *TOP();
-            *TOP() = *SECOND();
-            *SECOND() = *THIRD();
-            *THIRD() = tmp;
-            DISPATCH();
-        }
-        case OP_PRINT_EXPR: {
-            if(self->callbacks.displayhook) {
-                bool ok = self->callbacks.displayhook(TOP());
-                if(!ok) goto __ERROR;
-            } else {
-                if(TOP()->type != tp_NoneType) {
-                    bool ok = py_repr(TOP());
-                    if(!ok) goto __ERROR;
-                    self->callbacks.print(py_tostr(&self->last_retval));
-                    self->callbacks.print("\n");
-                }
-            }
-            POP();
-            DISPATCH();
-        }
-        /*****************************************/
-        case OP_LOAD_CONST: {
-            PUSH(c11__at(py_TValue, &frame->co->consts, byte.arg));
-            DISPATCH();
-        }
-        case OP_LOAD_NONE: {
-            py_newnone(SP()++);
-            DISPATCH();
-        }
-        case OP_LOAD_TRUE: {
-            py_newbool(SP()++, true);
-            DISPATCH();
-        }
-        case OP_LOAD_FALSE: {
-            py_newbool(SP()++, false);
-            DISPATCH();
-        }
-        /*****************************************/
-        case OP_LOAD_SMALL_INT: {
-            py_newint(SP()++, (int16_t)byte.arg);
-            DISPATCH();
-        }
-        /*****************************************/
-        case OP_LOAD_ELLIPSIS: {
-            py_newellipsis(SP()++);
-            DISPATCH();
-        }
-        case OP_LOAD_FUNCTION: {
-            FuncDecl_ decl = c11__getitem(FuncDecl_, &frame->co->func_decls, byte.arg);
-            Function* ud = py_newobject(SP(), tp_function, 0, sizeof(Function));
-            Function__ctor(ud, decl, frame->module, frame->globals);
-            if(decl->nested) {
-                if(frame->is_locals_special) {
-                    RuntimeError("cannot create closure from special locals");
-                    goto __ERROR;
-                }
-                ud->closure = FastLocals__to_namedict(frame->locals, frame->co);
-                py_Name name = py_name(decl->code.name->data);
-                // capture itself to allow recursion
-                NameDict__set(ud->closure, name, SP());
-            } else {
-                if(self->curr_class) ud->clazz = self->curr_class->_obj;
-            }
-            SP()++;
-            DISPATCH();
-        }
-        case OP_LOAD_NULL:
-            py_newnil(SP()++);
-            DISPATCH();
-            /*****************************************/
-        case OP_LOAD_FAST: {
-            assert(!frame->is_locals_special);
-            py_Ref val = &frame->locals[byte.arg];
-            if(!py_isnil(val)) {
-                PUSH(val);
-                DISPATCH();
-            }
-            py_Name name = c11__getitem(py_Name, &frame->co->varnames, byte.arg);
-            UnboundLocalError(name);
-            goto __ERROR;
-        }
-        case OP_LOAD_NAME: {
-            assert(frame->is_locals_special);
-            py_Name name = co_names[byte.arg];
-            // locals
-            switch(frame->locals->type) {
-                case tp_locals: {
-                    py_Frame* noproxy = frame->locals->_ptr;
-                    py_Ref slot = Frame__getlocal_noproxy(noproxy, name);
-                    if(slot == NULL) break;
-                    if(py_isnil(slot)) {
-                        UnboundLocalError(name);
-                        goto __ERROR;
-                    }
-                    PUSH(slot);
-                    DISPATCH();
-                }
-                case tp_dict: {
-                    int res = py_dict_getitem(frame->locals, py_name2ref(name));
-                    if(res == 1) {
-                        PUSH(&self->last_retval);
-                        DISPATCH();
-                    }
-                    if(res == 0) break;
-                    assert(res == -1);
-                    goto __ERROR;
-                }
-                case tp_nil: break;
-                default: c11__unreachable();
-            }
-            // globals
-            int res = Frame__getglobal(frame, name);
-            if(res == 1) {
-                PUSH(&self->last_retval);
-                DISPATCH();
-            }
-            if(res == -1) goto __ERROR;
-            // builtins
-            py_Ref tmp = py_getdict(self->builtins, name);
-            if(tmp != NULL) {
-                PUSH(tmp);
-                DISPATCH();
-            }
-            NameError(name);
-            goto __ERROR;
-        }
-        case OP_LOAD_NONLOCAL: {
-            py_Name name = co_names[byte.arg];
-            py_Ref tmp = Frame__getclosure(frame, name);
-            if(tmp != NULL) {
-                PUSH(tmp);
-                DISPATCH();
-            }
-            int res = Frame__getglobal(frame, name);
-            if(res == 1) {
-                PUSH(&self->last_retval);
-                DISPATCH();
-            }
-            if(res == -1) goto __ERROR;
-
-            tmp = py_getdict(self->builtins, name);
-            if(tmp != NULL) {
-                PUSH(tmp);
-                DISPATCH();
-            }
-            NameError(name);
-            goto __ERROR;
-        }
-        case OP_LOAD_GLOBAL: {
-            py_Name name = co_names[byte.arg];
-            int res = Frame__getglobal(frame, name);
-            if(res == 1) {
-                PUSH(&self->last_retval);
-                DISPATCH();
-            }
-            if(res == -1) goto __ERROR;
-            py_Ref tmp = py_getdict(self->builtins, name);
-            if(tmp != NULL) {
-                PUSH(tmp);
-                DISPATCH();
-            }
-            NameError(name);
-            goto __ERROR;
-        }
-        case OP_LOAD_ATTR: {
-            py_Name name = co_names[byte.arg];
-            if(py_getattr(TOP(), name)) {
-                py_assign(TOP(), py_retval());
-            } else {
-                goto __ERROR;
-            }
-            DISPATCH();
-        }
-        case OP_LOAD_CLASS_GLOBAL: {
-            assert(self->curr_class);
-            py_Name name = co_names[byte.arg];
-            py_Ref tmp = py_getdict(self->curr_class, name);
-            if(tmp) {
-                PUSH(tmp);
-                DISPATCH();
-            }
-            // load global if attribute not found
-            int res = Frame__getglobal(frame, name);
-            if(res == 1) {
-                PUSH(&self->last_retval);
-                DISPATCH();
-            }
-            if(res == -1) goto __ERROR;
-            tmp = py_getdict(self->builtins, name);
-            if(tmp) {
-                PUSH(tmp);
-                DISPATCH();
-            }
-            NameError(name);
-            goto __ERROR;
-        }
-        case OP_LOAD_METHOD: {
-            // [self] -> [unbound, self]
-            py_Name name = co_names[byte.arg];
-            bool ok = py_pushmethod(name);
-            if(!ok) {
-                // fallback to getattr
-                if(py_getattr(TOP(), name)) {
-                    py_assign(TOP(), py_retval());
-                    py_newnil(SP()++);
-                } else {
-                    goto __ERROR;
-                }
-            }
-            DISPATCH();
-        }
-        case OP_LOAD_SUBSCR: {
-            // [a, b] -> a[b]
-            py_Ref magic = py_tpfindmagic(SECOND()->type, __getitem__);
-            if(magic) {
-                if(magic->type == tp_nativefunc) {
-                    if(!py_callcfunc(magic->_cfunc, 2, SECOND())) goto __ERROR;
-                    POP();
-                    py_assign(TOP(), py_retval());
-                } else {
-                    INSERT_THIRD();     // [?, a, b]
-                    *THIRD() = *magic;  // [__getitem__, a, b]
-                    vectorcall_opcall(1, 0);
-                }
-                DISPATCH();
-            }
-            TypeError("'%t' object is not subscriptable", SECOND()->type);
-            goto __ERROR;
-        }
-        case OP_STORE_FAST: {
-            assert(!frame->is_locals_special);
-            frame->locals[byte.arg] = POPX();
-            DISPATCH();
-        }
-        case OP_STORE_NAME: {
-            assert(frame->is_locals_special);
-            py_Name name = co_names[byte.arg];
-            switch(frame->locals->type) {
-                case tp_locals: {
-                    py_Frame* noproxy = frame->locals->_ptr;
-                    py_Ref slot = Frame__getlocal_noproxy(noproxy, name);
-                    if(slot == NULL) {
-                        UnboundLocalError(name);
-                        goto __ERROR;
-                    }
-                    *slot = POPX();
-                    DISPATCH();
-                }
-                case tp_dict: {
-                    if(!py_dict_setitem(frame->locals, py_name2ref(name), TOP())) goto __ERROR;
-                    POP();
-                    DISPATCH();
-                }
-                case tp_nil: {
-                    // globals
-                    if(!Frame__setglobal(frame, name, TOP())) goto __ERROR;
-                    POP();
-                    DISPATCH();
-                }
-                default: c11__unreachable();
-            }
-        }
-        case OP_STORE_GLOBAL: {
-            py_Name name = co_names[byte.arg];
-            if(!Frame__setglobal(frame, name, TOP())) goto __ERROR;
-            POP();
-            DISPATCH();
-        }
-        case OP_STORE_ATTR: {
-            // [val, a] -> a.b = val
-            py_Name name = co_names[byte.arg];
-            if(!py_setattr(TOP(), name, SECOND())) goto __ERROR;
-            STACK_SHRINK(2);
-            DISPATCH();
-        }
-        case OP_STORE_SUBSCR: {
-            // [val, a, b] -> a[b] = val
-            py_Ref magic = py_tpfindmagic(SECOND()->type, __setitem__);
-            if(magic) {
-                PUSH(THIRD());  // [val, a, b, val]
-                if(magic->type == tp_nativefunc) {
-                    if(!py_callcfunc(magic->_cfunc, 3, THIRD())) goto __ERROR;
-                    STACK_SHRINK(4);
-                } else {
-                    *FOURTH() = *magic;  // [__setitem__, a, b, val]
-                    if(!py_vectorcall(2, 0)) goto __ERROR;
-                }
-                DISPATCH();
-            }
-            TypeError("'%t' object does not support item assignment", SECOND()->type);
-            goto __ERROR;
-        }
-        case OP_DELETE_FAST: {
-            assert(!frame->is_locals_special);
-            py_Ref tmp = &frame->locals[byte.arg];
-            if(py_isnil(tmp)) {
-                py_Name name = c11__getitem(py_Name, &frame->co->varnames, byte.arg);
-                UnboundLocalError(name);
-                goto __ERROR;
-            }
-            py_newnil(tmp);
-            DISPATCH();
-        }
-        case OP_DELETE_NAME: {
-            assert(frame->is_locals_special);
-            py_Name name = co_names[byte.arg];
-            switch(frame->locals->type) {
-                case tp_locals: {
-                    py_Frame* noproxy = frame->locals->_ptr;
-                    py_Ref slot = Frame__getlocal_noproxy(noproxy, name);
-                    if(slot == NULL || py_isnil(slot)) {
-                        UnboundLocalError(name);
-                        goto __ERROR;
-                    }
-                    py_newnil(slot);
-                    DISPATCH();
-                }
-                case tp_dict: {
-                    int res = py_dict_delitem(frame->locals, py_name2ref(name));
-                    if(res == 1) DISPATCH();
-                    if(res == 0) UnboundLocalError(name);
-                    goto __ERROR;
-                }
-                case tp_nil: {
-                    // globals
-                    int res = Frame__delglobal(frame, name);
-                    if(res == 1) DISPATCH();
-                    if(res == 0) NameError(name);
-                    goto __ERROR;
-                }
-                default: c11__unreachable();
-            }
-        }
-        case OP_DELETE_GLOBAL: {
-            py_Name name = co_names[byte.arg];
-            int res = Frame__delglobal(frame, name);
-            if(res == 1) DISPATCH();
-            if(res == -1) goto __ERROR;
-            NameError(name);
-            goto __ERROR;
-        }
-
-        case OP_DELETE_ATTR: {
-            py_Name name = co_names[byte.arg];
-            if(!py_delattr(TOP(), name)) goto __ERROR;
-            DISPATCH();
-        }
-
-        case OP_DELETE_SUBSCR: {
-            // [a, b] -> del a[b]
-            py_Ref magic = py_tpfindmagic(SECOND()->type, __delitem__);
-            if(magic) {
-                if(magic->type == tp_nativefunc) {
-                    if(!py_callcfunc(magic->_cfunc, 2, SECOND())) goto __ERROR;
-                    STACK_SHRINK(2);
-                } else {
-                    INSERT_THIRD();     // [?, a, b]
-                    *THIRD() = *magic;  // [__delitem__, a, b]
-                    if(!py_vectorcall(1, 0)) goto __ERROR;
-                }
-                DISPATCH();
-            }
-            TypeError("'%t' object does not support item deletion", SECOND()->type);
-            goto __ERROR;
-        }
-        /*****************************************/
-        case OP_BUILD_IMAG: {
-            // [x]
-            py_Ref f = py_getdict(self->builtins, py_name("complex"));
-            assert(f != NULL);
-            py_TValue tmp = *TOP();
-            *TOP() = *f;           // [complex]
-            py_newnil(SP()++);     // [complex, NULL]
-            py_newint(SP()++, 0);  // [complex, NULL, 0]
-            *SP()++ = tmp;         // [complex, NULL, 0, x]
-            vectorcall_opcall(2, 0);
-            DISPATCH();
-        }
-        case OP_BUILD_BYTES: {
-            int size;
-            py_Ref string = c11__at(py_TValue, &frame->co->consts, byte.arg);
-            const char* data = py_tostrn(string, &size);
-            unsigned char* p = py_newbytes(SP()++, size);
-            memcpy(p, data, size);
-            DISPATCH();
-        }
-        case OP_BUILD_TUPLE: {
-            py_TValue tmp;
-            py_Ref p = py_newtuple(&tmp, byte.arg);
-            py_TValue* begin = SP() - byte.arg;
-            for(int i = 0; i < byte.arg; i++)
-                p[i] = begin[i];
-            SP() = begin;
-            PUSH(&tmp);
-            DISPATCH();
-        }
-        case OP_BUILD_LIST: {
-            py_TValue tmp;
-            py_newlistn(&tmp, byte.arg);
-            py_TValue* begin = SP() - byte.arg;
-            for(int i = 0; i < byte.arg; i++) {
-                py_list_setitem(&tmp, i, begin + i);
-            }
-            SP() = begin;
-            PUSH(&tmp);
-            DISPATCH();
-        }
-        case OP_BUILD_DICT: {
-            py_TValue* begin = SP() - byte.arg * 2;
-            py_Ref tmp = py_pushtmp();
-            py_newdict(tmp);
-            for(int i = 0; i < byte.arg * 2; i += 2) {
-                bool ok = py_dict_setitem(tmp, begin + i, begin + i + 1);
-                if(!ok) goto __ERROR;
+// the attribute `name` of an instance, the shape and index of the last lookup are cached in `ic`
+static py_TValue* InlineCache__getdict(InlineCache* ic, PyObject* obj, py_Name name) {
+    if(obj->slots < -1) {
+        Shape* shape = PyObject__instdict(obj)->shape;
+        if(shape != NULL) {
+            if(shape != ic->shape) {
+                ic->shape = shape;
+                ic->shape_index = Shape__index(shape, name);
+                ic->shape_next = NULL;
             }
-            SP() = begin;
-            PUSH(tmp);
-            DISPATCH();
+            return ic->shape_index >= 0 ? PyObject__instdict_at(obj, ic->shape_index) : NULL;
         }
-        case OP_BUILD_SET: {
-            py_TValue* begin = SP() - byte.arg;
-            py_Ref typeobject_set = py_getdict(self->builtins, py_name("set"));
-            assert(typeobject_set != NULL);
-            py_push(typeobject_set);
-            py_pushnil();
-            if(!py_vectorcall(0, 0)) goto __ERROR;
-            py_push(py_retval());  // empty set
-            py_Name id_add = py_name("add");
-            for(int i = 0; i < byte.arg; i++) {
-                py_push(TOP());
-                if(!py_pushmethod(id_add)) {
-                    c11__abort("OP_BUILD_SET: failed to load method 'add'");
-                }
-                py_push(begin + i);
-                if(!py_vectorcall(1, 0)) goto __ERROR;
-            }
-            py_TValue tmp = *TOP();
-            SP() = begin;
-            PUSH(&tmp);
-            DISPATCH();
-        }
-        case OP_BUILD_SLICE: {
-            // [start, stop, step]
-            py_TValue tmp;
-            py_ObjectRef slots = py_newslice(&tmp);
-            slots[0] = *THIRD();
-            slots[1] = *SECOND();
-            slots[2] = *TOP();
-            STACK_SHRINK(3);
-            PUSH(&tmp);
-            DISPATCH();
-        }
-        case OP_BUILD_STRING: {
-            py_TValue* begin = SP() - byte.arg;
-            c11_sbuf ss;
-            c11_sbuf__ctor(&ss);
-            for(int i = 0; i < byte.arg; i++) {
-                if(!py_str(begin + i)) goto __ERROR;
-                c11_sbuf__write_sv(&ss, py_tosv(&self->last_retval));
-            }
-            SP() = begin;
-            c11_sbuf__py_submit(&ss, SP()++);
-            DISPATCH();
-        }
-        /*****************************/
-#define CASE_BINARY_OP(label, op, rop)                                                             \
-    case label: {                                                                                  \
-        if(!pk_stack_binaryop(self, op, rop)) goto __ERROR;                                        \
-        POP();                                                                                     \
-        *TOP() = self->last_retval;                                                                \
-        DISPATCH();                                                                                \
     }
-            CASE_BINARY_OP(OP_BINARY_ADD, __add__, __radd__)
-            CASE_BINARY_OP(OP_BINARY_SUB, __sub__, __rsub__)
-            CASE_BINARY_OP(OP_BINARY_MUL, __mul__, __rmul__)
-            CASE_BINARY_OP(OP_BINARY_TRUEDIV, __truediv__, __rtruediv__)
-            CASE_BINARY_OP(OP_BINARY_FLOORDIV, __floordiv__, __rfloordiv__)
-            CASE_BINARY_OP(OP_BINARY_MOD, __mod__, __rmod__)
-            CASE_BINARY_OP(OP_BINARY_POW, __pow__, __rpow__)
-            CASE_BINARY_OP(OP_BINARY_LSHIFT, __lshift__, 0)
-            CASE_BINARY_OP(OP_BINARY_RSHIFT, __rshift__, 0)
-            CASE_BINARY_OP(OP_BINARY_AND, __and__, 0)
-            CASE_BINARY_OP(OP_BINARY_OR, __or__, 0)
-            CASE_BINARY_OP(OP_BINARY_XOR, __xor__, 0)
-            CASE_BINARY_OP(OP_BINARY_MATMUL, __matmul__, 0)
-            CASE_BINARY_OP(OP_COMPARE_LT, __lt__, __gt__)
-            CASE_BINARY_OP(OP_COMPARE_LE, __le__, __ge__)
-            CASE_BINARY_OP(OP_COMPARE_EQ, __eq__, __eq__)
-            CASE_BINARY_OP(OP_COMPARE_NE, __ne__, __ne__)
-            CASE_BINARY_OP(OP_COMPARE_GT, __gt__, __lt__)
-            CASE_BINARY_OP(OP_COMPARE_GE, __ge__, __le__)
-#undef CASE_BINARY_OP
-        case OP_IS_OP: {
-            bool res = py_isidentical(SECOND(), TOP());
-            POP();
-            if(byte.arg) res = !res;
-            py_newbool(TOP(), res);
-            DISPATCH();
-        }
-        case OP_CONTAINS_OP: {
-            // [b, a] -> b __contains__ a (a in b) -> [retval]
-            py_Ref magic = py_tpfindmagic(SECOND()->type, __contains__);
-            if(magic) {
-                if(magic->type == tp_nativefunc) {
-                    if(!py_callcfunc(magic->_cfunc, 2, SECOND())) goto __ERROR;
-                    STACK_SHRINK(2);
-                } else {
-                    INSERT_THIRD();     // [?, b, a]
-                    *THIRD() = *magic;  // [__contains__, a, b]
-                    if(!py_vectorcall(1, 0)) goto __ERROR;
-                }
-                bool res = py_tobool(py_retval());
-                if(byte.arg) res = !res;
-                py_newbool(SP()++, res);
-                DISPATCH();
-            }
-            TypeError("'%t' type does not support '__contains__'", SECOND()->type);
-            goto __ERROR;
-        }
-            /*****************************************/
-        case OP_JUMP_FORWARD: DISPATCH_JUMP((int16_t)byte.arg);
-        case OP_POP_JUMP_IF_NOT_MATCH: {
-            int res = py_equal(SECOND(), TOP());
-            if(res < 0) goto __ERROR;
-            STACK_SHRINK(2);
-            if(!res) DISPATCH_JUMP((int16_t)byte.arg);
-            DISPATCH();
-        }
-        case OP_POP_JUMP_IF_FALSE: {
-            int res = py_bool(TOP());
-            if(res < 0) goto __ERROR;
-            POP();
-            if(!res) DISPATCH_JUMP((int16_t)byte.arg);
-            DISPATCH();
-        }
-        case OP_POP_JUMP_IF_TRUE: {
-            int res = py_bool(TOP());
-            if(res < 0) goto __ERROR;
-            POP();
-            if(res) DISPATCH_JUMP((int16_t)byte.arg);
-            DISPATCH();
-        }
-        case OP_JUMP_IF_TRUE_OR_POP: {
-            int res = py_bool(TOP());
-            if(res < 0) goto __ERROR;
-            if(res) {
-                DISPATCH_JUMP((int16_t)byte.arg);
-            } else {
-                POP();
-                DISPATCH();
-            }
-        }
-        case OP_JUMP_IF_FALSE_OR_POP: {
-            int res = py_bool(TOP());
-            if(res < 0) goto __ERROR;
-            if(!res) {
-                DISPATCH_JUMP((int16_t)byte.arg);
-            } else {
-                POP();
-                DISPATCH();
-            }
-        }
-        case OP_SHORTCUT_IF_FALSE_OR_POP: {
-            int res = py_bool(TOP());
-            if(res < 0) goto __ERROR;
-            if(!res) {                      // [b, False]
-                STACK_SHRINK(2);            // []
-                py_newbool(SP()++, false);  // [False]
-                DISPATCH_JUMP((int16_t)byte.arg);
-            } else {
-                POP();  // [b]
-                DISPATCH();
-            }
-        }
-        case OP_LOOP_CONTINUE: {
-            DISPATCH_JUMP((int16_t)byte.arg);
-        }
-        case OP_LOOP_BREAK: {
-            DISPATCH_JUMP((int16_t)byte.arg);
-        }
-        /*****************************************/
-        case OP_CALL: {
-            if(self->heap.gc_enabled) ManagedHeap__collect_hint(&self->heap);
-            vectorcall_opcall(byte.arg & 0xFF, byte.arg >> 8);
-            DISPATCH();
-        }
-        case OP_CALL_VARGS: {
-            // [_0, _1, _2 | k1, v1, k2, v2]
-            uint16_t argc = byte.arg & 0xFF;
-            uint16_t kwargc = byte.arg >> 8;
-
-            int n = 0;
-            py_TValue* sp = SP();
-            py_TValue* p1 = sp - kwargc * 2;
-            py_TValue* base = p1 - argc;
-            py_TValue* buf = self->vectorcall_buffer;
-
-            for(py_TValue* curr = base; curr != p1; curr++) {
-                if(curr->type != tp_star_wrapper) {
-                    buf[n++] = *curr;
-                } else {
-                    py_TValue* args = py_getslot(curr, 0);
-                    py_TValue* p;
-                    int length = pk_arrayview(args, &p);
-                    if(length != -1) {
-                        for(int j = 0; j < length; j++) {
-                            buf[n++] = p[j];
-                        }
-                        argc += length - 1;
-                    } else {
-                        TypeError("*args must be a list or tuple, got '%t'", args->type);
-                        goto __ERROR;
-                    }
-                }
-            }
-
-            for(py_TValue* curr = p1; curr != sp; curr += 2) {
-                if(curr[1].type != tp_star_wrapper) {
-                    buf[n++] = curr[0];
-                    buf[n++] = curr[1];
-                } else {
-                    assert(py_toint(&curr[0]) == 0);
-                    py_TValue* kwargs = py_getslot(&curr[1], 0);
-                    if(kwargs->type == tp_dict) {
-                        py_TValue* p = buf + n;
-                        if(!py_dict_apply(kwargs, unpack_dict_to_buffer, &p)) goto __ERROR;
-                        n = p - buf;
-                        kwargc += py_dict_len(kwargs) - 1;
-                    } else {
-                        TypeError("**kwargs must be a dict, got '%t'", kwargs->type);
-                        goto __ERROR;
-                    }
-                }
-            }
+    return PyObject__getdict(obj, name);
+}
 
-            memcpy(base, buf, n * sizeof(py_TValue));
-            SP() = base + n;
+// the slot of a member in `obj`, NULL if it is kept in the instance dict or out of range
+static py_TValue* InlineCache__member(InlineCache* ic, py_Ref obj) {
+    int index = ((py_MemberInfo*)py_touserdata(&ic->value))->index;
+    if(!obj->is_ptr || index < 0 || index >= obj->_obj->slots) return NULL;
+    return PyObject__slots(obj->_obj) + index;
+}
 
-            vectorcall_opcall(argc, kwargc);
-            DISPATCH();
-        }
-        case OP_RETURN_VALUE: {
-            if(byte.arg == BC_NOARG) {
-                self->last_retval = POPX();
-            } else {
-                py_newnone(&self->last_retval);
-            }
-            VM__pop_frame(self);
-            if(frame == base_frame) {  // [ frameBase<- ]
-                return RES_RETURN;
-            } else {
-                frame = self->top_frame;
-                PUSH(&self->last_retval);
-                goto __NEXT_FRAME;
-            }
-            DISPATCH();
-        }
-        case OP_YIELD_VALUE: {
-            if(byte.arg == 1) {
-                py_newnone(py_retval());
-            } else {
-                py_assign(py_retval(), TOP());
-                POP();
-            }
-            return RES_YIELD;
-        }
-        case OP_FOR_ITER_YIELD_VALUE: {
-            int res = py_next(TOP());
-            if(res == -1) goto __ERROR;
-            if(res) {
-                return RES_YIELD;
-            } else {
-                assert(self->last_retval.type == tp_StopIteration);
-                BaseException* ud = py_touserdata(py_retval());
-                py_ObjectRef value = &ud->args;
-                if(py_isnil(value)) value = py_None();
-                *TOP() = *value;  // [iter] -> [retval]
-                DISPATCH_JUMP((int16_t)byte.arg);
-            }
-        }
-        /////////
-        case OP_LIST_APPEND: {
-            // [list, iter, value]
-            py_list_append(THIRD(), TOP());
-            POP();
-            DISPATCH();
-        }
-        case OP_DICT_ADD: {
-            // [dict, iter, key, value]
-            bool ok = py_dict_setitem(FOURTH(), SECOND(), TOP());
-            if(!ok) goto __ERROR;
-            STACK_SHRINK(2);
-            DISPATCH();
-        }
-        case OP_SET_ADD: {
-            // [set, iter, value]
-            py_push(THIRD());  // [| set]
-            if(!py_pushmethod(py_name("add"))) {
-                c11__abort("OP_SET_ADD: failed to load method 'add'");
-            }  // [|add() set]
-            py_push(THIRD());
-            if(!py_vectorcall(1, 0)) goto __ERROR;
-            POP();
-            DISPATCH();
-        }
-        /////////
-        case OP_UNARY_NEGATIVE: {
-            if(!pk_callmagic(__neg__, 1, TOP())) goto __ERROR;
-            *TOP() = self->last_retval;
-            DISPATCH();
-        }
-        case OP_UNARY_NOT: {
-            int res = py_bool(TOP());
-            if(res < 0) goto __ERROR;
-            py_newbool(TOP(), !res);
-            DISPATCH();
-        }
-        case OP_UNARY_STAR: {
-            py_TValue value = POPX();
-            int* level = py_newobject(SP()++, tp_star_wrapper, 1, sizeof(int));
-            *level = byte.arg;
-            py_setslot(TOP(), 0, &value);
-            DISPATCH();
-        }
-        case OP_UNARY_INVERT: {
-            if(!pk_callmagic(__invert__, 1, TOP())) goto __ERROR;
-            *TOP() = self->last_retval;
-            DISPATCH();
-        }
-        ////////////////
-        case OP_GET_ITER: {
-            if(!py_iter(TOP())) goto __ERROR;
-            *TOP() = *py_retval();
-            DISPATCH();
-        }
-        case OP_FOR_ITER: {
-            int res = py_next(TOP());
-            if(res == -1) goto __ERROR;
-            if(res) {
-                PUSH(py_retval());
-                DISPATCH();
-            } else {
-                assert(self->last_retval.type == tp_StopIteration);
-                POP();  // [iter] -> []
-                DISPATCH_JUMP((int16_t)byte.arg);
-            }
-        }
-        ////////
-        case OP_IMPORT_PATH: {
-            py_Ref path_object = c11__at(py_TValue, &frame->co->consts, byte.arg);
-            const char* path = py_tostr(path_object);
-            int res = py_import(path);
-            if(res == -1) goto __ERROR;
-            if(res == 0) {
-                ImportError("No module named '%s'", path);
-                goto __ERROR;
-            }
-            PUSH(py_retval());
-            DISPATCH();
-        }
-        case OP_POP_IMPORT_STAR: {
-            // [module]
-            NameDict* dict = PyObject__dict(TOP()->_obj);
-            py_ItemRef all = NameDict__try_get(dict, __all__);
-            if(all) {
-                py_TValue* p;
-                int length = pk_arrayview(all, &p);
-                if(length == -1) {
-                    TypeError("'__all__' must be a list or tuple, got '%t'", all->type);
-                    goto __ERROR;
-                }
-                for(int i = 0; i < length; i++) {
-                    py_Name name = py_namev(py_tosv(p + i));
-                    py_ItemRef value = NameDict__try_get(dict, name);
-                    if(value == NULL) {
-                        ImportError("cannot import name '%n'", name);
-                        goto __ERROR;
-                    } else {
-                        if(!Frame__setglobal(frame, name, value)) goto __ERROR;
-                    }
-                }
-            } else {
-                for(int i = 0; i < dict->capacity; i++) {
-                    NameDict_KV* kv = &dict->items[i];
-                    if(kv->key == NULL) continue;
-                    c11_sv name = py_name2sv(kv->key);
-                    if(name.size == 0 || name.data[0] == '_') continue;
-                    if(!Frame__setglobal(frame, kv->key, &kv->value)) goto __ERROR;
-                }
-            }
-            POP();
-            DISPATCH();
+static int InlineCache__getattr_hit(InlineCache* ic, py_Ref obj, py_Name name) {
+    if(ic->kind == InlineCacheKind_PROPERTY) {
+        py_Ref getter = py_getslot(&ic->value, 0);
+        return py_call(getter, 1, obj) ? 1 : -1;
+    }
+    if(ic->kind == InlineCacheKind_MEMBER) {
+        py_TValue* res = InlineCache__member(ic, obj);
+        if(res == NULL || py_isnil(res)) return 0;
+        py_assign(py_retval(), res);
+        return 1;
+    }
+    // instance dict takes precedence over non-data descriptors
+    if(obj->is_ptr && obj->_obj->slots < 0) {
+        py_Ref res = InlineCache__getdict(ic, obj->_obj, name);
+        if(res) {
+            py_assign(py_retval(), res);
+            return 1;
         }
-        ////////
-        case OP_UNPACK_SEQUENCE: {
-            py_TValue* p;
-            int length;
+    }
+    switch(ic->kind) {
+        case InlineCacheKind_INSTANCE_DICT: return 0;
+        case InlineCacheKind_METHOD: py_newboundmethod(py_retval(), obj, &ic->value); return 1;
+        case InlineCacheKind_CLASSMETHOD:
+            py_newboundmethod(py_retval(), py_tpobject(obj->type), &ic->value);
+            return 1;
+        default: py_assign(py_retval(), &ic->value); return 1;
+    }
+}
 
-            switch(TOP()->type) {
-                case tp_tuple: {
-                    length = py_tuple_len(TOP());
-                    p = py_tuple_data(TOP());
-                    break;
-                }
-                case tp_list: {
-                    length = py_list_len(TOP());
-                    p = py_list_data(TOP());
-                    break;
-                }
-                case tp_vec2i: {
-                    length = 2;
-                    if(byte.arg != length) break;
-                    c11_vec2i val = py_tovec2i(TOP());
-                    POP();
-                    py_newint(SP()++, val.x);
-                    py_newint(SP()++, val.y);
-                    DISPATCH();
-                }
-                case tp_vec2: {
-                    length = 2;
-                    if(byte.arg != length) break;
-                    c11_vec2 val = py_tovec2(TOP());
-                    POP();
-                    py_newfloat(SP()++, val.x);
-                    py_newfloat(SP()++, val.y);
-                    DISPATCH();
-                }
-                case tp_vec3i: {
-                    length = 3;
-                    if(byte.arg != length) break;
-                    c11_vec3i val = py_tovec3i(TOP());
-                    POP();
-                    py_newint(SP()++, val.x);
-                    py_newint(SP()++, val.y);
-                    py_newint(SP()++, val.z);
-                    DISPATCH();
-                }
-                case tp_vec3: {
-                    length = 3;
-                    if(byte.arg != length) break;
-                    c11_vec3 val = py_tovec3(TOP());
-                    POP();
-                    py_newfloat(SP()++, val.x);
-                    py_newfloat(SP()++, val.y);
-                    py_newfloat(SP()++, val.z);
-                    DISPATCH();
-                }
-                default: {
-                    TypeError("expected list or tuple to unpack, got %t", TOP()->type);
-                    goto __ERROR;
-                }
-            }
-            if(length != byte.arg) {
-                ValueError("expected %d values to unpack, got %d", byte.arg, length);
-                goto __ERROR;
-            }
-            POP();
-            for(int i = 0; i < length; i++) {
-                PUSH(p + i);
-            }
-            DISPATCH();
-        }
-        case OP_UNPACK_EX: {
-            py_TValue* p;
-            int length = pk_arrayview(TOP(), &p);
-            if(length == -1) {
-                TypeError("expected list or tuple to unpack, got %t", TOP()->type);
-                goto __ERROR;
-            }
-            int exceed = length - byte.arg;
-            if(exceed < 0) {
-                ValueError("not enough values to unpack");
-                goto __ERROR;
-            }
-            POP();
-            for(int i = 0; i < byte.arg; i++) {
-                PUSH(p + i);
-            }
-            py_newlistn(SP()++, exceed);
-            for(int i = 0; i < exceed; i++) {
-                py_list_setitem(TOP(), i, p + byte.arg + i);
-            }
-            DISPATCH();
-        }
-        ///////////
-        case OP_BEGIN_CLASS: {
-            // [base]
-            py_Name name = co_names[byte.arg];
-            py_Type base;
-            if(py_isnone(TOP())) {
-                base = tp_object;
-            } else {
-                if(!py_checktype(TOP(), tp_type)) goto __ERROR;
-                base = py_totype(TOP());
-            }
-            POP();
+/// Fast path of `py_getattr`. Returns 1 on hit, 0 on miss and -1 on error.
+static int InlineCache__getattr(VM* self, InlineCache* ic, py_Ref obj, py_Name name) {
+    if(!InlineCache__check(self, ic, obj->type)) {
+        InlineCache__fill(ic, obj->type, name, OP_LOAD_ATTR);
+        return 0;
+    }
+    return InlineCache__getattr_hit(ic, obj, name);
+}
 
-            py_TypeInfo* base_ti = pk_typeinfo(base);
-            if(base_ti->is_final) {
-                TypeError("type '%t' is not an acceptable base type", base);
-                goto __ERROR;
+/// Fast path of `py_pushmethod`. [self] -> [unbound, self] on hit.
+static int InlineCache__loadmethod(VM* self, InlineCache* ic, py_StackRef obj, py_Name name) {
+    if(!InlineCache__check(self, ic, obj->type)) {
+        InlineCache__fill(ic, obj->type, name, OP_LOAD_METHOD);
+        return 0;
+    }
+    switch(ic->kind) {
+        case InlineCacheKind_METHOD:
+            obj[1] = obj[0];
+            obj[0] = ic->value;
+            return 1;
+        case InlineCacheKind_STATICMETHOD:
+            obj[0] = ic->value;
+            py_newnil(&obj[1]);
+            return 1;
+        case InlineCacheKind_CLASSMETHOD:
+            obj[0] = ic->value;
+            obj[1] = *py_tpobject(obj->type);
+            return 1;
+        default: {
+            // not a method, fallback to getattr
+            int res = InlineCache__getattr_hit(ic, obj, name);
+            if(res == 1) {
+                obj[0] = *py_retval();
+                py_newnil(&obj[1]);
             }
-
-            py_Type type = pk_newtypewithmode(name,
-                                              base,
-                                              frame->module,
-                                              NULL,
-                                              base_ti->is_python,
-                                              false,
-                                              frame->co->src->mode);
-            PUSH(py_tpobject(type));
-            self->curr_class = TOP();
-            DISPATCH();
+            return res;
         }
-        case OP_END_CLASS: {
-            // [cls or decorated]
-            py_Name name = co_names[byte.arg];
-            if(!Frame__setglobal(frame, name, TOP())) goto __ERROR;
+    }
+}
 
-            if(py_istype(TOP(), tp_type)) {
-                // call on_end_subclass
-                py_TypeInfo* ti = py_touserdata(TOP());
-                if(ti->base != tp_object) {
-                    py_TypeInfo* base_ti = ti->base_ti;
-                    if(base_ti->on_end_subclass) base_ti->on_end_subclass(ti);
-                }
-                py_TValue* slot_eq = py_getdict(&ti->self, __eq__);
-                py_TValue* slot_ne = py_getdict(&ti->self, __ne__);
-                if(slot_eq && !slot_ne) {
-                    TypeError("'%n' implements '__eq__' but not '__ne__'", ti->name);
-                    goto __ERROR;
-                }
-            }
-            // class with decorator is unsafe currently
-            // it skips the above check
-            POP();
-            self->curr_class = NULL;
-            DISPATCH();
-        }
-        case OP_STORE_CLASS_ATTR: {
-            assert(self->curr_class);
-            py_Name name = co_names[byte.arg];
-            // TOP() can be a function, classmethod or custom decorator
-            py_setdict(self->curr_class, name, TOP());
-            POP();
-            DISPATCH();
-        }
-        case OP_ADD_CLASS_ANNOTATION: {
-            assert(self->curr_class);
-            // [type_hint string]
-            py_TypeInfo* ti = py_touserdata(self->curr_class);
-            if(py_isnil(&ti->annotations)) py_newdict(&ti->annotations);
-            py_Name name = co_names[byte.arg];
-            bool ok = py_dict_setitem_by_str(&ti->annotations, py_name2str(name), TOP());
-            if(!ok) goto __ERROR;
-            POP();
-            DISPATCH();
-        }
-        ///////////
-        case OP_WITH_ENTER: {
-            // [expr]
-            py_push(TOP());
-            if(!py_pushmethod(__enter__)) {
-                TypeError("'%t' object does not support the context manager protocol", TOP()->type);
-                goto __ERROR;
-            }
-            vectorcall_opcall(0, 0);
-            DISPATCH();
-        }
-        case OP_WITH_EXIT: {
-            // [expr]
-            py_push(TOP());
-            if(!py_pushmethod(__exit__)) {
-                TypeError("'%t' object does not support the context manager protocol", TOP()->type);
-                goto __ERROR;
-            }
-            if(!py_vectorcall(0, 0)) goto __ERROR;
-            POP();
-            DISPATCH();
-        }
-        ///////////
-        case OP_BEGIN_TRY: {
-            Frame__begin_try(frame, SP());
-            DISPATCH();
-        }
-        case OP_END_TRY: {
-            c11_vector__pop(&frame->exc_stack);
-            DISPATCH();
-        }
-        case OP_EXCEPTION_MATCH: {
-            if(!py_checktype(TOP(), tp_type)) goto __ERROR;
-            bool ok = py_isinstance(&self->unhandled_exc, py_totype(TOP()));
-            py_newbool(TOP(), ok);
-            DISPATCH();
-        }
-        case OP_HANDLE_EXCEPTION: {
-            FrameExcInfo* info = Frame__top_exc_info(frame);
-            assert(info != NULL && py_isnil(&info->exc));
-            info->exc = self->unhandled_exc;
-            py_newnil(&self->unhandled_exc);
-            DISPATCH();
-        }
-        case OP_RAISE: {
-            // [exception]
-            if(py_istype(TOP(), tp_type)) {
-                if(!py_tpcall(py_totype(TOP()), 0, NULL)) goto __ERROR;
-                py_assign(TOP(), py_retval());
-            }
-            if(!py_isinstance(TOP(), tp_BaseException)) {
-                TypeError("exceptions must derive from BaseException");
-                goto __ERROR;
-            }
-            py_raise(TOP());
-            goto __ERROR;
-        }
-        case OP_RAISE_ASSERT: {
-            if(byte.arg) {
-                if(!py_str(TOP())) goto __ERROR;
-                POP();
-                py_exception(tp_AssertionError, "%s", py_tostr(py_retval()));
-            } else {
-                py_exception(tp_AssertionError, "");
-            }
-            goto __ERROR;
-        }
-        case OP_RE_RAISE: {
-            if(py_isnil(&self->unhandled_exc)) {
-                FrameExcInfo* info = Frame__top_exc_info(frame);
-                assert(info != NULL && !py_isnil(&info->exc));
-                self->unhandled_exc = info->exc;
-            }
-            c11_vector__pop(&frame->exc_stack);
-            goto __ERROR_RE_RAISE;
-        }
-        case OP_PUSH_EXCEPTION: {
-            FrameExcInfo* info = Frame__top_exc_info(frame);
-            assert(info != NULL && !py_isnil(&info->exc));
-            PUSH(&info->exc);
-            DISPATCH();
-        }
-        //////////////////
-        case OP_FORMAT_STRING: {
-            py_Ref spec = c11__at(py_TValue, &frame->co->consts, byte.arg);
-            bool ok = pk_format_object(self, TOP(), py_tosv(spec));
-            if(!ok) goto __ERROR;
-            py_assign(TOP(), py_retval());
-            DISPATCH();
+/// Fast path of `py_setattr`. Returns true on hit.
+static bool InlineCache__setattr(VM* self, InlineCache* ic, py_Ref obj, py_Name name, py_Ref val) {
+    if(!InlineCache__check(self, ic, obj->type)) {
+        InlineCache__fill(ic, obj->type, name, OP_STORE_ATTR);
+        return false;
+    }
+    if(ic->kind == InlineCacheKind_MEMBER) {
+        py_TValue* slot = InlineCache__member(ic, obj);
+        if(slot == NULL) return false;
+        pk__write_barrier_value(obj->_obj, val);
+        *slot = *val;
+        return true;
+    }
+    if(!obj->is_ptr || obj->_obj->slots >= 0) return false;
+    PyObject* o = obj->_obj;
+    Shape* shape = o->slots < -1 ? PyObject__instdict(o)->shape : NULL;
+    if(shape != NULL) {
+        if(shape != ic->shape) {
+            ic->shape = shape;
+            ic->shape_index = Shape__index(shape, name);
+            ic->shape_next = ic->shape_index < 0
+                                 ? ShapeTree__transition(&self->shapes, shape, name)
+                                 : NULL;
+        }
+        if(ic->shape_index >= 0) {
+            pk__write_barrier_value(o, val);
+            *PyObject__instdict_at(o, ic->shape_index) = *val;
+            return true;
+        }
+        if(ic->shape_next != NULL) {
+            pk__write_barrier_value(o, val);
+            PyObject__instdict_append(o, ic->shape_next, val);
+            return true;
         }
-        default: c11__unreachable();
     }
+    py_setdict(obj, name, val);
+    return true;
+}
+
+static bool VM__need_traced_loop(VM* self) {
+#if PK_ENABLE_WATCHDOG
+    if(self->watchdog_info.max_reset_time > 0) return true;
+#endif
+    return self->trace_info.func != NULL;
+}
 
-    c11__unreachable();
+#define PK_CEVAL_NAME VM__run_top_frame_fast
+#define PK_CEVAL_TRACED 0
+#include "pocketpy/xmacros/ceval.h"
 
-__ERROR:
-    assert(!py_isnil(&self->unhandled_exc));
-    py_BaseException__stpush(frame,
-                             &self->unhandled_exc,
-                             frame->co->src,
-                             Frame__lineno(frame),
-                             !frame->is_locals_special ? frame->co->name->data : NULL);
-__ERROR_RE_RAISE:
-    do {
-        self->curr_class = NULL;
-        self->curr_decl_based_function = NULL;
-    } while(0);
+#define PK_CEVAL_NAME VM__run_top_frame_traced
+#define PK_CEVAL_TRACED 1
+#include "pocketpy/xmacros/ceval.h"
 
-    int target = Frame__goto_exception_handler(frame, &self->stack, &self->unhandled_exc);
-    if(target >= 0) {
-        // 1. Exception can be handled inside the current frame
-        DISPATCH_JUMP_ABSOLUTE(target);
-    } else {
-        // 2. Exception need to be propagated to the upper frame
-        bool is_base_frame_to_be_popped = frame == base_frame;
-        VM__pop_frame(self);
-        if(self->top_frame == NULL || is_base_frame_to_be_popped) {
-            // propagate to the top level
-            return RES_ERROR;
+FrameResult VM__run_top_frame(VM* self) {
+    const py_Frame* base_frame = self->top_frame;
+    bool resume = false;
+    while(true) {
+        FrameResult res;
+        if(VM__need_traced_loop(self)) {
+            res = VM__run_top_frame_traced(self, base_frame, resume);
+        } else {
+            res = VM__run_top_frame_fast(self, base_frame, resume);
         }
-        frame = self->top_frame;
-        RESET_CO_CACHE();
-        goto __ERROR;
+        if(res != RES_SWITCH) return res;
+        resume = true;
     }
-
-    c11__unreachable();
 }
 
 const char* pk_op2str(py_Name op) {
@@ -1446,9 +574,6 @@ bool pk_format_object(VM* self, py_Ref val, c11_sv spec) {
 }
 
 #undef CHECK_RETURN_FROM_EXCEPT_OR_FINALLY
-#undef DISPATCH
-#undef DISPATCH_JUMP
-#undef DISPATCH_JUMP_ABSOLUTE
 #undef TOP
 #undef SECOND
 #undef THIRD
@@ -1462,3 +587,4 @@ bool pk_format_object(VM* self, py_Ref val, c11_sv spec) {
 #undef INSERT_THIRD
 #undef vectorcall_opcall
 #undef RESET_CO_CACHE
+#undef INLINE_CACHE
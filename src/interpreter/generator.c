@@ -5,20 +5,19 @@
 #include "pocketpy/pocketpy.h"
 #include <stdbool.h>
 #include <assert.h>
+#include <string.h>
 
 void pk_newgenerator(py_Ref out, py_Frame* frame, py_TValue* begin, py_TValue* end) {
-    Generator* ud = py_newobject(out, tp_generator, 1, sizeof(Generator));
+    Generator* ud = py_newobject(out, tp_generator, 0, sizeof(Generator));
     ud->frame = frame;
     ud->state = 0;
-    py_Ref tmp = py_getslot(out, 0);
-    py_newlist(tmp);
-    for(py_TValue* p = begin; p != end; p++) {
-        py_list_append(tmp, p);
-    }
+    c11_vector__ctor(&ud->stack, sizeof(py_TValue));
+    c11_vector__extend(py_TValue, &ud->stack, begin, end - begin);
 }
 
 void Generator__dtor(Generator* ud) {
     if(ud->frame) Frame__delete(ud->frame);
+    c11_vector__dtor(&ud->stack);
 }
 
 bool generator__next__(int argc, py_Ref argv) {
@@ -35,12 +34,9 @@ bool generator__next__(int argc, py_Ref argv) {
     ud->frame->locals = ud->frame->p0 + locals_offset;
     
     // restore the context
-    py_Ref backup = py_getslot(argv, 0);
-    int length = py_list_len(backup);
-    py_TValue* p = py_list_data(backup);
-    for(int i = 0; i < length; i++)
-        py_push(&p[i]);
-    py_list_clear(backup);
+    memcpy(vm->stack.sp, ud->stack.data, ud->stack.length * sizeof(py_TValue));
+    vm->stack.sp += ud->stack.length;
+    c11_vector__clear(&ud->stack);
 
     // push frame
     VM__push_frame(vm, ud->frame);
@@ -59,10 +55,9 @@ bool generator__next__(int argc, py_Ref argv) {
 
     if(res == RES_YIELD) {
         // backup the context
+        pk__write_barrier(argv->_obj);
         ud->frame = vm->top_frame;
-        for(py_StackRef p = ud->frame->p0; p != vm->stack.sp; p++) {
-            py_list_append(backup, p);
-        }
+        c11_vector__extend(py_TValue, &ud->stack, ud->frame->p0, vm->stack.sp - ud->frame->p0);
         vm->stack.sp = ud->frame->p0;
         vm->top_frame = vm->top_frame->f_back;
         vm->recursion_depth--;
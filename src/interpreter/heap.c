@@ -4,33 +4,201 @@
 #include "pocketpy/objects/base.h"
 #include "pocketpy/common/sstream.h"
 #include "pocketpy/pocketpy.h"
+#include "pocketpy/interpreter/vm.h"
+#include "pocketpy/interpreter/heap_tracer.h"
 #include <assert.h>
 
+// bytes allocated between two automatic steps of an incremental gc
+#define PK_GC_STEP_INTERVAL (PK_GC_MIN_BYTES / 8)
+// objects scanned between two clock checks of an incremental gc
+#define PK_GC_STEP_MARK_COUNT 256
+
+// large objects are allocated after a header that stores their slot in `large_objects` and their size
+#define kLargeObjectHeaderSize 8
+#define LargeObject__base(obj) ((char*)(obj) - kLargeObjectHeaderSize)
+#define LargeObject__slot(obj) ((int*)LargeObject__base(obj))
+#define LargeObject__size(obj) ((int*)LargeObject__base(obj) + 1)
+
 void ManagedHeap__ctor(ManagedHeap* self) {
     MultiPool__ctor(&self->small_objects);
     c11_vector__ctor(&self->large_objects, sizeof(PyObject*));
+    c11_vector__ctor(&self->large_free_slots, sizeof(int));
+    c11_vector__ctor(&self->large_marks, sizeof(uint64_t));
+    self->large_object_count = 0;
+    self->large_bytes = 0;
+    self->external_bytes = 0;
+    self->gc_marked_external = 0;
     c11_vector__ctor(&self->gc_roots, sizeof(PyObject*));
 
-    for(int i = 0; i < c11__count_array(self->freed_ma); i++) {
-        self->freed_ma[i] = PK_GC_MIN_THRESHOLD;
-    }
-    self->gc_threshold = PK_GC_MIN_THRESHOLD;
-    self->gc_counter = 0;
+    self->gc_threshold = PK_GC_MIN_BYTES;
+    self->gc_allocated = 0;
+    self->gc_live_bytes = 0;
+    self->gc_limit = 0;
+    self->gc_trigger = PK_GC_MIN_BYTES;
     self->gc_enabled = true;
     self->debug_callback = *py_None();
+
+    self->gc_generational = true;
+    self->gc_minor = false;
+    c11_vector__ctor(&self->nursery, sizeof(ManagedHeapYoung));
+    c11_vector__ctor(&self->remembered, sizeof(PyObject*));
+    self->gc_promoted = 0;
+    self->gc_promoted_limit = PK_GC_MIN_BYTES;
+
+    self->gc_state = PK_GC_IDLE;
+    self->gc_next_step = 0;
+    self->gc_cycle_freed = 0;
+    self->gc_cycle_start = 0;
+    self->gc_mark_clocks = 0;
+    self->gc_swpet_clocks = 0;
+    self->gc_cycle_info = NULL;
+
+    self->tracer = NULL;
 }
 
 void ManagedHeap__dtor(ManagedHeap* self) {
+    HeapTracer__stop(self);
     // small_objects
     MultiPool__dtor(&self->small_objects);
     // large_objects
     for(int i = 0; i < self->large_objects.length; i++) {
         PyObject* obj = c11__getitem(PyObject*, &self->large_objects, i);
+        if(obj == NULL) continue;
         PyObject__dtor(obj);
-        PK_FREE(obj);
+        PK_FREE(LargeObject__base(obj));
     }
     c11_vector__dtor(&self->large_objects);
+    c11_vector__dtor(&self->large_free_slots);
+    c11_vector__dtor(&self->large_marks);
     c11_vector__dtor(&self->gc_roots);
+    c11_vector__dtor(&self->nursery);
+    c11_vector__dtor(&self->remembered);
+    if(self->gc_cycle_info) ManagedHeapSwpetInfo__delete(self->gc_cycle_info);
+}
+
+void PyObject__remember(PyObject* self) {
+    ManagedHeap* heap = &pk_current_vm->heap;
+    assert(self->gc_gen == PK_GC_OLD);
+    self->gc_gen = PK_GC_REMEMBERED;
+    c11_vector__push(PyObject*, &heap->remembered, self);
+}
+
+void PyObject__remember_value(PyObject* self, PyObject* val) {
+    ManagedHeap* heap = &pk_current_vm->heap;
+    if(heap->gc_state == PK_GC_MARKING) {
+        // shade `val` instead, so that big containers are not scanned again
+        if(PyObject__mark(val)) c11_vector__push(PyObject*, &heap->gc_roots, val);
+        return;
+    }
+    PyObject__remember(self);
+}
+
+bool PyObject__is_marked_large(PyObject* self) {
+    ManagedHeap* heap = &pk_current_vm->heap;
+    int slot = *LargeObject__slot(self);
+    uint64_t word = c11__getitem(uint64_t, &heap->large_marks, slot >> 6);
+    return (word >> (slot & 63)) & 1;
+}
+
+bool PyObject__mark_large(PyObject* self) {
+    ManagedHeap* heap = &pk_current_vm->heap;
+    int slot = *LargeObject__slot(self);
+    uint64_t* word = c11__at(uint64_t, &heap->large_marks, (slot >> 6));
+    uint64_t bit = (uint64_t)1 << (slot & 63);
+    if(*word & bit) return false;
+    *word |= bit;
+    return true;
+}
+
+static PyObject* ManagedHeap__alloc_large(ManagedHeap* self, int size) {
+    int slot;
+    if(self->large_free_slots.length > 0) {
+        slot = c11_vector__back(int, &self->large_free_slots);
+        c11_vector__pop(&self->large_free_slots);
+    } else {
+        slot = self->large_objects.length;
+        c11_vector__push(PyObject*, &self->large_objects, NULL);
+        if(slot % 64 == 0) c11_vector__push(uint64_t, &self->large_marks, 0);
+    }
+    char* base = PK_MALLOC(kLargeObjectHeaderSize + size);
+    PyObject* obj = (PyObject*)(base + kLargeObjectHeaderSize);
+    *LargeObject__slot(obj) = slot;
+    *LargeObject__size(obj) = size;
+    c11__setitem(PyObject*, &self->large_objects, slot, obj);
+    self->large_object_count++;
+    self->large_bytes += kLargeObjectHeaderSize + size;
+    return obj;
+}
+
+static void ManagedHeap__free_large(ManagedHeap* self, PyObject* obj) {
+    int slot = *LargeObject__slot(obj);
+    self->large_bytes -= kLargeObjectHeaderSize + *LargeObject__size(obj);
+    PyObject__dtor(obj);
+    PK_FREE(LargeObject__base(obj));
+    c11__setitem(PyObject*, &self->large_objects, slot, NULL);
+    c11_vector__push(int, &self->large_free_slots, slot);
+    self->large_object_count--;
+}
+
+static void ManagedHeap__forget_remembered(ManagedHeap* self) {
+    c11__foreach(PyObject*, &self->remembered, p) { (*p)->gc_gen = PK_GC_OLD; }
+    c11_vector__clear(&self->remembered);
+}
+
+static void ManagedHeap__clear_marks(ManagedHeap* self) {
+    MultiPool__clear_marks(&self->small_objects);
+    memset(self->large_marks.data, 0, self->large_marks.length * sizeof(uint64_t));
+}
+
+static void ManagedHeap__set_threshold(ManagedHeap* self, ManagedHeapSwpetInfo* out_info) {
+    int64_t new_threshold;
+    if(self->gc_generational) {
+        // keep the nursery small, so that minor collections are short
+        new_threshold = PK_GC_MIN_BYTES;
+    } else {
+        // collect when the heap has grown by `PK_GC_HEAP_GROWTH` percent
+        new_threshold = self->gc_live_bytes * PK_GC_HEAP_GROWTH / 100;
+        new_threshold = c11__max(new_threshold, PK_GC_MIN_BYTES);
+    }
+    if(out_info) {
+        out_info->auto_thres.before = self->gc_threshold;
+        out_info->auto_thres.after = new_threshold;
+        out_info->auto_thres.live_bytes = self->gc_live_bytes;
+    }
+    self->gc_threshold = new_threshold;
+}
+
+void ManagedHeap__update_trigger(ManagedHeap* self) {
+    int64_t trigger = INT64_MAX;
+    if(self->gc_enabled) {
+        trigger = self->gc_state == PK_GC_IDLE ? self->gc_threshold : self->gc_next_step;
+    }
+    if(self->gc_limit > 0) {
+        // frees are not known until the next collection, so this is a lower bound.
+        // once a collection cannot get under the limit, wait for the next automatic one
+        int64_t headroom = self->gc_limit - ManagedHeap__used_bytes(self);
+        if(headroom > 0) trigger = c11__min(trigger, self->gc_allocated + headroom);
+    }
+    self->gc_trigger = trigger;
+}
+
+void ManagedHeap__set_limit(ManagedHeap* self, int64_t limit) {
+    self->gc_limit = limit;
+    ManagedHeap__update_trigger(self);
+}
+
+void ManagedHeap__set_generational(ManagedHeap* self, bool enabled) {
+    if(self->gc_generational == enabled) return;
+    ManagedHeap__finish_cycle(self);
+    self->gc_generational = enabled;
+    c11_vector__clear(&self->nursery);
+    ManagedHeap__forget_remembered(self);
+    if(enabled) {
+        // existing objects are not in the nursery, the next collection must be a full one
+        self->gc_promoted = self->gc_promoted_limit;
+    }
+    ManagedHeap__set_threshold(self, NULL);
+    ManagedHeap__update_trigger(self);
 }
 
 static void ManagedHeap__fire_debug_callback(ManagedHeap* self, ManagedHeapSwpetInfo* out_info) {
@@ -48,6 +216,7 @@ static void ManagedHeap__fire_debug_callback(ManagedHeap* self, ManagedHeapSwpet
 
     c11_sbuf__write_cstr(&buf, DIVIDER);
     pk_sprintf(&buf, "start:        %f\n", (double)start / 1000);
+    pk_sprintf(&buf, "kind:         %s\n", out_info->kind);
     pk_sprintf(&buf, "mark_ms:      %i\n", (py_i64)mark_ms);
     pk_sprintf(&buf, "swpet_ms:     %i\n", (py_i64)swpet_ms);
     pk_sprintf(&buf, "total_ms:     %i\n", (py_i64)(mark_ms + swpet_ms));
@@ -75,12 +244,9 @@ static void ManagedHeap__fire_debug_callback(ManagedHeap* self, ManagedHeapSwpet
         c11_sbuf__write_cstr(&buf, DIVIDER);
     }
 
-    pk_sprintf(&buf, "auto_thres.before:        %d\n", out_info->auto_thres.before);
-    pk_sprintf(&buf, "auto_thres.after:         %d\n", out_info->auto_thres.after);
-    pk_sprintf(&buf, "auto_thres.upper:         %d\n", out_info->auto_thres.upper);
-    pk_sprintf(&buf, "auto_thres.lower:         %d\n", out_info->auto_thres.lower);
-    pk_sprintf(&buf, "auto_thres.avg_freed:     %d\n", out_info->auto_thres.avg_freed);
-    pk_sprintf(&buf, "auto_thres.free_ratio:    %f\n", out_info->auto_thres.free_ratio);
+    pk_sprintf(&buf, "auto_thres.before:        %i\n", out_info->auto_thres.before);
+    pk_sprintf(&buf, "auto_thres.after:         %i\n", out_info->auto_thres.after);
+    pk_sprintf(&buf, "auto_thres.live_bytes:    %i\n", out_info->auto_thres.live_bytes);
     c11_sbuf__write_cstr(&buf, DIVIDER);
 
     py_push(&self->debug_callback);
@@ -94,36 +260,74 @@ static void ManagedHeap__fire_debug_callback(ManagedHeap* self, ManagedHeapSwpet
     }
 }
 
-void ManagedHeap__collect_hint(ManagedHeap* self) {
-    if(self->gc_counter < self->gc_threshold) return;
-    self->gc_counter = 0;
+static bool ManagedHeap__can_collect_young(ManagedHeap* self) {
+    return self->gc_generational && self->gc_promoted < self->gc_promoted_limit;
+}
+
+static int ManagedHeap__sweep_young(ManagedHeap* self, ManagedHeapSwpetInfo* out_info) {
+    int small_freed = 0;
+    int large_freed = 0;
+    // in reverse order, so that the next allocations reuse the blocks in address order
+    for(int i = self->nursery.length - 1; i >= 0; i--) {
+        ManagedHeapYoung* item = c11__at(ManagedHeapYoung, &self->nursery, i);
+        PyObject* obj = item->obj;
+        // survivors were made old when they were scanned, and their marks are kept
+        if(PyObject__is_marked(obj)) continue;
+        self->external_bytes -= PyObject__external_bytes(obj);
+        if(item->arena) {
+            if(out_info) out_info->small_types[obj->type]++;
+            MultiPool__dealloc(&self->small_objects, item->arena, obj);
+            small_freed++;
+        } else {
+            if(out_info) out_info->large_types[obj->type]++;
+            ManagedHeap__free_large(self, obj);
+            large_freed++;
+        }
+    }
+    c11_vector__clear(&self->nursery);
+    MultiPool__reclaim_arenas(&self->small_objects, PK_GC_ARENA_GRACE);
+    // growth of instance dicts is not accounted, so the estimate may be too small
+    self->external_bytes = c11__max(self->external_bytes, 0);
+    // survivors and the growth of old containers stay until the next full gc
+    self->gc_promoted = ManagedHeap__used_bytes(self) - self->gc_live_bytes;
+    if(out_info) {
+        out_info->small_freed = small_freed;
+        out_info->large_freed = large_freed;
+    }
+    return small_freed + large_freed;
+}
+
+static int ManagedHeap__collect_impl(ManagedHeap* self, bool minor, ManagedHeapSwpetInfo* out_info) {
+    assert(self->gc_state == PK_GC_IDLE);
+    int freed;
+    if(out_info) out_info->kind = minor ? "minor" : "full";
+    if(minor) {
+        // only trace objects in the nursery and the remembered set
+        self->gc_minor = true;
+        ManagedHeap__mark(self);
+        self->gc_minor = false;
+        if(out_info) out_info->mark_end = clock();
+        freed = ManagedHeap__sweep_young(self, out_info);
+    } else {
+        ManagedHeap__clear_marks(self);
+        ManagedHeap__forget_remembered(self);
+        self->gc_marked_external = 0;
+        ManagedHeap__mark(self);
+        if(out_info) out_info->mark_end = clock();
+        freed = ManagedHeap__sweep(self, out_info);
+    }
+    if(out_info) out_info->swpet_end = clock();
+    return freed;
+}
+
+static void ManagedHeap__collect_minor(ManagedHeap* self) {
+    self->gc_allocated = 0;
 
     ManagedHeapSwpetInfo* out_info = NULL;
     if(!py_isnone(&self->debug_callback)) out_info = ManagedHeapSwpetInfo__new();
-    
-    ManagedHeap__mark(self);
-    if(out_info) out_info->mark_end = clock();
-    int freed = ManagedHeap__sweep(self, out_info);
-    if(out_info) out_info->swpet_end = clock();
 
-    // adjust `gc_threshold` based on `freed_ma`
-    self->freed_ma[0] = self->freed_ma[1];
-    self->freed_ma[1] = self->freed_ma[2];
-    self->freed_ma[2] = freed;
-    int avg_freed = (self->freed_ma[0] + self->freed_ma[1] + self->freed_ma[2]) / 3;
-    const int upper = PK_GC_MIN_THRESHOLD * 16;
-    const int lower = PK_GC_MIN_THRESHOLD / 2;
-    float free_ratio = (float)avg_freed / self->gc_threshold;
-    int new_threshold = self->gc_threshold * (1.5f / free_ratio);
-    if(out_info) {
-        out_info->auto_thres.before = self->gc_threshold;
-        out_info->auto_thres.after = new_threshold;
-        out_info->auto_thres.upper = upper;
-        out_info->auto_thres.lower = lower;
-        out_info->auto_thres.avg_freed = avg_freed;
-        out_info->auto_thres.free_ratio = free_ratio;
-    }
-    self->gc_threshold = c11__min(c11__max(new_threshold, lower), upper);
+    ManagedHeap__collect_impl(self, true, out_info);
+    ManagedHeap__set_threshold(self, out_info);
 
     if(!py_isnone(&self->debug_callback)) {
         ManagedHeap__fire_debug_callback(self, out_info);
@@ -131,21 +335,203 @@ void ManagedHeap__collect_hint(ManagedHeap* self) {
     }
 }
 
-int ManagedHeap__collect(ManagedHeap* self) {
-    self->gc_counter = 0;
+static void ManagedHeap__begin_cycle(ManagedHeap* self) {
+    assert(self->gc_state == PK_GC_IDLE);
+    self->gc_allocated = 0;
+    self->gc_next_step = 0;
+    self->gc_marked_external = 0;
+    self->gc_cycle_freed = 0;
+    self->gc_cycle_start = clock();
+    self->gc_mark_clocks = 0;
+    self->gc_swpet_clocks = 0;
+    // objects in the nursery are traced by this cycle
+    c11_vector__clear(&self->nursery);
+    // every object is white now, only the bitmaps are cleared
+    ManagedHeap__clear_marks(self);
+    ManagedHeap__forget_remembered(self);
+    self->gc_state = PK_GC_MARKING;
+    ManagedHeap__mark_roots(self);
+}
+
+static int ManagedHeap__sweep_large(ManagedHeap* self, int* out_types);
 
+static void ManagedHeap__begin_sweeping(ManagedHeap* self) {
+    // the mutator may have changed the roots and the black objects since they were scanned,
+    // so scan them again and finish marking atomically
+    ManagedHeap__mark_roots(self);
+    ManagedHeap__propagate(self, -1);
+    // only the roots are left in the remembered set, in generational mode
+    assert(self->gc_generational || self->remembered.length == 0);
     ManagedHeapSwpetInfo* out_info = NULL;
     if(!py_isnone(&self->debug_callback)) out_info = ManagedHeapSwpetInfo__new();
-    
-    ManagedHeap__mark(self);
-    if(out_info) out_info->mark_end = clock();
-    int freed = ManagedHeap__sweep(self, out_info);
-    if(out_info) out_info->swpet_end = clock();
+    self->gc_cycle_info = out_info;
+    // new objects never go into an unswept arena, so they need no mark
+    self->gc_cycle_freed = ManagedHeap__sweep_large(self, out_info ? out_info->large_types : NULL);
+    MultiPool__begin_lazy_sweep(&self->small_objects, out_info ? out_info->small_types : NULL);
+    self->gc_state = PK_GC_SWEEPING;
+}
 
+static int ManagedHeap__sweep_large(ManagedHeap* self, int* out_types) {
+    int large_freed = 0;
+    for(int w = 0; w < self->large_marks.length; w++) {
+        // every slot of this word is marked
+        if(c11__getitem(uint64_t, &self->large_marks, w) == UINT64_MAX) continue;
+        int end = c11__min((w + 1) * 64, self->large_objects.length);
+        for(int slot = w * 64; slot < end; slot++) {
+            PyObject* obj = c11__getitem(PyObject*, &self->large_objects, slot);
+            if(obj == NULL || PyObject__is_marked_large(obj)) continue;
+            if(out_types) out_types[obj->type]++;
+            ManagedHeap__free_large(self, obj);
+            large_freed++;
+        }
+    }
+    return large_freed;
+}
+
+static int ManagedHeap__end_sweep(ManagedHeap* self,
+                                  int small_freed,
+                                  int large_freed,
+                                  ManagedHeapSwpetInfo* out_info) {
     if(out_info) {
-        out_info->auto_thres.before = self->gc_threshold;
-        out_info->auto_thres.after = self->gc_threshold;
+        out_info->small_freed = small_freed;
+        out_info->large_freed = large_freed;
+    }
+    // buffers of the survivors were counted while marking
+    self->external_bytes = self->gc_marked_external;
+    self->gc_live_bytes = ManagedHeap__used_bytes(self);
+    self->gc_promoted = 0;
+    int64_t growth = self->gc_live_bytes * PK_GC_HEAP_GROWTH / 100;
+    self->gc_promoted_limit = c11__max(growth, PK_GC_MIN_BYTES);
+    return small_freed + large_freed;
+}
+
+static void ManagedHeap__end_cycle(ManagedHeap* self) {
+    ManagedHeapSwpetInfo* out_info = self->gc_cycle_info;
+    MultiPool__reclaim_arenas(&self->small_objects, PK_GC_ARENA_GRACE);
+    int small_freed = self->small_objects.sweep_freed;
+    int large_freed = self->gc_cycle_freed;
+    int freed = ManagedHeap__end_sweep(self, small_freed, large_freed, out_info);
+    // objects created or written during sweeping are left to the next minor collection.
+    // objects created during sweeping are born old, native code may still be filling them
+    if(self->gc_generational) {
+        ManagedHeap__remember_roots(self);
+    } else {
+        ManagedHeap__forget_remembered(self);
+    }
+    self->gc_cycle_freed = freed;
+    self->gc_state = PK_GC_IDLE;
+    self->gc_allocated = 0;
+    self->gc_cycle_info = NULL;
+    ManagedHeap__set_threshold(self, out_info);
+
+    if(out_info) {
+        out_info->kind = "incremental";
+        out_info->start = self->gc_cycle_start;
+        out_info->mark_end = out_info->start + self->gc_mark_clocks;
+        out_info->swpet_end = out_info->mark_end + self->gc_swpet_clocks;
+        if(!py_isnone(&self->debug_callback)) ManagedHeap__fire_debug_callback(self, out_info);
+        ManagedHeapSwpetInfo__delete(out_info);
     }
+}
+
+bool ManagedHeap__step(ManagedHeap* self, int budget_us) {
+    if(self->gc_state == PK_GC_IDLE) {
+        if(self->gc_allocated < self->gc_threshold) return true;
+        if(ManagedHeap__can_collect_young(self)) {
+            // minor collections are short, run them at once
+            ManagedHeap__collect_minor(self);
+            ManagedHeap__update_trigger(self);
+            return true;
+        }
+        ManagedHeap__begin_cycle(self);
+    }
+
+    // a negative budget means no limit, do at least one unit of work otherwise
+    bool limited = budget_us >= 0;
+    clock_t start = clock();
+    clock_t deadline = start + (clock_t)((double)budget_us * CLOCKS_PER_SEC / 1000000);
+    self->gc_next_step = self->gc_allocated + PK_GC_STEP_INTERVAL;
+
+    if(self->gc_state == PK_GC_MARKING) {
+        while(!ManagedHeap__propagate(self, limited ? PK_GC_STEP_MARK_COUNT : -1)) {
+            if(clock() >= deadline) goto __PAUSE;
+        }
+        ManagedHeap__begin_sweeping(self);
+        clock_t now = clock();
+        self->gc_mark_clocks += now - start;
+        start = now;
+    }
+
+    if(self->gc_state == PK_GC_SWEEPING) {
+        // arenas are also swept on demand by `MultiPool__alloc`
+        while(MultiPool__lazy_sweep_one(&self->small_objects)) {
+            if(limited && clock() >= deadline) goto __PAUSE;
+        }
+        self->gc_swpet_clocks += clock() - start;
+        ManagedHeap__end_cycle(self);
+        ManagedHeap__update_trigger(self);
+        return true;
+    }
+
+__PAUSE:
+    if(self->gc_state == PK_GC_SWEEPING) {
+        self->gc_swpet_clocks += clock() - start;
+    } else {
+        self->gc_mark_clocks += clock() - start;
+    }
+    ManagedHeap__update_trigger(self);
+    return false;
+}
+
+int ManagedHeap__finish_cycle(ManagedHeap* self) {
+    if(self->gc_state == PK_GC_IDLE) return 0;
+    ManagedHeap__step(self, -1);
+    return self->gc_cycle_freed;
+}
+
+void ManagedHeap__collect_hint(ManagedHeap* self) {
+    if(self->gc_state == PK_GC_IDLE) {
+        if(self->gc_allocated < self->gc_threshold) return;
+    } else {
+        if(self->gc_allocated < self->gc_next_step) return;
+        if(self->gc_allocated >= c11__max(self->gc_threshold, self->gc_live_bytes / 2)) {
+            // the mutator outpaces the collector
+            ManagedHeap__finish_cycle(self);
+            return;
+        }
+    }
+    ManagedHeap__step(self, PK_GC_STEP_BUDGET_US);
+}
+
+bool ManagedHeap__reserve(ManagedHeap* self, int64_t bytes) {
+    if(self->gc_limit == 0 || bytes <= 0) return true;
+    if(ManagedHeap__used_bytes(self) + bytes <= self->gc_limit) return true;
+    // emergency collection, even if automatic collections are disabled
+    ManagedHeap__collect(self);
+    if(ManagedHeap__used_bytes(self) + bytes <= self->gc_limit) return true;
+    return MemoryError("memory limit of %i bytes exceeded", self->gc_limit);
+}
+
+void ManagedHeap__safepoint(ManagedHeap* self) {
+    if(self->gc_enabled) ManagedHeap__collect_hint(self);
+    if(self->gc_limit > 0 && ManagedHeap__used_bytes(self) > self->gc_limit) {
+        // emergency collection, `MemoryError` is left to the next `ManagedHeap__reserve`
+        ManagedHeap__collect(self);
+    }
+    ManagedHeap__update_trigger(self);
+}
+
+static int ManagedHeap__collect_now(ManagedHeap* self, bool minor) {
+    int freed = ManagedHeap__finish_cycle(self);
+    self->gc_allocated = 0;
+
+    ManagedHeapSwpetInfo* out_info = NULL;
+    if(!py_isnone(&self->debug_callback)) out_info = ManagedHeapSwpetInfo__new();
+
+    freed += ManagedHeap__collect_impl(self, minor && ManagedHeap__can_collect_young(self), out_info);
+
+    ManagedHeap__set_threshold(self, out_info);
+    ManagedHeap__update_trigger(self);
 
     if(!py_isnone(&self->debug_callback)) {
         ManagedHeap__fire_debug_callback(self, out_info);
@@ -154,56 +540,73 @@ int ManagedHeap__collect(ManagedHeap* self) {
     return freed;
 }
 
+int ManagedHeap__collect(ManagedHeap* self) { return ManagedHeap__collect_now(self, false); }
+
+int ManagedHeap__collect_young(ManagedHeap* self) { return ManagedHeap__collect_now(self, true); }
+
 int ManagedHeap__sweep(ManagedHeap* self, ManagedHeapSwpetInfo* out_info) {
     // small_objects
     int small_freed =
         MultiPool__sweep_dealloc(&self->small_objects, out_info ? out_info->small_types : NULL);
+    // explicit collections give empty arenas back at once
+    MultiPool__reclaim_arenas(&self->small_objects, 0);
     // large_objects
-    int large_living_count = 0;
-    for(int i = 0; i < self->large_objects.length; i++) {
-        PyObject* obj = c11__getitem(PyObject*, &self->large_objects, i);
-        if(obj->gc_marked) {
-            obj->gc_marked = false;
-            c11__setitem(PyObject*, &self->large_objects, large_living_count, obj);
-            large_living_count++;
-        } else {
-            if(out_info) out_info->large_types[obj->type]++;
-            PyObject__dtor(obj);
-            PK_FREE(obj);
-        }
-    }
-    // shrink `self->large_objects`
-    int large_freed = self->large_objects.length - large_living_count;
-    self->large_objects.length = large_living_count;
-    if(out_info) {
-        out_info->small_freed = small_freed;
-        out_info->large_freed = large_freed;
-    }
-    return small_freed + large_freed;
+    int large_freed = ManagedHeap__sweep_large(self, out_info ? out_info->large_types : NULL);
+    // every survivor is old now
+    c11_vector__clear(&self->nursery);
+    ManagedHeap__forget_remembered(self);
+    return ManagedHeap__end_sweep(self, small_freed, large_freed, out_info);
 }
 
 PyObject* ManagedHeap__gcnew(ManagedHeap* self, py_Type type, int slots, int udsize) {
     assert(slots >= 0 || slots == -1);
+    if(slots == -1 && type != tp_type && type != tp_module) {
+        // an instance dict, with the padding of its pool block used for more inline values
+        int n = pk_typeinfo(type)->inline_attrs;
+        int base_size = sizeof(PyObject) + sizeof(InstanceDict) + udsize;
+        int block_size = (base_size + n * (int)sizeof(py_TValue) + 31) & ~31;
+        if(block_size <= 32 * kMultiPoolCount) n = (block_size - base_size) / (int)sizeof(py_TValue);
+        slots = -2 - n;
+    }
     // header + slots + udsize
     int size = sizeof(PyObject) + PK_OBJ_SLOTS_SIZE(slots) + udsize;
-    PyObject* obj = MultiPool__alloc(&self->small_objects, size);
-    if(obj == NULL) {
-        obj = PK_MALLOC(size);
-        c11_vector__push(PyObject*, &self->large_objects, obj);
-    }
+    PoolArena* arena = NULL;
+    PyObject* obj = MultiPool__alloc(&self->small_objects, size, &arena);
+    if(obj == NULL) obj = ManagedHeap__alloc_large(self, size);
     obj->type = type;
-    obj->gc_marked = false;
+    obj->gc_gen = PK_GC_YOUNG;
+    obj->gc_large = arena == NULL;
     obj->slots = slots;
 
     // initialize slots or dict
     if(slots >= 0) {
         memset(obj->flex, 0, slots * sizeof(py_TValue));
+    } else if(slots == -1) {
+        NameDict* dict = (void*)obj->flex;
+        NameDict__ctor(dict, PK_TYPE_ATTR_LOAD_FACTOR);
+        ManagedHeap__account(self, dict->capacity * sizeof(NameDict_KV));
     } else {
-        float load_factor = (type == tp_type || type == tp_module) ? PK_TYPE_ATTR_LOAD_FACTOR
-                                                                   : PK_INST_ATTR_LOAD_FACTOR;
-        NameDict__ctor((void*)obj->flex, load_factor);
+        InstanceDict* d = (void*)obj->flex;
+        d->shape = pk_current_vm->shapes.root;
+        d->extra = NULL;
+        memset(d->values, 0, PK_OBJ_INLINE_ATTRS(slots) * sizeof(py_TValue));
     }
 
-    self->gc_counter++;
+    // objects created while marking are white and not in the nursery, the cycle handles them
+    if(self->gc_state == PK_GC_IDLE && self->gc_generational) {
+        ManagedHeapYoung item = {obj, arena};
+        c11_vector__push(ManagedHeapYoung, &self->nursery, item);
+    } else if(self->gc_state != PK_GC_MARKING) {
+        // born marked, so that the write barrier skips it until the next cycle.
+        // new objects only go into swept arenas, in generational mode they are born old
+        // so that the nursery does not grow during a long sweep
+        PyObject__mark(obj);
+        if(self->gc_generational) obj->gc_gen = PK_GC_OLD;
+    }
+    int bytes = arena ? arena->block_size : kLargeObjectHeaderSize + size;
+    self->gc_allocated += bytes;
+    if(self->tracer) {
+        HeapTracer__on_alloc(self->tracer, obj, arena, arena ? -1 : *LargeObject__slot(obj), bytes);
+    }
     return obj;
 }
\ No newline at end of file
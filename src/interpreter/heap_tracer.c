@@ -0,0 +1,164 @@
+#include "pocketpy/interpreter/heap_tracer.h"
+#include "pocketpy/interpreter/heap.h"
+#include "pocketpy/interpreter/frame.h"
+#include "pocketpy/interpreter/vm.h"
+#include <assert.h>
+#include <string.h>
+
+void HeapTracer__start(ManagedHeap* heap) {
+    if(heap->tracer) return;
+    HeapTracer* self = PK_MALLOC(sizeof(HeapTracer));
+    c11_vector__ctor(&self->sites, sizeof(HeapTraceSite));
+    HeapTraceSite untraced = {0};
+    c11_vector__push(HeapTraceSite, &self->sites, untraced);
+    c11_smallmap_p2i__ctor(&self->lines);
+    self->native_sites = 0;
+    c11_vector__ctor(&self->large, sizeof(HeapTraceLarge));
+    heap->tracer = self;
+}
+
+void HeapTracer__stop(ManagedHeap* heap) {
+    HeapTracer* self = heap->tracer;
+    if(self == NULL) return;
+    MultiPool__clear_sites(&heap->small_objects);
+    for(int i = 0; i < self->lines.length; i++) {
+        c11_smallmap_p2i_KV kv = c11__getitem(c11_smallmap_p2i_KV, &self->lines, i);
+        SourceData_ src = (SourceData_)kv.key;
+        PK_DECREF(src);
+        PK_FREE((void*)kv.value);
+    }
+    c11_smallmap_p2i__dtor(&self->lines);
+    c11_vector__dtor(&self->sites);
+    c11_vector__dtor(&self->large);
+    PK_FREE(self);
+    heap->tracer = NULL;
+}
+
+static int HeapTracer__site(HeapTracer* self, py_Type type) {
+    SourceLocation loc = {NULL, 0};
+    int* head = &self->native_sites;
+    py_Frame* frame = pk_current_vm->top_frame;
+    if(frame) {
+        loc = Frame__source_location(frame);
+        int max_lineno = loc.src->line_starts.length;
+        if(loc.lineno < 0 || loc.lineno > max_lineno) loc.lineno = 0;
+        int* lines = (int*)c11_smallmap_p2i__get(&self->lines, loc.src, 0);
+        if(lines == NULL) {
+            lines = PK_MALLOC(sizeof(int) * (max_lineno + 1));
+            memset(lines, 0, sizeof(int) * (max_lineno + 1));
+            c11_smallmap_p2i__set(&self->lines, loc.src, (py_i64)lines);
+            PK_INCREF(loc.src);
+        }
+        head = &lines[loc.lineno];
+    }
+    // a line creates objects of a few types, so a linked list is enough
+    for(int i = *head; i != 0;) {
+        HeapTraceSite* site = c11__at(HeapTraceSite, &self->sites, i);
+        if(site->type == type) return i;
+        i = site->next;
+    }
+    HeapTraceSite site = {
+        .src = loc.src,
+        .lineno = loc.lineno,
+        .type = type,
+        .next = *head,
+        .total_count = 0,
+        .total_size = 0,
+    };
+    c11_vector__push(HeapTraceSite, &self->sites, site);
+    *head = self->sites.length - 1;
+    return *head;
+}
+
+void HeapTracer__on_alloc(HeapTracer* self, void* obj, PoolArena* arena, int slot, int size) {
+    int index = HeapTracer__site(self, ((PyObject*)obj)->type);
+    HeapTraceSite* site = c11__at(HeapTraceSite, &self->sites, index);
+    site->total_count++;
+    site->total_size += size;
+    if(arena) {
+        if(arena->sites == NULL) {
+            arena->sites = PK_MALLOC(sizeof(int) * kPoolArenaUnits);
+            memset(arena->sites, 0, sizeof(int) * kPoolArenaUnits);
+        }
+        arena->sites[PoolArena__unit(arena, obj)] = index;
+    } else {
+        HeapTraceLarge empty = {0, 0};
+        while(self->large.length <= slot) {
+            c11_vector__push(HeapTraceLarge, &self->large, empty);
+        }
+        HeapTraceLarge item = {index, size};
+        c11__setitem(HeapTraceLarge, &self->large, slot, item);
+    }
+}
+
+static void HeapTracer__count_arenas(c11_vector* arenas, py_i64* counts, py_i64* sizes) {
+    c11__foreach(PoolArena*, arenas, p_arena) {
+        PoolArena* arena = *p_arena;
+        if(arena->sites == NULL) continue;
+        for(int w = 0; w < kPoolArenaBitmapWords; w++) {
+            uint64_t bits = arena->used[w];
+            while(bits) {
+                int unit = w * 64 + c11__ctz64(bits);
+                bits &= bits - 1;
+                int site = arena->sites[unit];
+                if(site == 0) continue;
+                PyObject* obj = (PyObject*)(arena->data + unit * 32);
+                counts[site]++;
+                sizes[site] += arena->block_size + PyObject__external_bytes(obj);
+            }
+        }
+    }
+}
+
+c11_vector HeapTracer__snapshot(ManagedHeap* heap) {
+    HeapTracer* self = heap->tracer;
+    assert(self != NULL);
+    // garbage is not counted
+    ManagedHeap__collect(heap);
+
+    int n = self->sites.length;
+    py_i64* counts = PK_MALLOC(sizeof(py_i64) * n * 2);
+    py_i64* sizes = counts + n;
+    memset(counts, 0, sizeof(py_i64) * n * 2);
+
+    for(int i = 0; i < kMultiPoolCount; i++) {
+        Pool* pool = &heap->small_objects.pools[i];
+        HeapTracer__count_arenas(&pool->arenas, counts, sizes);
+        HeapTracer__count_arenas(&pool->no_free_arenas, counts, sizes);
+        HeapTracer__count_arenas(&pool->unswept_arenas, counts, sizes);
+    }
+    for(int slot = 0; slot < self->large.length; slot++) {
+        HeapTraceLarge item = c11__getitem(HeapTraceLarge, &self->large, slot);
+        if(item.site == 0) continue;
+        PyObject* obj = c11__getitem(PyObject*, &heap->large_objects, slot);
+        if(obj == NULL) continue;
+        counts[item.site]++;
+        sizes[item.site] += item.size + PyObject__external_bytes(obj);
+    }
+
+    c11_vector records;
+    c11_vector__ctor(&records, sizeof(HeapSnapshotRecord));
+    for(int i = 1; i < n; i++) {
+        HeapTraceSite* site = c11__at(HeapTraceSite, &self->sites, i);
+        HeapSnapshotRecord record = {
+            .src = site->src,
+            .lineno = site->lineno,
+            .type = site->type,
+            .count = counts[i],
+            .size = sizes[i],
+            .total_count = site->total_count,
+            .total_size = site->total_size,
+        };
+        if(record.src) PK_INCREF(record.src);
+        c11_vector__push(HeapSnapshotRecord, &records, record);
+    }
+    PK_FREE(counts);
+    return records;
+}
+
+void HeapSnapshotRecord__dtor_all(c11_vector* records) {
+    c11__foreach(HeapSnapshotRecord, records, record) {
+        if(record->src) PK_DECREF(record->src);
+    }
+    c11_vector__dtor(records);
+}
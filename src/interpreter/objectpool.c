@@ -7,57 +7,76 @@
 #include <stdbool.h>
 #include <string.h>
 
+static_assert(sizeof(PoolArena) <= kPoolArenaAlign, "PoolArena is too large");
+
 static PoolArena* PoolArena__new(int block_size) {
-    assert(kPoolArenaSize % block_size == 0);
+    assert(block_size % 32 == 0);
     int block_count = kPoolArenaSize / block_size;
-    PoolArena* self = PK_MALLOC(sizeof(PoolArena) + sizeof(int) * block_count);
+    PoolArena* self = PK_ALIGNED_MALLOC(kPoolArenaAlign, kPoolArenaAlign);
     self->block_size = block_size;
     self->block_count = block_count;
     self->unused_length = block_count;
+    self->empty_since = -1;
+    self->sites = NULL;
+    memset(self->used, 0, sizeof(self->used));
+    memset(self->marks, 0, sizeof(self->marks));
+    // in reverse order, so that blocks are allocated in address order
+    int units_per_block = block_size / 32;
     for(int i = 0; i < block_count; i++) {
-        self->unused[i] = i;
+        self->unused[i] = (uint16_t)((block_count - 1 - i) * units_per_block);
     }
-    memset(self->data, 0, kPoolArenaSize);
     return self;
 }
 
+#define PoolArena__block(self, unit) ((PyObject*)((self)->data + (unit) * 32))
+#define PoolArena__test(bitmap, unit) (((bitmap)[(unit) >> 6] >> ((unit) & 63)) & 1)
+
 static void PoolArena__delete(PoolArena* self) {
-    for(int i = 0; i < self->block_count; i++) {
-        PyObject* obj = (PyObject*)(self->data + i * self->block_size);
-        if(obj->type != 0) PyObject__dtor(obj);
+    for(int w = 0; w < kPoolArenaBitmapWords; w++) {
+        uint64_t bits = self->used[w];
+        while(bits) {
+            int unit = w * 64 + c11__ctz64(bits);
+            bits &= bits - 1;
+            PyObject__dtor(PoolArena__block(self, unit));
+        }
     }
-    PK_FREE(self);
+    if(self->sites) PK_FREE(self->sites);
+    PK_ALIGNED_FREE(self);
 }
 
 static void* PoolArena__alloc(PoolArena* self) {
     assert(self->unused_length > 0);
-    int index = self->unused[self->unused_length - 1];
+    int unit = self->unused[self->unused_length - 1];
     self->unused_length--;
-    return self->data + index * self->block_size;
+    self->used[unit >> 6] |= (uint64_t)1 << (unit & 63);
+    return PoolArena__block(self, unit);
+}
+
+static void PoolArena__dealloc(PoolArena* self, void* p) {
+    int unit = PoolArena__unit(self, p);
+    assert(PoolArena__test(self->used, unit));
+    PyObject__dtor(p);
+    self->used[unit >> 6] &= ~((uint64_t)1 << (unit & 63));
+    self->unused[self->unused_length] = (uint16_t)unit;
+    self->unused_length++;
 }
 
-static int PoolArena__sweep_dealloc(PoolArena* self, int* out_types) {
+int PoolArena__sweep_dealloc(PoolArena* self, int* out_types) {
+    // only the garbage is visited, so living objects are not touched
     int freed = 0;
-    self->unused_length = 0;
-    for(int i = 0; i < self->block_count; i++) {
-        PyObject* obj = (PyObject*)(self->data + i * self->block_size);
-        if(obj->type == 0) {
-            // free slot
-            self->unused[self->unused_length] = i;
+    for(int w = 0; w < kPoolArenaBitmapWords; w++) {
+        uint64_t garbage = self->used[w] & ~self->marks[w];
+        if(garbage == 0) continue;
+        self->used[w] &= ~garbage;
+        while(garbage) {
+            int unit = w * 64 + c11__ctz64(garbage);
+            garbage &= garbage - 1;
+            PyObject* obj = PoolArena__block(self, unit);
+            if(out_types) out_types[obj->type]++;
+            PyObject__dtor(obj);
+            self->unused[self->unused_length] = (uint16_t)unit;
             self->unused_length++;
-        } else {
-            if(!obj->gc_marked) {
-                // not marked, need to free
-                if(out_types) out_types[obj->type]++;
-                PyObject__dtor(obj);
-                obj->type = 0;
-                freed++;
-                self->unused[self->unused_length] = i;
-                self->unused_length++;
-            } else {
-                // marked, clear mark
-                obj->gc_marked = false;
-            }
+            freed++;
         }
     }
     return freed;
@@ -66,18 +85,40 @@ static int PoolArena__sweep_dealloc(PoolArena* self, int* out_types) {
 static void Pool__ctor(Pool* self, int block_size) {
     c11_vector__ctor(&self->arenas, sizeof(PoolArena*));
     c11_vector__ctor(&self->no_free_arenas, sizeof(PoolArena*));
+    c11_vector__ctor(&self->unswept_arenas, sizeof(PoolArena*));
     self->block_size = block_size;
 }
 
 static void Pool__dtor(Pool* self) {
     c11__foreach(PoolArena*, &self->arenas, arena) PoolArena__delete(*arena);
     c11__foreach(PoolArena*, &self->no_free_arenas, arena) PoolArena__delete(*arena);
+    c11__foreach(PoolArena*, &self->unswept_arenas, arena) PoolArena__delete(*arena);
     c11_vector__dtor(&self->arenas);
     c11_vector__dtor(&self->no_free_arenas);
+    c11_vector__dtor(&self->unswept_arenas);
 }
 
-static void* Pool__alloc(Pool* self) {
+static void Pool__lazy_sweep_one(Pool* self, MultiPool* mp) {
+    PoolArena* arena = c11_vector__back(PoolArena*, &self->unswept_arenas);
+    c11_vector__pop(&self->unswept_arenas);
+    int freed = PoolArena__sweep_dealloc(arena, mp->sweep_out_types);
+    mp->sweep_freed += freed;
+    mp->used_bytes -= (int64_t)freed * self->block_size;
+    if(arena->unused_length > 0) {
+        c11_vector__push(PoolArena*, &self->arenas, arena);
+    } else {
+        c11_vector__push(PoolArena*, &self->no_free_arenas, arena);
+    }
+}
+
+static void* Pool__alloc(Pool* self, MultiPool* mp, PoolArena** out_arena) {
     PoolArena* arena;
+    // sweep a few arenas of the last collection before creating a new one,
+    // arenas full of survivors are left to `MultiPool__lazy_sweep_one`
+    for(int i = 0; i < kPoolLazySweepLimit; i++) {
+        if(self->arenas.length > 0 || self->unswept_arenas.length == 0) break;
+        Pool__lazy_sweep_one(self, mp);
+    }
     if(self->arenas.length == 0) {
         arena = PoolArena__new(self->block_size);
         c11_vector__push(PoolArena*, &self->arenas, arena);
@@ -85,6 +126,8 @@ static void* Pool__alloc(Pool* self) {
         arena = c11_vector__back(PoolArena*, &self->arenas);
     }
     void* ptr = PoolArena__alloc(arena);
+    mp->used_bytes += self->block_size;
+    if(out_arena) *out_arena = arena;
     if(arena->unused_length == 0) {
         c11_vector__pop(&self->arenas);
         c11_vector__push(PoolArena*, &self->no_free_arenas, arena);
@@ -96,6 +139,7 @@ static int Pool__sweep_dealloc(Pool* self,
                                c11_vector* arenas,
                                c11_vector* no_free_arenas,
                                int* out_types) {
+    assert(self->unswept_arenas.length == 0);
     c11_vector__clear(arenas);
     c11_vector__clear(no_free_arenas);
 
@@ -104,19 +148,7 @@ static int Pool__sweep_dealloc(Pool* self,
         PoolArena* item = c11__getitem(PoolArena*, &self->arenas, i);
         assert(item->unused_length > 0);
         freed += PoolArena__sweep_dealloc(item, out_types);
-        if(item->unused_length == item->block_count) {
-            // all free
-            if(arenas->length > 0) {
-                // at least one arena
-                PoolArena__delete(item);
-            } else {
-                // no arena
-                c11_vector__push(PoolArena*, arenas, item);
-            }
-        } else {
-            // some free
-            c11_vector__push(PoolArena*, arenas, item);
-        }
+        c11_vector__push(PoolArena*, arenas, item);
     }
     for(int i = 0; i < self->no_free_arenas.length; i++) {
         PoolArena* item = c11__getitem(PoolArena*, &self->no_free_arenas, i);
@@ -125,13 +157,8 @@ static int Pool__sweep_dealloc(Pool* self,
             // still no free
             c11_vector__push(PoolArena*, no_free_arenas, item);
         } else {
-            if(item->unused_length == item->block_count) {
-                // all free
-                PoolArena__delete(item);
-            } else {
-                // some free
-                c11_vector__push(PoolArena*, arenas, item);
-            }
+            // some free, empty arenas are released by `MultiPool__reclaim_arenas`
+            c11_vector__push(PoolArena*, arenas, item);
         }
     }
 
@@ -140,16 +167,103 @@ static int Pool__sweep_dealloc(Pool* self,
     return freed;
 }
 
-void* MultiPool__alloc(MultiPool* self, int size) {
+void* MultiPool__alloc(MultiPool* self, int size, PoolArena** out_arena) {
     assert(size > 0);
     int index = (size - 1) >> 5;
     if(index < kMultiPoolCount) {
         Pool* pool = &self->pools[index];
-        return Pool__alloc(pool);
+        return Pool__alloc(pool, self, out_arena);
     }
     return NULL;
 }
 
+void MultiPool__dealloc(MultiPool* self, PoolArena* arena, void* p) {
+    PoolArena__dealloc(arena, p);
+    self->used_bytes -= arena->block_size;
+}
+
+void MultiPool__clear_marks(MultiPool* self) {
+    for(int i = 0; i < kMultiPoolCount; i++) {
+        Pool* pool = &self->pools[i];
+        assert(pool->unswept_arenas.length == 0);
+        c11__foreach(PoolArena*, &pool->arenas, arena) {
+            memset((*arena)->marks, 0, sizeof((*arena)->marks));
+        }
+        c11__foreach(PoolArena*, &pool->no_free_arenas, arena) {
+            memset((*arena)->marks, 0, sizeof((*arena)->marks));
+        }
+    }
+}
+
+void MultiPool__reclaim_arenas(MultiPool* self, int grace) {
+    self->epoch++;
+    for(int i = 0; i < kMultiPoolCount; i++) {
+        Pool* pool = &self->pools[i];
+        assert(pool->unswept_arenas.length == 0);
+        // move arenas that got free blocks from `MultiPool__dealloc` back to `arenas`
+        int j = 0;
+        for(int k = 0; k < pool->no_free_arenas.length; k++) {
+            PoolArena* arena = c11__getitem(PoolArena*, &pool->no_free_arenas, k);
+            if(arena->unused_length > 0) {
+                c11_vector__push(PoolArena*, &pool->arenas, arena);
+            } else {
+                c11__setitem(PoolArena*, &pool->no_free_arenas, j, arena);
+                j++;
+            }
+        }
+        pool->no_free_arenas.length = j;
+        // release arenas that have been empty for `grace` calls
+        j = 0;
+        for(int k = 0; k < pool->arenas.length; k++) {
+            PoolArena* arena = c11__getitem(PoolArena*, &pool->arenas, k);
+            if(arena->unused_length < arena->block_count) {
+                arena->empty_since = -1;
+            } else {
+                if(arena->empty_since < 0) arena->empty_since = self->epoch;
+                if(self->epoch - arena->empty_since >= grace) {
+                    PoolArena__delete(arena);
+                    self->released_arenas++;
+                    continue;
+                }
+            }
+            c11__setitem(PoolArena*, &pool->arenas, j, arena);
+            j++;
+        }
+        pool->arenas.length = j;
+    }
+}
+
+void MultiPool__begin_lazy_sweep(MultiPool* self, int* out_types) {
+    // every arena is swept later, by `MultiPool__lazy_sweep_one` or when it is needed for allocation
+    self->sweep_out_types = out_types;
+    self->sweep_freed = 0;
+    for(int i = 0; i < kMultiPoolCount; i++) {
+        Pool* pool = &self->pools[i];
+        assert(pool->unswept_arenas.length == 0);
+        c11_vector__swap(&pool->unswept_arenas, &pool->no_free_arenas);
+        // `arenas.data` may be NULL, which `memcpy` does not accept even for 0 bytes
+        if(pool->arenas.length > 0) {
+            c11_vector__extend(PoolArena*,
+                               &pool->unswept_arenas,
+                               pool->arenas.data,
+                               pool->arenas.length);
+            c11_vector__clear(&pool->arenas);
+        }
+    }
+}
+
+bool MultiPool__lazy_sweep_one(MultiPool* self) {
+    for(int i = 0; i < kMultiPoolCount; i++) {
+        Pool* pool = &self->pools[i];
+        if(pool->unswept_arenas.length > 0) {
+            Pool__lazy_sweep_one(pool, self);
+            return true;
+        }
+    }
+    self->sweep_out_types = NULL;
+    return false;
+}
+
 int MultiPool__sweep_dealloc(MultiPool* self, int* out_types) {
     c11_vector arenas;
     c11_vector no_free_arenas;
@@ -158,7 +272,9 @@ int MultiPool__sweep_dealloc(MultiPool* self, int* out_types) {
     int freed = 0;
     for(int i = 0; i < kMultiPoolCount; i++) {
         Pool* item = &self->pools[i];
-        freed += Pool__sweep_dealloc(item, &arenas, &no_free_arenas, out_types);
+        int pool_freed = Pool__sweep_dealloc(item, &arenas, &no_free_arenas, out_types);
+        self->used_bytes -= (int64_t)pool_freed * item->block_size;
+        freed += pool_freed;
     }
     c11_vector__dtor(&arenas);
     c11_vector__dtor(&no_free_arenas);
@@ -169,6 +285,11 @@ void MultiPool__ctor(MultiPool* self) {
     for(int i = 0; i < kMultiPoolCount; i++) {
         Pool__ctor(&self->pools[i], 32 * (i + 1));
     }
+    self->epoch = 0;
+    self->released_arenas = 0;
+    self->used_bytes = 0;
+    self->sweep_out_types = NULL;
+    self->sweep_freed = 0;
 }
 
 void MultiPool__dtor(MultiPool* self) {
@@ -177,31 +298,68 @@ void MultiPool__dtor(MultiPool* self) {
     }
 }
 
+static void PoolArena__clear_sites(c11_vector* arenas) {
+    c11__foreach(PoolArena*, arenas, arena) {
+        if((*arena)->sites) PK_FREE((*arena)->sites);
+        (*arena)->sites = NULL;
+    }
+}
+
+void MultiPool__clear_sites(MultiPool* self) {
+    for(int i = 0; i < kMultiPoolCount; i++) {
+        Pool* pool = &self->pools[i];
+        PoolArena__clear_sites(&pool->arenas);
+        PoolArena__clear_sites(&pool->no_free_arenas);
+        PoolArena__clear_sites(&pool->unswept_arenas);
+    }
+}
+
 c11_string* MultiPool__summary(MultiPool* self) {
     c11_sbuf sbuf;
     c11_sbuf__ctor(&sbuf);
+    int reserved_bytes = 0;
     for(int i = 0; i < kMultiPoolCount; i++) {
         Pool* item = &self->pools[i];
-        int total_bytes = (item->arenas.length + item->no_free_arenas.length) * kPoolArenaSize;
+        int arena_count =
+            item->arenas.length + item->no_free_arenas.length + item->unswept_arenas.length;
+        int total_bytes = arena_count * kPoolArenaSize;
         int used_bytes = 0;
+        int empty_count = 0;
         for(int j = 0; j < item->arenas.length; j++) {
             PoolArena* arena = c11__getitem(PoolArena*, &item->arenas, j);
             used_bytes += (arena->block_count - arena->unused_length) * arena->block_size;
+            if(arena->unused_length == arena->block_count) empty_count++;
+        }
+        // unswept arenas still count their garbage
+        for(int j = 0; j < item->unswept_arenas.length; j++) {
+            PoolArena* arena = c11__getitem(PoolArena*, &item->unswept_arenas, j);
+            used_bytes += (arena->block_count - arena->unused_length) * arena->block_size;
         }
         used_bytes += item->no_free_arenas.length * kPoolArenaSize;
-        float used_pct = (float)used_bytes / total_bytes * 100;
+        float used_pct = total_bytes > 0 ? (float)used_bytes / total_bytes * 100 : 0.0f;
+        reserved_bytes += total_bytes;
         char buf[256];
         snprintf(buf,
                  sizeof(buf),
-                 "Pool<%d>: len(arenas)=%d, len(no_free_arenas)=%d, %d/%d (%.1f%% used)",
+                 "Pool<%d>: len(arenas)=%d, len(no_free_arenas)=%d, len(unswept_arenas)=%d, "
+                 "empty=%d, %d/%d (%.1f%% used)",
                  item->block_size,
                  item->arenas.length,
                  item->no_free_arenas.length,
+                 item->unswept_arenas.length,
+                 empty_count,
                  used_bytes,
                  total_bytes,
                  used_pct);
         c11_sbuf__write_cstr(&sbuf, buf);
         c11_sbuf__write_char(&sbuf, '\n');
     }
+    char buf[256];
+    snprintf(buf,
+             sizeof(buf),
+             "reserved_bytes=%d, released_arenas=%d\n",
+             reserved_bytes,
+             self->released_arenas);
+    c11_sbuf__write_cstr(&sbuf, buf);
     return c11_sbuf__submit(&sbuf);
 }
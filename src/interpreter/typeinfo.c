@@ -11,6 +11,31 @@ py_ItemRef pk_tpfindname(py_TypeInfo* ti, py_Name name) {
     return NULL;
 }
 
+uint32_t pk_tpversion(py_TypeInfo* ti) {
+    if(ti->version == 0) {
+        // a valid version tag implies all bases have valid version tags
+        if(ti->base_ti) pk_tpversion(ti->base_ti);
+        ti->version = ++pk_current_vm->next_type_version;
+    }
+    return ti->version;
+}
+
+void pk_tpmodified(py_TypeInfo* ti) {
+    // if `ti` has no version tag, none of its subclasses have one either
+    if(ti->version == 0) return;
+    ti->version = 0;
+    c11__foreach(TypePointer, &pk_current_vm->types, p) {
+        py_TypeInfo* sub = p->ti;
+        if(sub == NULL || sub->version == 0) continue;
+        for(py_TypeInfo* base = sub->base_ti; base; base = base->base_ti) {
+            if(base == ti) {
+                sub->version = 0;
+                break;
+            }
+        }
+    }
+}
+
 PK_INLINE py_TypeInfo* pk_typeinfo(py_Type type) {
 #ifndef NDEBUG
     int length = pk_current_vm->types.length;
@@ -39,6 +64,7 @@ static void py_TypeInfo__common_init(py_Name name,
     self->index = index;
     self->base = base;
     self->base_ti = base_ti;
+    self->native_base = index;
 
     py_assign(&self->self, typeobject);
     self->module = module ? module : py_NIL();
@@ -46,6 +72,9 @@ static void py_TypeInfo__common_init(py_Name name,
     if(!dtor && base) dtor = base_ti->dtor;
     self->is_python = is_python;
     self->is_final = is_final;
+    self->version = 0;
+    self->inline_attrs = base_ti ? base_ti->inline_attrs : 0;
+    self->inst_slots = -1;
 
     self->getattribute = NULL;
     self->setattribute = NULL;
@@ -53,6 +82,7 @@ static void py_TypeInfo__common_init(py_Name name,
     self->getunboundmethod = NULL;
 
     self->annotations = *py_NIL();
+    self->slot_names = *py_NIL();
     self->dtor = dtor;
     self->on_end_subclass = NULL;
 }
@@ -109,10 +139,14 @@ py_Type pk_newtypewithmode(py_Name name,
             TypePointer* pointer = c11__at(TypePointer, &pk_current_vm->types, index);
             pointer->ti = self;
             pointer->dtor = self->dtor;
+            self->native_base = self->base_ti->native_base;
             return index;
         }
     }
 
-    return pk_newtype(py_name2str(name), base, module, dtor, is_python, is_final);
+    py_Type index = pk_newtype(py_name2str(name), base, module, dtor, is_python, is_final);
+    py_TypeInfo* self = pk_typeinfo(index);
+    self->native_base = self->base_ti->native_base;
+    return index;
 }
 
@@ -6,6 +6,7 @@
 #include "pocketpy/interpreter/typeinfo.h"
 #include "pocketpy/objects/base.h"
 #include "pocketpy/interpreter/types.h"
+#include "pocketpy/interpreter/array2d.h"
 #include "pocketpy/common/_generated.h"
 #include "pocketpy/objects/exception.h"
 #include "pocketpy/pocketpy.h"
@@ -97,17 +98,21 @@ void VM__ctor(VM* self) {
 
     self->recursion_depth = 0;
     self->max_recursion_depth = 1000;
+    self->compile_cache = false;
 
     self->ctx = NULL;
     self->curr_class = NULL;
     self->curr_decl_based_function = NULL;
     memset(&self->trace_info, 0, sizeof(TraceInfo));
     memset(&self->watchdog_info, 0, sizeof(WatchdogInfo));
+    memset(&self->ic_stats, 0, sizeof(InlineCacheStats));
+    self->next_type_version = 0;
     LineProfiler__ctor(&self->line_profiler);
 
     FixedMemoryPool__ctor(&self->pool_frame, sizeof(py_Frame), 32);
 
     ManagedHeap__ctor(&self->heap);
+    ShapeTree__ctor(&self->shapes);
     self->stack.sp = self->stack.begin;
     self->stack.end = self->stack.begin + PK_VM_STACK_SIZE;
 
@@ -159,8 +164,11 @@ void VM__ctor(VM* self) {
 
     validate(tp_dict, pk_dict__register());
     validate(tp_dict_iterator, pk_dict_items__register());
+    validate(tp_set, pk_set__register());
+    validate(tp_frozenset, pk_frozenset__register());
 
     validate(tp_property, pk_property__register());
+    validate(tp_member_descriptor, pk_member_descriptor__register());
     validate(tp_star_wrapper, pk_newtype("star_wrapper", tp_object, NULL, NULL, false, true));
 
     validate(tp_staticmethod, pk_staticmethod__register());
@@ -171,6 +179,10 @@ void VM__ctor(VM* self) {
              pk_newtype("NotImplementedType", tp_object, NULL, NULL, false, true));
     validate(tp_ellipsis, pk_newtype("ellipsis", tp_object, NULL, NULL, false, true));
     validate(tp_generator, pk_generator__register());
+    validate(tp_enumerate, pk_enumerate__register());
+    validate(tp_zip, pk_zip__register());
+    validate(tp_map, pk_map__register());
+    validate(tp_filter, pk_filter__register());
 
     self->builtins = pk_builtins__register();
 
@@ -204,6 +216,7 @@ void VM__ctor(VM* self) {
     INJECT_BUILTIN_EXC(ImportError, tp_Exception);
     INJECT_BUILTIN_EXC(AssertionError, tp_Exception);
     INJECT_BUILTIN_EXC(KeyError, tp_Exception);
+    INJECT_BUILTIN_EXC(MemoryError, tp_Exception);
 
 #undef INJECT_BUILTIN_EXC
 #undef validate
@@ -222,6 +235,12 @@ void VM__ctor(VM* self) {
         tp_range,
         tp_bytes,
         tp_dict,
+        tp_set,
+        tp_frozenset,
+        tp_enumerate,
+        tp_zip,
+        tp_map,
+        tp_filter,
         tp_property,
         tp_staticmethod,
         tp_classmethod,
@@ -239,6 +258,8 @@ void VM__ctor(VM* self) {
 
     pk__add_module_vmath();
     pk__add_module_array2d();
+    pk__add_module_collections();
+    pk__add_module_array();
     pk__add_module_colorcvt();
 
     // add modules
@@ -250,6 +271,7 @@ void VM__ctor(VM* self) {
     pk__add_module_random();
     pk__add_module_json();
     pk__add_module_gc();
+    pk__add_module_tracemalloc();
     pk__add_module_time();
     pk__add_module_easing();
     pk__add_module_traceback();
@@ -270,7 +292,7 @@ void VM__ctor(VM* self) {
     // add python builtins
     do {
         bool ok;
-        ok = py_exec(kPythonLibs_builtins, "<builtins>", EXEC_MODE, self->builtins);
+        ok = pk_exec_pythonlib("builtins", kPythonLibs_builtins, "<builtins>", self->builtins);
         if(!ok) goto __ABORT;
         break;
     __ABORT:
@@ -297,6 +319,7 @@ void VM__dtor(VM* self) {
     LineProfiler__dtor(&self->line_profiler);
     // destroy all objects
     ManagedHeap__dtor(&self->heap);
+    ShapeTree__dtor(&self->shapes);
     // clear frames
     while(self->top_frame) {
         VM__pop_frame(self);
@@ -644,15 +667,44 @@ static void pk__mark_value_func(py_Ref val, void* ctx) {
     pk__mark_value(val);
 }
 
-void ManagedHeap__mark(ManagedHeap* self) {
+void ManagedHeap__mark_roots(ManagedHeap* self) {
     VM* vm = pk_current_vm;
     c11_vector* p_stack = &self->gc_roots;
-    assert(p_stack->length == 0);
+
+    // in generational mode, objects on the value stack or in the registers stay in the remembered
+    // set until the next gc, because native code may still be writing to them after any kind of
+    // collection has made them old. a minor gc and the final mark of an incremental gc also scan
+    // them again, since they may have been written without a barrier
+#define pk__remember_root(val)                                                                     \
+    if((val)->is_ptr && (val)->_obj->gc_gen != PK_GC_REMEMBERED) {                                 \
+        PyObject* obj = (val)->_obj;                                                               \
+        if(obj->gc_gen == PK_GC_OLD && (self->gc_minor || self->gc_state == PK_GC_MARKING)) {      \
+            c11_vector__push(PyObject*, p_stack, obj);                                             \
+        }                                                                                          \
+        if(self->gc_generational) {                                                                \
+            obj->gc_gen = PK_GC_REMEMBERED;                                                        \
+            c11_vector__push(PyObject*, &self->remembered, obj);                                   \
+        }                                                                                          \
+    }
+
+    if(self->gc_minor || self->gc_state == PK_GC_MARKING) {
+        // old objects that were written since last gc (or since they were scanned)
+        for(int i = 0; i < self->remembered.length; i++) {
+            PyObject* obj = c11__getitem(PyObject*, &self->remembered, i);
+            assert(obj->gc_gen == PK_GC_REMEMBERED);
+            obj->gc_gen = PK_GC_OLD;
+            // old objects may not be reached yet by an incremental gc, they are scanned anyway
+            PyObject__mark(obj);
+            c11_vector__push(PyObject*, p_stack, obj);
+        }
+        c11_vector__clear(&self->remembered);
+    }
 
     // mark value stack
     for(py_TValue* p = vm->stack.begin; p < vm->stack.sp; p++) {
         // assert(p->type != tp_nil);
         pk__mark_value(p);
+        pk__remember_root(p);
     }
     // mark modules
     BinTree__apply_mark(&vm->modules, p_stack);
@@ -674,6 +726,7 @@ void ManagedHeap__mark(ManagedHeap* self) {
         py_TypeInfo* ti = c11__getitem(TypePointer, &vm->types, i).ti;
         pk__mark_value(&ti->self);
         pk__mark_value(&ti->annotations);
+        pk__mark_value(&ti->slot_names);
     }
     // mark frame
     for(py_Frame* frame = vm->top_frame; frame; frame = frame->f_back) {
@@ -681,57 +734,147 @@ void ManagedHeap__mark(ManagedHeap* self) {
     }
     // mark vm's registers
     pk__mark_value(&vm->last_retval);
+    pk__remember_root(&vm->last_retval);
     pk__mark_value(&vm->unhandled_exc);
     for(int i = 0; i < c11__count_array(vm->reg); i++) {
         pk__mark_value(&vm->reg[i]);
+        pk__remember_root(&vm->reg[i]);
     }
+#undef pk__remember_root
     // mark gc debug callback
     pk__mark_value(&vm->heap.debug_callback);
     // mark user func
     if(vm->callbacks.gc_mark) vm->callbacks.gc_mark(pk__mark_value_func, p_stack);
-    /*****************************/
+}
+
+void ManagedHeap__mark(ManagedHeap* self) {
+    assert(self->gc_roots.length == 0);
+    ManagedHeap__mark_roots(self);
+    ManagedHeap__propagate(self, -1);
+}
+
+void ManagedHeap__remember_roots(ManagedHeap* self) {
+    VM* vm = pk_current_vm;
+#define pk__remember_root(val)                                                                     \
+    if((val)->is_ptr && (val)->_obj->gc_gen == PK_GC_OLD) PyObject__remember((val)->_obj);
+    for(py_TValue* p = vm->stack.begin; p < vm->stack.sp; p++) {
+        pk__remember_root(p);
+    }
+    pk__remember_root(&vm->last_retval);
+    for(int i = 0; i < c11__count_array(vm->reg); i++) {
+        pk__remember_root(&vm->reg[i]);
+    }
+#undef pk__remember_root
+}
+
+int64_t PyObject__external_bytes(PyObject* self) {
+    int64_t bytes = 0;
+    py_Type type = self->type;
+    if(self->slots < 0) {
+        bytes = PyObject__dict_external_bytes(self);
+        if(self->slots == -1) return bytes;
+        type = pk_typeinfo(type)->native_base;
+    }
+    switch(type) {
+        case tp_list: return bytes + List__external_bytes(PyObject__userdata(self));
+        case tp_dict:
+        case tp_set:
+        case tp_frozenset:
+        case tp_defaultdict:
+        case tp_Counter: return bytes + Dict__external_bytes(PyObject__userdata(self));
+        case tp_deque: return bytes + Deque__external_bytes(PyObject__userdata(self));
+        case tp_array: return bytes + Array__external_bytes(PyObject__userdata(self));
+        case tp_array2d: return bytes + c11_array2d__external_bytes(PyObject__userdata(self));
+        default: return bytes;
+    }
+}
+
+bool ManagedHeap__propagate(ManagedHeap* self, int max_count) {
+    ManagedHeap* heap = self;  // `self` is shadowed below
+    bool gc_minor = self->gc_minor;
+    c11_vector* p_stack = &self->gc_roots;
+    // scan at most `max_count` objects (no limit if negative), return true if all marked
     while(p_stack->length > 0) {
+        if(max_count-- == 0) return false;
         PyObject* obj = c11_vector__back(PyObject*, p_stack);
         c11_vector__pop(p_stack);
 
-        assert(obj->gc_marked);
+        assert(PyObject__is_marked(obj));
+        // scanned objects are old (black), arm their write barrier
+        if(obj->gc_gen == PK_GC_YOUNG) obj->gc_gen = PK_GC_OLD;
 
         if(obj->slots > 0) {
             py_TValue* p = PyObject__slots(obj);
             for(int i = 0; i < obj->slots; i++)
                 pk__mark_value(p + i);
-        } else if(obj->slots == -1) {
-            NameDict* dict = PyObject__dict(obj);
-            for(int i = 0; i < dict->capacity; i++) {
-                NameDict_KV* kv = &dict->items[i];
-                if(kv->key == NULL) continue;
-                pk__mark_value(&kv->value);
+        } else if(obj->slots < 0) {
+            if(!gc_minor) heap->gc_marked_external += PyObject__dict_external_bytes(obj);
+            InstanceDict* d = obj->slots == -1 ? NULL : PyObject__instdict(obj);
+            if(d && d->shape) {
+                int length = d->shape->length;
+                int n = c11__min(PK_OBJ_INLINE_ATTRS(obj->slots), length);
+                for(int i = 0; i < n; i++)
+                    pk__mark_value(d->values + i);
+                for(int i = 0; i < length - n; i++)
+                    pk__mark_value(d->extra + i);
+            } else {
+                NameDict* dict = d ? d->dict : PyObject__dict(obj);
+                for(int i = 0; i < dict->capacity; i++) {
+                    NameDict_KV* kv = &dict->items[i];
+                    if(kv->key == NULL) continue;
+                    pk__mark_value(&kv->value);
+                }
             }
         }
 
         void* ud = PyObject__userdata(obj);
-        switch(obj->type) {
+        // python subclasses of builtin types have the userdata of their builtin base
+        py_Type type = obj->slots < -1 ? pk_typeinfo(obj->type)->native_base : obj->type;
+        switch(type) {
             case tp_list: {
                 List* self = ud;
+                if(!gc_minor) heap->gc_marked_external += List__external_bytes(self);
                 for(int i = 0; i < self->length; i++) {
                     py_TValue* val = c11__at(py_TValue, self, i);
                     pk__mark_value(val);
                 }
                 break;
             }
-            case tp_dict: {
+            case tp_dict:
+            case tp_set:
+            case tp_frozenset:
+            case tp_defaultdict:
+            case tp_Counter: {
                 Dict* self = ud;
+                if(type == tp_defaultdict) pk__mark_value(&((DefaultDict*)ud)->default_factory);
+                if(!gc_minor) heap->gc_marked_external += Dict__external_bytes(self);
+                bool has_values = Dict__has_values(self);
                 for(int i = 0; i < self->entries.length; i++) {
-                    DictEntry* entry = c11__at(DictEntry, &self->entries, i);
+                    DictEntry* entry = Dict__entry(self, i);
                     if(py_isnil(&entry->key)) continue;
                     pk__mark_value(&entry->key);
-                    pk__mark_value(&entry->val);
+                    if(has_values) pk__mark_value(&entry->val);
                 }
                 break;
             }
+            case tp_deque: {
+                Deque* self = ud;
+                if(!gc_minor) heap->gc_marked_external += Deque__external_bytes(self);
+                for(int i = 0; i < self->length; i++) {
+                    pk__mark_value(&self->data[(self->head + i) & (self->capacity - 1)]);
+                }
+                break;
+            }
+            case tp_array: {
+                Array* self = ud;
+                if(!gc_minor) heap->gc_marked_external += Array__external_bytes(self);
+                pk__mark_value(&self->base);
+                break;
+            }
             case tp_generator: {
                 Generator* self = ud;
                 if(self->frame) Frame__gc_mark(self->frame, p_stack);
+                c11__foreach(py_TValue, &self->stack, p) { pk__mark_value(p); }
                 break;
             }
             case tp_function: {
@@ -753,10 +896,15 @@ void ManagedHeap__mark(ManagedHeap* self) {
                 CodeObject__gc_mark(self, p_stack);
                 break;
             }
+            case tp_array2d: {
+                if(!gc_minor) heap->gc_marked_external += c11_array2d__external_bytes(ud);
+                break;
+            }
             case tp_chunked_array2d: {
                 c11_chunked_array2d__mark(ud, p_stack);
                 break;
             }
         }
     }
+    return true;
 }
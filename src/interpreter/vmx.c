@@ -127,6 +127,13 @@ void PyObject__dtor(PyObject* self) {
     if(self->slots == -1) {
         NameDict* dict = PyObject__dict(self);
         NameDict__dtor(dict);
+    } else if(self->slots < -1) {
+        InstanceDict* d = PyObject__instdict(self);
+        if(d->shape == NULL) {
+            NameDict__delete(d->dict);
+        } else {
+            PK_FREE(d->extra);
+        }
     }
 }
 
@@ -0,0 +1,1244 @@
+#include "pocketpy/pocketpy.h"
+
+#include "pocketpy/common/utils.h"
+#include "pocketpy/common/sstream.h"
+#include "pocketpy/objects/object.h"
+#include "pocketpy/interpreter/types.h"
+#include "pocketpy/interpreter/array2d.h"
+#include "pocketpy/interpreter/vm.h"
+
+#include <string.h>
+
+/* array */
+
+#define ARRAY_TYPECODES "bhiqfd"
+
+// storage of one item, aligned for any typecode
+typedef union {
+    int64_t q;
+    double d;
+    char bytes[8];
+} ArrayItem;
+
+static int Array__itemsize(char typecode) {
+    switch(typecode) {
+        case 'b': return 1;
+        case 'h': return 2;
+        case 'i': return 4;
+        case 'q': return 8;
+        case 'f': return 4;
+        case 'd': return 8;
+        default: return 0;
+    }
+}
+
+// index of `typecode` in `ARRAY_TYPECODES`
+static int Array__kind(char typecode) {
+    return strchr(ARRAY_TYPECODES, typecode) - ARRAY_TYPECODES;
+}
+
+static bool Array__isfloat(char typecode) { return typecode == 'f' || typecode == 'd'; }
+
+static void Array__ctor(Array* self, char typecode, int capacity) {
+    if(capacity < 4) capacity = 4;
+    self->typecode = typecode;
+    self->itemsize = Array__itemsize(typecode);
+    self->data = PK_MALLOC((size_t)capacity * self->itemsize);
+    self->length = 0;
+    self->capacity = capacity;
+    self->offset = 0;
+    py_newnil(&self->base);
+    ManagedHeap__account(&pk_current_vm->heap, Array__external_bytes(self));
+}
+
+static void Array__dtor(Array* self) { PK_FREE(self->data); }
+
+// NULL with `MemoryError` if the buffer would exceed the memory limit
+static Array* Array__new(py_OutRef out, char typecode, int length) {
+    int64_t bytes = (int64_t)length * Array__itemsize(typecode);
+    if(!ManagedHeap__reserve(&pk_current_vm->heap, bytes)) return NULL;
+    Array* self = py_newobject(out, tp_array, 0, sizeof(Array));
+    Array__ctor(self, typecode, length);
+    self->length = length;
+    return self;
+}
+
+// the first element, or NULL with an exception if a view outlived the range of its base
+static char* Array__data(Array* self) {
+    if(py_isnil(&self->base)) return self->data;
+    Array* base = py_touserdata(&self->base);
+    if(self->offset + self->length > base->length) {
+        ValueError("array view is out of the range of its base");
+        return NULL;
+    }
+    return base->data + (size_t)self->offset * self->itemsize;
+}
+
+static bool Array__reserve(Array* self, int capacity) {
+    if(!py_isnil(&self->base)) return TypeError("cannot resize an array view");
+    if(capacity <= self->capacity) return true;
+    int new_capacity = c11__max(capacity, self->capacity * 2);
+    int64_t bytes = (int64_t)(new_capacity - self->capacity) * self->itemsize;
+    if(!ManagedHeap__reserve(&pk_current_vm->heap, bytes)) return false;
+    self->data = PK_REALLOC(self->data, (size_t)new_capacity * self->itemsize);
+    ManagedHeap__account(&pk_current_vm->heap, bytes);
+    self->capacity = new_capacity;
+    return true;
+}
+
+static void Array__read(char typecode, const char* p, py_OutRef out) {
+    switch(typecode) {
+        case 'b': py_newint(out, *(const int8_t*)p); break;
+        case 'h': py_newint(out, *(const int16_t*)p); break;
+        case 'i': py_newint(out, *(const int32_t*)p); break;
+        case 'q': py_newint(out, *(const int64_t*)p); break;
+        case 'f': py_newfloat(out, *(const float*)p); break;
+        case 'd': py_newfloat(out, *(const double*)p); break;
+        default: c11__unreachable();
+    }
+}
+
+// whether the integer `x` is representable with an integer `typecode`
+static bool Array__fits(char typecode, py_i64 x) {
+    switch(typecode) {
+        case 'b': return x >= INT8_MIN && x <= INT8_MAX;
+        case 'h': return x >= INT16_MIN && x <= INT16_MAX;
+        case 'i': return x >= INT32_MIN && x <= INT32_MAX;
+        case 'q': return true;
+        default: c11__unreachable();
+    }
+}
+
+static bool Array__write(char typecode, char* p, py_Ref val) {
+    if(Array__isfloat(typecode)) {
+        py_f64 x;
+        if(!py_castfloat(val, &x)) return false;
+        if(typecode == 'f') {
+            *(float*)p = (float)x;
+        } else {
+            *(double*)p = x;
+        }
+        return true;
+    }
+    if(!py_isint(val)) return TypeError("array item must be 'int', not '%t'", val->type);
+    py_i64 x = py_toint(val);
+    if(!Array__fits(typecode, x)) {
+        return ValueError("%i is out of range for typecode '%c'", x, typecode);
+    }
+    switch(typecode) {
+        case 'b': *(int8_t*)p = (int8_t)x; break;
+        case 'h': *(int16_t*)p = (int16_t)x; break;
+        case 'i': *(int32_t*)p = (int32_t)x; break;
+        case 'q': *(int64_t*)p = x; break;
+        default: c11__unreachable();
+    }
+    return true;
+}
+
+// element `i` as an integer, both operands must have an integer typecode
+static int64_t Array__int_at(char typecode, const char* p, int i) {
+    switch(typecode) {
+        case 'b': return ((const int8_t*)p)[i];
+        case 'h': return ((const int16_t*)p)[i];
+        case 'i': return ((const int32_t*)p)[i];
+        case 'q': return ((const int64_t*)p)[i];
+        default: c11__unreachable();
+    }
+}
+
+static double Array__float_at(char typecode, const char* p, int i) {
+    switch(typecode) {
+        case 'f': return ((const float*)p)[i];
+        case 'd': return ((const double*)p)[i];
+        default: return (double)Array__int_at(typecode, p, i);
+    }
+}
+
+#define ARRAY_CONVERT(DT, ST)                                                                      \
+    do {                                                                                           \
+        DT* restrict o = out;                                                                      \
+        const ST* restrict s = in;                                                                 \
+        for(int i = 0; i < n; i++)                                                                 \
+            o[i] = (DT)s[i];                                                                       \
+    } while(0)
+
+#define ARRAY_CONVERT_FROM(ST)                                                                     \
+    switch(dst) {                                                                                  \
+        case 'b': ARRAY_CONVERT(int8_t, ST); break;                                                \
+        case 'h': ARRAY_CONVERT(int16_t, ST); break;                                               \
+        case 'i': ARRAY_CONVERT(int32_t, ST); break;                                               \
+        case 'q': ARRAY_CONVERT(int64_t, ST); break;                                               \
+        case 'f': ARRAY_CONVERT(float, ST); break;                                                 \
+        case 'd': ARRAY_CONVERT(double, ST); break;                                                \
+        default: c11__unreachable();                                                               \
+    }
+
+// widening conversion of `n` elements
+static void Array__convert(char dst, void* out, char src, const void* in, int n) {
+    switch(src) {
+        case 'b': ARRAY_CONVERT_FROM(int8_t); break;
+        case 'h': ARRAY_CONVERT_FROM(int16_t); break;
+        case 'i': ARRAY_CONVERT_FROM(int32_t); break;
+        case 'q': ARRAY_CONVERT_FROM(int64_t); break;
+        case 'f': ARRAY_CONVERT_FROM(float); break;
+        case 'd': ARRAY_CONVERT_FROM(double); break;
+        default: c11__unreachable();
+    }
+}
+
+#undef ARRAY_CONVERT_FROM
+#undef ARRAY_CONVERT
+
+// whether every value of `src` is representable in `dst`
+static bool Array__widens(char src, char dst) {
+    if(src == dst) return true;
+    if(Array__isfloat(src)) return dst == 'd';
+    if(Array__isfloat(dst)) return true;
+    return Array__itemsize(src) <= Array__itemsize(dst);
+}
+
+// typecode of the result of an element-wise operation, like numpy does
+static char Array__promote(char a, char b) {
+    bool fa = Array__isfloat(a), fb = Array__isfloat(b);
+    if(!fa && !fb) return Array__itemsize(a) >= Array__itemsize(b) ? a : b;
+    if(a == 'd' || b == 'd') return 'd';
+    char other = fa ? b : a;
+    if(other == 'f') return 'f';
+    // float32 holds int8 and int16 exactly
+    return Array__itemsize(other) <= 2 ? 'f' : 'd';
+}
+
+/* element-wise kernels, plain loops over packed buffers that compilers vectorize */
+
+typedef void (*ArrayKernel)(void* out, const void* a, const void* b, int n, bool scalar);
+
+enum {
+    ARRAY_ADD,
+    ARRAY_SUB,
+    ARRAY_MUL,
+    ARRAY_DIV,
+    ARRAY_LT,
+    ARRAY_LE,
+    ARRAY_GT,
+    ARRAY_GE,
+    ARRAY_EQ,
+    ARRAY_NE,
+    ARRAY_OP_COUNT,
+};
+
+#define DEF_ARRAY_KERNEL(S, T, name, OUT_T, expr)                                                  \
+    static void Array__##name##_##S(void* out_, const void* a_, const void* b_, int n, bool s) {   \
+        OUT_T* restrict out = out_;                                                                \
+        const T* restrict a = a_;                                                                  \
+        if(s) {                                                                                    \
+            const T y = *(const T*)b_;                                                             \
+            for(int i = 0; i < n; i++) {                                                           \
+                const T x = a[i];                                                                  \
+                out[i] = (expr);                                                                   \
+            }                                                                                      \
+        } else {                                                                                   \
+            const T* restrict b = b_;                                                              \
+            for(int i = 0; i < n; i++) {                                                           \
+                const T x = a[i];                                                                  \
+                const T y = b[i];                                                                  \
+                out[i] = (expr);                                                                   \
+            }                                                                                      \
+        }                                                                                          \
+    }
+
+// integers wrap around, `U` is wide enough to avoid signed overflow after promotion
+#define DEF_ARRAY_KERNELS(S, T, U)                                                                 \
+    DEF_ARRAY_KERNEL(S, T, add, T, (T)((U)x + (U)y))                                               \
+    DEF_ARRAY_KERNEL(S, T, sub, T, (T)((U)x - (U)y))                                               \
+    DEF_ARRAY_KERNEL(S, T, mul, T, (T)((U)x * (U)y))                                               \
+    DEF_ARRAY_KERNEL(S, T, lt, int8_t, x < y)                                                      \
+    DEF_ARRAY_KERNEL(S, T, le, int8_t, x <= y)                                                     \
+    DEF_ARRAY_KERNEL(S, T, gt, int8_t, x > y)                                                      \
+    DEF_ARRAY_KERNEL(S, T, ge, int8_t, x >= y)                                                     \
+    DEF_ARRAY_KERNEL(S, T, eq, int8_t, x == y)                                                     \
+    DEF_ARRAY_KERNEL(S, T, ne, int8_t, x != y)
+
+DEF_ARRAY_KERNELS(b, int8_t, uint32_t)
+DEF_ARRAY_KERNELS(h, int16_t, uint32_t)
+DEF_ARRAY_KERNELS(i, int32_t, uint32_t)
+DEF_ARRAY_KERNELS(q, int64_t, uint64_t)
+DEF_ARRAY_KERNELS(f, float, float)
+DEF_ARRAY_KERNELS(d, double, double)
+DEF_ARRAY_KERNEL(f, float, div, float, x / y)
+DEF_ARRAY_KERNEL(d, double, div, double, x / y)
+
+#undef DEF_ARRAY_KERNELS
+#undef DEF_ARRAY_KERNEL
+
+#define ARRAY_KERNELS(S, div)                                                                      \
+    {Array__add_##S,                                                                               \
+     Array__sub_##S,                                                                               \
+     Array__mul_##S,                                                                               \
+     div,                                                                                          \
+     Array__lt_##S,                                                                                \
+     Array__le_##S,                                                                                \
+     Array__gt_##S,                                                                                \
+     Array__ge_##S,                                                                                \
+     Array__eq_##S,                                                                                \
+     Array__ne_##S}
+
+// indexed by `Array__kind`, integer division promotes to 'd' first
+static const ArrayKernel Array__kernels[6][ARRAY_OP_COUNT] = {
+    ARRAY_KERNELS(b, NULL),
+    ARRAY_KERNELS(h, NULL),
+    ARRAY_KERNELS(i, NULL),
+    ARRAY_KERNELS(q, NULL),
+    ARRAY_KERNELS(f, Array__div_f),
+    ARRAY_KERNELS(d, Array__div_d),
+};
+
+#undef ARRAY_KERNELS
+
+// typecode a number broadcasts as against an array of `typecode`, 0 if it is not a number
+static char Array__scalar_typecode(char typecode, py_Ref val, char* buf) {
+    if(py_isint(val)) {
+        // small integers keep the typecode of the array
+        char tc = typecode;
+        if(!Array__isfloat(typecode) && !Array__fits(typecode, py_toint(val))) tc = 'q';
+        Array__write(tc, buf, val);
+        return tc;
+    }
+    if(py_isfloat(val)) {
+        char tc = typecode == 'f' ? 'f' : 'd';
+        Array__write(tc, buf, val);
+        return tc;
+    }
+    return 0;
+}
+
+// `self op other`, where `other` is an array of the same length or a number
+static bool Array__binaryop(py_Ref self, py_Ref other, int op) {
+    Array* a = py_touserdata(self);
+    int n = a->length;
+    char ta = a->typecode, tb;
+    const char* pb;
+    ArrayItem scalar;
+    bool is_scalar = !py_isinstance(other, tp_array);
+    if(is_scalar) {
+        tb = Array__scalar_typecode(ta, other, scalar.bytes);
+        if(!tb) return TypeError("expected an array or a number, got '%t'", other->type);
+        pb = scalar.bytes;
+    } else {
+        Array* b = py_touserdata(other);
+        if(b->length != n) {
+            return ValueError("arrays have different lengths: %d and %d", n, b->length);
+        }
+        tb = b->typecode;
+        pb = Array__data(b);
+        if(!pb) return false;
+    }
+    const char* pa = Array__data(a);
+    if(!pa) return false;
+
+    char tr = Array__promote(ta, tb);
+    if(op == ARRAY_DIV && !Array__isfloat(tr)) tr = 'd';
+    bool is_compare = op >= ARRAY_LT;
+    Array* out = Array__new(py_retval(), is_compare ? 'b' : tr, n);
+    if(!out) return false;
+
+    // operands of other typecodes are widened to `tr` first
+    int itemsize = Array__itemsize(tr);
+    void* tmp_a = NULL;
+    void* tmp_b = NULL;
+    ArrayItem scalar_r;
+    if(ta != tr) {
+        tmp_a = PK_MALLOC((size_t)n * itemsize);
+        Array__convert(tr, tmp_a, ta, pa, n);
+        pa = tmp_a;
+    }
+    if(tb != tr) {
+        if(is_scalar) {
+            Array__convert(tr, scalar_r.bytes, tb, pb, 1);
+            pb = scalar_r.bytes;
+        } else {
+            tmp_b = PK_MALLOC((size_t)n * itemsize);
+            Array__convert(tr, tmp_b, tb, pb, n);
+            pb = tmp_b;
+        }
+    }
+    Array__kernels[Array__kind(tr)][op](out->data, pa, pb, n, is_scalar);
+    PK_FREE(tmp_a);
+    PK_FREE(tmp_b);
+    return true;
+}
+
+#define DEF_ARRAY_BINARYOP(name, op)                                                               \
+    static bool array_##name(int argc, py_Ref argv) {                                              \
+        PY_CHECK_ARGC(2);                                                                          \
+        return Array__binaryop(argv, py_arg(1), op);                                               \
+    }
+
+DEF_ARRAY_BINARYOP(add, ARRAY_ADD)
+DEF_ARRAY_BINARYOP(sub, ARRAY_SUB)
+DEF_ARRAY_BINARYOP(mul, ARRAY_MUL)
+DEF_ARRAY_BINARYOP(div, ARRAY_DIV)
+DEF_ARRAY_BINARYOP(lt, ARRAY_LT)
+DEF_ARRAY_BINARYOP(le, ARRAY_LE)
+DEF_ARRAY_BINARYOP(gt, ARRAY_GT)
+DEF_ARRAY_BINARYOP(ge, ARRAY_GE)
+DEF_ARRAY_BINARYOP(eq, ARRAY_EQ)
+DEF_ARRAY_BINARYOP(ne, ARRAY_NE)
+
+#undef DEF_ARRAY_BINARYOP
+
+/* reductions */
+
+#define ARRAY_SUM(T, ACC_T)                                                                        \
+    do {                                                                                           \
+        const T* restrict a = (const T*)p;                                                         \
+        ACC_T acc = 0;                                                                             \
+        for(int i = 0; i < n; i++)                                                                 \
+            acc += a[i];                                                                           \
+        *out = acc;                                                                                \
+    } while(0)
+
+static bool array_sum(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Array* self = py_touserdata(argv);
+    const char* p = Array__data(self);
+    if(!p) return false;
+    int n = self->length;
+    if(Array__isfloat(self->typecode)) {
+        double value;
+        double* out = &value;
+        if(self->typecode == 'f') {
+            ARRAY_SUM(float, double);
+        } else {
+            ARRAY_SUM(double, double);
+        }
+        py_newfloat(py_retval(), value);
+    } else {
+        // wraps around on overflow like `int`
+        uint64_t value;
+        uint64_t* out = &value;
+        switch(self->typecode) {
+            case 'b': ARRAY_SUM(int8_t, uint64_t); break;
+            case 'h': ARRAY_SUM(int16_t, uint64_t); break;
+            case 'i': ARRAY_SUM(int32_t, uint64_t); break;
+            case 'q': ARRAY_SUM(int64_t, uint64_t); break;
+            default: c11__unreachable();
+        }
+        py_newint(py_retval(), (py_i64)value);
+    }
+    return true;
+}
+
+#undef ARRAY_SUM
+
+#define ARRAY_MINMAX(T, cmp)                                                                       \
+    do {                                                                                           \
+        const T* restrict a = (const T*)p;                                                         \
+        T res = a[0];                                                                              \
+        for(int i = 1; i < n; i++)                                                                 \
+            res = a[i] cmp res ? a[i] : res;                                                       \
+        *(T*)out.bytes = res;                                                                      \
+    } while(0)
+
+#define ARRAY_MINMAX_SWITCH(cmp)                                                                   \
+    switch(self->typecode) {                                                                       \
+        case 'b': ARRAY_MINMAX(int8_t, cmp); break;                                                \
+        case 'h': ARRAY_MINMAX(int16_t, cmp); break;                                               \
+        case 'i': ARRAY_MINMAX(int32_t, cmp); break;                                               \
+        case 'q': ARRAY_MINMAX(int64_t, cmp); break;                                               \
+        case 'f': ARRAY_MINMAX(float, cmp); break;                                                 \
+        case 'd': ARRAY_MINMAX(double, cmp); break;                                                \
+        default: c11__unreachable();                                                               \
+    }
+
+static bool Array__minmax(py_Ref argv, bool is_max) {
+    Array* self = py_touserdata(argv);
+    const char* p = Array__data(self);
+    if(!p) return false;
+    int n = self->length;
+    if(n == 0) return ValueError("%s() arg is an empty array", is_max ? "max" : "min");
+    ArrayItem out;
+    if(is_max) {
+        ARRAY_MINMAX_SWITCH(>);
+    } else {
+        ARRAY_MINMAX_SWITCH(<);
+    }
+    Array__read(self->typecode, out.bytes, py_retval());
+    return true;
+}
+
+#undef ARRAY_MINMAX_SWITCH
+#undef ARRAY_MINMAX
+
+static bool array_min(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    return Array__minmax(argv, false);
+}
+
+static bool array_max(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    return Array__minmax(argv, true);
+}
+
+#define ARRAY_DOT(T, ACC_T)                                                                        \
+    do {                                                                                           \
+        const T* restrict a = pa;                                                                  \
+        const T* restrict b = pb;                                                                  \
+        ACC_T acc = 0;                                                                             \
+        for(int i = 0; i < n; i++)                                                                 \
+            acc += (ACC_T)a[i] * (ACC_T)b[i];                                                      \
+        value = acc;                                                                               \
+    } while(0)
+
+static bool array_dot(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    if(!py_checkinstance(py_arg(1), tp_array)) return false;
+    Array* a = py_touserdata(argv);
+    Array* b = py_touserdata(py_arg(1));
+    int n = a->length;
+    if(b->length != n) return ValueError("arrays have different lengths: %d and %d", n, b->length);
+    const void* pa = Array__data(a);
+    if(!pa) return false;
+    const void* pb = Array__data(b);
+    if(!pb) return false;
+    char tr = Array__promote(a->typecode, b->typecode);
+    void* tmp_a = NULL;
+    void* tmp_b = NULL;
+    if(a->typecode != tr) {
+        tmp_a = PK_MALLOC((size_t)n * Array__itemsize(tr));
+        Array__convert(tr, tmp_a, a->typecode, pa, n);
+        pa = tmp_a;
+    }
+    if(b->typecode != tr) {
+        tmp_b = PK_MALLOC((size_t)n * Array__itemsize(tr));
+        Array__convert(tr, tmp_b, b->typecode, pb, n);
+        pb = tmp_b;
+    }
+    if(Array__isfloat(tr)) {
+        double value;
+        if(tr == 'f') {
+            ARRAY_DOT(float, double);
+        } else {
+            ARRAY_DOT(double, double);
+        }
+        py_newfloat(py_retval(), value);
+    } else {
+        uint64_t value;
+        switch(tr) {
+            case 'b': ARRAY_DOT(int8_t, uint64_t); break;
+            case 'h': ARRAY_DOT(int16_t, uint64_t); break;
+            case 'i': ARRAY_DOT(int32_t, uint64_t); break;
+            case 'q': ARRAY_DOT(int64_t, uint64_t); break;
+            default: c11__unreachable();
+        }
+        py_newint(py_retval(), (py_i64)value);
+    }
+    PK_FREE(tmp_a);
+    PK_FREE(tmp_b);
+    return true;
+}
+
+#undef ARRAY_DOT
+
+/* construction */
+
+// append the values of `iterable` to `self`
+static bool Array__extend(Array* self, py_Ref iterable) {
+    if(py_isinstance(iterable, tp_array)) {
+        Array* other = py_touserdata(iterable);
+        int n = other->length;
+        if(!Array__reserve(self, self->length + n)) return false;
+        // `other` may be `self`, or a view of it
+        const char* src = Array__data(other);
+        if(!src) return false;
+        char* dst = self->data + (size_t)self->length * self->itemsize;
+        if(other->typecode == self->typecode) {
+            memmove(dst, src, (size_t)n * self->itemsize);
+        } else if(Array__widens(other->typecode, self->typecode)) {
+            Array__convert(self->typecode, dst, other->typecode, src, n);
+        } else {
+            // narrowing conversions check each value
+            if(Array__isfloat(other->typecode)) {
+                return TypeError("cannot extend an '%c' array with a '%c' array",
+                                 self->typecode,
+                                 other->typecode);
+            }
+            py_StackRef tmp = py_pushtmp();
+            for(int i = 0; i < n; i++) {
+                Array__read(other->typecode, src + (size_t)i * other->itemsize, tmp);
+                if(!Array__write(self->typecode, dst + (size_t)i * self->itemsize, tmp)) {
+                    return false;
+                }
+            }
+            py_pop();
+        }
+        self->length += n;
+        return true;
+    }
+    if(py_istype(iterable, tp_bytes)) {
+        return TypeError("use frombytes() to extend an array with bytes");
+    }
+    py_TValue* p;
+    int n = pk_arrayview(iterable, &p);
+    if(n != -1) {
+        if(!Array__reserve(self, self->length + n)) return false;
+        for(int i = 0; i < n; i++) {
+            char* dst = self->data + (size_t)(self->length) * self->itemsize;
+            if(!Array__write(self->typecode, dst, &p[i])) return false;
+            self->length++;
+        }
+        return true;
+    }
+    if(py_isinstance(iterable, tp_array2d_like)) {
+        // row-major order
+        c11_array2d_like* grid = py_touserdata(iterable);
+        if(!Array__reserve(self, self->length + grid->numel)) return false;
+        for(int j = 0; j < grid->n_rows; j++) {
+            for(int i = 0; i < grid->n_cols; i++) {
+                py_Ref val = grid->f_get(grid, i, j);
+                if(!val) return false;
+                char* dst = self->data + (size_t)(self->length) * self->itemsize;
+                if(!Array__write(self->typecode, dst, val)) return false;
+                self->length++;
+            }
+        }
+        return true;
+    }
+    if(!py_iter(iterable)) return false;
+    py_push(py_retval());
+    while(true) {
+        int res = py_next(py_peek(-1));
+        if(res == -1) return false;
+        if(res == 0) break;
+        if(!Array__reserve(self, self->length + 1)) return false;
+        char* dst = self->data + (size_t)(self->length) * self->itemsize;
+        if(!Array__write(self->typecode, dst, py_retval())) return false;
+        self->length++;
+    }
+    py_pop();
+    return true;
+}
+
+static bool Array__frombytes(Array* self, py_Ref bytes) {
+    if(!py_checktype(bytes, tp_bytes)) return false;
+    int size;
+    unsigned char* p = py_tobytes(bytes, &size);
+    if(size % self->itemsize != 0) return ValueError("bytes length not a multiple of item size");
+    int n = size / self->itemsize;
+    if(!Array__reserve(self, self->length + n)) return false;
+    memcpy(self->data + (size_t)self->length * self->itemsize, p, size);
+    self->length += n;
+    return true;
+}
+
+// __new__(cls, typecode, initializer=None)
+static bool array__new__(int argc, py_Ref argv) {
+    py_Type cls = py_totype(argv);
+    if(!py_checkstr(py_arg(1))) return false;
+    c11_sv tc = py_tosv(py_arg(1));
+    if(tc.size != 1 || !Array__itemsize(tc.data[0])) {
+        return ValueError("bad typecode (must be one of '%s')", ARRAY_TYPECODES);
+    }
+    int slots = cls == tp_array ? 0 : -1;
+    py_StackRef out = py_pushtmp();
+    Array* self = py_newobject(out, cls, slots, sizeof(Array));
+    Array__ctor(self, tc.data[0], 0);
+    py_Ref init = py_arg(2);
+    if(py_istype(init, tp_bytes)) {
+        if(!Array__frombytes(self, init)) return false;
+    } else if(!py_isnone(init)) {
+        if(!Array__extend(self, init)) return false;
+    }
+    py_assign(py_retval(), out);
+    py_pop();
+    return true;
+}
+
+static bool array__init__(int argc, py_Ref argv) {
+    py_newnone(py_retval());
+    return true;
+}
+
+/* sequence protocol */
+
+static bool array__len__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Array* self = py_touserdata(argv);
+    py_newint(py_retval(), self->length);
+    return true;
+}
+
+static bool array__getitem__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    Array* self = py_touserdata(argv);
+    const char* p = Array__data(self);
+    if(!p) return false;
+    py_Ref key = py_arg(1);
+    if(py_isint(key)) {
+        int index = py_toint(key);
+        if(!pk__normalize_index(&index, self->length)) return false;
+        Array__read(self->typecode, p + (size_t)index * self->itemsize, py_retval());
+        return true;
+    }
+    if(py_istype(key, tp_slice)) {
+        int start, stop, step;
+        if(!pk__parse_int_slice(key, self->length, &start, &stop, &step)) return false;
+        int n = 0;
+        PK_SLICE_LOOP(i, start, stop, step) { n++; }
+        // a copy like in cpython, see `view()` for one that shares the buffer
+        Array* out = Array__new(py_retval(), self->typecode, n);
+        if(!out) return false;
+        char* dst = out->data;
+        PK_SLICE_LOOP(i, start, stop, step) {
+            memcpy(dst, p + (size_t)i * self->itemsize, self->itemsize);
+            dst += self->itemsize;
+        }
+        return true;
+    }
+    return TypeError("array indices must be integers or slices");
+}
+
+static bool array__setitem__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(3);
+    Array* self = py_touserdata(argv);
+    char* p = Array__data(self);
+    if(!p) return false;
+    py_Ref key = py_arg(1);
+    py_Ref val = py_arg(2);
+    if(py_isint(key)) {
+        int index = py_toint(key);
+        if(!pk__normalize_index(&index, self->length)) return false;
+        if(!Array__write(self->typecode, p + (size_t)index * self->itemsize, val)) return false;
+        py_newnone(py_retval());
+        return true;
+    }
+    if(py_istype(key, tp_slice)) {
+        if(!py_isinstance(val, tp_array)) {
+            return TypeError("can only assign array (not '%t') to array slice", val->type);
+        }
+        Array* other = py_touserdata(val);
+        if(other->typecode != self->typecode) {
+            return TypeError("bad argument type for built-in operation");
+        }
+        const char* src = Array__data(other);
+        if(!src) return false;
+        int start, stop, step;
+        if(!pk__parse_int_slice(key, self->length, &start, &stop, &step)) return false;
+        int n = 0;
+        PK_SLICE_LOOP(i, start, stop, step) { n++; }
+        int size = self->itemsize;
+        if(step == 1 && n != other->length) {
+            // resize in place, `other` may share the buffer so it is copied first
+            int m = other->length;
+            char* tmp = PK_MALLOC((size_t)m * size);
+            memcpy(tmp, src, (size_t)m * size);
+            if(!Array__reserve(self, self->length - n + m)) {
+                PK_FREE(tmp);
+                return false;
+            }
+            memmove(self->data + (size_t)(start + m) * size,
+                    self->data + (size_t)stop * size,
+                    (size_t)(self->length - stop) * size);
+            memcpy(self->data + (size_t)start * size, tmp, (size_t)m * size);
+            PK_FREE(tmp);
+            self->length += m - n;
+        } else {
+            if(n != other->length) {
+                return ValueError("attempt to assign array of size %d to extended slice of size %d",
+                                  other->length,
+                                  n);
+            }
+            int k = 0;
+            PK_SLICE_LOOP(i, start, stop, step) {
+                memmove(p + (size_t)i * size, src + (size_t)(k++) * size, size);
+            }
+        }
+        py_newnone(py_retval());
+        return true;
+    }
+    return TypeError("array indices must be integers or slices");
+}
+
+static bool array__delitem__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    PY_CHECK_ARG_TYPE(1, tp_int);
+    Array* self = py_touserdata(argv);
+    if(!py_isnil(&self->base)) return TypeError("cannot resize an array view");
+    int index = py_toint(py_arg(1));
+    if(!pk__normalize_index(&index, self->length)) return false;
+    int size = self->itemsize;
+    memmove(self->data + (size_t)index * size,
+            self->data + (size_t)(index + 1) * size,
+            (size_t)(self->length - index - 1) * size);
+    self->length--;
+    py_newnone(py_retval());
+    return true;
+}
+
+// index of the first element equal to `val` from `start`, -1 if not found
+static int Array__find(Array* self, const char* p, py_Ref val, int start) {
+    if(py_isint(val) && !Array__isfloat(self->typecode)) {
+        py_i64 x = py_toint(val);
+        for(int i = start; i < self->length; i++) {
+            if(Array__int_at(self->typecode, p, i) == x) return i;
+        }
+    } else if(py_isint(val) || py_isfloat(val)) {
+        py_f64 x = py_isint(val) ? (py_f64)py_toint(val) : py_tofloat(val);
+        for(int i = start; i < self->length; i++) {
+            if(Array__float_at(self->typecode, p, i) == x) return i;
+        }
+    }
+    return -1;
+}
+
+static bool array__contains__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    Array* self = py_touserdata(argv);
+    const char* p = Array__data(self);
+    if(!p) return false;
+    py_newbool(py_retval(), Array__find(self, p, py_arg(1), 0) != -1);
+    return true;
+}
+
+static bool Array__equal(Array* a, const char* pa, Array* b, const char* pb) {
+    if(a->length != b->length) return false;
+    if(!Array__isfloat(a->typecode) && !Array__isfloat(b->typecode)) {
+        for(int i = 0; i < a->length; i++) {
+            if(Array__int_at(a->typecode, pa, i) != Array__int_at(b->typecode, pb, i)) return false;
+        }
+    } else {
+        for(int i = 0; i < a->length; i++) {
+            if(Array__float_at(a->typecode, pa, i) != Array__float_at(b->typecode, pb, i)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool array__eq__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    if(!py_isinstance(py_arg(1), tp_array)) {
+        py_newnotimplemented(py_retval());
+        return true;
+    }
+    Array* a = py_touserdata(argv);
+    Array* b = py_touserdata(py_arg(1));
+    const char* pa = Array__data(a);
+    if(!pa) return false;
+    const char* pb = Array__data(b);
+    if(!pb) return false;
+    py_newbool(py_retval(), Array__equal(a, pa, b, pb));
+    return true;
+}
+
+static bool array__ne__(int argc, py_Ref argv) {
+    if(!array__eq__(argc, argv)) return false;
+    if(py_isbool(py_retval())) py_newbool(py_retval(), !py_tobool(py_retval()));
+    return true;
+}
+
+static bool array__repr__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Array* self = py_touserdata(argv);
+    const char* p = Array__data(self);
+    if(!p) return false;
+    c11_sbuf buf;
+    c11_sbuf__ctor(&buf);
+    pk_sprintf(&buf, "%t('%c'", argv->type, self->typecode);
+    if(self->length > 0) {
+        c11_sbuf__write_cstr(&buf, ", [");
+        py_StackRef item = py_pushtmp();
+        for(int i = 0; i < self->length; i++) {
+            if(i > 0) c11_sbuf__write_cstr(&buf, ", ");
+            Array__read(self->typecode, p + (size_t)i * self->itemsize, item);
+            if(!py_repr(item)) {
+                c11_sbuf__dtor(&buf);
+                return false;
+            }
+            c11_sbuf__write_sv(&buf, py_tosv(py_retval()));
+        }
+        py_pop();
+        c11_sbuf__write_char(&buf, ']');
+    }
+    c11_sbuf__write_char(&buf, ')');
+    c11_sbuf__py_submit(&buf, py_retval());
+    return true;
+}
+
+static bool array__iter__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    int* index = py_newobject(py_retval(), tp_array_iterator, 1, sizeof(int));
+    *index = 0;
+    py_setslot(py_retval(), 0, argv);
+    return true;
+}
+
+static bool array_iterator__next__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    int* index = py_touserdata(argv);
+    Array* self = py_touserdata(py_getslot(argv, 0));
+    if(*index >= self->length) return StopIteration();
+    const char* p = Array__data(self);
+    if(!p) return false;
+    Array__read(self->typecode, p + (size_t)(*index) * self->itemsize, py_retval());
+    (*index)++;
+    return true;
+}
+
+static bool array__reduce__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Array* self = py_touserdata(argv);
+    const char* p = Array__data(self);
+    if(!p) return false;
+    py_Ref reduced = py_newtuple(py_pushtmp(), 2);
+    reduced[0] = *py_tpobject(argv->type);
+    py_Ref args = py_newtuple(&reduced[1], 2);
+    char typecode[2] = {self->typecode, '\0'};
+    py_newstr(&args[0], typecode);
+    int size = self->length * self->itemsize;
+    memcpy(py_newbytes(&args[1], size), p, size);
+    py_assign(py_retval(), py_peek(-1));
+    py_pop();
+    return true;
+}
+
+/* properties and methods */
+
+static bool array_typecode(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Array* self = py_touserdata(argv);
+    char typecode[2] = {self->typecode, '\0'};
+    py_newstr(py_retval(), typecode);
+    return true;
+}
+
+static bool array_itemsize(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Array* self = py_touserdata(argv);
+    py_newint(py_retval(), self->itemsize);
+    return true;
+}
+
+static bool array_append(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    Array* self = py_touserdata(argv);
+    if(!Array__reserve(self, self->length + 1)) return false;
+    char* dst = self->data + (size_t)self->length * self->itemsize;
+    if(!Array__write(self->typecode, dst, py_arg(1))) return false;
+    self->length++;
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool array_extend(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    if(!Array__extend(py_touserdata(argv), py_arg(1))) return false;
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool array_frombytes(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    if(!Array__frombytes(py_touserdata(argv), py_arg(1))) return false;
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool array_fromlist(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    if(!py_checktype(py_arg(1), tp_list)) return false;
+    Array* self = py_touserdata(argv);
+    int length = self->length;
+    if(!Array__extend(self, py_arg(1))) {
+        // like cpython, the array is unchanged on errors
+        self->length = length;
+        return false;
+    }
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool array_tobytes(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Array* self = py_touserdata(argv);
+    const char* p = Array__data(self);
+    if(!p) return false;
+    int size = self->length * self->itemsize;
+    memcpy(py_newbytes(py_retval(), size), p, size);
+    return true;
+}
+
+static bool array_tolist(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Array* self = py_touserdata(argv);
+    const char* p = Array__data(self);
+    if(!p) return false;
+    py_newlistn(py_retval(), self->length);
+    py_TValue* out = py_list_data(py_retval());
+    for(int i = 0; i < self->length; i++) {
+        Array__read(self->typecode, p + (size_t)i * self->itemsize, &out[i]);
+    }
+    return true;
+}
+
+// pop(self, i=-1)
+static bool array_pop(int argc, py_Ref argv) {
+    Array* self = py_touserdata(argv);
+    if(!py_isnil(&self->base)) return TypeError("cannot resize an array view");
+    if(!py_checkint(py_arg(1))) return false;
+    if(self->length == 0) return IndexError("pop from empty array");
+    int index = py_toint(py_arg(1));
+    if(!pk__normalize_index(&index, self->length)) return false;
+    int size = self->itemsize;
+    Array__read(self->typecode, self->data + (size_t)index * size, py_retval());
+    memmove(self->data + (size_t)index * size,
+            self->data + (size_t)(index + 1) * size,
+            (size_t)(self->length - index - 1) * size);
+    self->length--;
+    return true;
+}
+
+static bool array_insert(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(3);
+    PY_CHECK_ARG_TYPE(1, tp_int);
+    Array* self = py_touserdata(argv);
+    int index = py_toint(py_arg(1));
+    if(index < 0) index += self->length;
+    if(index < 0) index = 0;
+    if(index > self->length) index = self->length;
+    ArrayItem item;
+    if(!Array__write(self->typecode, item.bytes, py_arg(2))) return false;
+    if(!Array__reserve(self, self->length + 1)) return false;
+    int size = self->itemsize;
+    memmove(self->data + (size_t)(index + 1) * size,
+            self->data + (size_t)index * size,
+            (size_t)(self->length - index) * size);
+    memcpy(self->data + (size_t)index * size, item.bytes, size);
+    self->length++;
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool array_index(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    Array* self = py_touserdata(argv);
+    const char* p = Array__data(self);
+    if(!p) return false;
+    int index = Array__find(self, p, py_arg(1), 0);
+    if(index == -1) return ValueError("array.index(x): x not in array");
+    py_newint(py_retval(), index);
+    return true;
+}
+
+static bool array_remove(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    Array* self = py_touserdata(argv);
+    if(!py_isnil(&self->base)) return TypeError("cannot resize an array view");
+    int index = Array__find(self, self->data, py_arg(1), 0);
+    if(index == -1) return ValueError("array.remove(x): x not in array");
+    int size = self->itemsize;
+    memmove(self->data + (size_t)index * size,
+            self->data + (size_t)(index + 1) * size,
+            (size_t)(self->length - index - 1) * size);
+    self->length--;
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool array_count(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    Array* self = py_touserdata(argv);
+    const char* p = Array__data(self);
+    if(!p) return false;
+    int count = 0;
+    for(int i = Array__find(self, p, py_arg(1), 0); i != -1;
+        i = Array__find(self, p, py_arg(1), i + 1)) {
+        count++;
+    }
+    py_newint(py_retval(), count);
+    return true;
+}
+
+static bool array_reverse(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Array* self = py_touserdata(argv);
+    char* p = Array__data(self);
+    if(!p) return false;
+    int size = self->itemsize;
+    char tmp[8];
+    for(int i = 0, j = self->length - 1; i < j; i++, j--) {
+        memcpy(tmp, p + (size_t)i * size, size);
+        memcpy(p + (size_t)i * size, p + (size_t)j * size, size);
+        memcpy(p + (size_t)j * size, tmp, size);
+    }
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool array_fill(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    Array* self = py_touserdata(argv);
+    char* p = Array__data(self);
+    if(!p) return false;
+    ArrayItem item;
+    if(!Array__write(self->typecode, item.bytes, py_arg(1))) return false;
+    int size = self->itemsize;
+    for(int i = 0; i < self->length; i++) {
+        memcpy(p + (size_t)i * size, item.bytes, size);
+    }
+    py_newnone(py_retval());
+    return true;
+}
+
+// view(self, start=0, stop=None)
+static bool array_view(int argc, py_Ref argv) {
+    Array* self = py_touserdata(argv);
+    PY_CHECK_ARG_TYPE(1, tp_int);
+    int start = py_toint(py_arg(1));
+    int stop = self->length;
+    if(!py_isnone(py_arg(2))) {
+        PY_CHECK_ARG_TYPE(2, tp_int);
+        stop = py_toint(py_arg(2));
+    }
+    if(start < 0) start += self->length;
+    if(stop < 0) stop += self->length;
+    if(start < 0 || stop > self->length || start > stop) {
+        return IndexError("view [%d:%d] is out of range of an array of length %d",
+                          start,
+                          stop,
+                          self->length);
+    }
+    // views of a view share the buffer of its base
+    py_Ref base = argv;
+    if(!py_isnil(&self->base)) {
+        base = &self->base;
+        start += self->offset;
+        stop += self->offset;
+    }
+    py_StackRef out = py_pushtmp();
+    Array* view = py_newobject(out, tp_array, 0, sizeof(Array));
+    view->data = NULL;
+    view->length = stop - start;
+    view->capacity = 0;
+    view->offset = start;
+    view->typecode = self->typecode;
+    view->itemsize = self->itemsize;
+    view->base = *base;
+    py_assign(py_retval(), out);
+    py_pop();
+    return true;
+}
+
+static bool array_compress(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    if(!py_checkinstance(py_arg(1), tp_array)) return false;
+    Array* self = py_touserdata(argv);
+    Array* mask = py_touserdata(py_arg(1));
+    if(mask->length != self->length) {
+        return ValueError("arrays have different lengths: %d and %d", self->length, mask->length);
+    }
+    int n = 0;
+    Array* out = Array__new(py_retval(), self->typecode, self->length);
+    if(!out) return false;
+    const char* p = Array__data(self);
+    if(!p) return false;
+    const char* pm = Array__data(mask);
+    if(!pm) return false;
+    int size = self->itemsize;
+    for(int i = 0; i < self->length; i++) {
+        if(Array__float_at(mask->typecode, pm, i) == 0) continue;
+        memcpy(out->data + (size_t)(n++) * size, p + (size_t)i * size, size);
+    }
+    out->length = n;
+    return true;
+}
+
+static bool array_to_array2d(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(3);
+    PY_CHECK_ARG_TYPE(1, tp_int);
+    PY_CHECK_ARG_TYPE(2, tp_int);
+    Array* self = py_touserdata(argv);
+    const char* p = Array__data(self);
+    if(!p) return false;
+    int n_cols = py_toint(py_arg(1));
+    int n_rows = py_toint(py_arg(2));
+    if(n_cols <= 0 || n_rows <= 0) return ValueError("array2d() expected positive dimensions");
+    if(n_cols * n_rows != self->length) {
+        return ValueError("cannot reshape an array of length %d into %dx%d",
+                          self->length,
+                          n_cols,
+                          n_rows);
+    }
+    c11_array2d* res = c11_newarray2d(py_retval(), n_cols, n_rows);
+    for(int i = 0; i < self->length; i++) {
+        Array__read(self->typecode, p + (size_t)i * self->itemsize, &res->data[i]);
+    }
+    return true;
+}
+
+static void register_array(py_Ref mod) {
+    py_Type type = py_newtype("array", tp_object, mod, (py_Dtor)Array__dtor);
+    assert(type == tp_array);
+
+    py_bind(py_tpobject(type), "__new__(cls, typecode, initializer=None)", array__new__);
+    py_bind(py_tpobject(type), "__init__(self, *args)", array__init__);
+    py_bindmagic(type, __len__, array__len__);
+    py_bindmagic(type, __getitem__, array__getitem__);
+    py_bindmagic(type, __setitem__, array__setitem__);
+    py_bindmagic(type, __delitem__, array__delitem__);
+    py_bindmagic(type, __contains__, array__contains__);
+    py_bindmagic(type, __eq__, array__eq__);
+    py_bindmagic(type, __ne__, array__ne__);
+    py_bindmagic(type, __repr__, array__repr__);
+    py_bindmagic(type, __iter__, array__iter__);
+    py_bindmagic(type, __reduce__, array__reduce__);
+    py_setdict(py_tpobject(type), __hash__, py_None());
+
+    py_bindproperty(type, "typecode", array_typecode, NULL);
+    py_bindproperty(type, "itemsize", array_itemsize, NULL);
+
+    py_bindmethod(type, "append", array_append);
+    py_bindmethod(type, "extend", array_extend);
+    py_bindmethod(type, "frombytes", array_frombytes);
+    py_bindmethod(type, "fromlist", array_fromlist);
+    py_bindmethod(type, "tobytes", array_tobytes);
+    py_bindmethod(type, "tolist", array_tolist);
+    py_bind(py_tpobject(type), "pop(self, i=-1)", array_pop);
+    py_bindmethod(type, "insert", array_insert);
+    py_bindmethod(type, "index", array_index);
+    py_bindmethod(type, "remove", array_remove);
+    py_bindmethod(type, "count", array_count);
+    py_bindmethod(type, "reverse", array_reverse);
+
+    py_bindmethod(type, "fill", array_fill);
+    py_bind(py_tpobject(type), "view(self, start=0, stop=None)", array_view);
+    py_bindmethod(type, "compress", array_compress);
+    py_bindmethod(type, "to_array2d", array_to_array2d);
+
+    py_bindmethod(type, "add", array_add);
+    py_bindmethod(type, "sub", array_sub);
+    py_bindmethod(type, "mul", array_mul);
+    py_bindmethod(type, "div", array_div);
+    py_bindmethod(type, "lt", array_lt);
+    py_bindmethod(type, "le", array_le);
+    py_bindmethod(type, "gt", array_gt);
+    py_bindmethod(type, "ge", array_ge);
+    py_bindmethod(type, "eq", array_eq);
+    py_bindmethod(type, "ne", array_ne);
+
+    py_bindmethod(type, "sum", array_sum);
+    py_bindmethod(type, "min", array_min);
+    py_bindmethod(type, "max", array_max);
+    py_bindmethod(type, "dot", array_dot);
+
+    type = py_newtype("array_iterator", tp_object, mod, NULL);
+    assert(type == tp_array_iterator);
+    py_bindmagic(type, __iter__, pk_wrapper__self);
+    py_bindmagic(type, __next__, array_iterator__next__);
+}
+
+void pk__add_module_array() {
+    py_Ref mod = py_newmodule("array");
+    py_newstr(py_emplacedict(mod, py_name("typecodes")), ARRAY_TYPECODES);
+    register_array(mod);
+}
@@ -2,6 +2,9 @@
 #include "pocketpy/interpreter/vm.h"
 #include "pocketpy/pocketpy.h"
 #include <limits.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
 
 static bool c11_array2d_like_is_valid(c11_array2d_like* self, int col, int row) {
     return col >= 0 && col < self->n_cols && row >= 0 && row < self->n_rows;
@@ -11,7 +14,13 @@ static py_Ref c11_array2d__get(c11_array2d* self, int col, int row) {
     return self->data + row * self->header.n_cols + col;
 }
 
+// the object whose slots, or userdata if it has no slots, start at `flex`
+static PyObject* c11_array2d__owner(void* flex) {
+    return (PyObject*)((char*)flex - offsetof(PyObject, flex));
+}
+
 static bool c11_array2d__set(c11_array2d* self, int col, int row, py_Ref value) {
+    pk__write_barrier_value(c11_array2d__owner(self->data), value);
     self->data[row * self->header.n_cols + col] = *value;
     return true;
 }
@@ -25,9 +34,314 @@ c11_array2d* c11_newarray2d(py_OutRef out, int n_cols, int n_rows) {
     ud->header.f_get = (py_Ref (*)(c11_array2d_like*, int, int))c11_array2d__get;
     ud->header.f_set = (bool (*)(c11_array2d_like*, int, int, py_Ref))c11_array2d__set;
     ud->data = py_getslot(out, 0);
+    ud->dtype = c11_array2d_object;
+    ud->buffer = NULL;
+    return ud;
+}
+
+/* typed array2d */
+
+static const char* c11_array2d_dtype__name(c11_array2d_dtype dtype) {
+    switch(dtype) {
+        case c11_array2d_int8: return "int8";
+        case c11_array2d_int32: return "int32";
+        case c11_array2d_float32: return "float32";
+        case c11_array2d_bool: return "bool";
+        default: return NULL;
+    }
+}
+
+static bool c11_array2d_dtype__parse(py_Ref name, c11_array2d_dtype* out) {
+    if(py_isnone(name)) {
+        *out = c11_array2d_object;
+        return true;
+    }
+    if(!py_checkstr(name)) return false;
+    for(c11_array2d_dtype dtype = c11_array2d_int8; dtype <= c11_array2d_bool; dtype++) {
+        if(strcmp(py_tostr(name), c11_array2d_dtype__name(dtype)) == 0) {
+            *out = dtype;
+            return true;
+        }
+    }
+    return ValueError("dtype must be 'int8', 'int32', 'float32', 'bool' or None");
+}
+
+static void
+c11_array2d__read(c11_array2d_dtype dtype, const void* buffer, int index, py_OutRef out) {
+    switch(dtype) {
+        case c11_array2d_int8: py_newint(out, ((const int8_t*)buffer)[index]); break;
+        case c11_array2d_int32: py_newint(out, ((const int32_t*)buffer)[index]); break;
+        case c11_array2d_float32: py_newfloat(out, ((const float*)buffer)[index]); break;
+        case c11_array2d_bool: py_newbool(out, ((const uint8_t*)buffer)[index]); break;
+        default: c11__unreachable();
+    }
+}
+
+static bool c11_array2d__write(c11_array2d_dtype dtype, void* buffer, int index, py_Ref value) {
+    switch(dtype) {
+        case c11_array2d_int8:
+        case c11_array2d_int32: {
+            if(!py_checkint(value)) return false;
+            py_i64 x = py_toint(value);
+            if(dtype == c11_array2d_int8) {
+                if(x < INT8_MIN || x > INT8_MAX) break;
+                ((int8_t*)buffer)[index] = (int8_t)x;
+            } else {
+                if(x < INT32_MIN || x > INT32_MAX) break;
+                ((int32_t*)buffer)[index] = (int32_t)x;
+            }
+            return true;
+        }
+        case c11_array2d_float32: {
+            py_f64 x;
+            if(!py_castfloat(value, &x)) return false;
+            ((float*)buffer)[index] = (float)x;
+            return true;
+        }
+        case c11_array2d_bool: {
+            if(!py_checkbool(value)) return false;
+            ((uint8_t*)buffer)[index] = py_tobool(value);
+            return true;
+        }
+        default: c11__unreachable();
+    }
+    return ValueError("%i is out of range for dtype '%s'",
+                      py_toint(value),
+                      c11_array2d_dtype__name(dtype));
+}
+
+static py_Ref c11_array2d__get_typed(c11_array2d* self, int col, int row) {
+    py_Ref out = &self->boxed[self->boxed_index++ % c11__count_array(self->boxed)];
+    c11_array2d__read(self->dtype, self->buffer, row * self->header.n_cols + col, out);
+    return out;
+}
+
+static bool c11_array2d__set_typed(c11_array2d* self, int col, int row, py_Ref value) {
+    return c11_array2d__write(self->dtype, self->buffer, row * self->header.n_cols + col, value);
+}
+
+c11_array2d* c11_newarray2d_typed(py_OutRef out, int n_cols, int n_rows, c11_array2d_dtype dtype) {
+    if(dtype == c11_array2d_object) return c11_newarray2d(out, n_cols, n_rows);
+    int numel = n_cols * n_rows;
+    size_t size = (size_t)numel * c11_array2d_dtype__itemsize(dtype);
+    if(!ManagedHeap__reserve(&pk_current_vm->heap, size)) return NULL;
+    c11_array2d* ud = py_newobject(out, tp_array2d, 0, sizeof(c11_array2d));
+    ud->header.n_cols = n_cols;
+    ud->header.n_rows = n_rows;
+    ud->header.numel = numel;
+    ud->header.f_get = (py_Ref (*)(c11_array2d_like*, int, int))c11_array2d__get_typed;
+    ud->header.f_set = (bool (*)(c11_array2d_like*, int, int, py_Ref))c11_array2d__set_typed;
+    ud->data = NULL;
+    ud->dtype = dtype;
+    ud->buffer = PK_MALLOC(size);
+    memset(ud->buffer, 0, size);
+    ud->boxed_index = 0;
+    ManagedHeap__account(&pk_current_vm->heap, c11_array2d__external_bytes(ud));
     return ud;
 }
 
+static void c11_array2d__dtor(c11_array2d* self) { PK_FREE(self->buffer); }
+
+// the typed array behind `self`, NULL for object arrays and other array2d_like
+static c11_array2d* c11_array2d__typed(py_Ref self) {
+    if(!py_istype(self, tp_array2d)) return NULL;
+    c11_array2d* ud = py_touserdata(self);
+    return ud->dtype == c11_array2d_object ? NULL : ud;
+}
+
+// values of `self` as `dtype`, converted into `*tmp` if needed
+static const void* c11_array2d__as(c11_array2d* self, c11_array2d_dtype dtype, void** tmp) {
+    if(self->dtype == dtype) return self->buffer;
+    int n = self->header.numel;
+    *tmp = PK_MALLOC((size_t)n * c11_array2d_dtype__itemsize(dtype));
+    if(self->dtype == c11_array2d_int8 && dtype == c11_array2d_int32) {
+        const int8_t* restrict src = self->buffer;
+        int32_t* restrict dst = *tmp;
+        for(int i = 0; i < n; i++)
+            dst[i] = src[i];
+    } else if(self->dtype == c11_array2d_int8 && dtype == c11_array2d_float32) {
+        const int8_t* restrict src = self->buffer;
+        float* restrict dst = *tmp;
+        for(int i = 0; i < n; i++)
+            dst[i] = src[i];
+    } else if(self->dtype == c11_array2d_int32 && dtype == c11_array2d_float32) {
+        const int32_t* restrict src = self->buffer;
+        float* restrict dst = *tmp;
+        for(int i = 0; i < n; i++)
+            dst[i] = (float)src[i];
+    } else {
+        c11__unreachable();
+    }
+    return *tmp;
+}
+
+enum {
+    ARRAY2D_ADD,
+    ARRAY2D_SUB,
+    ARRAY2D_MUL,
+    ARRAY2D_TRUEDIV,
+    ARRAY2D_LT,
+    ARRAY2D_LE,
+    ARRAY2D_GT,
+    ARRAY2D_GE,
+    ARRAY2D_EQ,
+    ARRAY2D_NE,
+    ARRAY2D_AND,
+    ARRAY2D_OR,
+    ARRAY2D_XOR,
+    ARRAY2D_OP_COUNT,
+};
+
+typedef void (*c11_array2d_kernel)(void* out, const void* a, const void* b, int n, bool scalar);
+
+typedef union {
+    int8_t i8;
+    int32_t i32;
+    float f32;
+    uint8_t b;
+} c11_array2d_scalar;
+
+// element-wise loops over packed buffers, `b` is one value if `s` is true
+#define DEF_ARRAY2D_KERNEL(S, T, name, OUT_T, expr)                                                \
+    static void _array2d_##name##_##S(void* out_, const void* a_, const void* b_, int n, bool s) { \
+        OUT_T* restrict out = out_;                                                                \
+        const T* restrict a = a_;                                                                  \
+        if(s) {                                                                                    \
+            const T y = *(const T*)b_;                                                             \
+            for(int i = 0; i < n; i++) {                                                           \
+                const T x = a[i];                                                                  \
+                out[i] = (expr);                                                                   \
+            }                                                                                      \
+        } else {                                                                                   \
+            const T* restrict b = b_;                                                              \
+            for(int i = 0; i < n; i++) {                                                           \
+                const T x = a[i];                                                                  \
+                const T y = b[i];                                                                  \
+                out[i] = (expr);                                                                   \
+            }                                                                                      \
+        }                                                                                          \
+    }
+
+#define DEF_ARRAY2D_COMPARE_KERNELS(S, T)                                                          \
+    DEF_ARRAY2D_KERNEL(S, T, lt, uint8_t, x < y)                                                   \
+    DEF_ARRAY2D_KERNEL(S, T, le, uint8_t, x <= y)                                                  \
+    DEF_ARRAY2D_KERNEL(S, T, gt, uint8_t, x > y)                                                   \
+    DEF_ARRAY2D_KERNEL(S, T, ge, uint8_t, x >= y)                                                  \
+    DEF_ARRAY2D_KERNEL(S, T, eq, uint8_t, x == y)                                                  \
+    DEF_ARRAY2D_KERNEL(S, T, ne, uint8_t, x != y)
+
+// int32 wraps around on overflow
+DEF_ARRAY2D_KERNEL(int32, int32_t, add, int32_t, (int32_t)((uint32_t)x + (uint32_t)y))
+DEF_ARRAY2D_KERNEL(int32, int32_t, sub, int32_t, (int32_t)((uint32_t)x - (uint32_t)y))
+DEF_ARRAY2D_KERNEL(int32, int32_t, mul, int32_t, (int32_t)((uint32_t)x * (uint32_t)y))
+DEF_ARRAY2D_KERNEL(int32, int32_t, and, int32_t, x & y)
+DEF_ARRAY2D_KERNEL(int32, int32_t, or, int32_t, x | y)
+DEF_ARRAY2D_KERNEL(int32, int32_t, xor, int32_t, x ^ y)
+DEF_ARRAY2D_COMPARE_KERNELS(int32, int32_t)
+
+DEF_ARRAY2D_KERNEL(float32, float, add, float, x + y)
+DEF_ARRAY2D_KERNEL(float32, float, sub, float, x - y)
+DEF_ARRAY2D_KERNEL(float32, float, mul, float, x * y)
+DEF_ARRAY2D_KERNEL(float32, float, truediv, float, x / y)
+DEF_ARRAY2D_COMPARE_KERNELS(float32, float)
+
+DEF_ARRAY2D_KERNEL(int8, int8_t, eq, uint8_t, x == y)
+
+DEF_ARRAY2D_KERNEL(bool, uint8_t, eq, uint8_t, x == y)
+DEF_ARRAY2D_KERNEL(bool, uint8_t, ne, uint8_t, x != y)
+DEF_ARRAY2D_KERNEL(bool, uint8_t, and, uint8_t, x & y)
+DEF_ARRAY2D_KERNEL(bool, uint8_t, or, uint8_t, x | y)
+DEF_ARRAY2D_KERNEL(bool, uint8_t, xor, uint8_t, x ^ y)
+
+#undef DEF_ARRAY2D_COMPARE_KERNELS
+#undef DEF_ARRAY2D_KERNEL
+
+#define ARRAY2D_COMPARE_KERNELS(S)                                                                 \
+    [ARRAY2D_LT] = _array2d_lt_##S, [ARRAY2D_LE] = _array2d_le_##S,                                \
+    [ARRAY2D_GT] = _array2d_gt_##S, [ARRAY2D_GE] = _array2d_ge_##S,                                \
+    [ARRAY2D_EQ] = _array2d_eq_##S, [ARRAY2D_NE] = _array2d_ne_##S
+
+static const c11_array2d_kernel _array2d_int32_kernels[ARRAY2D_OP_COUNT] = {
+    [ARRAY2D_ADD] = _array2d_add_int32,
+    [ARRAY2D_SUB] = _array2d_sub_int32,
+    [ARRAY2D_MUL] = _array2d_mul_int32,
+    [ARRAY2D_AND] = _array2d_and_int32,
+    [ARRAY2D_OR] = _array2d_or_int32,
+    [ARRAY2D_XOR] = _array2d_xor_int32,
+    ARRAY2D_COMPARE_KERNELS(int32),
+};
+
+static const c11_array2d_kernel _array2d_float32_kernels[ARRAY2D_OP_COUNT] = {
+    [ARRAY2D_ADD] = _array2d_add_float32,
+    [ARRAY2D_SUB] = _array2d_sub_float32,
+    [ARRAY2D_MUL] = _array2d_mul_float32,
+    [ARRAY2D_TRUEDIV] = _array2d_truediv_float32,
+    ARRAY2D_COMPARE_KERNELS(float32),
+};
+
+static const c11_array2d_kernel _array2d_bool_kernels[ARRAY2D_OP_COUNT] = {
+    [ARRAY2D_EQ] = _array2d_eq_bool,
+    [ARRAY2D_NE] = _array2d_ne_bool,
+    [ARRAY2D_AND] = _array2d_and_bool,
+    [ARRAY2D_OR] = _array2d_or_bool,
+    [ARRAY2D_XOR] = _array2d_xor_bool,
+};
+
+#undef ARRAY2D_COMPARE_KERNELS
+
+// a mask of the elements equal to `value`, NULL if the generic path must compare them
+static uint8_t* c11_array2d__eq_mask(c11_array2d* self, py_Ref value) {
+    int n = self->header.numel;
+    c11_array2d_scalar key;
+    bool never_equal = false;
+    c11_array2d_kernel kernel;
+    switch(self->dtype) {
+        case c11_array2d_int8:
+        case c11_array2d_int32: {
+            if(!py_isint(value)) return NULL;
+            py_i64 x = py_toint(value);
+            if(self->dtype == c11_array2d_int8) {
+                never_equal = x < INT8_MIN || x > INT8_MAX;
+                key.i8 = (int8_t)x;
+                kernel = _array2d_eq_int8;
+            } else {
+                never_equal = x < INT32_MIN || x > INT32_MAX;
+                key.i32 = (int32_t)x;
+                kernel = _array2d_eq_int32;
+            }
+            break;
+        }
+        case c11_array2d_float32: {
+            py_f64 x;
+            if(py_isint(value)) {
+                x = py_toint(value);
+            } else if(py_isfloat(value)) {
+                x = py_tofloat(value);
+            } else {
+                return NULL;
+            }
+            key.f32 = (float)x;
+            never_equal = (py_f64)key.f32 != x;
+            kernel = _array2d_eq_float32;
+            break;
+        }
+        case c11_array2d_bool: {
+            if(!py_isbool(value)) return NULL;
+            key.b = py_tobool(value);
+            kernel = _array2d_eq_bool;
+            break;
+        }
+        default: c11__unreachable();
+    }
+    uint8_t* mask = PK_MALLOC(n);
+    if(never_equal) {
+        memset(mask, 0, n);
+    } else {
+        kernel(mask, self->buffer, &key, n, true);
+    }
+    return mask;
+}
+
 /* array2d_like bindings */
 static bool array2d_like_n_cols(int argc, py_Ref argv) {
     PY_CHECK_ARGC(1);
@@ -224,6 +538,11 @@ static bool array2d_like_render_with_color(int argc, py_Ref argv) {
 static bool array2d_like_all(int argc, py_Ref argv) {
     PY_CHECK_ARGC(1);
     c11_array2d_like* self = py_touserdata(argv);
+    c11_array2d* typed = c11_array2d__typed(argv);
+    if(typed != NULL && typed->dtype == c11_array2d_bool) {
+        py_newbool(py_retval(), memchr(typed->buffer, 0, self->numel) == NULL);
+        return true;
+    }
     for(int j = 0; j < self->n_rows; j++) {
         for(int i = 0; i < self->n_cols; i++) {
             py_Ref item = self->f_get(self, i, j);
@@ -241,6 +560,11 @@ static bool array2d_like_all(int argc, py_Ref argv) {
 static bool array2d_like_any(int argc, py_Ref argv) {
     PY_CHECK_ARGC(1);
     c11_array2d_like* self = py_touserdata(argv);
+    c11_array2d* typed = c11_array2d__typed(argv);
+    if(typed != NULL && typed->dtype == c11_array2d_bool) {
+        py_newbool(py_retval(), memchr(typed->buffer, 1, self->numel) != NULL);
+        return true;
+    }
     for(int j = 0; j < self->n_rows; j++) {
         for(int i = 0; i < self->n_cols; i++) {
             py_Ref item = self->f_get(self, i, j);
@@ -265,7 +589,7 @@ static bool array2d_like_map(int argc, py_Ref argv) {
         for(int i = 0; i < self->n_cols; i++) {
             py_Ref item = self->f_get(self, i, j);
             if(!py_call(f, 1, item)) return false;
-            res->data[j * self->n_cols + i] = *py_retval();
+            c11_array2d__set(res, i, j, py_retval());
         }
     }
     py_assign(py_retval(), py_peek(-1));
@@ -302,6 +626,71 @@ static bool _array2d_like_check_same_shape(c11_array2d_like* self, c11_array2d_l
     return _check_same_shape(self->n_cols, self->n_rows, other->n_cols, other->n_rows);
 }
 
+// `lhs op rhs` on packed buffers, returns 0 if the operands need the generic path
+static int _array2d_typed_binaryop(py_Ref lhs, py_Ref rhs, int op) {
+    c11_array2d* a = c11_array2d__typed(lhs);
+    if(a == NULL) return 0;
+    c11_array2d* b = NULL;
+    c11_array2d_dtype ta = a->dtype, tb;
+    if(py_isinstance(rhs, tp_array2d_like)) {
+        b = c11_array2d__typed(rhs);
+        if(b == NULL) return 0;
+        if(!_array2d_like_check_same_shape(&a->header, &b->header)) return -1;
+        tb = b->dtype;
+    } else if(py_isint(rhs)) {
+        py_i64 x = py_toint(rhs);
+        if(x < INT32_MIN || x > INT32_MAX) return 0;
+        tb = c11_array2d_int32;
+    } else if(py_isfloat(rhs)) {
+        tb = c11_array2d_float32;
+    } else if(py_isbool(rhs)) {
+        tb = c11_array2d_bool;
+    } else {
+        return 0;
+    }
+
+    // bool arrays only support logical operators, ints are computed as int32
+    c11_array2d_dtype tc;
+    const c11_array2d_kernel* kernels;
+    if(ta == c11_array2d_bool || tb == c11_array2d_bool) {
+        if(ta != tb) return 0;
+        tc = c11_array2d_bool;
+        kernels = _array2d_bool_kernels;
+    } else if(ta == c11_array2d_float32 || tb == c11_array2d_float32 || op == ARRAY2D_TRUEDIV) {
+        tc = c11_array2d_float32;
+        kernels = _array2d_float32_kernels;
+    } else {
+        tc = c11_array2d_int32;
+        kernels = _array2d_int32_kernels;
+    }
+    c11_array2d_kernel kernel = kernels[op];
+    if(kernel == NULL) return 0;
+
+    bool is_compare = op >= ARRAY2D_LT && op <= ARRAY2D_NE;
+    c11_array2d* res = c11_newarray2d_typed(py_pushtmp(),
+                                            a->header.n_cols,
+                                            a->header.n_rows,
+                                            is_compare ? c11_array2d_bool : tc);
+    if(!res) return false;
+    void* tmp_a = NULL;
+    void* tmp_b = NULL;
+    const void* pa = c11_array2d__as(a, tc, &tmp_a);
+    const void* pb;
+    c11_array2d_scalar scalar;
+    if(b != NULL) {
+        pb = c11_array2d__as(b, tc, &tmp_b);
+    } else {
+        c11_array2d__write(tc, &scalar, 0, rhs);
+        pb = &scalar;
+    }
+    kernel(res->buffer, pa, pb, a->header.numel, b == NULL);
+    PK_FREE(tmp_a);
+    PK_FREE(tmp_b);
+    py_assign(py_retval(), py_peek(-1));
+    py_pop();
+    return 1;
+}
+
 static bool _array2d_like_broadcasted_zip_with(int argc, py_Ref argv, py_Name op, py_Name rop) {
     PY_CHECK_ARGC(2);
     c11_array2d_like* self = py_touserdata(argv);
@@ -354,35 +743,65 @@ static bool array2d_like_zip_with(int argc, py_Ref argv) {
     return true;
 }
 
-#define DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(name, op, rop)                                            \
+// `typed_op` is -1 if typed arrays also use the generic path
+#define DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(name, op, rop, typed_op)                                  \
     static bool array2d_like##name(int argc, py_Ref argv) {                                        \
+        PY_CHECK_ARGC(2);                                                                          \
+        if(typed_op != -1) {                                                                       \
+            int res = _array2d_typed_binaryop(argv, py_arg(1), typed_op);                          \
+            if(res != 0) return res == 1;                                                          \
+        }                                                                                          \
         return _array2d_like_broadcasted_zip_with(argc, argv, op, rop);                            \
     }
 
-DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__le__, __le__, __ge__)
-DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__lt__, __lt__, __gt__)
-DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__ge__, __ge__, __le__)
-DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__gt__, __gt__, __lt__)
-DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__eq__, __eq__, __eq__)
-DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__ne__, __ne__, __ne__)
-
-DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__add__, __add__, __radd__)
-DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__sub__, __sub__, __rsub__)
-DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__mul__, __mul__, __rmul__)
-DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__truediv__, __truediv__, __rtruediv__)
-DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__floordiv__, __floordiv__, __rfloordiv__)
-DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__mod__, __mod__, __rmod__)
-DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__pow__, __pow__, __rpow__)
-
-DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__and__, __and__, 0)
-DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__or__, __or__, 0)
-DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__xor__, __xor__, 0)
+DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__le__, __le__, __ge__, ARRAY2D_LE)
+DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__lt__, __lt__, __gt__, ARRAY2D_LT)
+DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__ge__, __ge__, __le__, ARRAY2D_GE)
+DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__gt__, __gt__, __lt__, ARRAY2D_GT)
+DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__eq__, __eq__, __eq__, ARRAY2D_EQ)
+DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__ne__, __ne__, __ne__, ARRAY2D_NE)
+
+DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__add__, __add__, __radd__, ARRAY2D_ADD)
+DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__sub__, __sub__, __rsub__, ARRAY2D_SUB)
+DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__mul__, __mul__, __rmul__, ARRAY2D_MUL)
+DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__truediv__, __truediv__, __rtruediv__, ARRAY2D_TRUEDIV)
+DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__floordiv__, __floordiv__, __rfloordiv__, -1)
+DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__mod__, __mod__, __rmod__, -1)
+DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__pow__, __pow__, __rpow__, -1)
+
+DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__and__, __and__, 0, ARRAY2D_AND)
+DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__or__, __or__, 0, ARRAY2D_OR)
+DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH(__xor__, __xor__, 0, ARRAY2D_XOR)
 
 #undef DEF_ARRAY2D_LIKE__MAGIC_ZIP_WITH
 
 static bool array2d_like__invert__(int argc, py_Ref argv) {
     PY_CHECK_ARGC(1);
     c11_array2d_like* self = py_touserdata(argv);
+    c11_array2d* typed = c11_array2d__typed(argv);
+    if(typed != NULL && typed->dtype != c11_array2d_float32) {
+        c11_array2d* res =
+            c11_newarray2d_typed(py_retval(), self->n_cols, self->n_rows, typed->dtype);
+        if(!res) return false;
+        int n = self->numel;
+        if(typed->dtype == c11_array2d_int8) {
+            const int8_t* restrict src = typed->buffer;
+            int8_t* restrict dst = res->buffer;
+            for(int i = 0; i < n; i++)
+                dst[i] = ~src[i];
+        } else if(typed->dtype == c11_array2d_int32) {
+            const int32_t* restrict src = typed->buffer;
+            int32_t* restrict dst = res->buffer;
+            for(int i = 0; i < n; i++)
+                dst[i] = ~src[i];
+        } else {
+            const uint8_t* restrict src = typed->buffer;
+            uint8_t* restrict dst = res->buffer;
+            for(int i = 0; i < n; i++)
+                dst[i] = !src[i];
+        }
+        return true;
+    }
     c11_array2d* res = c11_newarray2d(py_pushtmp(), self->n_cols, self->n_rows);
     for(int j = 0; j < self->n_rows; j++) {
         for(int i = 0; i < self->n_cols; i++) {
@@ -400,6 +819,14 @@ static bool array2d_like_copy(int argc, py_Ref argv) {
     // def copy(self) -> 'array2d': ...
     PY_CHECK_ARGC(1);
     c11_array2d_like* self = py_touserdata(argv);
+    c11_array2d* typed = c11_array2d__typed(argv);
+    if(typed != NULL) {
+        c11_array2d* res =
+            c11_newarray2d_typed(py_retval(), self->n_cols, self->n_rows, typed->dtype);
+        if(!res) return false;
+        memcpy(res->buffer, typed->buffer, c11_array2d__external_bytes(typed));
+        return true;
+    }
     c11_array2d* res = c11_newarray2d(py_retval(), self->n_cols, self->n_rows);
     for(int j = 0; j < self->n_rows; j++) {
         for(int i = 0; i < self->n_cols; i++) {
@@ -410,6 +837,25 @@ static bool array2d_like_copy(int argc, py_Ref argv) {
     return true;
 }
 
+// astype(self, dtype: str | None) -> array2d
+static bool array2d_like_astype(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    c11_array2d_like* self = py_touserdata(argv);
+    c11_array2d_dtype dtype;
+    if(!c11_array2d_dtype__parse(py_arg(1), &dtype)) return false;
+    c11_array2d* res = c11_newarray2d_typed(py_pushtmp(), self->n_cols, self->n_rows, dtype);
+    if(!res) return false;
+    for(int j = 0; j < self->n_rows; j++) {
+        for(int i = 0; i < self->n_cols; i++) {
+            py_Ref item = self->f_get(self, i, j);
+            if(!res->header.f_set(&res->header, i, j, item)) return false;
+        }
+    }
+    py_assign(py_retval(), py_peek(-1));
+    py_pop();
+    return true;
+}
+
 static bool array2d_like_tolist(int argc, py_Ref argv) {
     PY_CHECK_ARGC(1);
     c11_array2d_like* self = py_touserdata(argv);
@@ -669,6 +1115,16 @@ static bool array2d_like__setitem__(int argc, py_Ref argv) {
 static bool array2d_like_count(int argc, py_Ref argv) {
     PY_CHECK_ARGC(2);
     c11_array2d_like* self = py_touserdata(argv);
+    c11_array2d* typed = c11_array2d__typed(argv);
+    uint8_t* mask = typed ? c11_array2d__eq_mask(typed, py_arg(1)) : NULL;
+    if(mask != NULL) {
+        int count = 0;
+        for(int i = 0; i < self->numel; i++)
+            count += mask[i];
+        PK_FREE(mask);
+        py_newint(py_retval(), count);
+        return true;
+    }
     int count = 0;
     for(int j = 0; j < self->n_rows; j++) {
         for(int i = 0; i < self->n_cols; i++) {
@@ -717,14 +1173,7 @@ static bool array2d_like_get_bounding_rect(int argc, py_Ref argv) {
     return true;
 }
 
-// count_neighbors(self, value: T, neighborhood: Neighborhood) -> array2d[int]
-static bool array2d_like_count_neighbors(int argc, py_Ref argv) {
-    PY_CHECK_ARGC(3);
-    c11_array2d_like* self = py_touserdata(argv);
-    c11_array2d* res = c11_newarray2d(py_pushtmp(), self->n_cols, self->n_rows);
-    py_Ref value = py_arg(1);
-    const char* neighborhood = py_tostr(py_arg(2));
-
+static bool _array2d_neighborhood(py_Ref name, const c11_vec2i** offsets, int* n_offsets) {
     const static c11_vec2i Moore[] = {
         {{-1, -1}},
         {{0, -1}},
@@ -743,17 +1192,54 @@ static bool array2d_like_count_neighbors(int argc, py_Ref argv) {
         {{0, 1}},
     };
 
-    const c11_vec2i* offsets;
-    int n_offsets;
+    if(!py_checkstr(name)) return false;
+    const char* neighborhood = py_tostr(name);
     if(strcmp(neighborhood, "Moore") == 0) {
-        offsets = Moore;
-        n_offsets = c11__count_array(Moore);
+        *offsets = Moore;
+        *n_offsets = c11__count_array(Moore);
     } else if(strcmp(neighborhood, "von Neumann") == 0) {
-        offsets = von_Neumann;
-        n_offsets = c11__count_array(von_Neumann);
+        *offsets = von_Neumann;
+        *n_offsets = c11__count_array(von_Neumann);
     } else {
         return ValueError("neighborhood must be 'Moore' or 'von Neumann'");
     }
+    return true;
+}
+
+// count_neighbors(self, value: T, neighborhood: Neighborhood) -> array2d[int]
+static bool array2d_like_count_neighbors(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(3);
+    c11_array2d_like* self = py_touserdata(argv);
+    py_Ref value = py_arg(1);
+    const c11_vec2i* offsets;
+    int n_offsets;
+    if(!_array2d_neighborhood(py_arg(2), &offsets, &n_offsets)) return false;
+    c11_array2d* typed = c11_array2d__typed(argv);
+    uint8_t* mask = typed ? c11_array2d__eq_mask(typed, value) : NULL;
+    if(mask != NULL) {
+        // add the mask shifted by each offset to the interior it overlaps
+        int n_cols = self->n_cols;
+        c11_array2d* counts =
+            c11_newarray2d_typed(py_retval(), n_cols, self->n_rows, c11_array2d_int32);
+        if(!counts) {
+            PK_FREE(mask);
+            return false;
+        }
+        int32_t* restrict out = counts->buffer;
+        for(int k = 0; k < n_offsets; k++) {
+            int dx = offsets[k].x, dy = offsets[k].y;
+            int i0 = c11__max(0, -dx), i1 = n_cols - c11__max(0, dx);
+            for(int j = c11__max(0, -dy); j < self->n_rows - c11__max(0, dy); j++) {
+                int32_t* restrict dst = out + j * n_cols;
+                const uint8_t* restrict src = mask + (j + dy) * n_cols + dx;
+                for(int i = i0; i < i1; i++)
+                    dst[i] += src[i];
+            }
+        }
+        PK_FREE(mask);
+        return true;
+    }
+    c11_array2d* res = c11_newarray2d(py_pushtmp(), self->n_cols, self->n_rows);
     for(int j = 0; j < self->n_rows; j++) {
         for(int i = 0; i < self->n_cols; i++) {
             py_i64 count = 0;
@@ -775,6 +1261,101 @@ static bool array2d_like_count_neighbors(int argc, py_Ref argv) {
     return true;
 }
 
+// the source padded by `ksize / 2` on each side, then the kernel is added one shifted copy
+// at a time. returns 0 if the generic path is needed
+static int _array2d_typed_convolve(c11_array2d* self, c11_array2d_like* kernel, int32_t padding) {
+    int ksize = kernel->n_cols;
+    int half = ksize / 2;
+    int32_t* k = PK_MALLOC(sizeof(int32_t) * ksize * ksize);
+    int64_t k_abs_sum = 0;
+    for(int jj = 0; jj < ksize; jj++) {
+        for(int ii = 0; ii < ksize; ii++) {
+            py_Ref kitem = kernel->f_get(kernel, ii, jj);
+            if(!py_checkint(kitem)) {
+                PK_FREE(k);
+                return -1;
+            }
+            py_i64 kv = py_toint(kitem);
+            if(kv < INT32_MIN || kv > INT32_MAX) {
+                PK_FREE(k);
+                return 0;
+            }
+            k[jj * ksize + ii] = (int32_t)kv;
+            k_abs_sum += kv < 0 ? -kv : kv;
+        }
+    }
+
+    int n_cols = self->header.n_cols, n_rows = self->header.n_rows;
+    int p_cols = n_cols + 2 * half, p_rows = n_rows + 2 * half;
+    int32_t* padded = PK_MALLOC(sizeof(int32_t) * p_cols * p_rows);
+    int64_t max_abs = padding < 0 ? -(int64_t)padding : padding;
+    for(int i = 0; i < p_cols * p_rows; i++)
+        padded[i] = padding;
+    for(int j = 0; j < n_rows; j++) {
+        int32_t* restrict dst = padded + (j + half) * p_cols + half;
+        if(self->dtype == c11_array2d_int8) {
+            const int8_t* restrict src = (const int8_t*)self->buffer + j * n_cols;
+            for(int i = 0; i < n_cols; i++)
+                dst[i] = src[i];
+        } else {
+            memcpy(dst, (const int32_t*)self->buffer + j * n_cols, sizeof(int32_t) * n_cols);
+        }
+    }
+    for(int i = 0; i < n_cols * n_rows; i++) {
+        int32_t x = self->dtype == c11_array2d_int8 ? ((const int8_t*)self->buffer)[i]
+                                                    : ((const int32_t*)self->buffer)[i];
+        int64_t x_abs = x < 0 ? -(int64_t)x : x;
+        if(x_abs > max_abs) max_abs = x_abs;
+    }
+
+    int n = n_cols * n_rows;
+    // sums are exact, in int32 when they are known to fit
+    bool fits_int32 = k_abs_sum == 0 || max_abs <= INT32_MAX / k_abs_sum;
+    if(fits_int32) {
+        c11_array2d* res = c11_newarray2d_typed(py_retval(), n_cols, n_rows, c11_array2d_int32);
+        if(!res) {
+            PK_FREE(padded);
+            PK_FREE(k);
+            return -1;
+        }
+        int32_t* out = res->buffer;
+        for(int jj = 0; jj < ksize; jj++) {
+            for(int ii = 0; ii < ksize; ii++) {
+                int32_t kv = k[jj * ksize + ii];
+                if(kv == 0) continue;
+                for(int j = 0; j < n_rows; j++) {
+                    int32_t* restrict dst = out + j * n_cols;
+                    const int32_t* restrict src = padded + (j + jj) * p_cols + ii;
+                    for(int i = 0; i < n_cols; i++)
+                        dst[i] += kv * src[i];
+                }
+            }
+        }
+    } else {
+        int64_t* out = PK_MALLOC(sizeof(int64_t) * n);
+        memset(out, 0, sizeof(int64_t) * n);
+        for(int jj = 0; jj < ksize; jj++) {
+            for(int ii = 0; ii < ksize; ii++) {
+                int64_t kv = k[jj * ksize + ii];
+                if(kv == 0) continue;
+                for(int j = 0; j < n_rows; j++) {
+                    int64_t* restrict dst = out + j * n_cols;
+                    const int32_t* restrict src = padded + (j + jj) * p_cols + ii;
+                    for(int i = 0; i < n_cols; i++)
+                        dst[i] += kv * src[i];
+                }
+            }
+        }
+        c11_array2d* res = c11_newarray2d(py_retval(), n_cols, n_rows);
+        for(int i = 0; i < n; i++)
+            py_newint(&res->data[i], out[i]);
+        PK_FREE(out);
+    }
+    PK_FREE(padded);
+    PK_FREE(k);
+    return 1;
+}
+
 // convolve(self: array2d_like[int], kernel: array2d_like[int], padding: int) -> array2d[int]
 static bool array2d_like_convolve(int argc, py_Ref argv) {
     PY_CHECK_ARGC(3);
@@ -787,6 +1368,12 @@ static bool array2d_like_convolve(int argc, py_Ref argv) {
     int ksize = kernel->n_cols;
     if(ksize % 2 == 0) return ValueError("kernel size must be odd");
     int ksize_half = ksize / 2;
+    c11_array2d* typed = c11_array2d__typed(argv);
+    if(typed != NULL && typed->dtype != c11_array2d_float32 && typed->dtype != c11_array2d_bool &&
+       padding >= INT32_MIN && padding <= INT32_MAX) {
+        int res = _array2d_typed_convolve(typed, kernel, (int32_t)padding);
+        if(res != 0) return res == 1;
+    }
     c11_array2d* res = c11_newarray2d(py_pushtmp(), self->n_cols, self->n_rows);
     for(int j = 0; j < self->n_rows; j++) {
         for(int i = 0; i < self->n_cols; i++) {
@@ -819,6 +1406,426 @@ static bool array2d_like_convolve(int argc, py_Ref argv) {
 
 #undef HANDLE_SLICE
 
+/* grid algorithms */
+
+enum {
+    ARRAY2D_CELL_PASSABLE = 1,
+    ARRAY2D_CELL_BLOCKED = 2,
+    ARRAY2D_CELL_SEEN = 4,
+    ARRAY2D_CELL_CLOSED = 8,
+};
+
+// tests whether cells can be walked on, each cell is tested once and cached in `state`
+typedef struct {
+    c11_array2d_like* grid;
+    py_Ref passable;  // a value equal to the passable cells, or a predicate
+    bool is_predicate;
+    py_Ref tmp;
+    uint8_t* state;
+} c11_array2d_walker;
+
+// `tmp` is a stack slot owned by the walker
+static void c11_array2d_walker__ctor(c11_array2d_walker* self,
+                                     py_Ref grid,
+                                     py_Ref passable,
+                                     bool is_predicate,
+                                     py_Ref tmp) {
+    self->grid = py_touserdata(grid);
+    self->passable = passable;
+    self->is_predicate = is_predicate;
+    self->tmp = tmp;
+    int n = self->grid->numel;
+    self->state = PK_MALLOC(n);
+    c11_array2d* typed = is_predicate ? NULL : c11_array2d__typed(grid);
+    uint8_t* mask = typed ? c11_array2d__eq_mask(typed, passable) : NULL;
+    if(mask != NULL) {
+        for(int i = 0; i < n; i++)
+            self->state[i] = mask[i] ? ARRAY2D_CELL_PASSABLE : ARRAY2D_CELL_BLOCKED;
+        PK_FREE(mask);
+    } else {
+        memset(self->state, 0, n);
+    }
+}
+
+static void c11_array2d_walker__dtor(c11_array2d_walker* self) { PK_FREE(self->state); }
+
+// returns -1 on error
+static int c11_array2d_walker__test(c11_array2d_walker* self, int col, int row) {
+    int index = row * self->grid->n_cols + col;
+    int state = self->state[index] & (ARRAY2D_CELL_PASSABLE | ARRAY2D_CELL_BLOCKED);
+    if(state != 0) return state == ARRAY2D_CELL_PASSABLE;
+    py_assign(self->tmp, self->grid->f_get(self->grid, col, row));
+    int res;
+    if(self->is_predicate) {
+        if(!py_call(self->passable, 1, self->tmp)) return -1;
+        res = py_bool(py_retval());
+    } else {
+        res = py_equal(self->tmp, self->passable);
+    }
+    if(res == -1) return -1;
+    self->state[index] |= res ? ARRAY2D_CELL_PASSABLE : ARRAY2D_CELL_BLOCKED;
+    return res;
+}
+
+// breadth-first search from `queue[head:*tail]`, `dist` of unvisited cells is -1
+static bool _array2d_bfs(c11_array2d_walker* walker,
+                         const c11_vec2i* offsets,
+                         int n_offsets,
+                         int32_t* dist,
+                         int* queue,
+                         int head,
+                         int* tail) {
+    int n_cols = walker->grid->n_cols;
+    while(head < *tail) {
+        int u = queue[head++];
+        int col = u % n_cols, row = u / n_cols;
+        for(int k = 0; k < n_offsets; k++) {
+            int vcol = col + offsets[k].x, vrow = row + offsets[k].y;
+            if(!c11_array2d_like_is_valid(walker->grid, vcol, vrow)) continue;
+            int v = vrow * n_cols + vcol;
+            if(dist[v] != -1) continue;
+            int res = c11_array2d_walker__test(walker, vcol, vrow);
+            if(res == -1) return false;
+            if(res == 0) continue;
+            dist[v] = dist[u] + 1;
+            queue[(*tail)++] = v;
+        }
+    }
+    return true;
+}
+
+// get_connected_components(self, value: T, neighborhood: Neighborhood) -> tuple[array2d[int], int]
+static bool array2d_like_get_connected_components(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(3);
+    c11_array2d_like* self = py_touserdata(argv);
+    const c11_vec2i* offsets;
+    int n_offsets;
+    if(!_array2d_neighborhood(py_arg(2), &offsets, &n_offsets)) return false;
+    c11_array2d_walker walker;
+    c11_array2d_walker__ctor(&walker, argv, py_arg(1), false, py_pushtmp());
+    int n = self->numel;
+    int32_t* dist = PK_MALLOC(sizeof(int32_t) * n);
+    int32_t* labels = PK_MALLOC(sizeof(int32_t) * n);
+    int* queue = PK_MALLOC(sizeof(int) * n);
+    memset(dist, -1, sizeof(int32_t) * n);
+    memset(labels, 0, sizeof(int32_t) * n);
+    // every cell is queued at most once, so components share the queue
+    int tail = 0;
+    int count = 0;
+    for(int j = 0; j < self->n_rows; j++) {
+        for(int i = 0; i < self->n_cols; i++) {
+            int index = j * self->n_cols + i;
+            if(dist[index] != -1) continue;
+            int res = c11_array2d_walker__test(&walker, i, j);
+            if(res == -1) goto __ERROR;
+            if(res == 0) continue;
+            count++;
+            int head = tail;
+            dist[index] = 0;
+            queue[tail++] = index;
+            if(!_array2d_bfs(&walker, offsets, n_offsets, dist, queue, head, &tail)) goto __ERROR;
+            for(int k = head; k < tail; k++)
+                labels[queue[k]] = count;
+        }
+    }
+    c11_array2d* res = c11_newarray2d(py_peek(-1), self->n_cols, self->n_rows);
+    for(int i = 0; i < n; i++)
+        py_newint(&res->data[i], labels[i]);
+    py_TValue* data = py_newtuple(py_retval(), 2);
+    py_assign(&data[0], py_peek(-1));
+    py_newint(&data[1], count);
+    py_pop();
+    c11_array2d_walker__dtor(&walker);
+    PK_FREE(dist);
+    PK_FREE(labels);
+    PK_FREE(queue);
+    return true;
+__ERROR:
+    c11_array2d_walker__dtor(&walker);
+    PK_FREE(dist);
+    PK_FREE(labels);
+    PK_FREE(queue);
+    return false;
+}
+
+// get_distance_field(self, sources, passable, neighborhood='von Neumann') -> array2d[int]
+static bool array2d_like_get_distance_field(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(4);
+    c11_array2d_like* self = py_touserdata(argv);
+    const c11_vec2i* offsets;
+    int n_offsets;
+    if(!_array2d_neighborhood(py_arg(3), &offsets, &n_offsets)) return false;
+    py_Ref sources = py_arg(1);
+    py_TValue* p;
+    int n_sources;
+    if(py_istype(sources, tp_vec2i)) {
+        p = sources;
+        n_sources = 1;
+    } else {
+        n_sources = pk_arrayview(sources, &p);
+        if(n_sources == -1) {
+            return TypeError("expected 'vec2i' or a list of 'vec2i', got '%t'", sources->type);
+        }
+    }
+    for(int k = 0; k < n_sources; k++) {
+        if(!py_checktype(&p[k], tp_vec2i)) return false;
+        c11_vec2i pos = py_tovec2i(&p[k]);
+        if(!c11_array2d_like_is_valid(self, pos.x, pos.y)) {
+            return _array2d_like_IndexError(self, pos.x, pos.y);
+        }
+    }
+
+    py_Ref passable = py_arg(2);
+    c11_array2d_walker walker;
+    c11_array2d_walker__ctor(&walker, argv, passable, py_callable(passable), py_pushtmp());
+    c11_array2d* res =
+        c11_newarray2d_typed(py_pushtmp(), self->n_cols, self->n_rows, c11_array2d_int32);
+    if(!res) return false;
+    int32_t* dist = res->buffer;
+    memset(dist, -1, sizeof(int32_t) * self->numel);
+    int* queue = PK_MALLOC(sizeof(int) * self->numel);
+    int tail = 0;
+    // sources are reached even if they are not passable
+    for(int k = 0; k < n_sources; k++) {
+        c11_vec2i pos = py_tovec2i(&p[k]);
+        int index = pos.y * self->n_cols + pos.x;
+        if(dist[index] == -1) {
+            dist[index] = 0;
+            queue[tail++] = index;
+        }
+    }
+    bool ok = _array2d_bfs(&walker, offsets, n_offsets, dist, queue, 0, &tail);
+    c11_array2d_walker__dtor(&walker);
+    PK_FREE(queue);
+    if(!ok) return false;
+    py_assign(py_retval(), py_peek(-1));
+    py_shrink(2);
+    return true;
+}
+
+// flood_fill(self, pos: vec2i, neighborhood='von Neumann') -> array2d[bool]
+static bool array2d_like_flood_fill(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(3);
+    PY_CHECK_ARG_TYPE(1, tp_vec2i);
+    c11_array2d_like* self = py_touserdata(argv);
+    c11_vec2i pos = py_tovec2i(py_arg(1));
+    if(!c11_array2d_like_is_valid(self, pos.x, pos.y)) {
+        return _array2d_like_IndexError(self, pos.x, pos.y);
+    }
+    const c11_vec2i* offsets;
+    int n_offsets;
+    if(!_array2d_neighborhood(py_arg(2), &offsets, &n_offsets)) return false;
+    // `f_get` may return a temporary, so the value is copied
+    py_StackRef value = py_pushtmp();
+    py_assign(value, self->f_get(self, pos.x, pos.y));
+    c11_array2d_walker walker;
+    c11_array2d_walker__ctor(&walker, argv, value, false, py_pushtmp());
+    int n = self->numel;
+    int32_t* dist = PK_MALLOC(sizeof(int32_t) * n);
+    int* queue = PK_MALLOC(sizeof(int) * n);
+    memset(dist, -1, sizeof(int32_t) * n);
+    int tail = 0;
+    int index = pos.y * self->n_cols + pos.x;
+    dist[index] = 0;
+    queue[tail++] = index;
+    bool ok = _array2d_bfs(&walker, offsets, n_offsets, dist, queue, 0, &tail);
+    if(ok) {
+        c11_array2d* res =
+            c11_newarray2d_typed(py_retval(), self->n_cols, self->n_rows, c11_array2d_bool);
+        ok = res != NULL;
+        for(int k = 0; ok && k < tail; k++)
+            ((uint8_t*)res->buffer)[queue[k]] = 1;
+    }
+    c11_array2d_walker__dtor(&walker);
+    PK_FREE(dist);
+    PK_FREE(queue);
+    if(!ok) return false;
+    py_shrink(2);
+    return true;
+}
+
+typedef struct {
+    double f;
+    double h;
+    int index;
+} c11_astar_node;
+
+static bool c11_astar_node__lt(const c11_astar_node* a, const c11_astar_node* b) {
+    if(a->f != b->f) return a->f < b->f;
+    return a->h < b->h;
+}
+
+static void _astar_heap_push(c11_vector* heap, c11_astar_node node) {
+    c11_vector__push(c11_astar_node, heap, node);
+    c11_astar_node* p = heap->data;
+    int i = heap->length - 1;
+    while(i > 0) {
+        int parent = (i - 1) / 2;
+        if(!c11_astar_node__lt(&node, &p[parent])) break;
+        p[i] = p[parent];
+        i = parent;
+    }
+    p[i] = node;
+}
+
+static c11_astar_node _astar_heap_pop(c11_vector* heap) {
+    c11_astar_node* p = heap->data;
+    c11_astar_node top = p[0];
+    c11_astar_node last = p[--heap->length];
+    int n = heap->length;
+    int i = 0;
+    while(true) {
+        int child = 2 * i + 1;
+        if(child >= n) break;
+        if(child + 1 < n && c11_astar_node__lt(&p[child + 1], &p[child])) child++;
+        if(!c11_astar_node__lt(&p[child], &last)) break;
+        p[i] = p[child];
+        i = child;
+    }
+    if(n > 0) p[i] = last;
+    return top;
+}
+
+typedef struct {
+    c11_array2d_walker* walker;
+    const c11_vec2i* offsets;
+    int n_offsets;
+    const double* costs;  // NULL if every step costs 1
+    double min_cost;
+    c11_vec2i goal;
+    double* g;
+    int* parent;
+    c11_vector heap;
+} c11_astar;
+
+static double c11_astar__h(c11_astar* self, int col, int row) {
+    int dx = abs(col - self->goal.x), dy = abs(row - self->goal.y);
+    // diagonal steps cost the same as straight ones
+    int steps = self->n_offsets == 8 ? c11__max(dx, dy) : dx + dy;
+    return steps * self->min_cost;
+}
+
+// returns 1 if the goal is reached, 0 if it is unreachable and -1 on error
+static int c11_astar__run(c11_astar* self, c11_vec2i start) {
+    c11_array2d_like* grid = self->walker->grid;
+    uint8_t* state = self->walker->state;
+    int n_cols = grid->n_cols;
+    int s = start.y * n_cols + start.x;
+    int t = self->goal.y * n_cols + self->goal.x;
+    double h = c11_astar__h(self, start.x, start.y);
+    state[s] |= ARRAY2D_CELL_SEEN;
+    self->g[s] = 0;
+    self->parent[s] = -1;
+    _astar_heap_push(&self->heap, (c11_astar_node){h, h, s});
+    while(self->heap.length > 0) {
+        int u = _astar_heap_pop(&self->heap).index;
+        // stale entries of improved cells
+        if(state[u] & ARRAY2D_CELL_CLOSED) continue;
+        state[u] |= ARRAY2D_CELL_CLOSED;
+        if(u == t) return 1;
+        int col = u % n_cols, row = u / n_cols;
+        for(int k = 0; k < self->n_offsets; k++) {
+            int vcol = col + self->offsets[k].x, vrow = row + self->offsets[k].y;
+            if(!c11_array2d_like_is_valid(grid, vcol, vrow)) continue;
+            int v = vrow * n_cols + vcol;
+            if(state[v] & ARRAY2D_CELL_CLOSED) continue;
+            int res = c11_array2d_walker__test(self->walker, vcol, vrow);
+            if(res == -1) return -1;
+            if(res == 0) continue;
+            double g = self->g[u] + (self->costs ? self->costs[v] : 1);
+            if((state[v] & ARRAY2D_CELL_SEEN) && g >= self->g[v]) continue;
+            state[v] |= ARRAY2D_CELL_SEEN;
+            self->g[v] = g;
+            self->parent[v] = u;
+            h = c11_astar__h(self, vcol, vrow);
+            _astar_heap_push(&self->heap, (c11_astar_node){g + h, h, v});
+        }
+    }
+    return 0;
+}
+
+// find_path(self, start: vec2i, goal: vec2i, passable=None, neighborhood='von Neumann')
+static bool array2d_like_find_path(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(5);
+    PY_CHECK_ARG_TYPE(1, tp_vec2i);
+    PY_CHECK_ARG_TYPE(2, tp_vec2i);
+    c11_array2d_like* self = py_touserdata(argv);
+    c11_vec2i start = py_tovec2i(py_arg(1));
+    c11_vec2i goal = py_tovec2i(py_arg(2));
+    if(!c11_array2d_like_is_valid(self, start.x, start.y)) {
+        return _array2d_like_IndexError(self, start.x, start.y);
+    }
+    if(!c11_array2d_like_is_valid(self, goal.x, goal.y)) {
+        return _array2d_like_IndexError(self, goal.x, goal.y);
+    }
+    c11_astar astar;
+    if(!_array2d_neighborhood(py_arg(4), &astar.offsets, &astar.n_offsets)) return false;
+    py_Ref passable = py_arg(3);
+    c11_array2d_walker walker;
+    c11_array2d_walker__ctor(&walker, argv, passable, py_callable(passable), py_pushtmp());
+    int n = self->numel;
+    astar.walker = &walker;
+    astar.costs = NULL;
+    astar.min_cost = 1;
+    astar.goal = goal;
+    astar.g = PK_MALLOC(sizeof(double) * n);
+    astar.parent = PK_MALLOC(sizeof(int) * n);
+    c11_vector__ctor(&astar.heap, sizeof(c11_astar_node));
+    double* costs = NULL;
+    if(py_isnone(passable)) {
+        // the cells are the costs of entering them, negative costs block them
+        costs = PK_MALLOC(sizeof(double) * n);
+        astar.min_cost = -1;
+        for(int j = 0; j < self->n_rows; j++) {
+            for(int i = 0; i < self->n_cols; i++) {
+                int index = j * self->n_cols + i;
+                if(!py_castfloat(self->f_get(self, i, j), &costs[index])) goto __ERROR;
+                if(costs[index] < 0) {
+                    walker.state[index] = ARRAY2D_CELL_BLOCKED;
+                } else {
+                    walker.state[index] = ARRAY2D_CELL_PASSABLE;
+                    if(astar.min_cost < 0 || costs[index] < astar.min_cost) {
+                        astar.min_cost = costs[index];
+                    }
+                }
+            }
+        }
+        if(astar.min_cost < 0) astar.min_cost = 0;
+        astar.costs = costs;
+    }
+    int res = c11_astar__run(&astar, start);
+    if(res == -1) goto __ERROR;
+    if(res == 0) {
+        py_newnone(py_retval());
+    } else {
+        int t = goal.y * self->n_cols + goal.x;
+        int length = 0;
+        for(int u = t; u != -1; u = astar.parent[u])
+            length++;
+        py_newlistn(py_retval(), length);
+        for(int u = t; u != -1; u = astar.parent[u]) {
+            c11_vec2i pos = {
+                {u % self->n_cols, u / self->n_cols}
+            };
+            py_newvec2i(py_list_getitem(py_retval(), --length), pos);
+        }
+    }
+    py_pop();
+    c11_array2d_walker__dtor(&walker);
+    c11_vector__dtor(&astar.heap);
+    PK_FREE(astar.g);
+    PK_FREE(astar.parent);
+    PK_FREE(costs);
+    return true;
+__ERROR:
+    c11_array2d_walker__dtor(&walker);
+    c11_vector__dtor(&astar.heap);
+    PK_FREE(astar.g);
+    PK_FREE(astar.parent);
+    PK_FREE(costs);
+    return false;
+}
+
 static void register_array2d_like(py_Ref mod) {
     py_Type type = py_newtype("array2d_like", tp_object, mod, NULL);
     assert(type == tp_array2d_like);
@@ -844,6 +1851,7 @@ static void register_array2d_like(py_Ref mod) {
     py_bindmethod(type, "apply", array2d_like_apply);
     py_bindmethod(type, "zip_with", array2d_like_zip_with);
     py_bindmethod(type, "copy", array2d_like_copy);
+    py_bindmethod(type, "astype", array2d_like_astype);
     py_bindmethod(type, "tolist", array2d_like_tolist);
 
     py_bindmagic(type, __le__, array2d_like__le__);
@@ -876,13 +1884,16 @@ static void register_array2d_like(py_Ref mod) {
     py_bindmethod(type, "get_bounding_rect", array2d_like_get_bounding_rect);
     py_bindmethod(type, "count_neighbors", array2d_like_count_neighbors);
     py_bindmethod(type, "convolve", array2d_like_convolve);
-
-    const char* scc =
-        "\ndef get_connected_components(self, value: T, neighborhood: Neighborhood) -> tuple[array2d[int], int]:\n    from collections import deque\n    from vmath import vec2i\n\n    DIRS = [vec2i.LEFT, vec2i.RIGHT, vec2i.UP, vec2i.DOWN]\n    assert neighborhood in ['Moore', 'von Neumann']\n\n    if neighborhood == 'Moore':\n        DIRS.extend([\n            vec2i.LEFT+vec2i.UP,\n            vec2i.RIGHT+vec2i.UP,\n            vec2i.LEFT+vec2i.DOWN,\n            vec2i.RIGHT+vec2i.DOWN\n            ])\n\n    visited = array2d[int](self.width, self.height, default=0)\n    queue = deque()\n    count = 0\n    for y in range(self.height):\n        for x in range(self.width):\n            if visited[x, y] or self[x, y] != value:\n                continue\n            count += 1\n            queue.append((x, y))\n            visited[x, y] = count\n            while queue:\n                cx, cy = queue.popleft()\n                for dx, dy in DIRS:\n                    nx, ny = cx+dx, cy+dy\n                    if self.is_valid(nx, ny) and not visited[nx, ny] and self[nx, ny] == value:\n                        queue.append((nx, ny))\n                        visited[nx, ny] = count\n    return visited, count\n\narray2d_like.get_connected_components = get_connected_components\ndel get_connected_components\n";
-    if(!py_exec(scc, "array2d.py", EXEC_MODE, mod)) {
-        py_printexc();
-        c11__abort("failed to execute array2d.py");
-    }
+    py_bindmethod(type, "get_connected_components", array2d_like_get_connected_components);
+    py_bind(py_tpobject(type),
+            "get_distance_field(self, sources, passable, neighborhood='von Neumann')",
+            array2d_like_get_distance_field);
+    py_bind(py_tpobject(type),
+            "flood_fill(self, pos, neighborhood='von Neumann')",
+            array2d_like_flood_fill);
+    py_bind(py_tpobject(type),
+            "find_path(self, start, goal, passable=None, neighborhood='von Neumann')",
+            array2d_like_find_path);
 }
 
 bool array2d_like_iterator__next__(int argc, py_Ref argv) {
@@ -911,7 +1922,7 @@ static void register_array2d_like_iterator(py_Ref mod) {
 }
 
 static bool array2d__new__(int argc, py_Ref argv) {
-    // __new__(cls, n_cols: int, n_rows: int, default: Callable[[vec2i], T] = None)
+    // __new__(cls, n_cols: int, n_rows: int, default: Callable[[vec2i], T] = None, dtype=None)
     py_Ref default_ = py_arg(3);
     PY_CHECK_ARG_TYPE(0, tp_type);
     PY_CHECK_ARG_TYPE(1, tp_int);
@@ -919,6 +1930,37 @@ static bool array2d__new__(int argc, py_Ref argv) {
     int n_cols = argv[1]._i64;
     int n_rows = argv[2]._i64;
     if(n_cols <= 0 || n_rows <= 0) return ValueError("array2d() expected positive dimensions");
+    c11_array2d_dtype dtype;
+    if(!c11_array2d_dtype__parse(py_arg(4), &dtype)) return false;
+    if(dtype != c11_array2d_object) {
+        c11_array2d* ud = c11_newarray2d_typed(py_pushtmp(), n_cols, n_rows, dtype);
+        if(!ud) return false;
+        // typed arrays start with zeros
+        if(py_callable(default_)) {
+            for(int j = 0; j < n_rows; j++) {
+                for(int i = 0; i < n_cols; i++) {
+                    py_TValue tmp;
+                    py_newvec2i(&tmp,
+                                (c11_vec2i){
+                                    {i, j}
+                    });
+                    if(!py_call(default_, 1, &tmp)) return false;
+                    if(!c11_array2d__write(dtype, ud->buffer, j * n_cols + i, py_retval())) {
+                        return false;
+                    }
+                }
+            }
+        } else if(!py_isnone(default_)) {
+            if(!c11_array2d__write(dtype, ud->buffer, 0, default_)) return false;
+            int size = c11_array2d_dtype__itemsize(dtype);
+            for(int i = 1; i < ud->header.numel; i++) {
+                memcpy((char*)ud->buffer + i * size, ud->buffer, size);
+            }
+        }
+        py_assign(py_retval(), py_peek(-1));
+        py_pop();
+        return true;
+    }
     c11_array2d* ud = c11_newarray2d(py_pushtmp(), n_cols, n_rows);
     // setup initial values
     if(py_callable(default_)) {
@@ -930,7 +1972,7 @@ static bool array2d__new__(int argc, py_Ref argv) {
                                 {i, j}
                 });
                 if(!py_call(default_, 1, &tmp)) return false;
-                ud->data[j * n_cols + i] = *py_retval();
+                c11_array2d__set(ud, i, j, py_retval());
             }
         }
     } else {
@@ -971,12 +2013,25 @@ static bool array2d_fromlist_STATIC(int argc, py_Ref argv) {
     return true;
 }
 
+static bool array2d_dtype(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    c11_array2d* self = py_touserdata(argv);
+    const char* name = c11_array2d_dtype__name(self->dtype);
+    if(name == NULL) {
+        py_newnone(py_retval());
+    } else {
+        py_newstr(py_retval(), name);
+    }
+    return true;
+}
+
 static void register_array2d(py_Ref mod) {
-    py_Type type = py_newtype("array2d", tp_array2d_like, mod, NULL);
+    py_Type type = py_newtype("array2d", tp_array2d_like, mod, (py_Dtor)c11_array2d__dtor);
     assert(type == tp_array2d);
     py_bind(py_tpobject(type),
-            "__new__(cls, n_cols: int, n_rows: int, default=None)",
+            "__new__(cls, n_cols: int, n_rows: int, default=None, dtype=None)",
             array2d__new__);
+    py_bindproperty(type, "dtype", array2d_dtype, NULL);
     py_bindstaticmethod(type, "fromlist", array2d_fromlist_STATIC);
 }
 
@@ -1017,6 +2072,7 @@ static py_TValue* c11_chunked_array2d__new_chunk(c11_chunked_array2d* self, c11_
             PK_FREE(data);
             return NULL;
         }
+        pk__write_barrier_value(c11_array2d__owner(self), py_retval());
         data[0] = *py_retval();
     } else {
         data[0] = *py_None();
@@ -1091,6 +2147,7 @@ bool c11_chunked_array2d__set(c11_chunked_array2d* self, int col, int row, py_Re
         data = c11_chunked_array2d__new_chunk(self, chunk_pos);
         if(data == NULL) return false;
     }
+    pk__write_barrier_value(c11_array2d__owner(self), value);
     data[1 + local_pos.y * self->chunk_size + local_pos.x] = *value;
     return true;
 }
@@ -1463,11 +2520,11 @@ int py_array2d_getheight(py_Ref self) {
 py_ObjectRef py_array2d_getitem(py_Ref self, int x, int y) {
     assert(self->type == tp_array2d);
     c11_array2d* ud = py_touserdata(self);
-    return c11_array2d__get(ud, x, y);
+    return ud->header.f_get(&ud->header, x, y);
 }
 
-void py_array2d_setitem(py_Ref self, int x, int y, py_Ref value) {
+bool py_array2d_setitem(py_Ref self, int x, int y, py_Ref value) {
     assert(self->type == tp_array2d);
     c11_array2d* ud = py_touserdata(self);
-    c11_array2d__set(ud, x, y, value);
+    return ud->header.f_set(&ud->header, x, y, value);
 }
\ No newline at end of file
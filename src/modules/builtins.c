@@ -4,6 +4,7 @@
 #include "pocketpy/pocketpy.h"
 #include "pocketpy/common/utils.h"
 #include "pocketpy/objects/object.h"
+#include "pocketpy/objects/iterator.h"
 #include "pocketpy/common/sstream.h"
 #include "pocketpy/interpreter/vm.h"
 #include "pocketpy/common/_generated.h"
@@ -151,6 +152,194 @@ static bool builtins_round(int argc, py_Ref argv) {
     return pk_callmagic(__round__, argc, argv);
 }
 
+// 1: exhausted, 0: stopped by `f`, -1: error
+// lists, tuples and ranges are walked in place without an iterator object
+static int builtins__foreach(py_Ref iterable, int (*f)(py_Ref item, void* ctx), void* ctx) {
+    py_TValue* p;
+    int length = pk_arrayview(iterable, &p);
+    if(length != -1) {
+        // `f` may run user code that resizes the list, so re-fetch the view each step
+        for(int i = 0; i < length; i++) {
+            py_push(&p[i]);
+            int res = f(py_peek(-1), ctx);
+            py_pop();
+            if(res != 1) return res;
+            length = pk_arrayview(iterable, &p);
+        }
+        return 1;
+    }
+    if(iterable->type == tp_range) {
+        Range r = *(Range*)py_touserdata(iterable);
+        py_StackRef item = py_pushtmp();
+        for(py_i64 i = r.start; r.step > 0 ? i < r.stop : i > r.stop; i += r.step) {
+            py_newint(item, i);
+            int res = f(item, ctx);
+            if(res != 1) {
+                py_pop();
+                return res;
+            }
+        }
+        py_pop();
+        return 1;
+    }
+    if(!py_iter(iterable)) return -1;
+    py_push(py_retval());
+    int res;
+    do {
+        int next = py_next(py_peek(-1));
+        if(next == -1) return -1;
+        if(next == 0) {
+            res = 1;
+            break;
+        }
+        py_push(py_retval());
+        res = f(py_peek(-1), ctx);
+        py_pop();
+        if(res == -1) return -1;
+    } while(res == 1);
+    py_pop();
+    return res;
+}
+
+static int builtins__sum_step(py_Ref item, void* ctx) {
+    py_Ref acc = ctx;
+    if(acc->type == tp_int && item->type == tp_int) {
+        acc->_i64 += item->_i64;
+        return 1;
+    }
+    if(acc->type == tp_float && item->type == tp_float) {
+        acc->_f64 += item->_f64;
+        return 1;
+    }
+    if(!py_binaryadd(acc, item)) return -1;
+    py_assign(acc, py_retval());
+    return 1;
+}
+
+// sum(iterable, start=0)
+static bool builtins_sum(int argc, py_Ref argv) {
+    py_StackRef acc = py_pushtmp();
+    py_assign(acc, py_arg(1));
+    if(builtins__foreach(py_arg(0), builtins__sum_step, acc) == -1) return false;
+    py_assign(py_retval(), acc);
+    py_pop();
+    return true;
+}
+
+typedef struct {
+    py_Ref key;
+    py_StackRef res;
+    py_StackRef res_key;
+    bool is_max;
+} MinMax;
+
+static int builtins__minmax_step(py_Ref item, void* ctx) {
+    MinMax* self = ctx;
+    if(self->key) {
+        if(!py_call(self->key, 1, item)) return -1;
+        py_push(py_retval());
+    } else {
+        py_push(item);
+    }
+    py_Ref k = py_peek(-1);
+    int res = 1;
+    if(py_isnil(self->res)) {
+        py_assign(self->res, item);
+        py_assign(self->res_key, k);
+    } else {
+        // ties keep the first extreme item like CPython does
+        res = self->is_max ? py_less(self->res_key, k) : py_less(k, self->res_key);
+        if(res == 1) {
+            py_assign(self->res, item);
+            py_assign(self->res_key, k);
+        }
+        if(res != -1) res = 1;
+    }
+    py_pop();
+    return res;
+}
+
+static bool builtins__minmax(int argc, py_Ref argv, bool is_max) {
+    const char* name = is_max ? "max" : "min";
+    int n = py_tuple_len(py_arg(0));
+    if(n == 0) return TypeError("%s() expected at least 1 argument, got 0", name);
+    // min([1, 2, 3]) iterates its only argument, min(1, 2, 3) its arguments
+    py_Ref iterable = n == 1 ? py_tuple_getitem(py_arg(0), 0) : py_arg(0);
+    MinMax ctx = {
+        .key = py_isnone(py_arg(1)) ? NULL : py_arg(1),
+        .res = py_pushtmp(),
+        .res_key = py_pushtmp(),
+        .is_max = is_max,
+    };
+    py_newnil(ctx.res);
+    if(builtins__foreach(iterable, builtins__minmax_step, &ctx) == -1) return false;
+    if(py_isnil(ctx.res)) return ValueError("%s() arg is an empty sequence", name);
+    py_assign(py_retval(), ctx.res);
+    py_shrink(2);
+    return true;
+}
+
+// min(*args, key=None)
+static bool builtins_min(int argc, py_Ref argv) { return builtins__minmax(argc, argv, false); }
+
+// max(*args, key=None)
+static bool builtins_max(int argc, py_Ref argv) { return builtins__minmax(argc, argv, true); }
+
+// stops at the first item whose truth value equals `ctx`
+static int builtins__anyall_step(py_Ref item, void* ctx) {
+    int res = py_bool(item);
+    if(res == -1) return -1;
+    return res != *(bool*)ctx;
+}
+
+static bool builtins_any(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    bool stop = true;
+    int res = builtins__foreach(argv, builtins__anyall_step, &stop);
+    if(res == -1) return false;
+    py_newbool(py_retval(), res == 0);
+    return true;
+}
+
+static bool builtins_all(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    bool stop = false;
+    int res = builtins__foreach(argv, builtins__anyall_step, &stop);
+    if(res == -1) return false;
+    py_newbool(py_retval(), res == 1);
+    return true;
+}
+
+// sorted(iterable, key=None, reverse=False)
+static bool builtins_sorted(int argc, py_Ref argv) {
+    if(!py_tpcall(tp_list, 1, py_arg(0))) return false;
+    // the new list replaces `iterable` and becomes `self` of list.sort
+    py_assign(py_arg(0), py_retval());
+    py_Ref sort = py_getdict(py_tpobject(tp_list), py_name("sort"));
+    if(!py_call(sort, 3, argv)) return false;
+    py_assign(py_retval(), py_arg(0));
+    return true;
+}
+
+// returns a list instead of a lazy iterator, see differences.md
+static bool builtins_reversed(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    py_TValue* p;
+    int length = pk_arrayview(argv, &p);
+    if(length != -1) {
+        py_newlistn(py_retval(), length);
+        py_TValue* out = py_list_data(py_retval());
+        for(int i = 0; i < length; i++) {
+            out[i] = p[length - 1 - i];
+        }
+        return true;
+    }
+    if(!py_tpcall(tp_list, 1, argv)) return false;
+    c11_vector* list = py_touserdata(py_retval());
+    c11__reverse(py_TValue, list);
+    return true;
+}
+
 static bool builtins_print(int argc, py_Ref argv) {
     // print(*args, sep=' ', end='\n', flush=False)
     py_TValue* args = py_tuple_data(argv);
@@ -470,6 +659,14 @@ py_GlobalRef pk_builtins__register() {
     py_bindfunc(builtins, "divmod", builtins_divmod);
     py_bindfunc(builtins, "round", builtins_round);
 
+    py_bind(builtins, "sum(iterable, start=0)", builtins_sum);
+    py_bind(builtins, "min(*args, key=None)", builtins_min);
+    py_bind(builtins, "max(*args, key=None)", builtins_max);
+    py_bindfunc(builtins, "any", builtins_any);
+    py_bindfunc(builtins, "all", builtins_all);
+    py_bind(builtins, "sorted(iterable, key=None, reverse=False)", builtins_sorted);
+    py_bindfunc(builtins, "reversed", builtins_reversed);
+
     py_bind(builtins, "print(*args, sep=' ', end='\\n', flush=False)", builtins_print);
 
     py_bindfunc(builtins, "isinstance", builtins_isinstance);
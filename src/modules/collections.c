@@ -0,0 +1,818 @@
+#include "pocketpy/pocketpy.h"
+
+#include "pocketpy/common/utils.h"
+#include "pocketpy/common/sstream.h"
+#include "pocketpy/common/algorithm.h"
+#include "pocketpy/objects/object.h"
+#include "pocketpy/interpreter/types.h"
+#include "pocketpy/interpreter/vm.h"
+
+#include <string.h>
+
+/* deque */
+
+#define Deque__at(self, i) ((self)->data + (((self)->head + (i)) & ((self)->capacity - 1)))
+
+static void Deque__ctor(Deque* self, int maxlen) {
+    self->capacity = 8;
+    self->data = PK_MALLOC(sizeof(py_TValue) * self->capacity);
+    self->head = 0;
+    self->length = 0;
+    self->maxlen = maxlen;
+    ManagedHeap__account(&pk_current_vm->heap, Deque__external_bytes(self));
+}
+
+static void Deque__dtor(Deque* self) { PK_FREE(self->data); }
+
+static bool Deque__grow(Deque* self) {
+    int capacity = self->capacity * 2;
+    int64_t bytes = sizeof(py_TValue) * (int64_t)(capacity - self->capacity);
+    if(!ManagedHeap__reserve(&pk_current_vm->heap, bytes)) return false;
+    py_TValue* data = PK_MALLOC(sizeof(py_TValue) * capacity);
+    // unwrap the elements to the front of the new buffer
+    int n = c11__min(self->length, self->capacity - self->head);
+    memcpy(data, self->data + self->head, sizeof(py_TValue) * n);
+    memcpy(data + n, self->data, sizeof(py_TValue) * (self->length - n));
+    PK_FREE(self->data);
+    ManagedHeap__account(&pk_current_vm->heap, bytes);
+    self->data = data;
+    self->capacity = capacity;
+    self->head = 0;
+    return true;
+}
+
+static bool Deque__append(PyObject* obj, Deque* self, py_Ref val) {
+    if(self->length == self->maxlen) {
+        if(self->maxlen == 0) return true;
+        // drop the leftmost element
+        self->head = (self->head + 1) & (self->capacity - 1);
+        self->length--;
+    } else if(self->length == self->capacity) {
+        if(!Deque__grow(self)) return false;
+    }
+    pk__write_barrier_value(obj, val);
+    *Deque__at(self, self->length) = *val;
+    self->length++;
+    return true;
+}
+
+static bool Deque__appendleft(PyObject* obj, Deque* self, py_Ref val) {
+    if(self->length == self->maxlen) {
+        if(self->maxlen == 0) return true;
+        // drop the rightmost element
+        self->length--;
+    } else if(self->length == self->capacity) {
+        if(!Deque__grow(self)) return false;
+    }
+    pk__write_barrier_value(obj, val);
+    self->head = (self->head - 1) & (self->capacity - 1);
+    self->data[self->head] = *val;
+    self->length++;
+    return true;
+}
+
+// list of the elements, on the stack
+static py_StackRef Deque__tolist(Deque* self) {
+    py_StackRef out = py_pushtmp();
+    py_newlistn(out, self->length);
+    py_TValue* p = py_list_data(out);
+    for(int i = 0; i < self->length; i++) {
+        p[i] = *Deque__at(self, i);
+    }
+    return out;
+}
+
+// append the elements of `iterable` to the right, or to the left
+static bool Deque__extend(py_Ref self, py_Ref iterable, bool left) {
+    Deque* ud = py_touserdata(self);
+    bool (*append)(PyObject*, Deque*, py_Ref) = left ? Deque__appendleft : Deque__append;
+    py_StackRef p0 = py_peek(0);
+    // the elements of a deque are copied first, it could be `self`
+    if(py_isinstance(iterable, tp_deque)) iterable = Deque__tolist(py_touserdata(iterable));
+    py_TValue* p;
+    int length = pk_arrayview(iterable, &p);
+    if(length != -1) {
+        for(int i = 0; i < length; i++) {
+            if(!append(self->_obj, ud, &p[i])) return false;
+        }
+        py_shrink(py_peek(0) - p0);
+        return true;
+    }
+    if(!py_iter(iterable)) return false;
+    py_push(py_retval());
+    while(true) {
+        int res = py_next(py_peek(-1));
+        if(res == -1) return false;
+        if(res == 0) break;
+        if(!append(self->_obj, ud, py_retval())) return false;
+    }
+    py_pop();
+    return true;
+}
+
+static bool deque__new__(int argc, py_Ref argv) {
+    py_Type cls = py_totype(argv);
+    int slots = cls == tp_deque ? 0 : -1;
+    Deque* ud = py_newobject(py_retval(), cls, slots, sizeof(Deque));
+    Deque__ctor(ud, -1);
+    return true;
+}
+
+// __init__(self, iterable=None, maxlen=None)
+static bool deque__init__(int argc, py_Ref argv) {
+    Deque* self = py_touserdata(argv);
+    py_Ref iterable = py_arg(1);
+    py_Ref maxlen = py_arg(2);
+    self->head = 0;
+    self->length = 0;
+    self->maxlen = -1;
+    if(!py_isnone(maxlen)) {
+        if(!py_checkint(maxlen)) return false;
+        py_i64 n = py_toint(maxlen);
+        if(n < 0 || n > INT32_MAX) return ValueError("maxlen must be non-negative");
+        self->maxlen = (int)n;
+    }
+    if(!py_isnone(iterable)) {
+        if(!Deque__extend(argv, iterable, false)) return false;
+    }
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool deque_maxlen(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Deque* self = py_touserdata(argv);
+    if(self->maxlen == -1) {
+        py_newnone(py_retval());
+    } else {
+        py_newint(py_retval(), self->maxlen);
+    }
+    return true;
+}
+
+static bool deque__len__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Deque* self = py_touserdata(argv);
+    py_newint(py_retval(), self->length);
+    return true;
+}
+
+static bool deque_append(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    if(!Deque__append(argv->_obj, py_touserdata(argv), py_arg(1))) return false;
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool deque_appendleft(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    if(!Deque__appendleft(argv->_obj, py_touserdata(argv), py_arg(1))) return false;
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool deque_pop(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Deque* self = py_touserdata(argv);
+    if(self->length == 0) return IndexError("pop from an empty deque");
+    self->length--;
+    py_assign(py_retval(), Deque__at(self, self->length));
+    return true;
+}
+
+static bool deque_popleft(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Deque* self = py_touserdata(argv);
+    if(self->length == 0) return IndexError("pop from an empty deque");
+    py_assign(py_retval(), self->data + self->head);
+    self->head = (self->head + 1) & (self->capacity - 1);
+    self->length--;
+    return true;
+}
+
+static bool deque_extend(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    if(!Deque__extend(argv, py_arg(1), false)) return false;
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool deque_extendleft(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    if(!Deque__extend(argv, py_arg(1), true)) return false;
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool deque_clear(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Deque* self = py_touserdata(argv);
+    self->head = 0;
+    self->length = 0;
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool deque_copy(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Deque* self = py_touserdata(argv);
+    Deque* ud = py_newobject(py_retval(), tp_deque, 0, sizeof(Deque));
+    Deque__ctor(ud, self->maxlen);
+    for(int i = 0; i < self->length; i++) {
+        if(!Deque__append(py_retval()->_obj, ud, Deque__at(self, i))) return false;
+    }
+    return true;
+}
+
+// index of the first element equal to `val` from `start`, -1 if not found, -2 on error
+static int Deque__index(Deque* self, py_Ref val, int start) {
+    // `__eq__` may change the deque, so the length is checked on each step
+    for(int i = start; i < self->length; i++) {
+        py_TValue item = *Deque__at(self, i);
+        int res = py_equal(&item, val);
+        if(res == -1) return -2;
+        if(res) return i;
+    }
+    return -1;
+}
+
+static bool deque_count(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    Deque* self = py_touserdata(argv);
+    int count = 0;
+    int i = 0;
+    while(true) {
+        i = Deque__index(self, py_arg(1), i);
+        if(i == -2) return false;
+        if(i == -1) break;
+        count++;
+        i++;
+    }
+    py_newint(py_retval(), count);
+    return true;
+}
+
+static bool deque__contains__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    int i = Deque__index(py_touserdata(argv), py_arg(1), 0);
+    if(i == -2) return false;
+    py_newbool(py_retval(), i != -1);
+    return true;
+}
+
+static bool deque_remove(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    Deque* self = py_touserdata(argv);
+    int i = Deque__index(self, py_arg(1), 0);
+    if(i == -2) return false;
+    if(i == -1) return ValueError("deque.remove(x): x not in deque");
+    for(; i < self->length - 1; i++) {
+        *Deque__at(self, i) = *Deque__at(self, i + 1);
+    }
+    self->length--;
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool deque_reverse(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Deque* self = py_touserdata(argv);
+    for(int i = 0, j = self->length - 1; i < j; i++, j--) {
+        py_TValue tmp = *Deque__at(self, i);
+        *Deque__at(self, i) = *Deque__at(self, j);
+        *Deque__at(self, j) = tmp;
+    }
+    py_newnone(py_retval());
+    return true;
+}
+
+// rotate(self, n=1)
+static bool deque_rotate(int argc, py_Ref argv) {
+    Deque* self = py_touserdata(argv);
+    if(!py_checkint(py_arg(1))) return false;
+    py_i64 n = py_toint(py_arg(1));
+    if(self->length > 1) {
+        n %= self->length;
+        if(n < 0) n += self->length;
+        // move `n` elements from the right end to the left end
+        for(int i = 0; i < n; i++) {
+            self->length--;
+            py_TValue val = *Deque__at(self, self->length);
+            self->head = (self->head - 1) & (self->capacity - 1);
+            self->data[self->head] = val;
+            self->length++;
+        }
+    }
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool Deque__checkindex(Deque* self, py_Ref index, int* out) {
+    if(!py_checkint(index)) return false;
+    py_i64 i = py_toint(index);
+    if(i < 0) i += self->length;
+    if(i < 0 || i >= self->length) return IndexError("deque index out of range");
+    *out = (int)i;
+    return true;
+}
+
+static bool deque__getitem__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    Deque* self = py_touserdata(argv);
+    int i;
+    if(!Deque__checkindex(self, py_arg(1), &i)) return false;
+    py_assign(py_retval(), Deque__at(self, i));
+    return true;
+}
+
+static bool deque__setitem__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(3);
+    Deque* self = py_touserdata(argv);
+    int i;
+    if(!Deque__checkindex(self, py_arg(1), &i)) return false;
+    pk__write_barrier_value(argv->_obj, py_arg(2));
+    *Deque__at(self, i) = *py_arg(2);
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool deque__eq__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    if(!py_isinstance(py_arg(1), tp_deque)) {
+        py_newnotimplemented(py_retval());
+        return true;
+    }
+    Deque* self = py_touserdata(argv);
+    Deque* other = py_touserdata(py_arg(1));
+    bool res = self->length == other->length;
+    for(int i = 0; res && i < self->length && i < other->length; i++) {
+        py_TValue a = *Deque__at(self, i);
+        py_TValue b = *Deque__at(other, i);
+        int eq = py_equal(&a, &b);
+        if(eq == -1) return false;
+        res = eq;
+    }
+    py_newbool(py_retval(), res);
+    return true;
+}
+
+static bool deque__ne__(int argc, py_Ref argv) {
+    if(!deque__eq__(argc, argv)) return false;
+    if(py_isbool(py_retval())) py_newbool(py_retval(), !py_tobool(py_retval()));
+    return true;
+}
+
+static bool deque__repr__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Deque* self = py_touserdata(argv);
+    c11_sbuf buf;
+    c11_sbuf__ctor(&buf);
+    pk_sprintf(&buf, "%t([", argv->type);
+    for(int i = 0; i < self->length; i++) {
+        if(i > 0) c11_sbuf__write_cstr(&buf, ", ");
+        py_TValue item = *Deque__at(self, i);
+        if(!py_repr(&item)) {
+            c11_sbuf__dtor(&buf);
+            return false;
+        }
+        c11_sbuf__write_sv(&buf, py_tosv(py_retval()));
+    }
+    c11_sbuf__write_char(&buf, ']');
+    if(self->maxlen != -1) pk_sprintf(&buf, ", maxlen=%d", self->maxlen);
+    c11_sbuf__write_char(&buf, ')');
+    c11_sbuf__py_submit(&buf, py_retval());
+    return true;
+}
+
+static bool deque__iter__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    int* index = py_newobject(py_retval(), tp_deque_iterator, 1, sizeof(int));
+    *index = 0;
+    py_setslot(py_retval(), 0, argv);
+    return true;
+}
+
+static bool deque_iterator__next__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    int* index = py_touserdata(argv);
+    Deque* self = py_touserdata(py_getslot(argv, 0));
+    if(*index >= self->length) return StopIteration();
+    py_assign(py_retval(), Deque__at(self, *index));
+    (*index)++;
+    return true;
+}
+
+static bool deque__reduce__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Deque* self = py_touserdata(argv);
+    py_StackRef list = Deque__tolist(self);
+    py_Ref p = py_newtuple(py_pushtmp(), 2);
+    p[0] = *py_tpobject(argv->type);
+    py_Ref args = py_newtuple(&p[1], 2);
+    args[0] = *list;
+    if(self->maxlen == -1) {
+        py_newnone(&args[1]);
+    } else {
+        py_newint(&args[1], self->maxlen);
+    }
+    py_assign(py_retval(), py_peek(-1));
+    py_shrink(2);
+    return true;
+}
+
+static void register_deque(py_Ref mod) {
+    py_Type type = py_newtype("deque", tp_object, mod, (py_Dtor)Deque__dtor);
+    assert(type == tp_deque);
+
+    py_bind(py_tpobject(type), "__new__(cls, *args, **kwargs)", deque__new__);
+    py_bind(py_tpobject(type), "__init__(self, iterable=None, maxlen=None)", deque__init__);
+    py_bindmagic(type, __len__, deque__len__);
+    py_bindmagic(type, __contains__, deque__contains__);
+    py_bindmagic(type, __getitem__, deque__getitem__);
+    py_bindmagic(type, __setitem__, deque__setitem__);
+    py_bindmagic(type, __eq__, deque__eq__);
+    py_bindmagic(type, __ne__, deque__ne__);
+    py_bindmagic(type, __repr__, deque__repr__);
+    py_bindmagic(type, __iter__, deque__iter__);
+    py_bindmagic(type, __reduce__, deque__reduce__);
+    py_setdict(py_tpobject(type), __hash__, py_None());
+
+    py_bindproperty(type, "maxlen", deque_maxlen, NULL);
+    py_bindmethod(type, "append", deque_append);
+    py_bindmethod(type, "appendleft", deque_appendleft);
+    py_bindmethod(type, "pop", deque_pop);
+    py_bindmethod(type, "popleft", deque_popleft);
+    py_bindmethod(type, "extend", deque_extend);
+    py_bindmethod(type, "extendleft", deque_extendleft);
+    py_bindmethod(type, "clear", deque_clear);
+    py_bindmethod(type, "copy", deque_copy);
+    py_bindmethod(type, "count", deque_count);
+    py_bindmethod(type, "remove", deque_remove);
+    py_bindmethod(type, "reverse", deque_reverse);
+    py_bind(py_tpobject(type), "rotate(self, n=1)", deque_rotate);
+
+    type = py_newtype("deque_iterator", tp_object, mod, NULL);
+    assert(type == tp_deque_iterator);
+    py_bindmagic(type, __iter__, pk_wrapper__self);
+    py_bindmagic(type, __next__, deque_iterator__next__);
+}
+
+/* defaultdict */
+
+static bool defaultdict__new__(int argc, py_Ref argv) {
+    py_Type cls = py_totype(argv);
+    int slots = cls == tp_defaultdict ? 0 : -1;
+    DefaultDict* ud = py_newobject(py_retval(), cls, slots, sizeof(DefaultDict));
+    Dict__ctor(&ud->dict, kDictMinCapacity, 4, sizeof(DictEntry));
+    py_newnone(&ud->default_factory);
+    return true;
+}
+
+// __init__(self, *args), `args` are `default_factory` and an optional argument of `dict.__init__`
+static bool defaultdict__init__(int argc, py_Ref argv) {
+    DefaultDict* self = py_touserdata(argv);
+    int n = py_tuple_len(py_arg(1));
+    if(n > 2) return TypeError("defaultdict expected at most 2 arguments, got %d", n);
+    if(n > 0) {
+        py_Ref factory = py_tuple_getitem(py_arg(1), 0);
+        if(!py_isnone(factory) && !py_callable(factory)) {
+            return TypeError("first argument must be callable or None");
+        }
+        pk__write_barrier_value(argv->_obj, factory);
+        self->default_factory = *factory;
+    }
+    if(n == 2) {
+        py_Ref other = py_tuple_getitem(py_arg(1), 1);
+        py_Name name = py_isinstance(other, tp_dict) ? py_name("update") : __init__;
+        py_push(py_getdict(py_tpobject(tp_dict), name));
+        py_push(argv);
+        py_push(other);
+        if(!py_vectorcall(1, 0)) return false;
+    }
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool defaultdict__missing__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    DefaultDict* self = py_touserdata(argv);
+    if(py_isnone(&self->default_factory)) return KeyError(py_arg(1));
+    if(!py_call(&self->default_factory, 0, NULL)) return false;
+    py_push(py_retval());
+    pk__write_barrier_value(argv->_obj, py_arg(1));
+    pk__write_barrier_value(argv->_obj, py_peek(-1));
+    if(!Dict__set(&self->dict, py_arg(1), py_peek(-1))) return false;
+    py_assign(py_retval(), py_peek(-1));
+    py_pop();
+    return true;
+}
+
+static bool defaultdict_default_factory(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    DefaultDict* self = py_touserdata(argv);
+    py_assign(py_retval(), &self->default_factory);
+    return true;
+}
+
+static bool defaultdict_default_factory_setter(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    DefaultDict* self = py_touserdata(argv);
+    pk__write_barrier_value(argv->_obj, py_arg(1));
+    self->default_factory = *py_arg(1);
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool defaultdict__repr__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    DefaultDict* self = py_touserdata(argv);
+    c11_sbuf buf;
+    c11_sbuf__ctor(&buf);
+    pk_sprintf(&buf, "%t(", argv->type);
+    if(!py_repr(&self->default_factory)) goto __ERROR;
+    c11_sbuf__write_sv(&buf, py_tosv(py_retval()));
+    c11_sbuf__write_cstr(&buf, ", ");
+    if(!py_call(py_getdict(py_tpobject(tp_dict), __repr__), 1, argv)) goto __ERROR;
+    c11_sbuf__write_sv(&buf, py_tosv(py_retval()));
+    c11_sbuf__write_char(&buf, ')');
+    c11_sbuf__py_submit(&buf, py_retval());
+    return true;
+__ERROR:
+    c11_sbuf__dtor(&buf);
+    return false;
+}
+
+static bool defaultdict_copy(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    DefaultDict* self = py_touserdata(argv);
+    DefaultDict* ud = py_newobject(py_retval(), tp_defaultdict, 0, sizeof(DefaultDict));
+    if(!Dict__copy(&self->dict, &ud->dict)) return false;
+    ud->default_factory = self->default_factory;
+    return true;
+}
+
+static void register_defaultdict(py_Ref mod) {
+    py_Type type = py_newtype("defaultdict", tp_dict, mod, (py_Dtor)Dict__dtor);
+    assert(type == tp_defaultdict);
+
+    py_bind(py_tpobject(type), "__new__(cls, *args, **kwargs)", defaultdict__new__);
+    py_bind(py_tpobject(type), "__init__(self, *args)", defaultdict__init__);
+    py_bindmagic(type, __missing__, defaultdict__missing__);
+    py_bindmagic(type, __repr__, defaultdict__repr__);
+    py_bindproperty(type,
+                    "default_factory",
+                    defaultdict_default_factory,
+                    defaultdict_default_factory_setter);
+    py_bindmethod(type, "copy", defaultdict_copy);
+}
+
+/* Counter */
+
+// add `n` to the count of `key`
+static bool Counter__add(py_Ref self, py_Ref key, py_Ref n) {
+    Dict* ud = py_touserdata(self);
+    pk__write_barrier_value(self->_obj, key);
+    pk__write_barrier_value(self->_obj, n);
+    DictEntry* entry;
+    int res = Dict__emplace(ud, key, &entry);
+    if(res == -1) return false;
+    if(res == 1) {
+        entry->val = *n;
+        return true;
+    }
+    if(py_isint(&entry->val) && py_isint(n)) {
+        py_newint(&entry->val, py_toint(&entry->val) + py_toint(n));
+        return true;
+    }
+    // `__add__` may change the dict, so the sum is stored by key
+    if(!py_binaryadd(&entry->val, n)) return false;
+    py_push(py_retval());
+    pk__write_barrier_value(self->_obj, py_peek(-1));
+    if(!Dict__set(ud, key, py_peek(-1))) return false;
+    py_pop();
+    return true;
+}
+
+// count the elements of `iterable`, or add the counts of a mapping. `sign` is 1 or -1
+static bool Counter__update(py_Ref self, py_Ref iterable, int sign) {
+    py_StackRef p0 = py_peek(0);
+    if(py_isinstance(iterable, tp_dict)) {
+        Dict* other = py_touserdata(iterable);
+        py_StackRef n = py_pushtmp();
+        for(int i = 0; i < other->entries.length; i++) {
+            DictEntry* entry = Dict__entry(other, i);
+            if(py_isnil(&entry->key)) continue;
+            py_StackRef key = py_pushtmp();
+            *key = entry->key;
+            *n = entry->val;
+            if(sign < 0) {
+                if(!pk_callmagic(__neg__, 1, n)) return false;
+                *n = *py_retval();
+            }
+            if(!Counter__add(self, key, n)) return false;
+            py_pop();
+        }
+        py_shrink(py_peek(0) - p0);
+        return true;
+    }
+    py_StackRef n = py_pushtmp();
+    py_newint(n, sign);
+    py_TValue* p;
+    int length = pk_arrayview(iterable, &p);
+    if(length != -1) {
+        for(int i = 0; i < length; i++) {
+            if(!Counter__add(self, &p[i], n)) return false;
+        }
+        py_pop();
+        return true;
+    }
+    if(!py_iter(iterable)) return false;
+    py_push(py_retval());
+    while(true) {
+        int res = py_next(py_peek(-1));
+        if(res == -1) return false;
+        if(res == 0) break;
+        // `py_retval()` is reset by the `__hash__` call
+        py_push(py_retval());
+        if(!Counter__add(self, py_peek(-1), n)) return false;
+        py_pop();
+    }
+    py_shrink(py_peek(0) - p0);
+    return true;
+}
+
+static bool Counter__new__(int argc, py_Ref argv) {
+    py_Type cls = py_totype(argv);
+    int slots = cls == tp_Counter ? 0 : -1;
+    Dict* ud = py_newobject(py_retval(), cls, slots, sizeof(Dict));
+    Dict__ctor(ud, kDictMinCapacity, 4, sizeof(DictEntry));
+    return true;
+}
+
+// __init__(self, iterable=None)
+static bool Counter__init__(int argc, py_Ref argv) {
+    if(!py_isnone(py_arg(1))) {
+        if(!Counter__update(argv, py_arg(1), 1)) return false;
+    }
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool Counter__missing__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(2);
+    py_newint(py_retval(), 0);
+    return true;
+}
+
+// update(self, iterable=None)
+static bool Counter_update(int argc, py_Ref argv) {
+    if(!py_isnone(py_arg(1))) {
+        if(!Counter__update(argv, py_arg(1), 1)) return false;
+    }
+    py_newnone(py_retval());
+    return true;
+}
+
+// subtract(self, iterable=None)
+static bool Counter_subtract(int argc, py_Ref argv) {
+    if(!py_isnone(py_arg(1))) {
+        if(!Counter__update(argv, py_arg(1), -1)) return false;
+    }
+    py_newnone(py_retval());
+    return true;
+}
+
+static int Counter__count_gt(py_TValue* a, py_TValue* b, PyObject** lists) {
+    py_TValue* count_a = py_tuple_getitem(a, 1);
+    py_TValue* count_b = py_tuple_getitem(b, 1);
+    if(py_isint(count_a) && py_isint(count_b)) return py_toint(count_a) > py_toint(count_b);
+    // the pairs may have moved into the scanned list or merge buffer before a gc step
+    pk__write_barrier(lists[0]);
+    pk__write_barrier(lists[1]);
+    return py_less(count_b, count_a);
+}
+
+// list of `(key, count)` sorted by count in descending order, equal counts keep their order
+static bool Counter__most_common(py_Ref self, py_OutRef out) {
+    Dict* ud = py_touserdata(self);
+    py_newlistn(out, ud->length);
+    py_TValue* p = py_list_data(out);
+    int n = 0;
+    for(int i = 0; i < ud->entries.length; i++) {
+        DictEntry* entry = Dict__entry(ud, i);
+        if(py_isnil(&entry->key)) continue;
+        py_Ref pair = py_newtuple(&p[n++], 2);
+        pair[0] = entry->key;
+        pair[1] = entry->val;
+    }
+    // counts of other types may trigger a gc from `__lt__`, so the merge buffer is a list
+    py_StackRef buffer = py_pushtmp();
+    py_newlistn(buffer, n / 2 + 1);
+    for(int i = 0; i < n / 2 + 1; i++) {
+        py_newnil(py_list_getitem(buffer, i));
+    }
+    PyObject* lists[2] = {out->_obj, buffer->_obj};
+    bool ok = c11__timsort(p,
+                           n,
+                           sizeof(py_TValue),
+                           (int (*)(const void*, const void*, void*))Counter__count_gt,
+                           lists,
+                           py_list_data(buffer));
+    py_pop();
+    return ok;
+}
+
+// most_common(self, n=None)
+static bool Counter_most_common(int argc, py_Ref argv) {
+    py_StackRef out = py_pushtmp();
+    if(!Counter__most_common(argv, out)) return false;
+    if(!py_isnone(py_arg(1))) {
+        if(!py_checkint(py_arg(1))) return false;
+        py_i64 n = py_toint(py_arg(1));
+        List* list = py_touserdata(out);
+        if(n < 0) n = 0;
+        if(n < list->length) list->length = (int)n;
+    }
+    py_assign(py_retval(), out);
+    py_pop();
+    return true;
+}
+
+static bool Counter_total(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Dict* self = py_touserdata(argv);
+    py_StackRef total = py_pushtmp();
+    py_newint(total, 0);
+    for(int i = 0; i < self->entries.length; i++) {
+        DictEntry* entry = Dict__entry(self, i);
+        if(py_isnil(&entry->key)) continue;
+        if(py_isint(total) && py_isint(&entry->val)) {
+            py_newint(total, py_toint(total) + py_toint(&entry->val));
+        } else {
+            if(!py_binaryadd(total, &entry->val)) return false;
+            *total = *py_retval();
+        }
+    }
+    py_assign(py_retval(), total);
+    py_pop();
+    return true;
+}
+
+static bool Counter_copy(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    Dict* self = py_touserdata(argv);
+    Dict* ud = py_newobject(py_retval(), tp_Counter, 0, sizeof(Dict));
+    if(!Dict__copy(self, ud)) return false;
+    return true;
+}
+
+static bool Counter__repr__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    py_StackRef items = py_pushtmp();
+    if(!Counter__most_common(argv, items)) return false;
+    List* list = py_touserdata(items);
+    c11_sbuf buf;
+    c11_sbuf__ctor(&buf);
+    pk_sprintf(&buf, "%t(", argv->type);
+    if(list->length > 0) c11_sbuf__write_char(&buf, '{');
+    for(int i = 0; i < list->length; i++) {
+        py_Ref pair = c11__at(py_TValue, list, i);
+        if(i > 0) c11_sbuf__write_cstr(&buf, ", ");
+        for(int j = 0; j < 2; j++) {
+            if(!py_repr(py_tuple_getitem(pair, j))) {
+                c11_sbuf__dtor(&buf);
+                return false;
+            }
+            c11_sbuf__write_sv(&buf, py_tosv(py_retval()));
+            if(j == 0) c11_sbuf__write_cstr(&buf, ": ");
+        }
+    }
+    if(list->length > 0) c11_sbuf__write_char(&buf, '}');
+    c11_sbuf__write_char(&buf, ')');
+    c11_sbuf__py_submit(&buf, py_retval());
+    py_pop();
+    return true;
+}
+
+static void register_Counter(py_Ref mod) {
+    py_Type type = py_newtype("Counter", tp_dict, mod, (py_Dtor)Dict__dtor);
+    assert(type == tp_Counter);
+
+    py_bind(py_tpobject(type), "__new__(cls, *args, **kwargs)", Counter__new__);
+    py_bind(py_tpobject(type), "__init__(self, iterable=None)", Counter__init__);
+    py_bindmagic(type, __missing__, Counter__missing__);
+    py_bindmagic(type, __repr__, Counter__repr__);
+    py_bind(py_tpobject(type), "update(self, iterable=None)", Counter_update);
+    py_bind(py_tpobject(type), "subtract(self, iterable=None)", Counter_subtract);
+    py_bind(py_tpobject(type), "most_common(self, n=None)", Counter_most_common);
+    py_bindmethod(type, "total", Counter_total);
+    py_bindmethod(type, "copy", Counter_copy);
+}
+
+void pk__add_module_collections() {
+    py_Ref mod = py_newmodule("collections");
+
+    register_deque(mod);
+    register_defaultdict(mod);
+    register_Counter(mod);
+}
@@ -57,7 +57,8 @@ static bool disassemble(CodeObject* co) {
 
             c11_sbuf__write_int(&ss, byte.arg);
             switch(byte.op) {
-                case OP_LOAD_CONST: {
+                case OP_LOAD_CONST:
+                case OP_LOAD_CONST_RETURN_VALUE: {
                     py_Ref value = c11__at(py_TValue, &co->consts, byte.arg);
                     if(py_repr(value)) {
                         pk_sprintf(&ss, " (%v)", py_tosv(py_retval()));
@@ -73,6 +74,7 @@ static bool disassemble(CodeObject* co) {
                     break;
                 }
                 case OP_LOAD_NAME:
+                case OP_LOAD_KWARG_KEY:
                 case OP_LOAD_GLOBAL:
                 case OP_LOAD_NONLOCAL:
                 case OP_STORE_GLOBAL:
@@ -94,6 +96,28 @@ static bool disassemble(CodeObject* co) {
                     pk_sprintf(&ss, " (%n)", name);
                     break;
                 }
+                case OP_LOAD_FAST_LOAD_FAST: {
+                    Bytecode next = c11__getitem(Bytecode, &co->codes, i + 1);
+                    py_Name name = c11__getitem(py_Name, &co->varnames, byte.arg);
+                    py_Name name2 = c11__getitem(py_Name, &co->varnames, next.arg);
+                    pk_sprintf(&ss, " (%n, %n)", name, name2);
+                    break;
+                }
+                case OP_LOAD_FAST_LOAD_ATTR: {
+                    Bytecode next = c11__getitem(Bytecode, &co->codes, i + 1);
+                    py_Name name = c11__getitem(py_Name, &co->varnames, byte.arg);
+                    py_Name attr = c11__getitem(py_Name, &co->names, next.arg);
+                    pk_sprintf(&ss, " (%n.%n)", name, attr);
+                    break;
+                }
+                case OP_COMPARE_POP_JUMP_IF_FALSE: {
+                    Bytecode next = c11__getitem(Bytecode, &co->codes, i + 1);
+                    pk_sprintf(&ss,
+                               " (%s, to %d)",
+                               pk_opname(byte.arg),
+                               (int16_t)next.arg + i + 1);
+                    break;
+                }
                 case OP_LOAD_FUNCTION: {
                     const FuncDecl* decl = c11__getitem(FuncDecl*, &co->func_decls, byte.arg);
                     pk_sprintf(&ss, " (%s)", decl->code.name->data);
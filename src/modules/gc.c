@@ -5,6 +5,7 @@ static bool gc_enable(int argc, py_Ref argv) {
     PY_CHECK_ARGC(0);
     ManagedHeap* heap = &pk_current_vm->heap;
     heap->gc_enabled = true;
+    ManagedHeap__update_trigger(heap);
     py_newnone(py_retval());
     return true;
 }
@@ -13,6 +14,7 @@ static bool gc_disable(int argc, py_Ref argv) {
     PY_CHECK_ARGC(0);
     ManagedHeap* heap = &pk_current_vm->heap;
     heap->gc_enabled = false;
+    ManagedHeap__update_trigger(heap);
     py_newnone(py_retval());
     return true;
 }
@@ -25,13 +27,39 @@ static bool gc_isenabled(int argc, py_Ref argv) {
 }
 
 static bool gc_collect(int argc, py_Ref argv) {
-    PY_CHECK_ARGC(0);
     ManagedHeap* heap = &pk_current_vm->heap;
-    int res = ManagedHeap__collect(heap);
+    int res;
+    if(argc == 0) {
+        res = ManagedHeap__collect(heap);
+    } else {
+        PY_CHECK_ARGC(1);
+        PY_CHECK_ARG_TYPE(0, tp_int);
+        py_i64 generation = py_toint(argv);
+        if(generation != 0 && generation != 1) {
+            return ValueError("invalid generation %i", generation);
+        }
+        res = generation == 0 ? ManagedHeap__collect_young(heap) : ManagedHeap__collect(heap);
+    }
     py_newint(py_retval(), res);
     return true;
 }
 
+static bool gc_set_generational(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_bool);
+    ManagedHeap* heap = &pk_current_vm->heap;
+    ManagedHeap__set_generational(heap, py_tobool(argv));
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool gc_isgenerational(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(0);
+    ManagedHeap* heap = &pk_current_vm->heap;
+    py_newbool(py_retval(), heap->gc_generational);
+    return true;
+}
+
 static bool gc_collect_hint(int argc, py_Ref argv) {
     PY_CHECK_ARGC(0);
     ManagedHeap* heap = &pk_current_vm->heap;
@@ -40,6 +68,39 @@ static bool gc_collect_hint(int argc, py_Ref argv) {
     return true;
 }
 
+static bool gc_step(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_int);
+    py_i64 budget_us = py_toint(argv);
+    if(budget_us < 0) return ValueError("budget_us must be non-negative");
+    ManagedHeap* heap = &pk_current_vm->heap;
+    bool done = ManagedHeap__step(heap, (int)c11__min(budget_us, INT32_MAX));
+    py_newbool(py_retval(), done);
+    return true;
+}
+
+static bool gc_set_memory_limit(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_int);
+    py_i64 limit = py_toint(argv);
+    if(limit < 0) return ValueError("limit must be non-negative");
+    ManagedHeap__set_limit(&pk_current_vm->heap, limit);
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool gc_get_memory_limit(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(0);
+    py_newint(py_retval(), pk_current_vm->heap.gc_limit);
+    return true;
+}
+
+static bool gc_get_memory_usage(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(0);
+    py_newint(py_retval(), ManagedHeap__used_bytes(&pk_current_vm->heap));
+    return true;
+}
+
 static bool gc_setup_debug_callback(int argc, py_Ref argv) {
     PY_CHECK_ARGC(1);
     ManagedHeap* heap = &pk_current_vm->heap;
@@ -54,8 +115,14 @@ void pk__add_module_gc() {
     py_bindfunc(mod, "enable", gc_enable);
     py_bindfunc(mod, "disable", gc_disable);
     py_bindfunc(mod, "isenabled", gc_isenabled);
+    py_bindfunc(mod, "set_generational", gc_set_generational);
+    py_bindfunc(mod, "isgenerational", gc_isgenerational);
 
     py_bindfunc(mod, "collect", gc_collect);
     py_bindfunc(mod, "collect_hint", gc_collect_hint);
+    py_bindfunc(mod, "step", gc_step);
+    py_bindfunc(mod, "set_memory_limit", gc_set_memory_limit);
+    py_bindfunc(mod, "get_memory_limit", gc_get_memory_limit);
+    py_bindfunc(mod, "get_memory_usage", gc_get_memory_usage);
     py_bindfunc(mod, "setup_debug_callback", gc_setup_debug_callback);
 }
@@ -25,7 +25,7 @@ typedef enum {
     PKL_VEC2, PKL_VEC3,
     PKL_VEC2I, PKL_VEC3I,
     PKL_TYPE,
-    PKL_ARRAY2D,
+    PKL_ARRAY2D, PKL_ARRAY2D_TYPED,
     PKL_IMPORT_PATH,
     PKL_GETATTR,
     PKL_TVALUE,
@@ -380,6 +380,18 @@ static bool pkl__write_object(PickleObject* buf, py_TValue* obj) {
         case tp_array2d: {
             if(pkl__try_memo(buf, obj->_obj)) return true;
             c11_array2d* arr = py_touserdata(obj);
+            if(arr->dtype != c11_array2d_object) {
+                pkl__emit_op(buf, PKL_ARRAY2D_TYPED);
+                pkl__emit_int(buf, arr->header.n_cols);
+                pkl__emit_int(buf, arr->header.n_rows);
+                pkl__emit_int(buf, arr->dtype);
+                PickleObject__write_bytes(buf,
+                                          arr->buffer,
+                                          arr->header.numel *
+                                              c11_array2d_dtype__itemsize(arr->dtype));
+                pkl__store_memo(buf, obj->_obj);
+                return true;
+            }
             for(int i = 0; i < arr->header.numel; i++) {
                 if(arr->data[i].is_ptr)
                     return TypeError(
@@ -427,23 +439,42 @@ static bool pkl__write_object(PickleObject* buf, py_TValue* obj) {
                 return true;
             }
             if(ti->is_python) {
-                NameDict* dict = PyObject__dict(obj->_obj);
-                for(int i = dict->capacity - 1; i >= 0; i--) {
-                    NameDict_KV* kv = &dict->items[i];
-                    if(kv->key == NULL) continue;
-                    if(!pkl__write_object(buf, &kv->value)) return false;
+                // values are written in reverse order, so that they are popped in field order
+                c11_vector /*T=NameDict_KV*/ fields;
+                c11_vector__ctor(&fields, sizeof(NameDict_KV));
+                if(obj->_obj->slots >= 0) {
+                    // an instance of a class with `__slots__`, unset slots are skipped
+                    py_TValue* values = PyObject__slots(obj->_obj);
+                    for(int i = 0; i < obj->_obj->slots; i++) {
+                        if(py_isnil(&values[i])) continue;
+                        py_Ref name = py_tuple_getitem(&ti->slot_names, i);
+                        NameDict_KV kv = {py_namev(py_tosv(name)), values[i]};
+                        c11_vector__push(NameDict_KV, &fields, kv);
+                    }
+                } else {
+                    py_Name name;
+                    py_TValue* val;
+                    for(int i = 0; PyObject__nextdict(obj->_obj, &i, &name, &val);) {
+                        NameDict_KV kv = {name, *val};
+                        c11_vector__push(NameDict_KV, &fields, kv);
+                    }
+                }
+                for(int i = fields.length - 1; i >= 0; i--) {
+                    if(!pkl__write_object(buf, &c11__getitem(NameDict_KV, &fields, i).value)) {
+                        c11_vector__dtor(&fields);
+                        return false;
+                    }
                 }
                 pkl__emit_op(buf, PKL_OBJECT);
                 pkl__emit_int(buf, obj->type);
                 buf->used_types[obj->type] = true;
-                pkl__emit_int(buf, dict->length);
-                for(int i = 0; i < dict->capacity; i++) {
-                    NameDict_KV* kv = &dict->items[i];
-                    if(kv->key == NULL) continue;
+                pkl__emit_int(buf, fields.length);
+                c11__foreach(NameDict_KV, &fields, kv) {
                     c11_sv field = py_name2sv(kv->key);
                     // include '\0'
                     PickleObject__write_bytes(buf, field.data, field.size + 1);
                 }
+                c11_vector__dtor(&fields);
 
                 // store memo
                 pkl__store_memo(buf, obj->_obj);
@@ -719,6 +750,16 @@ bool py_pickle_loads_body(const unsigned char* p, int memo_length, c11_smallmap_
                 p += total_size;
                 break;
             }
+            case PKL_ARRAY2D_TYPED: {
+                int n_cols = pkl__read_int(&p);
+                int n_rows = pkl__read_int(&p);
+                c11_array2d_dtype dtype = (c11_array2d_dtype)pkl__read_int(&p);
+                c11_array2d* arr = c11_newarray2d_typed(py_pushtmp(), n_cols, n_rows, dtype);
+                int total_size = arr->header.numel * c11_array2d_dtype__itemsize(dtype);
+                memcpy(arr->buffer, p, total_size);
+                p += total_size;
+                break;
+            }
             case PKL_IMPORT_PATH: {
                 const char* path = pkl__read_cstr(&p);
                 int res = py_import(path);
@@ -751,13 +792,17 @@ bool py_pickle_loads_body(const unsigned char* p, int memo_length, c11_smallmap_
             case PKL_OBJECT: {
                 py_Type type = (py_Type)pkl__read_int(&p);
                 type = pkl__fix_type(type, type_mapping);
-                py_newobject(py_retval(), type, -1, 0);
-                NameDict* dict = PyObject__dict(py_retval()->_obj);
+                py_newobject(py_retval(), type, pk_typeinfo(type)->inst_slots, 0);
                 int dict_length = pkl__read_int(&p);
                 for(int i = 0; i < dict_length; i++) {
                     py_StackRef value = py_peek(-1);
                     c11_sv field = {(const char*)p, strlen((const char*)p)};
-                    NameDict__set(dict, py_namev(field), value);
+                    if(py_retval()->_obj->slots < 0) {
+                        py_setdict(py_retval(), py_namev(field), value);
+                    } else {
+                        // set through the member descriptors of `__slots__`
+                        if(!py_setattr(py_retval(), py_namev(field), value)) return false;
+                    }
                     py_pop();
                     p += field.size + 1;
                 }
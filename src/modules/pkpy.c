@@ -8,6 +8,7 @@
 
 #include "pocketpy/common/threads.h"
 #include <time.h>
+#include <string.h>
 
 #define DEF_TVALUE_METHODS(T, Field)                                                               \
     static bool TValue_##T##__new__(int argc, py_Ref argv) {                                       \
@@ -41,7 +42,7 @@ static bool pkpy_memory_usage(int argc, py_Ref argv) {
     PY_CHECK_ARGC(0);
     ManagedHeap* heap = &pk_current_vm->heap;
     c11_string* small_objects_usage = MultiPool__summary(&heap->small_objects);
-    int large_object_count = heap->large_objects.length;
+    int large_object_count = heap->large_object_count;
     c11_sbuf buf;
     c11_sbuf__ctor(&buf);
     c11_sbuf__write_cstr(&buf, "== heap.small_objects ==\n");
@@ -49,14 +50,63 @@ static bool pkpy_memory_usage(int argc, py_Ref argv) {
     c11_sbuf__write_cstr(&buf, "== heap.large_objects ==\n");
     pk_sprintf(&buf, "len(large_objects)=%d\n", large_object_count);
     c11_sbuf__write_cstr(&buf, "== heap.gc ==\n");
-    pk_sprintf(&buf, "gc_counter=%d\n", heap->gc_counter);
-    pk_sprintf(&buf, "gc_threshold=%d", heap->gc_threshold);
+    pk_sprintf(&buf, "used_bytes=%i\n", ManagedHeap__used_bytes(heap));
+    pk_sprintf(&buf, "live_bytes=%i\n", heap->gc_live_bytes);
+    pk_sprintf(&buf, "gc_allocated=%i\n", heap->gc_allocated);
+    pk_sprintf(&buf, "gc_threshold=%i\n", heap->gc_threshold);
+    pk_sprintf(&buf, "memory_limit=%i", heap->gc_limit);
     // c11_sbuf__write_cstr(&buf, "== vm.pool_frame ==\n");
     c11_sbuf__py_submit(&buf, py_retval());
     c11_string__delete(small_objects_usage);
     return true;
 }
 
+#if PK_ENABLE_IC_STATS
+static bool pkpy_inline_cache_stats(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(0);
+    InlineCacheStats* stats = &pk_current_vm->ic_stats;
+    py_Ref p = py_newtuple(py_retval(), 2);
+    py_newint(&p[0], stats->hits);
+    py_newint(&p[1], stats->misses);
+    return true;
+}
+#endif
+
+static bool pkpy_compile_to_bytes(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(3);
+    PY_CHECK_ARG_TYPE(0, tp_str);
+    PY_CHECK_ARG_TYPE(1, tp_str);
+    PY_CHECK_ARG_TYPE(2, tp_str);
+    const char* mode = py_tostr(py_arg(2));
+    enum py_CompileMode compile_mode;
+    if(strcmp(mode, "exec") == 0) {
+        compile_mode = EXEC_MODE;
+    } else if(strcmp(mode, "eval") == 0) {
+        compile_mode = EVAL_MODE;
+    } else if(strcmp(mode, "single") == 0) {
+        compile_mode = SINGLE_MODE;
+    } else {
+        return ValueError("mode must be 'exec', 'eval' or 'single'");
+    }
+    return py_compile_to_bytes(py_tostr(py_arg(0)), py_tostr(py_arg(1)), compile_mode);
+}
+
+static bool pkpy_exec_bytes(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_bytes);
+    int size;
+    unsigned char* data = py_tobytes(py_arg(0), &size);
+    return py_exec_bytes(data, size, NULL);
+}
+
+static bool pkpy_compile_cache(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_bool);
+    py_setcompilecache(py_tobool(py_arg(0)));
+    py_newnone(py_retval());
+    return true;
+}
+
 static bool pkpy_currentvm(int argc, py_Ref argv) {
     PY_CHECK_ARGC(0);
     py_newint(py_retval(), py_currentvm());
@@ -522,6 +572,13 @@ void pk__add_module_pkpy() {
     py_pop();
 
     py_bindfunc(mod, "memory_usage", pkpy_memory_usage);
+#if PK_ENABLE_IC_STATS
+    py_bindfunc(mod, "inline_cache_stats", pkpy_inline_cache_stats);
+#endif
+
+    py_bindfunc(mod, "compile_to_bytes", pkpy_compile_to_bytes);
+    py_bindfunc(mod, "exec_bytes", pkpy_exec_bytes);
+    py_bindfunc(mod, "compile_cache", pkpy_compile_cache);
 
     py_bindfunc(mod, "currentvm", pkpy_currentvm);
 
@@ -545,7 +602,12 @@ void pk__add_module_pkpy() {
     pkpy_configmacros_add(configmacros, "PK_ENABLE_THREADS", PK_ENABLE_THREADS);
     pkpy_configmacros_add(configmacros, "PK_ENABLE_DETERMINISM", PK_ENABLE_DETERMINISM);
     pkpy_configmacros_add(configmacros, "PK_ENABLE_WATCHDOG", PK_ENABLE_WATCHDOG);
-    pkpy_configmacros_add(configmacros, "PK_GC_MIN_THRESHOLD", PK_GC_MIN_THRESHOLD);
+    pkpy_configmacros_add(configmacros, "PK_ENABLE_IC_STATS", PK_ENABLE_IC_STATS);
+    pkpy_configmacros_add(configmacros, "PK_ENABLE_COMPUTED_GOTO", PK_ENABLE_COMPUTED_GOTO);
+    pkpy_configmacros_add(configmacros, "PK_GC_MIN_BYTES", PK_GC_MIN_BYTES);
+    pkpy_configmacros_add(configmacros, "PK_GC_HEAP_GROWTH", PK_GC_HEAP_GROWTH);
+    pkpy_configmacros_add(configmacros, "PK_GC_STEP_BUDGET_US", PK_GC_STEP_BUDGET_US);
+    pkpy_configmacros_add(configmacros, "PK_GC_ARENA_GRACE", PK_GC_ARENA_GRACE);
     pkpy_configmacros_add(configmacros, "PK_VM_STACK_SIZE", PK_VM_STACK_SIZE);
 }
 
@@ -0,0 +1,309 @@
+#include "pocketpy/pocketpy.h"
+#include "pocketpy/interpreter/vm.h"
+#include "pocketpy/interpreter/heap_tracer.h"
+#include "pocketpy/common/sstream.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define kHeapStatFields 4
+
+static const char* const kHeapStatNames[kHeapStatFields] = {
+    "count",
+    "size",
+    "total_count",
+    "total_size",
+};
+
+static const char* const kHeapStatDiffNames[kHeapStatFields] = {
+    "count_diff",
+    "size_diff",
+    "total_count_diff",
+    "total_size_diff",
+};
+
+enum HeapStatKey {
+    HEAP_STAT_LINENO,
+    HEAP_STAT_FILENAME,
+    HEAP_STAT_TYPE,
+    HEAP_STAT_SITE,
+};
+
+// records of a snapshot grouped by `key_type`
+typedef struct HeapStat {
+    const char* filename;  // NULL if not grouped by filename
+    int lineno;            // -1 if not grouped by line
+    py_Type type;          // 0 if not grouped by type
+    py_i64 values[2][kHeapStatFields];  // of the snapshot and of the old snapshot
+    py_i64 order[2];                    // sort keys, in descending order
+} HeapStat;
+
+static const char* HeapSnapshotRecord__filename(const HeapSnapshotRecord* self) {
+    return self->src ? self->src->filename->data : "<unknown>";
+}
+
+static int HeapStat__cmp_key(const void* a, const void* b) {
+    const HeapStat* lhs = a;
+    const HeapStat* rhs = b;
+    if(lhs->filename != rhs->filename) {
+        if(lhs->filename == NULL) return -1;
+        if(rhs->filename == NULL) return 1;
+        int res = strcmp(lhs->filename, rhs->filename);
+        if(res != 0) return res;
+    }
+    if(lhs->lineno != rhs->lineno) return lhs->lineno < rhs->lineno ? -1 : 1;
+    if(lhs->type != rhs->type) return lhs->type < rhs->type ? -1 : 1;
+    return 0;
+}
+
+static int HeapStat__cmp_order(const void* a, const void* b) {
+    const HeapStat* lhs = a;
+    const HeapStat* rhs = b;
+    for(int i = 0; i < 2; i++) {
+        if(lhs->order[i] != rhs->order[i]) return lhs->order[i] > rhs->order[i] ? -1 : 1;
+    }
+    return HeapStat__cmp_key(a, b);
+}
+
+static void HeapStat__add_records(c11_vector* stats, c11_vector* records, int key, int which) {
+    c11__foreach(HeapSnapshotRecord, records, record) {
+        HeapStat stat;
+        memset(&stat, 0, sizeof(HeapStat));
+        stat.filename = key == HEAP_STAT_TYPE ? NULL : HeapSnapshotRecord__filename(record);
+        stat.lineno = key == HEAP_STAT_LINENO || key == HEAP_STAT_SITE ? record->lineno : -1;
+        stat.type = key == HEAP_STAT_TYPE || key == HEAP_STAT_SITE ? record->type : 0;
+        stat.values[which][0] = record->count;
+        stat.values[which][1] = record->size;
+        stat.values[which][2] = record->total_count;
+        stat.values[which][3] = record->total_size;
+        c11_vector__push(HeapStat, stats, stat);
+    }
+}
+
+static bool HeapStat__parse_args(py_Ref argv, int* key, int* field, int* limit) {
+    PY_CHECK_ARG_TYPE(0, tp_str);
+    PY_CHECK_ARG_TYPE(1, tp_str);
+    const char* key_type = py_tostr(py_arg(0));
+    const char* sort_by = py_tostr(py_arg(1));
+    if(strcmp(key_type, "lineno") == 0) {
+        *key = HEAP_STAT_LINENO;
+    } else if(strcmp(key_type, "filename") == 0) {
+        *key = HEAP_STAT_FILENAME;
+    } else if(strcmp(key_type, "type") == 0) {
+        *key = HEAP_STAT_TYPE;
+    } else if(strcmp(key_type, "site") == 0) {
+        *key = HEAP_STAT_SITE;
+    } else {
+        return ValueError("unknown key_type: %s", key_type);
+    }
+    *field = -1;
+    for(int i = 0; i < kHeapStatFields; i++) {
+        if(strcmp(sort_by, kHeapStatNames[i]) == 0) *field = i;
+    }
+    if(*field < 0) return ValueError("unknown sort_by: %s", sort_by);
+    if(py_isnone(py_arg(2))) {
+        *limit = -1;
+    } else {
+        PY_CHECK_ARG_TYPE(2, tp_int);
+        *limit = (int)py_toint(py_arg(2));
+        if(*limit < 0) return ValueError("limit must be non-negative");
+    }
+    return true;
+}
+
+static bool HeapStat__set_int(py_Ref dict, const char* key, py_i64 value) {
+    py_newint(py_r0(), value);
+    return py_dict_setitem_by_str(dict, key, py_r0());
+}
+
+// group, sort and convert the records to a list of dicts
+static bool Snapshot__statistics(c11_vector* records, c11_vector* old_records, py_Ref argv) {
+    int key, field, limit;
+    if(!HeapStat__parse_args(argv, &key, &field, &limit)) return false;
+
+    c11_vector stats;
+    c11_vector__ctor(&stats, sizeof(HeapStat));
+    HeapStat__add_records(&stats, records, key, 0);
+    if(old_records) HeapStat__add_records(&stats, old_records, key, 1);
+    if(stats.length > 0) qsort(stats.data, stats.length, sizeof(HeapStat), HeapStat__cmp_key);
+
+    // merge the records of the same key
+    int length = 0;
+    for(int i = 0; i < stats.length; i++) {
+        HeapStat* curr = c11__at(HeapStat, &stats, i);
+        HeapStat* last = length > 0 ? c11__at(HeapStat, &stats, length - 1) : NULL;
+        if(last && HeapStat__cmp_key(last, curr) == 0) {
+            for(int j = 0; j < kHeapStatFields; j++) {
+                last->values[0][j] += curr->values[0][j];
+                last->values[1][j] += curr->values[1][j];
+            }
+        } else {
+            c11__setitem(HeapStat, &stats, length, *curr);
+            length++;
+        }
+    }
+    stats.length = length;
+
+    c11__foreach(HeapStat, &stats, stat) {
+        if(old_records) {
+            py_i64 diff = stat->values[0][field] - stat->values[1][field];
+            stat->order[0] = diff < 0 ? -diff : diff;
+            stat->order[1] = stat->values[0][field];
+        } else {
+            stat->order[0] = stat->values[0][field];
+            stat->order[1] = 0;
+        }
+    }
+    if(stats.length > 0) qsort(stats.data, stats.length, sizeof(HeapStat), HeapStat__cmp_order);
+    if(limit >= 0 && limit < stats.length) stats.length = limit;
+
+    py_Ref list = py_pushtmp();
+    py_newlist(list);
+    py_Ref item = py_pushtmp();
+    bool ok = true;
+    c11__foreach(HeapStat, &stats, stat) {
+        py_newdict(item);
+        if(stat->filename) {
+            py_newstr(py_r0(), stat->filename);
+        } else {
+            py_newnone(py_r0());
+        }
+        ok = py_dict_setitem_by_str(item, "filename", py_r0());
+        if(!ok) break;
+        if(stat->lineno >= 0) {
+            py_newint(py_r0(), stat->lineno);
+        } else {
+            py_newnone(py_r0());
+        }
+        ok = py_dict_setitem_by_str(item, "lineno", py_r0());
+        if(!ok) break;
+        if(stat->type) {
+            py_newstr(py_r0(), py_tpname(stat->type));
+        } else {
+            py_newnone(py_r0());
+        }
+        ok = py_dict_setitem_by_str(item, "type", py_r0());
+        if(!ok) break;
+        for(int j = 0; j < kHeapStatFields && ok; j++) {
+            ok = HeapStat__set_int(item, kHeapStatNames[j], stat->values[0][j]);
+            if(ok && old_records) {
+                py_i64 diff = stat->values[0][j] - stat->values[1][j];
+                ok = HeapStat__set_int(item, kHeapStatDiffNames[j], diff);
+            }
+        }
+        if(!ok) break;
+        py_list_append(list, item);
+    }
+    c11_vector__dtor(&stats);
+    if(ok) py_assign(py_retval(), list);
+    py_shrink(2);
+    return ok;
+}
+
+static void Snapshot__dtor(void* ud) { HeapSnapshotRecord__dtor_all(ud); }
+
+static bool Snapshot__new__(int argc, py_Ref argv) {
+    c11_vector* ud = py_newobject(py_retval(), py_totype(argv), 0, sizeof(c11_vector));
+    c11_vector__ctor(ud, sizeof(HeapSnapshotRecord));
+    return true;
+}
+
+static bool Snapshot_statistics(int argc, py_Ref argv) {
+    c11_vector* records = py_touserdata(py_arg(0));
+    return Snapshot__statistics(records, NULL, py_arg(1));
+}
+
+static bool Snapshot_compare_to(int argc, py_Ref argv) {
+    py_Type type = py_gettype("tracemalloc", py_name("Snapshot"));
+    PY_CHECK_ARG_TYPE(1, type);
+    c11_vector* records = py_touserdata(py_arg(0));
+    c11_vector* old_records = py_touserdata(py_arg(1));
+    return Snapshot__statistics(records, old_records, py_arg(2));
+}
+
+static bool Snapshot_to_json(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    c11_vector* records = py_touserdata(py_arg(0));
+    c11_sbuf buf;
+    c11_sbuf__ctor(&buf);
+    c11_sbuf__write_cstr(&buf, "{\"records\": [");
+    for(int i = 0; i < records->length; i++) {
+        HeapSnapshotRecord* record = c11__at(HeapSnapshotRecord, records, i);
+        if(i > 0) c11_sbuf__write_cstr(&buf, ", ");
+        c11_sbuf__write_cstr(&buf, "{\"filename\": ");
+        const char* filename = HeapSnapshotRecord__filename(record);
+        c11_sbuf__write_quoted(&buf, (c11_sv){filename, strlen(filename)}, '"');
+        c11_sbuf__write_cstr(&buf, ", \"lineno\": ");
+        c11_sbuf__write_int(&buf, record->lineno);
+        c11_sbuf__write_cstr(&buf, ", \"type\": ");
+        const char* tpname = py_tpname(record->type);
+        c11_sbuf__write_quoted(&buf, (c11_sv){tpname, strlen(tpname)}, '"');
+        py_i64 values[kHeapStatFields] = {
+            record->count,
+            record->size,
+            record->total_count,
+            record->total_size,
+        };
+        for(int j = 0; j < kHeapStatFields; j++) {
+            c11_sbuf__write_cstr(&buf, ", \"");
+            c11_sbuf__write_cstr(&buf, kHeapStatNames[j]);
+            c11_sbuf__write_cstr(&buf, "\": ");
+            c11_sbuf__write_i64(&buf, values[j]);
+        }
+        c11_sbuf__write_char(&buf, '}');
+    }
+    c11_sbuf__write_cstr(&buf, "]}");
+    c11_sbuf__py_submit(&buf, py_retval());
+    return true;
+}
+
+static bool tracemalloc_start(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(0);
+    HeapTracer__start(&pk_current_vm->heap);
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool tracemalloc_stop(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(0);
+    HeapTracer__stop(&pk_current_vm->heap);
+    py_newnone(py_retval());
+    return true;
+}
+
+static bool tracemalloc_is_tracing(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(0);
+    py_newbool(py_retval(), pk_current_vm->heap.tracer != NULL);
+    return true;
+}
+
+static bool tracemalloc_take_snapshot(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(0);
+    ManagedHeap* heap = &pk_current_vm->heap;
+    if(heap->tracer == NULL) {
+        return RuntimeError("the tracemalloc module must be tracing memory allocations");
+    }
+    c11_vector records = HeapTracer__snapshot(heap);
+    py_Type type = py_gettype("tracemalloc", py_name("Snapshot"));
+    c11_vector* ud = py_newobject(py_retval(), type, 0, sizeof(c11_vector));
+    *ud = records;
+    return true;
+}
+
+void pk__add_module_tracemalloc() {
+    py_Ref mod = py_newmodule("tracemalloc");
+
+    py_Type type = py_newtype("Snapshot", tp_object, mod, Snapshot__dtor);
+    py_bindmagic(type, __new__, Snapshot__new__);
+    py_bind(py_tpobject(type),
+            "statistics(self, key_type='lineno', sort_by='size', limit=None)",
+            Snapshot_statistics);
+    py_bind(py_tpobject(type),
+            "compare_to(self, old, key_type='lineno', sort_by='size', limit=None)",
+            Snapshot_compare_to);
+    py_bindmethod(type, "to_json", Snapshot_to_json);
+
+    py_bindfunc(mod, "start", tracemalloc_start);
+    py_bindfunc(mod, "stop", tracemalloc_stop);
+    py_bindfunc(mod, "is_tracing", tracemalloc_is_tracing);
+    py_bindfunc(mod, "take_snapshot", tracemalloc_take_snapshot);
+}
@@ -14,7 +14,126 @@ void Bytecode__set_signed_arg(Bytecode* self, int arg) {
 bool Bytecode__is_forward_jump(const Bytecode* self) {
     Opcode op = self->op;
     return (op >= OP_JUMP_FORWARD && op <= OP_LOOP_BREAK) ||
-           (op == OP_FOR_ITER || op == OP_FOR_ITER_YIELD_VALUE);
+           (op == OP_FOR_ITER || op == OP_FOR_ITER_YIELD_VALUE) ||
+           (op >= OP_FOR_ITER_RANGE && op <= OP_FOR_ITER_DICT);
+}
+
+bool Bytecode__fuse(Bytecode* self, const Bytecode* next) {
+    Opcode fused;
+    switch(self->op) {
+        case OP_LOAD_FAST:
+            if(next->op == OP_LOAD_FAST) {
+                fused = OP_LOAD_FAST_LOAD_FAST;
+            } else if(next->op == OP_LOAD_ATTR) {
+                fused = OP_LOAD_FAST_LOAD_ATTR;
+            } else {
+                return false;
+            }
+            break;
+        case OP_COMPARE_LT:
+        case OP_COMPARE_LE:
+        case OP_COMPARE_EQ:
+        case OP_COMPARE_NE:
+        case OP_COMPARE_GT:
+        case OP_COMPARE_GE:
+            if(next->op != OP_POP_JUMP_IF_FALSE) return false;
+            // the comparison is moved into arg
+            self->arg = self->op;
+            fused = OP_COMPARE_POP_JUMP_IF_FALSE;
+            break;
+        case OP_LOAD_CONST:
+            if(next->op != OP_RETURN_VALUE || next->arg != BC_NOARG) return false;
+            fused = OP_LOAD_CONST_RETURN_VALUE;
+            break;
+        case OP_LOAD_SMALL_INT:
+            if(next->op != OP_BINARY_ADD) return false;
+            fused = OP_LOAD_SMALL_INT_BINARY_ADD;
+            break;
+        default: return false;
+    }
+    self->op = fused;
+    return true;
+}
+
+bool Opcode__has_inline_cache(Opcode op) {
+    return op == OP_LOAD_ATTR || op == OP_LOAD_METHOD || op == OP_STORE_ATTR;
+}
+
+Opcode Opcode__generic(Opcode op) {
+    switch(op) {
+        case OP_BINARY_ADD_INT:
+        case OP_BINARY_ADD_FLOAT: return OP_BINARY_ADD;
+        case OP_BINARY_SUB_INT:
+        case OP_BINARY_SUB_FLOAT: return OP_BINARY_SUB;
+        case OP_BINARY_MUL_INT:
+        case OP_BINARY_MUL_FLOAT: return OP_BINARY_MUL;
+        case OP_BINARY_FLOORDIV_INT: return OP_BINARY_FLOORDIV;
+        case OP_BINARY_MOD_INT: return OP_BINARY_MOD;
+        case OP_BINARY_TRUEDIV_FLOAT: return OP_BINARY_TRUEDIV;
+        case OP_COMPARE_LT_INT:
+        case OP_COMPARE_LT_FLOAT: return OP_COMPARE_LT;
+        case OP_COMPARE_LE_INT:
+        case OP_COMPARE_LE_FLOAT: return OP_COMPARE_LE;
+        case OP_COMPARE_EQ_INT:
+        case OP_COMPARE_EQ_FLOAT: return OP_COMPARE_EQ;
+        case OP_COMPARE_NE_INT:
+        case OP_COMPARE_NE_FLOAT: return OP_COMPARE_NE;
+        case OP_COMPARE_GT_INT:
+        case OP_COMPARE_GT_FLOAT: return OP_COMPARE_GT;
+        case OP_COMPARE_GE_INT:
+        case OP_COMPARE_GE_FLOAT: return OP_COMPARE_GE;
+        case OP_FOR_ITER_RANGE:
+        case OP_FOR_ITER_LIST:
+        case OP_FOR_ITER_TUPLE:
+        case OP_FOR_ITER_DICT: return OP_FOR_ITER;
+        default: return op;
+    }
+}
+
+Opcode Opcode__quicken_binary(Opcode op, py_Type lhs, py_Type rhs) {
+    bool is_lhs_num = lhs == tp_int || lhs == tp_float;
+    bool is_rhs_num = rhs == tp_int || rhs == tp_float;
+    if(!is_lhs_num || !is_rhs_num) return op;
+    if(lhs == tp_int && rhs == tp_int) {
+        switch(op) {
+            case OP_BINARY_ADD: return OP_BINARY_ADD_INT;
+            case OP_BINARY_SUB: return OP_BINARY_SUB_INT;
+            case OP_BINARY_MUL: return OP_BINARY_MUL_INT;
+            case OP_BINARY_FLOORDIV: return OP_BINARY_FLOORDIV_INT;
+            case OP_BINARY_MOD: return OP_BINARY_MOD_INT;
+            case OP_BINARY_TRUEDIV: return OP_BINARY_TRUEDIV_FLOAT;
+            case OP_COMPARE_LT: return OP_COMPARE_LT_INT;
+            case OP_COMPARE_LE: return OP_COMPARE_LE_INT;
+            case OP_COMPARE_EQ: return OP_COMPARE_EQ_INT;
+            case OP_COMPARE_NE: return OP_COMPARE_NE_INT;
+            case OP_COMPARE_GT: return OP_COMPARE_GT_INT;
+            case OP_COMPARE_GE: return OP_COMPARE_GE_INT;
+            default: return op;
+        }
+    }
+    switch(op) {
+        case OP_BINARY_ADD: return OP_BINARY_ADD_FLOAT;
+        case OP_BINARY_SUB: return OP_BINARY_SUB_FLOAT;
+        case OP_BINARY_MUL: return OP_BINARY_MUL_FLOAT;
+        case OP_BINARY_TRUEDIV: return OP_BINARY_TRUEDIV_FLOAT;
+        case OP_COMPARE_LT: return OP_COMPARE_LT_FLOAT;
+        case OP_COMPARE_LE: return OP_COMPARE_LE_FLOAT;
+        case OP_COMPARE_EQ: return OP_COMPARE_EQ_FLOAT;
+        case OP_COMPARE_NE: return OP_COMPARE_NE_FLOAT;
+        case OP_COMPARE_GT: return OP_COMPARE_GT_FLOAT;
+        case OP_COMPARE_GE: return OP_COMPARE_GE_FLOAT;
+        default: return op;
+    }
+}
+
+Opcode Opcode__quicken_for_iter(py_Type iter) {
+    switch(iter) {
+        case tp_range_iterator: return OP_FOR_ITER_RANGE;
+        case tp_list_iterator: return OP_FOR_ITER_LIST;
+        case tp_tuple_iterator: return OP_FOR_ITER_TUPLE;
+        case tp_dict_iterator: return OP_FOR_ITER_DICT;
+        default: return OP_FOR_ITER;
+    }
 }
 
 static void FuncDecl__dtor(FuncDecl* self) {
@@ -133,6 +252,7 @@ void CodeObject__ctor(CodeObject* self, SourceData_ src, c11_sv name) {
 
     c11_vector__ctor(&self->blocks, sizeof(CodeBlock));
     c11_vector__ctor(&self->func_decls, sizeof(FuncDecl_));
+    c11_vector__ctor(&self->caches, sizeof(InlineCache));
 
     self->start_line = -1;
     self->end_line = -1;
@@ -162,6 +282,7 @@ void CodeObject__dtor(CodeObject* self) {
         PK_DECREF(decl);
     }
     c11_vector__dtor(&self->func_decls);
+    c11_vector__dtor(&self->caches);
 }
 
 void Function__ctor(Function* self, FuncDecl_ decl, py_GlobalRef module, py_Ref globals) {
@@ -193,6 +314,12 @@ int CodeObject__add_name(CodeObject* self, py_Name name) {
     return index;
 }
 
+int CodeObject__add_inline_cache(CodeObject* self) {
+    InlineCache* ic = c11_vector__emplace(&self->caches);
+    memset(ic, 0, sizeof(InlineCache));
+    return self->caches.length - 1;
+}
+
 void Function__dtor(Function* self) {
     // printf("%s() in %s freed!\n", self->decl->code.name->data,
     // self->decl->code.src->filename->data);
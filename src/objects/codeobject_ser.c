@@ -0,0 +1,586 @@
+#include "pocketpy/objects/codeobject.h"
+#include "pocketpy/common/utils.h"
+#include "pocketpy/pocketpy.h"
+#include <string.h>
+
+/* Binary layout of a serialized code object.
+   `u64` is fixed-width little-endian, other integers are LEB128 varints (`i32`/`i64` zigzag-encoded).
+
+   header:
+       "pkc" u8(PK_CODE_FORMAT)
+       str(PK_VERSION) u64(hash of opcode names)
+       u8(mode) u8(is_dynamic) str(filename)
+       u64(source hash) i32(source size)
+   code:
+       str(name) i32(start_line) i32(end_line)
+       i32(n) n * [u8(op) varint(arg)]
+       n * [i32(lineno) i32(iblock) i32(icache)]
+       i32(ncaches)
+       i32(n) n * value
+       i32(n) n * str(varname)
+       i32(n) n * str(name)
+       i32(n) n * [u8(type) i32(parent) i32(start) i32(end) i32(end2)]
+       i32(n) n * funcdecl
+   funcdecl:
+       code
+       i32(n) n * i32(arg)
+       i32(n) n * [i32(index) str(key) value]
+       i32(starred_arg) i32(starred_kwarg) u8(nested) u8(type) i32(docstring const index)
+   value:
+       u8(tag) payload
+*/
+
+#define PK_CODE_FORMAT 2
+
+enum {
+    PKC_NONE,
+    PKC_FALSE,
+    PKC_TRUE,
+    PKC_INT,
+    PKC_FLOAT,
+    PKC_STR,
+    PKC_BYTES,
+    PKC_TUPLE,
+    PKC_ELLIPSIS,
+};
+
+static const int kOpcodeCount = 0
+#define OPCODE(name) +1
+#include "pocketpy/xmacros/opcodes.h"
+#undef OPCODE
+    ;
+
+// any change to the opcode table invalidates serialized code
+static uint64_t opcode_table_hash() {
+    static const char kOpcodeNames[] =
+#define OPCODE(name) #name ","
+#include "pocketpy/xmacros/opcodes.h"
+#undef OPCODE
+        ;
+    return c11_sv__hash((c11_sv){kOpcodeNames, sizeof(kOpcodeNames) - 1});
+}
+
+/* writer */
+static void w_u8(c11_vector* out, uint8_t v) { c11_vector__push(char, out, (char)v); }
+
+static void w_u64(c11_vector* out, uint64_t v) {
+    for(int i = 0; i < 8; i++) {
+        w_u8(out, (v >> (i * 8)) & 0xff);
+    }
+}
+
+static void w_varint(c11_vector* out, uint64_t v) {
+    while(v >= 0x80) {
+        w_u8(out, (v & 0x7f) | 0x80);
+        v >>= 7;
+    }
+    w_u8(out, v);
+}
+
+static void w_i64(c11_vector* out, int64_t v) { w_varint(out, ((uint64_t)v << 1) ^ (uint64_t)(v >> 63)); }
+
+static void w_i32(c11_vector* out, int v) { w_i64(out, v); }
+
+static void w_sv(c11_vector* out, c11_sv sv) {
+    w_i32(out, sv.size);
+    c11_vector__extend(char, out, sv.data, sv.size);
+}
+
+static bool w_value(c11_vector* out, py_Ref val) {
+    switch(val->type) {
+        case tp_NoneType: w_u8(out, PKC_NONE); return true;
+        case tp_bool: w_u8(out, py_tobool(val) ? PKC_TRUE : PKC_FALSE); return true;
+        case tp_int:
+            w_u8(out, PKC_INT);
+            w_i64(out, py_toint(val));
+            return true;
+        case tp_float: {
+            py_f64 f = py_tofloat(val);
+            uint64_t bits;
+            memcpy(&bits, &f, sizeof(bits));
+            w_u8(out, PKC_FLOAT);
+            w_u64(out, bits);
+            return true;
+        }
+        case tp_str:
+            w_u8(out, PKC_STR);
+            w_sv(out, py_tosv(val));
+            return true;
+        case tp_bytes: {
+            int size;
+            unsigned char* data = py_tobytes(val, &size);
+            w_u8(out, PKC_BYTES);
+            w_sv(out, (c11_sv){(const char*)data, size});
+            return true;
+        }
+        case tp_tuple: {
+            int n = py_tuple_len(val);
+            w_u8(out, PKC_TUPLE);
+            w_i32(out, n);
+            for(int i = 0; i < n; i++) {
+                if(!w_value(out, py_tuple_getitem(val, i))) return false;
+            }
+            return true;
+        }
+        case tp_ellipsis: w_u8(out, PKC_ELLIPSIS); return true;
+        default:
+            return TypeError("cannot serialize constant of type '%t'", val->type);
+    }
+}
+
+static bool w_code(c11_vector* out, const CodeObject* co);
+
+static bool w_funcdecl(c11_vector* out, const FuncDecl* decl) {
+    if(!w_code(out, &decl->code)) return false;
+    w_i32(out, decl->args.length);
+    c11__foreach(int, &decl->args, p) w_i32(out, *p);
+    w_i32(out, decl->kwargs.length);
+    c11__foreach(FuncDeclKwArg, &decl->kwargs, kw) {
+        w_i32(out, kw->index);
+        w_sv(out, py_name2sv(kw->key));
+        if(!w_value(out, &kw->value)) return false;
+    }
+    w_i32(out, decl->starred_arg);
+    w_i32(out, decl->starred_kwarg);
+    w_u8(out, decl->nested);
+    w_u8(out, decl->type);
+    // docstring is a weak ref into one of the string constants
+    int docstring = -1;
+    for(int i = 0; decl->docstring && i < decl->code.consts.length; i++) {
+        py_TValue* c = c11__at(py_TValue, &decl->code.consts, i);
+        if(c->type == tp_str && py_tostr(c) == decl->docstring) {
+            docstring = i;
+            break;
+        }
+    }
+    w_i32(out, docstring);
+    return true;
+}
+
+static bool w_code(c11_vector* out, const CodeObject* co) {
+    w_sv(out, c11_string__sv(co->name));
+    w_i32(out, co->start_line);
+    w_i32(out, co->end_line);
+    w_i32(out, co->codes.length);
+    c11__foreach(Bytecode, &co->codes, bc) {
+        // runtime specializations are written back as their generic forms
+        w_u8(out, Opcode__generic(bc->op));
+        w_varint(out, bc->arg);
+    }
+    c11__foreach(BytecodeEx, &co->codes_ex, ex) {
+        w_i32(out, ex->lineno);
+        w_i32(out, ex->iblock);
+        w_i32(out, ex->icache);
+    }
+    w_i32(out, co->caches.length);
+    w_i32(out, co->consts.length);
+    for(int i = 0; i < co->consts.length; i++) {
+        if(!w_value(out, c11__at(py_TValue, &co->consts, i))) return false;
+    }
+    w_i32(out, co->varnames.length);
+    c11__foreach(py_Name, &co->varnames, p) w_sv(out, py_name2sv(*p));
+    w_i32(out, co->names.length);
+    c11__foreach(py_Name, &co->names, p) w_sv(out, py_name2sv(*p));
+    w_i32(out, co->blocks.length);
+    c11__foreach(CodeBlock, &co->blocks, b) {
+        w_u8(out, b->type);
+        w_i32(out, b->parent);
+        w_i32(out, b->start);
+        w_i32(out, b->end);
+        w_i32(out, b->end2);
+    }
+    w_i32(out, co->func_decls.length);
+    c11__foreach(FuncDecl_, &co->func_decls, p) {
+        if(!w_funcdecl(out, *p)) return false;
+    }
+    return true;
+}
+
+bool CodeObject__serialize(const CodeObject* self, c11_sv source, c11_vector* out) {
+    c11_vector__extend(char, out, "pkc", 3);
+    w_u8(out, PK_CODE_FORMAT);
+    w_sv(out, (c11_sv){PK_VERSION, sizeof(PK_VERSION) - 1});
+    w_u64(out, opcode_table_hash());
+    w_u8(out, self->src->mode);
+    w_u8(out, self->src->is_dynamic);
+    w_sv(out, c11_string__sv(self->src->filename));
+    w_u64(out, c11_sv__hash(source));
+    w_i32(out, source.size);
+    return w_code(out, self);
+}
+
+/* reader */
+typedef struct Reader {
+    const unsigned char* p;
+    const unsigned char* end;
+    const char* error;
+} Reader;
+
+static bool r_fail(Reader* r, const char* msg) {
+    if(!r->error) r->error = msg;
+    r->p = r->end;
+    return false;
+}
+
+static bool r_has(Reader* r, int n) {
+    if(r->error) return false;
+    if(n < 0 || r->end - r->p < n) return r_fail(r, "unexpected end of data");
+    return true;
+}
+
+static uint8_t r_u8(Reader* r) {
+    if(!r_has(r, 1)) return 0;
+    return *r->p++;
+}
+
+static uint64_t r_u64(Reader* r) {
+    uint64_t v = 0;
+    for(int i = 0; i < 8; i++) {
+        v |= (uint64_t)r_u8(r) << (i * 8);
+    }
+    return v;
+}
+
+static uint64_t r_varint(Reader* r) {
+    uint64_t v = 0;
+    for(int shift = 0; shift < 64; shift += 7) {
+        uint8_t byte = r_u8(r);
+        v |= (uint64_t)(byte & 0x7f) << shift;
+        if(!(byte & 0x80)) return v;
+    }
+    r_fail(r, "invalid varint");
+    return 0;
+}
+
+static int64_t r_i64(Reader* r) {
+    uint64_t v = r_varint(r);
+    return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+static int r_i32(Reader* r) {
+    int64_t v = r_i64(r);
+    if(v < INT32_MIN || v > INT32_MAX) {
+        r_fail(r, "integer out of range");
+        return 0;
+    }
+    return (int)v;
+}
+
+// read a length prefix; each element takes at least `min_elem_size` bytes
+static int r_len(Reader* r, int min_elem_size) {
+    int n = r_i32(r);
+    if(r->error) return 0;
+    if(n < 0 || (r->end - r->p) / min_elem_size < n) {
+        r_fail(r, "invalid length");
+        return 0;
+    }
+    return n;
+}
+
+static c11_sv r_sv(Reader* r) {
+    int n = r_len(r, 1);
+    c11_sv sv = {(const char*)r->p, n};
+    r->p += n;
+    return sv;
+}
+
+static bool r_value(Reader* r, py_OutRef out, int depth) {
+    if(depth > 64) return r_fail(r, "constant nested too deeply");
+    switch(r_u8(r)) {
+        case PKC_NONE: py_newnone(out); return !r->error;
+        case PKC_FALSE: py_newbool(out, false); return true;
+        case PKC_TRUE: py_newbool(out, true); return true;
+        case PKC_INT: py_newint(out, r_i64(r)); return !r->error;
+        case PKC_FLOAT: {
+            uint64_t bits = r_u64(r);
+            py_f64 f;
+            memcpy(&f, &bits, sizeof(f));
+            py_newfloat(out, f);
+            return !r->error;
+        }
+        case PKC_STR: {
+            c11_sv sv = r_sv(r);
+            if(r->error) return false;
+            py_newstrv(out, sv);
+            return true;
+        }
+        case PKC_BYTES: {
+            c11_sv sv = r_sv(r);
+            if(r->error) return false;
+            unsigned char* p = py_newbytes(out, sv.size);
+            memcpy(p, sv.data, sv.size);
+            return true;
+        }
+        case PKC_TUPLE: {
+            int n = r_len(r, 1);
+            if(r->error) return false;
+            py_newtuple(out, n);
+            for(int i = 0; i < n; i++) {
+                if(!r_value(r, py_tuple_getitem(out, i), depth + 1)) return false;
+            }
+            return true;
+        }
+        case PKC_ELLIPSIS: py_newellipsis(out); return true;
+        default: return r_fail(r, "invalid constant tag");
+    }
+}
+
+static bool r_const_str(const CodeObject* co, int index) {
+    return index < co->consts.length && c11__at(py_TValue, &co->consts, index)->type == tp_str;
+}
+
+// the loaded code may come from anywhere, so every argument that the
+// interpreter uses as an index or a jump offset is checked here;
+// operand counts (e.g. of BUILD_TUPLE) are not checked against the stack depth
+static bool r_verify(Reader* r, const CodeObject* co) {
+    int ncodes = co->codes.length;
+    int nblocks = co->blocks.length;
+    const Bytecode* codes = co->codes.data;
+
+    c11__foreach(CodeBlock, &co->blocks, b) {
+        if(b->start < 0 || b->start > ncodes || b->end < -1 || b->end > ncodes ||
+           b->end2 < -1 || b->end2 > ncodes) {
+            return r_fail(r, "invalid block");
+        }
+    }
+    // no instruction may fall through the end of the code
+    if(codes[ncodes - 1].op != OP_RETURN_VALUE) return r_fail(r, "missing return");
+
+    for(int i = 0; i < ncodes; i++) {
+        const BytecodeEx* ex = c11__at(BytecodeEx, &co->codes_ex, i);
+        if(ex->iblock < 0 || ex->iblock >= nblocks) return r_fail(r, "invalid block index");
+        if(ex->icache < -1 || ex->icache >= co->caches.length) {
+            return r_fail(r, "invalid cache index");
+        }
+        Bytecode bc = codes[i];
+        if(Opcode__has_inline_cache(bc.op) && ex->icache < 0) {
+            return r_fail(r, "missing inline cache");
+        }
+        // quickened forms assume the operand types they were specialized for
+        if(Opcode__generic(bc.op) != bc.op) return r_fail(r, "invalid instruction");
+
+        bool ok = true;
+        switch(bc.op) {
+            case OP_LOAD_CONST:
+            case OP_LOAD_CONST_RETURN_VALUE: ok = bc.arg < co->consts.length; break;
+            case OP_BUILD_BYTES:
+            case OP_IMPORT_PATH:
+            case OP_FORMAT_STRING: ok = r_const_str(co, bc.arg); break;
+            case OP_LOAD_KWARG_KEY:
+            case OP_LOAD_NAME:
+            case OP_LOAD_NONLOCAL:
+            case OP_LOAD_GLOBAL:
+            case OP_LOAD_ATTR:
+            case OP_LOAD_CLASS_GLOBAL:
+            case OP_LOAD_METHOD:
+            case OP_STORE_NAME:
+            case OP_STORE_GLOBAL:
+            case OP_STORE_ATTR:
+            case OP_DELETE_NAME:
+            case OP_DELETE_GLOBAL:
+            case OP_DELETE_ATTR:
+            case OP_BEGIN_CLASS:
+            case OP_END_CLASS:
+            case OP_STORE_CLASS_ATTR:
+            case OP_ADD_CLASS_ANNOTATION: ok = bc.arg < co->names.length; break;
+            case OP_LOAD_FAST:
+            case OP_STORE_FAST:
+            case OP_DELETE_FAST:
+            case OP_LOAD_FAST_LOAD_FAST:
+            case OP_LOAD_FAST_LOAD_ATTR: ok = bc.arg < co->nlocals; break;
+            case OP_LOAD_FUNCTION: ok = bc.arg < co->func_decls.length; break;
+            case OP_BEGIN_TRY: {
+                // exceptions raised inside the block jump to its end
+                int end = c11__at(CodeBlock, &co->blocks, ex->iblock)->end;
+                ok = end >= 0 && end < ncodes;
+                break;
+            }
+            case OP_COMPARE_POP_JUMP_IF_FALSE:
+                ok = bc.arg >= OP_COMPARE_LT && bc.arg <= OP_COMPARE_GE;
+                break;
+            default: break;
+        }
+        if(ok && Bytecode__is_forward_jump(&bc)) {
+            int target = i + (int16_t)bc.arg;
+            ok = target >= 0 && target < ncodes;
+        }
+        // the second instruction of a superinstruction is run in place
+        switch(bc.op) {
+            case OP_LOAD_FAST_LOAD_FAST: ok = ok && codes[i + 1].op == OP_LOAD_FAST; break;
+            case OP_LOAD_FAST_LOAD_ATTR: ok = ok && codes[i + 1].op == OP_LOAD_ATTR; break;
+            case OP_COMPARE_POP_JUMP_IF_FALSE:
+                ok = ok && codes[i + 1].op == OP_POP_JUMP_IF_FALSE;
+                break;
+            case OP_LOAD_CONST_RETURN_VALUE: ok = ok && codes[i + 1].op == OP_RETURN_VALUE; break;
+            case OP_LOAD_SMALL_INT_BINARY_ADD: ok = ok && codes[i + 1].op == OP_BINARY_ADD; break;
+            default: break;
+        }
+        if(!ok) return r_fail(r, "invalid instruction argument");
+    }
+    return true;
+}
+
+static bool r_code(Reader* r, CodeObject* co, int depth);
+
+static bool r_funcdecl(Reader* r, CodeObject* parent, int depth) {
+    FuncDecl_ decl = FuncDecl__rcnew(parent->src, (c11_sv){"", 0});
+    // owned by `parent` from now on, so it is released on failure
+    c11_vector__push(FuncDecl_, &parent->func_decls, decl);
+    if(!r_code(r, &decl->code, depth + 1)) return false;
+    int nvarnames = decl->code.varnames.length;
+
+    int nargs = r_len(r, 1);
+    for(int i = 0; i < nargs; i++) {
+        int index = r_i32(r);
+        if(index < 0 || index >= nvarnames) return r_fail(r, "invalid argument index");
+        c11_vector__push(int, &decl->args, index);
+    }
+    int nkwargs = r_len(r, 3);
+    for(int i = 0; i < nkwargs; i++) {
+        FuncDeclKwArg* kw = c11_vector__emplace(&decl->kwargs);
+        kw->index = r_i32(r);
+        kw->key = py_namev(r_sv(r));
+        py_newnone(&kw->value);
+        if(!r_value(r, &kw->value, 0)) return false;
+        if(kw->index < 0 || kw->index >= nvarnames) return r_fail(r, "invalid argument index");
+        c11_smallmap_n2d__set(&decl->kw_to_index, kw->key, kw->index);
+    }
+    decl->starred_arg = r_i32(r);
+    decl->starred_kwarg = r_i32(r);
+    if(decl->starred_arg < -1 || decl->starred_arg >= nvarnames ||
+       decl->starred_kwarg < -1 || decl->starred_kwarg >= nvarnames) {
+        return r_fail(r, "invalid argument index");
+    }
+    decl->nested = r_u8(r) != 0;
+    decl->type = (FuncType)r_u8(r);
+    if(decl->type > FuncType_GENERATOR) return r_fail(r, "invalid function type");
+    int docstring = r_i32(r);
+    if(docstring >= 0) {
+        if(docstring >= decl->code.consts.length) return r_fail(r, "invalid docstring");
+        py_TValue* c = c11__at(py_TValue, &decl->code.consts, docstring);
+        if(c->type != tp_str) return r_fail(r, "invalid docstring");
+        decl->docstring = py_tostr(c);
+    }
+    return !r->error;
+}
+
+static bool r_code(Reader* r, CodeObject* co, int depth) {
+    if(depth > 256) return r_fail(r, "code nested too deeply");
+    c11_sv name = r_sv(r);
+    if(r->error) return false;
+    c11_string__delete(co->name);
+    co->name = c11_string__new2(name.data, name.size);
+    co->start_line = r_i32(r);
+    co->end_line = r_i32(r);
+
+    int ncodes = r_len(r, 5);
+    if(ncodes == 0) return r_fail(r, "empty code");
+    c11_vector__reserve(&co->codes, ncodes);
+    for(int i = 0; i < ncodes; i++) {
+        Bytecode bc;
+        bc.op = r_u8(r);
+        bc.counter = 0;
+        uint64_t arg = r_varint(r);
+        if(bc.op >= kOpcodeCount || arg > UINT16_MAX) return r_fail(r, "invalid instruction");
+        bc.arg = (uint16_t)arg;
+        c11_vector__push(Bytecode, &co->codes, bc);
+    }
+    c11_vector__reserve(&co->codes_ex, ncodes);
+    for(int i = 0; i < ncodes; i++) {
+        BytecodeEx ex;
+        ex.lineno = r_i32(r);
+        ex.iblock = r_i32(r);
+        ex.icache = r_i32(r);
+        c11_vector__push(BytecodeEx, &co->codes_ex, ex);
+    }
+    int ncaches = r_i32(r);
+    if(ncaches < 0 || ncaches > ncodes) return r_fail(r, "invalid length");
+    for(int i = 0; i < ncaches; i++) {
+        CodeObject__add_inline_cache(co);
+    }
+
+    int nconsts = r_len(r, 1);
+    for(int i = 0; i < nconsts; i++) {
+        py_TValue* c = c11_vector__emplace(&co->consts);
+        py_newnone(c);
+        if(!r_value(r, c, 0)) return false;
+    }
+    int nvarnames = r_len(r, 1);
+    for(int i = 0; i < nvarnames; i++) {
+        c11_sv sv = r_sv(r);
+        if(r->error) return false;
+        if(CodeObject__add_varname(co, py_namev(sv)) != i) return r_fail(r, "duplicated varname");
+    }
+    // module code has no fast locals, `frame->locals` is not an array there
+    if(depth == 0 && nvarnames > 0) return r_fail(r, "unexpected varnames");
+    int nnames = r_len(r, 1);
+    for(int i = 0; i < nnames; i++) {
+        c11_sv sv = r_sv(r);
+        if(r->error) return false;
+        if(CodeObject__add_name(co, py_namev(sv)) != i) return r_fail(r, "duplicated name");
+    }
+
+    // discard the root block pushed by CodeObject__ctor
+    c11_vector__clear(&co->blocks);
+    int nblocks = r_len(r, 5);
+    if(nblocks == 0) return r_fail(r, "missing root block");
+    for(int i = 0; i < nblocks; i++) {
+        CodeBlock b;
+        b.type = (CodeBlockType)r_u8(r);
+        b.parent = r_i32(r);
+        b.start = r_i32(r);
+        b.end = r_i32(r);
+        b.end2 = r_i32(r);
+        if(b.type > CodeBlockType_EXCEPT || b.parent < -1 || b.parent >= nblocks) {
+            return r_fail(r, "invalid block");
+        }
+        c11_vector__push(CodeBlock, &co->blocks, b);
+    }
+
+    int nfuncs = r_len(r, 1);
+    for(int i = 0; i < nfuncs; i++) {
+        if(!r_funcdecl(r, co, depth)) return false;
+    }
+    if(r->error) return false;
+    return r_verify(r, co);
+}
+
+const char* CodeObject__deserialize(CodeObject* out, const void* data, int size, const char* source) {
+    Reader r = {data, (const unsigned char*)data + size, NULL};
+    if(!r_has(&r, 4) || memcmp(r.p, "pkc", 3) != 0) return "not a pkc file";
+    r.p += 3;
+    if(r_u8(&r) != PK_CODE_FORMAT) return "unsupported format version";
+    c11_sv version = r_sv(&r);
+    if(r.error) return r.error;
+    if(!c11__sveq2(version, PK_VERSION)) return "version mismatch";
+    if(r_u64(&r) != opcode_table_hash()) return "opcode table mismatch";
+    enum py_CompileMode mode = (enum py_CompileMode)r_u8(&r);
+    bool is_dynamic = r_u8(&r) != 0;
+    c11_sv filename = r_sv(&r);
+    uint64_t hash = r_u64(&r);
+    int source_size = r_i32(&r);
+    if(r.error) return r.error;
+    if(mode != EXEC_MODE && mode != EVAL_MODE && mode != SINGLE_MODE && mode != RELOAD_MODE) {
+        return "invalid compile mode";
+    }
+    if(source) {
+        c11_sv sv = {source, strlen(source)};
+        if(sv.size != source_size || c11_sv__hash(sv) != hash) return "source mismatch";
+    }
+
+    c11_string* filename_str = c11_string__new2(filename.data, filename.size);
+    SourceData_ src = SourceData__rcnew(source ? source : "", filename_str->data, mode, is_dynamic);
+    c11_string__delete(filename_str);
+    // rebuild the line table normally filled by the lexer, so tracebacks can show source lines
+    for(const char* p = src->source->data; *p; p++) {
+        if(*p == '\n') c11_vector__push(const char*, &src->line_starts, p + 1);
+    }
+
+    CodeObject__ctor(out, src, (c11_sv){"", 0});
+    PK_DECREF(src);
+    if(!r_code(&r, out, 0) || r.p != r.end) {
+        CodeObject__dtor(out);
+        return r.error ? r.error : "trailing data";
+    }
+    return NULL;
+}
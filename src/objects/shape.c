@@ -0,0 +1,198 @@
+#include "pocketpy/objects/shape.h"
+#include "pocketpy/objects/object.h"
+#include "pocketpy/common/utils.h"
+#include "pocketpy/interpreter/vm.h"
+
+#include <string.h>
+#include <assert.h>
+
+static Shape* Shape__new(Shape* parent, py_Name name) {
+    int length = parent ? parent->length + 1 : 0;
+    Shape* self = PK_MALLOC(sizeof(Shape) + sizeof(py_Name) * length);
+    self->parent = parent;
+    self->first_child = NULL;
+    self->next_sibling = NULL;
+    self->length = length;
+    if(parent) {
+        memcpy(self->names, parent->names, sizeof(py_Name) * parent->length);
+        self->names[length - 1] = name;
+        self->next_sibling = parent->first_child;
+        parent->first_child = self;
+    }
+    return self;
+}
+
+static void Shape__delete(Shape* self) {
+    // the depth is at most `PK_SHAPE_MAX_ATTRS`
+    Shape* child = self->first_child;
+    while(child) {
+        Shape* next = child->next_sibling;
+        Shape__delete(child);
+        child = next;
+    }
+    PK_FREE(self);
+}
+
+void ShapeTree__ctor(ShapeTree* self) {
+    self->root = Shape__new(NULL, NULL);
+    self->count = 1;
+}
+
+void ShapeTree__dtor(ShapeTree* self) { Shape__delete(self->root); }
+
+Shape* ShapeTree__transition(ShapeTree* self, Shape* shape, py_Name name) {
+    for(Shape* p = shape->first_child; p; p = p->next_sibling) {
+        if(p->names[p->length - 1] == name) return p;
+    }
+    if(shape->length >= PK_SHAPE_MAX_ATTRS || self->count >= PK_SHAPE_MAX_COUNT) return NULL;
+    self->count++;
+    return Shape__new(shape, name);
+}
+
+////////////////////////////////
+// move the attributes of an instance into a `NameDict`, it never gets a shape again until cleared
+static void InstanceDict__to_namedict(PyObject* self) {
+    InstanceDict* d = PyObject__instdict(self);
+    NameDict* dict = NameDict__new(PK_INST_ATTR_LOAD_FACTOR);
+    for(int i = 0; i < d->shape->length; i++) {
+        NameDict__set(dict, d->shape->names[i], PyObject__instdict_at(self, i));
+    }
+    memset(d->values, 0, sizeof(py_TValue) * PK_OBJ_INLINE_ATTRS(self->slots));
+    PK_FREE(d->extra);
+    d->shape = NULL;
+    d->dict = dict;
+    ManagedHeap__account(&pk_current_vm->heap, dict->capacity * sizeof(NameDict_KV));
+}
+
+void PyObject__instdict_append(PyObject* self, Shape* next, py_TValue* val) {
+    InstanceDict* d = PyObject__instdict(self);
+    assert(next->parent == d->shape);
+    int n = PK_OBJ_INLINE_ATTRS(self->slots);
+    int index = d->shape->length;
+    if(index < n) {
+        d->values[index] = *val;
+    } else {
+        int old_cap = InstanceDict__extra_capacity(index - n);
+        int new_cap = InstanceDict__extra_capacity(index - n + 1);
+        if(new_cap > old_cap) {
+            d->extra = PK_REALLOC(d->extra, sizeof(py_TValue) * new_cap);
+            ManagedHeap__account(&pk_current_vm->heap, sizeof(py_TValue) * (new_cap - old_cap));
+        }
+        d->extra[index - n] = *val;
+        // later instances of the type keep as many attributes inline
+        py_TypeInfo* ti = pk_typeinfo(self->type);
+        if(ti->inline_attrs <= index) {
+            ti->inline_attrs = c11__min(index + 1, PK_INST_MAX_INLINE_ATTRS);
+        }
+    }
+    d->shape = next;
+}
+
+PK_INLINE py_TValue* PyObject__getdict(PyObject* self, py_Name name) {
+    assert(self->slots < 0);
+    if(self->slots == -1) return NameDict__try_get(PyObject__dict(self), name);
+    InstanceDict* d = PyObject__instdict(self);
+    if(d->shape == NULL) return NameDict__try_get(d->dict, name);
+    int index = Shape__index(d->shape, name);
+    return index >= 0 ? PyObject__instdict_at(self, index) : NULL;
+}
+
+void PyObject__setdict(PyObject* self, py_Name name, py_TValue* val) {
+    assert(self->slots < 0);
+    if(self->slots == -1) {
+        NameDict__set(PyObject__dict(self), name, val);
+        return;
+    }
+    InstanceDict* d = PyObject__instdict(self);
+    if(d->shape != NULL) {
+        int index = Shape__index(d->shape, name);
+        if(index >= 0) {
+            *PyObject__instdict_at(self, index) = *val;
+            return;
+        }
+        Shape* next = ShapeTree__transition(&pk_current_vm->shapes, d->shape, name);
+        if(next != NULL) {
+            PyObject__instdict_append(self, next, val);
+            return;
+        }
+        InstanceDict__to_namedict(self);
+    }
+    NameDict__set(d->dict, name, val);
+}
+
+bool PyObject__deldict(PyObject* self, py_Name name) {
+    assert(self->slots < 0);
+    if(self->slots == -1) return NameDict__del(PyObject__dict(self), name);
+    InstanceDict* d = PyObject__instdict(self);
+    if(d->shape != NULL) {
+        int index = Shape__index(d->shape, name);
+        if(index < 0) return false;
+        if(index == d->shape->length - 1) {
+            // the last attribute goes back to the parent shape
+            py_newnil(PyObject__instdict_at(self, index));
+            d->shape = d->shape->parent;
+            return true;
+        }
+        InstanceDict__to_namedict(self);
+    }
+    return NameDict__del(d->dict, name);
+}
+
+void PyObject__cleardict(PyObject* self) {
+    assert(self->slots < 0);
+    if(self->slots == -1) {
+        NameDict__clear(PyObject__dict(self));
+        return;
+    }
+    InstanceDict* d = PyObject__instdict(self);
+    if(d->shape == NULL) {
+        NameDict__delete(d->dict);
+    } else {
+        PK_FREE(d->extra);
+    }
+    memset(d->values, 0, sizeof(py_TValue) * PK_OBJ_INLINE_ATTRS(self->slots));
+    d->shape = pk_current_vm->shapes.root;
+    d->extra = NULL;
+}
+
+int PyObject__dictlen(PyObject* self) {
+    assert(self->slots < 0);
+    if(self->slots == -1) return PyObject__dict(self)->length;
+    InstanceDict* d = PyObject__instdict(self);
+    return d->shape ? d->shape->length : d->dict->length;
+}
+
+bool PyObject__nextdict(PyObject* self, int* i, py_Name* name, py_TValue** val) {
+    assert(self->slots < 0);
+    NameDict* dict;
+    if(self->slots == -1) {
+        dict = PyObject__dict(self);
+    } else {
+        InstanceDict* d = PyObject__instdict(self);
+        if(d->shape != NULL) {
+            if(*i >= d->shape->length) return false;
+            *name = d->shape->names[*i];
+            *val = PyObject__instdict_at(self, *i);
+            (*i)++;
+            return true;
+        }
+        dict = d->dict;
+    }
+    while(*i < dict->capacity) {
+        NameDict_KV* kv = &dict->items[(*i)++];
+        if(kv->key == NULL) continue;
+        *name = kv->key;
+        *val = &kv->value;
+        return true;
+    }
+    return false;
+}
+
+int64_t PyObject__dict_external_bytes(PyObject* self) {
+    assert(self->slots < 0);
+    if(self->slots == -1) return PyObject__dict(self)->capacity * sizeof(NameDict_KV);
+    InstanceDict* d = PyObject__instdict(self);
+    if(d->shape == NULL) return d->dict->capacity * sizeof(NameDict_KV);
+    int n_extra = d->shape->length - PK_OBJ_INLINE_ATTRS(self->slots);
+    return n_extra > 0 ? InstanceDict__extra_capacity(n_extra) * sizeof(py_TValue) : 0;
+}
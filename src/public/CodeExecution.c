@@ -5,8 +5,10 @@
 #include "pocketpy/common/utils.h"
 #include "pocketpy/interpreter/vm.h"
 #include "pocketpy/compiler/compiler.h"
+#include "pocketpy/common/_generated.h"
 #include <assert.h>
 #include <ctype.h>
+#include <string.h>
 
 py_Type pk_code__register() {
     py_Type type = pk_newtype("code", tp_object, NULL, (py_Dtor)CodeObject__dtor, false, true);
@@ -115,10 +117,10 @@ static bool
         buf[0] = '_';
         buf[1] = '0' + i;
         buf[2] = '\0';
-        py_dict_setitem_by_str(locals, buf, val);
+        if(!py_dict_setitem_by_str(locals, buf, val)) return false;
         if(i == 0) {
             // _ => _0
-            py_dict_setitem_by_str(locals, "_", val);
+            if(!py_dict_setitem_by_str(locals, "_", val)) return false;
         }
     }
     ok = pk_execdyn(co, module, py_peek(-3), locals);
@@ -149,6 +151,104 @@ bool py_exec(const char* source, const char* filename, enum py_CompileMode mode,
     return ok;
 }
 
+bool py_compile_to_bytes(const char* source, const char* filename, enum py_CompileMode mode) {
+    CodeObject co;
+    if(!_py_compile(&co, source, filename, mode, false)) return false;
+    c11_vector buf;
+    c11_vector__ctor(&buf, sizeof(char));
+    bool ok = CodeObject__serialize(&co, (c11_sv){source, strlen(source)}, &buf);
+    CodeObject__dtor(&co);
+    if(ok) {
+        unsigned char* p = py_newbytes(py_retval(), buf.length);
+        memcpy(p, buf.data, buf.length);
+    }
+    c11_vector__dtor(&buf);
+    return ok;
+}
+
+bool py_exec_bytes(const unsigned char* data, int size, py_Ref module) {
+    CodeObject co;
+    const char* err = CodeObject__deserialize(&co, data, size, NULL);
+    if(err) return ValueError("invalid bytecode: %s", err);
+    bool ok = pk_exec(&co, module);
+    CodeObject__dtor(&co);
+    return ok;
+}
+
+void py_setcompilecache(bool enabled) { pk_current_vm->compile_cache = enabled; }
+
+#if PK_ENABLE_OS
+static char* pk_readfile(const char* path, int* size) {
+    FILE* f = fopen(path, "rb");
+    if(f == NULL) return NULL;
+    fseek(f, 0, SEEK_END);
+    long n = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char* buffer = PK_MALLOC(n > 0 ? n : 1);
+    *size = (int)fread(buffer, 1, n, f);
+    fclose(f);
+    return buffer;
+}
+#endif
+
+bool pk_exec_cached(const char* source, const char* filename, py_Ref module) {
+#if PK_ENABLE_OS
+    VM* vm = pk_current_vm;
+    int len = strlen(filename);
+    if(!vm->compile_cache || len < 3 || strcmp(filename + len - 3, ".py") != 0) {
+        return py_exec(source, filename, EXEC_MODE, module);
+    }
+    // foo.py => foo.pkc
+    c11_string* path = c11_string__new3("%vpkc", (c11_sv){filename, len - 2});
+    CodeObject co;
+    int size;
+    char* data = pk_readfile(path->data, &size);
+    bool hit = data && CodeObject__deserialize(&co, data, size, source) == NULL;
+    PK_FREE(data);
+    if(!hit) {
+        if(!_py_compile(&co, source, filename, EXEC_MODE, false)) {
+            c11_string__delete(path);
+            return false;
+        }
+        c11_vector buf;
+        c11_vector__ctor(&buf, sizeof(char));
+        py_StackRef p0 = py_peek(0);
+        if(CodeObject__serialize(&co, (c11_sv){source, strlen(source)}, &buf)) {
+            // the cache is best-effort, write errors are ignored
+            FILE* f = fopen(path->data, "wb");
+            if(f) {
+                fwrite(buf.data, 1, buf.length, f);
+                fclose(f);
+            }
+        } else {
+            py_clearexc(p0);
+        }
+        c11_vector__dtor(&buf);
+    }
+    c11_string__delete(path);
+    bool ok = pk_exec(&co, module);
+    CodeObject__dtor(&co);
+    return ok;
+#else
+    return py_exec(source, filename, EXEC_MODE, module);
+#endif
+}
+
+bool pk_exec_pythonlib(const char* name, const char* source, const char* filename, py_Ref module) {
+    int size;
+    const unsigned char* data = load_kPythonLibBytecode(name, &size);
+    if(data) {
+        CodeObject co;
+        // fails if `_generated.c` is stale, e.g. the opcodes changed since `prebuild.py` ran
+        if(CodeObject__deserialize(&co, data, size, source) == NULL) {
+            bool ok = pk_exec(&co, module);
+            CodeObject__dtor(&co);
+            return ok;
+        }
+    }
+    return py_exec(source, filename, EXEC_MODE, module);
+}
+
 bool py_eval(const char* source, py_Ref module) {
     return py_exec(source, "<string>", EVAL_MODE, module);
 }
@@ -8,31 +8,34 @@ PK_INLINE py_Ref py_retval() { return &pk_current_vm->last_retval; }
 
 PK_INLINE py_Ref py_getdict(py_Ref self, py_Name name) {
     assert(self && self->is_ptr);
-    return NameDict__try_get(PyObject__dict(self->_obj), name);
+    return PyObject__getdict(self->_obj, name);
 }
 
 PK_INLINE void py_setdict(py_Ref self, py_Name name, py_Ref val) {
     assert(self && self->is_ptr);
-    NameDict__set(PyObject__dict(self->_obj), name, val);
+    if(self->type == tp_type) pk_tpmodified(py_touserdata(self));
+    pk__write_barrier_value(self->_obj, val);
+    PyObject__setdict(self->_obj, name, val);
 }
 
 bool py_deldict(py_Ref self, py_Name name) {
     assert(self && self->is_ptr);
-    return NameDict__del(PyObject__dict(self->_obj), name);
+    if(self->type == tp_type) pk_tpmodified(py_touserdata(self));
+    return PyObject__deldict(self->_obj, name);
 }
 
 py_ItemRef py_emplacedict(py_Ref self, py_Name name) {
+    pk__write_barrier(self->_obj);
     py_setdict(self, name, py_NIL());
     return py_getdict(self, name);
 }
 
 bool py_applydict(py_Ref self, bool (*f)(py_Name, py_Ref, void*), void* ctx) {
     assert(self && self->is_ptr);
-    NameDict* dict = PyObject__dict(self->_obj);
-    for(int i = 0; i < dict->capacity; i++) {
-        NameDict_KV* kv = &dict->items[i];
-        if(kv->key == NULL) continue;
-        bool ok = f(kv->key, &kv->value, ctx);
+    py_Name name;
+    py_TValue* val;
+    for(int i = 0; PyObject__nextdict(self->_obj, &i, &name, &val);) {
+        bool ok = f(name, val, ctx);
         if(!ok) return false;
     }
     return true;
@@ -40,8 +43,8 @@ bool py_applydict(py_Ref self, bool (*f)(py_Name, py_Ref, void*), void* ctx) {
 
 void py_cleardict(py_Ref self) {
     assert(self && self->is_ptr);
-    NameDict* dict = PyObject__dict(self->_obj);
-    NameDict__clear(dict);
+    if(self->type == tp_type) pk_tpmodified(py_touserdata(self));
+    PyObject__cleardict(self->_obj);
 }
 
 py_Ref py_getslot(py_Ref self, int i) {
@@ -53,6 +56,7 @@ py_Ref py_getslot(py_Ref self, int i) {
 void py_setslot(py_Ref self, int i, py_Ref val) {
     assert(self && self->is_ptr);
     assert(i >= 0 && i < self->_obj->slots);
+    pk__write_barrier_value(self->_obj, val);
     PyObject__slots(self->_obj)[i] = *val;
 }
 
@@ -138,6 +138,21 @@ int py_gc_collect() {
     return ManagedHeap__collect(heap);
 }
 
+bool py_gc_step(int budget_us) {
+    ManagedHeap* heap = &pk_current_vm->heap;
+    return ManagedHeap__step(heap, budget_us);
+}
+
+void py_setmemorylimit(size_t bytes) {
+    ManagedHeap* heap = &pk_current_vm->heap;
+    ManagedHeap__set_limit(heap, (int64_t)c11__min(bytes, (size_t)INT64_MAX));
+}
+
+size_t py_getmemoryusage() {
+    ManagedHeap* heap = &pk_current_vm->heap;
+    return (size_t)ManagedHeap__used_bytes(heap);
+}
+
 /////////////////////////////
 
 void* py_malloc(size_t size) { return PK_MALLOC(size); }
@@ -163,7 +163,12 @@ __SUCCESS:
     do {
     } while(0);
     py_GlobalRef mod = py_newmodule(path_cstr);
-    bool ok = py_exec((const char*)data, filename->data, EXEC_MODE, mod);
+    bool ok;
+    if(need_free) {
+        ok = pk_exec_cached(data, filename->data, mod);
+    } else {
+        ok = pk_exec_pythonlib(path_cstr, data, filename->data, mod);
+    }
     py_assign(py_retval(), mod);
 
     c11_string__delete(filename);
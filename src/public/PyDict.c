@@ -8,59 +8,92 @@
 typedef struct {
     Dict* dict;  // weakref for slot 0
     Dict dict_backup;
-    DictEntry* curr;
-    DictEntry* end;
+    int index;
     int mode;  // 0: keys, 1: values, 2: items
 } DictIterator;
 
-#define Dict__step(x) ((x) < mask ? (x) + 1 : 0)
-
-static uint32_t Dict__next_cap(uint32_t cap) {
-    switch(cap) {
-        case 7: return 17;
-        case 17: return 37;
-        case 37: return 79;
-        case 79: return 163;
-        case 163: return 331;
-        case 331: return 673;
-        case 673: return 1361;
-        case 1361: return 2053;
-        case 2053: return 3083;
-        case 3083: return 4637;
-        case 4637: return 6959;
-        case 6959: return 10453;
-        case 10453: return 15683;
-        case 15683: return 23531;
-        case 23531: return 35311;
-        case 35311: return 52967;
-        case 52967: return 79451;
-        case 79451: return 119179;
-        case 119179: return 178781;
-        case 178781: return 268189;
-        case 268189: return 402299;
-        case 402299: return 603457;
-        case 603457: return 905189;
-        case 905189: return 1357787;
-        case 1357787: return 2036687;
-        case 2036687: return 3055043;
-        case 3055043: return 4582577;
-        case 4582577: return 6873871;
-        case 6873871: return 10310819;
-        case 10310819: return 15466229;
-        case 15466229: return 23199347;
-        case 23199347: return 34799021;
-        case 34799021: return 52198537;
-        case 52198537: return 78297827;
-        case 78297827: return 117446801;
-        case 117446801: return 176170229;
-        case 176170229: return 264255353;
-        case 264255353: return 396383041;
-        case 396383041: return 594574583;
-        case 594574583: return 891861923;
-        default: c11__unreachable();
+/* Open addressing with one control byte per slot (swiss table).
+ * A control byte is `kDictCtrlEmpty`, `kDictCtrlDeleted` or the low 7 bits of the hash.
+ * Slots are probed a group at a time, all control bytes of a group are compared at once,
+ * and a probe stops at the first group that has an empty slot.
+ * A group is stored as its control bytes followed by the indices of its slots in `entries`,
+ * so that a probe usually reads one or two adjacent cache lines of the table.
+ */
+#define kDictGroupWidth 16
+#define kDictCtrlEmpty 0x80
+#define kDictCtrlDeleted 0xFE
+
+#define Dict__h1(hash) ((uint32_t)((hash) >> 7))
+#define Dict__h2(hash) ((uint8_t)((hash) & 0x7F))
+// at most 7/8 of the slots can be used
+#define Dict__max_load(capacity) ((capacity) - (capacity) / 8)
+
+#define Dict__group_size(self) (kDictGroupWidth * ((self)->index_is_short ? 3 : 5))
+#define Dict__group(self, pos) ((self)->table + (size_t)(pos) * Dict__group_size(self))
+#define Dict__ctrl(self, slot) (Dict__group(self, (slot) / kDictGroupWidth) + (slot) % kDictGroupWidth)
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) ||                                  \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+
+// one bit per slot of a group, set if the control byte is `h2`
+static uint32_t DictGroup__match(const uint8_t* group, uint8_t h2) {
+    __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)h2)));
+}
+
+static uint32_t DictGroup__match_empty(const uint8_t* group) {
+    return DictGroup__match(group, kDictCtrlEmpty);
+}
+
+// empty or deleted slots, they are the only ones with the high bit set
+static uint32_t DictGroup__match_free(const uint8_t* group) {
+    __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+    return (uint32_t)_mm_movemask_epi8(ctrl);
+}
+#else
+// portable version, 8 control bytes at a time
+#define kDictLsbs 0x0101010101010101ull
+#define kDictMsbs 0x8080808080808080ull
+
+static uint64_t DictGroup__load8(const uint8_t* p) {
+    uint64_t x = 0;
+    for(int i = 0; i < 8; i++) {
+        x |= (uint64_t)p[i] << (i * 8);
     }
+    return x;
 }
 
+// the high bit of each byte to one bit per byte
+static uint32_t DictGroup__compress8(uint64_t msbs) {
+    return (uint32_t)(((msbs >> 7) * 0x0102040810204080ull) >> 56);
+}
+
+// may have false positives, which are rejected by comparing the hashes
+static uint32_t DictGroup__match8(uint64_t x, uint8_t h2) {
+    uint64_t t = x ^ (kDictLsbs * h2);
+    return DictGroup__compress8((t - kDictLsbs) & ~t & kDictMsbs);
+}
+
+static uint32_t DictGroup__match(const uint8_t* group, uint8_t h2) {
+    return DictGroup__match8(DictGroup__load8(group), h2) |
+           DictGroup__match8(DictGroup__load8(group + 8), h2) << 8;
+}
+
+static uint32_t DictGroup__match_empty(const uint8_t* group) {
+    // only `kDictCtrlEmpty` has the high bit set and bit 1 clear
+    uint64_t lo = DictGroup__load8(group);
+    uint64_t hi = DictGroup__load8(group + 8);
+    return DictGroup__compress8(lo & ~(lo << 6) & kDictMsbs) |
+           DictGroup__compress8(hi & ~(hi << 6) & kDictMsbs) << 8;
+}
+
+static uint32_t DictGroup__match_free(const uint8_t* group) {
+    return DictGroup__compress8(DictGroup__load8(group) & kDictMsbs) |
+           DictGroup__compress8(DictGroup__load8(group + 8) & kDictMsbs) << 8;
+}
+#endif
+
 static uint64_t Dict__hash_2nd(uint64_t key) {
     // https://gist.github.com/badboy/6267743
     key = (~key) + (key << 21);  // key = (key << 21) - key - 1
@@ -73,66 +106,54 @@ static uint64_t Dict__hash_2nd(uint64_t key) {
     return key;
 }
 
-static void Dict__ctor(Dict* self, uint32_t capacity, int entries_capacity) {
+// bytes of the table of a dict with `capacity` slots
+static int64_t Dict__table_bytes(uint32_t capacity) {
+    size_t index_size = capacity < UINT16_MAX ? sizeof(uint16_t) : sizeof(uint32_t);
+    return (int64_t)capacity * (1 + index_size);
+}
+
+void Dict__ctor(Dict* self, uint32_t capacity, int entries_capacity, int entry_size) {
+    assert(capacity >= kDictMinCapacity && (capacity & (capacity - 1)) == 0);
+    assert(entry_size == sizeof(DictEntry) || entry_size == kSetEntrySize);
     self->length = 0;
     self->capacity = capacity;
-
-    size_t indices_size;
-    if(self->capacity < UINT16_MAX) {
-        self->index_is_short = true;
-        indices_size = self->capacity * sizeof(uint16_t);
-        self->null_index_value = UINT16_MAX;
-    } else {
-        self->index_is_short = false;
-        indices_size = self->capacity * sizeof(uint32_t);
-        self->null_index_value = UINT32_MAX;
+    self->growth_left = Dict__max_load(capacity);
+    // `entries.length` is less than twice the max load, see `Dict__pop`
+    self->index_is_short = capacity < UINT16_MAX;
+
+    uint32_t group_count = capacity / kDictGroupWidth;
+    self->table = PK_MALLOC(group_count * Dict__group_size(self));
+    for(uint32_t i = 0; i < group_count; i++) {
+        memset(Dict__group(self, i), kDictCtrlEmpty, kDictGroupWidth);
     }
 
-    self->indices = PK_MALLOC(indices_size);
-    memset(self->indices, -1, indices_size);
-
-    c11_vector__ctor(&self->entries, sizeof(DictEntry));
+    c11_vector__ctor(&self->entries, entry_size);
     c11_vector__reserve(&self->entries, entries_capacity);
 }
 
-static void Dict__dtor(Dict* self) {
+void Dict__dtor(Dict* self) {
     self->length = 0;
     self->capacity = 0;
-    PK_FREE(self->indices);
+    PK_FREE(self->table);
     c11_vector__dtor(&self->entries);
 }
 
-static uint32_t Dict__get_index(Dict* self, uint32_t index) {
+static uint32_t Dict__get_index(Dict* self, const uint8_t* group, int lane) {
+    const void* indices = group + kDictGroupWidth;
     if(self->index_is_short) {
-        uint16_t* indices = self->indices;
-        return indices[index];
+        return ((const uint16_t*)indices)[lane];
     } else {
-        uint32_t* indices = self->indices;
-        return indices[index];
+        return ((const uint32_t*)indices)[lane];
     }
 }
 
-static void Dict__swap_null_index(Dict* self, uint32_t pre_z, uint32_t z) {
+static void Dict__set_index(Dict* self, uint8_t* group, int lane, uint32_t value) {
+    void* indices = group + kDictGroupWidth;
     if(self->index_is_short) {
-        uint16_t* indices = self->indices;
-        assert(indices[pre_z] == UINT16_MAX);
-        indices[pre_z] = indices[z];
-        indices[z] = UINT16_MAX;
+        assert(value < UINT16_MAX);
+        ((uint16_t*)indices)[lane] = (uint16_t)value;
     } else {
-        uint32_t* indices = self->indices;
-        assert(indices[pre_z] == UINT32_MAX);
-        indices[pre_z] = indices[z];
-        indices[z] = UINT32_MAX;
-    }
-}
-
-static void Dict__set_index(Dict* self, uint32_t index, uint32_t value) {
-    if(self->index_is_short) {
-        uint16_t* indices = self->indices;
-        indices[index] = (uint16_t)value;
-    } else {
-        uint32_t* indices = self->indices;
-        indices[index] = value;
+        ((uint32_t*)indices)[lane] = value;
     }
 }
 
@@ -140,85 +161,95 @@ static void Dict__set_index(Dict* self, uint32_t index, uint32_t value) {
 static bool Dict__probe(Dict* self,
                         py_TValue* key,
                         uint64_t* p_hash,
-                        uint32_t* p_idx,
+                        uint32_t* p_slot,
                         DictEntry** p_entry) {
-    if(py_isstr(key)) {
-        *p_hash = c11_sv__hash(py_tosv(key));
+    bool key_is_str = py_isstr(key);
+    c11_sv key_sv;
+    if(key_is_str) {
+        key_sv = py_tosv(key);
+        *p_hash = pk_strhash(key);  // already well distributed
     } else {
         py_i64 h_user;
         if(!py_hash(key, &h_user)) return false;
         *p_hash = Dict__hash_2nd((uint64_t)h_user);
     }
-    uint32_t mask = self->capacity - 1;
-    uint32_t idx = (*p_hash) % self->capacity;
-    while(true) {
-        uint32_t idx2 = Dict__get_index(self, idx);
-        if(idx2 == self->null_index_value) break;
-        DictEntry* entry = c11__at(DictEntry, &self->entries, idx2);
-        if(entry->hash == (*p_hash)) {
-            if(py_isstr(&entry->key) && py_isstr(key)) {
-                c11_sv lhs = py_tosv(&entry->key);
-                c11_sv rhs = py_tosv(key);
-                if(c11__sveq(lhs, rhs)) {
-                    *p_idx = idx;
-                    *p_entry = entry;
-                    return true;
-                }
+    uint64_t hash = *p_hash;
+    uint8_t h2 = Dict__h2(hash);
+    uint32_t group_mask = self->capacity / kDictGroupWidth - 1;
+    uint32_t pos = Dict__h1(hash) & group_mask;
+    // triangular probing visits every group
+    for(uint32_t step = 1;; step++) {
+        const uint8_t* group = Dict__group(self, pos);
+        uint32_t match = DictGroup__match(group, h2);
+        while(match) {
+            int lane = c11__ctz64(match);
+            match &= match - 1;
+            DictEntry* entry = Dict__entry(self, Dict__get_index(self, group, lane));
+            if(entry->hash != hash) continue;
+            if(key_is_str && py_isstr(&entry->key)) {
+                if(!c11__sveq(py_tosv(&entry->key), key_sv)) continue;
             } else {
                 int res = py_equal(&entry->key, key);
-                if(res == 1) {
-                    *p_idx = idx;
-                    *p_entry = entry;
-                    return true;
-                }
                 if(res == -1) return false;  // error
+                if(res == 0) continue;
             }
+            *p_slot = pos * kDictGroupWidth + lane;
+            *p_entry = entry;
+            return true;
         }
-        // try next index
-        idx = Dict__step(idx);
+        if(DictGroup__match_empty(group)) break;
+        pos = (pos + step) & group_mask;
     }
     // not found
-    *p_idx = idx;
     *p_entry = NULL;
     return true;
 }
 
-static bool Dict__try_get(Dict* self, py_TValue* key, DictEntry** out) {
+// the first empty or deleted slot of the probe sequence of `hash`
+static uint32_t Dict__find_free(Dict* self, uint64_t hash) {
+    uint32_t group_mask = self->capacity / kDictGroupWidth - 1;
+    uint32_t pos = Dict__h1(hash) & group_mask;
+    for(uint32_t step = 1;; step++) {
+        uint32_t match = DictGroup__match_free(Dict__group(self, pos));
+        if(match) return pos * kDictGroupWidth + c11__ctz64(match);
+        pos = (pos + step) & group_mask;
+    }
+}
+
+bool Dict__try_get(Dict* self, py_TValue* key, DictEntry** out) {
     uint64_t hash;
-    uint32_t idx;
-    return Dict__probe(self, key, &hash, &idx, out);
+    uint32_t slot;
+    return Dict__probe(self, key, &hash, &slot, out);
 }
 
-static void Dict__clear(Dict* self) {
-    size_t indices_size = self->index_is_short ? self->capacity * sizeof(uint16_t)
-                                               : self->capacity * sizeof(uint32_t);
-    memset(self->indices, -1, indices_size);
+void Dict__clear(Dict* self) {
+    for(uint32_t i = 0; i < self->capacity / kDictGroupWidth; i++) {
+        memset(Dict__group(self, i), kDictCtrlEmpty, kDictGroupWidth);
+    }
+    self->growth_left = Dict__max_load(self->capacity);
     c11_vector__clear(&self->entries);
     self->length = 0;
 }
 
-static void Dict__rehash_2x(Dict* self) {
+// insert an entry whose key is not in the dict, there must be room for it
+static void Dict__insert_unique(Dict* self, uint32_t slot, DictEntry* entry) {
+    uint8_t* group = Dict__group(self, slot / kDictGroupWidth);
+    int lane = slot % kDictGroupWidth;
+    if(group[lane] == kDictCtrlEmpty) self->growth_left--;
+    group[lane] = Dict__h2(entry->hash);
+    Dict__set_index(self, group, lane, self->entries.length);
+    memcpy(c11_vector__emplace(&self->entries), entry, self->entries.elem_size);
+    self->length++;
+}
+
+// rebuild the table with `new_capacity`, which also drops deleted slots and entries
+static void Dict__rehash(Dict* self, uint32_t new_capacity) {
     Dict old_dict = *self;
-    uint32_t new_capacity = Dict__next_cap(old_dict.capacity);
-    uint32_t mask = new_capacity - 1;
-    // create a new dict with new capacity
-    Dict__ctor(self, new_capacity, old_dict.entries.capacity);
-    // move entries from old dict to new dict
+    Dict__ctor(self, new_capacity, old_dict.entries.capacity, old_dict.entries.elem_size);
     for(int i = 0; i < old_dict.entries.length; i++) {
-        DictEntry* old_entry = c11__at(DictEntry, &old_dict.entries, i);
+        DictEntry* old_entry = Dict__entry(&old_dict, i);
         if(py_isnil(&old_entry->key)) continue;  // skip deleted
-        uint32_t idx = old_entry->hash % new_capacity;
-        while(true) {
-            uint32_t idx2 = Dict__get_index(self, idx);
-            if(idx2 == self->null_index_value) {
-                c11_vector__push(DictEntry, &self->entries, *old_entry);
-                Dict__set_index(self, idx, self->entries.length - 1);
-                self->length++;
-                break;
-            }
-            // try next index
-            idx = Dict__step(idx);
-        }
+        Dict__insert_unique(self, Dict__find_free(self, old_entry->hash), old_entry);
     }
     Dict__dtor(&old_dict);
 }
@@ -228,118 +259,139 @@ static void Dict__compact_entries(Dict* self) {
 
     int n = 0;
     for(int i = 0; i < self->entries.length; i++) {
-        DictEntry* entry = c11__at(DictEntry, &self->entries, i);
+        DictEntry* entry = Dict__entry(self, i);
         if(py_isnil(&entry->key)) continue;
         mappings[i] = n;
-        if(i != n) {
-            DictEntry* new_entry = c11__at(DictEntry, &self->entries, n);
-            *new_entry = *entry;
-        }
+        if(i != n) memcpy(Dict__entry(self, n), entry, self->entries.elem_size);
         n++;
     }
     self->entries.length = n;
-    // update indices
-    for(uint32_t idx = 0; idx < self->capacity; idx++) {
-        uint32_t idx2 = Dict__get_index(self, idx);
-        if(idx2 == self->null_index_value) continue;
-        Dict__set_index(self, idx, mappings[idx2]);
+    // update indices of the used slots
+    for(uint32_t i = 0; i < self->capacity / kDictGroupWidth; i++) {
+        uint8_t* group = Dict__group(self, i);
+        for(int lane = 0; lane < kDictGroupWidth; lane++) {
+            if(group[lane] & 0x80) continue;  // empty or deleted
+            Dict__set_index(self, group, lane, mappings[Dict__get_index(self, group, lane)]);
+        }
     }
     PK_FREE(mappings);
 }
 
-static bool Dict__set(Dict* self, py_TValue* key, py_TValue* val) {
+int Dict__emplace(Dict* self, py_TValue* key, DictEntry** out) {
     uint64_t hash;
-    uint32_t idx;
-    DictEntry* entry;
-    if(!Dict__probe(self, key, &hash, &idx, &entry)) return false;
-    if(entry) {
-        // update existing entry
-        entry->val = *val;
-        return true;
-    }
+    uint32_t slot;
+    if(!Dict__probe(self, key, &hash, &slot, out)) return -1;
+    if(*out) return 0;
     // insert new entry
-    DictEntry* new_entry = c11_vector__emplace(&self->entries);
-    new_entry->hash = hash;
-    new_entry->key = *key;
-    new_entry->val = *val;
-    Dict__set_index(self, idx, self->entries.length - 1);
-    self->length++;
-    // check if we need to rehash
-    float load_factor = (float)self->length / self->capacity;
-    if(load_factor > (self->index_is_short ? 0.3f : 0.4f)) Dict__rehash_2x(self);
-    return true;
+    int64_t old_bytes = Dict__external_bytes(self);
+    slot = Dict__find_free(self, hash);
+    bool rehash = self->growth_left == 0 && *Dict__ctrl(self, slot) == kDictCtrlEmpty;
+    // grow, or only drop the deleted slots if most of the used slots are deleted
+    uint32_t new_capacity = self->capacity;
+    if(rehash && self->length >= Dict__max_load(self->capacity) / 2) new_capacity *= 2;
+    // reserve the buffers that are allocated below
+    int64_t bytes = rehash ? Dict__table_bytes(new_capacity) : 0;
+    if(self->entries.length == self->entries.capacity) {
+        int nextcap = c11_vector__nextcap(&self->entries);
+        bytes += (int64_t)(nextcap - self->entries.capacity) * self->entries.elem_size;
+    }
+    if(!ManagedHeap__reserve(&pk_current_vm->heap, bytes)) return -1;
+    if(rehash) {
+        Dict__rehash(self, new_capacity);
+        slot = Dict__find_free(self, hash);
+    }
+    DictEntry new_entry = {hash, *key};
+    Dict__insert_unique(self, slot, &new_entry);
+    *out = Dict__entry(self, self->entries.length - 1);
+    int64_t new_bytes = Dict__external_bytes(self);
+    if(new_bytes > old_bytes) ManagedHeap__account(&pk_current_vm->heap, new_bytes - old_bytes);
+    return 1;
 }
 
-/// Delete an entry from the dict.
-/// -1: error, 0: not found, 1: found and deleted
-static int Dict__pop(Dict* self, py_Ref key) {
-    // Dict__log_index(self, "before pop");
-    uint64_t hash;
-    uint32_t idx;
+bool Dict__set(Dict* self, py_TValue* key, py_TValue* val) {
     DictEntry* entry;
-    if(!Dict__probe(self, key, &hash, &idx, &entry)) return -1;
-    if(!entry) return 0;  // not found
+    if(Dict__emplace(self, key, &entry) == -1) return false;
+    entry->val = *val;
+    return true;
+}
 
-    // found the entry, delete and return it
-    py_assign(py_retval(), &entry->val);
-    Dict__set_index(self, idx, self->null_index_value);
+// delete the entry at `slot`
+static void Dict__erase(Dict* self, uint32_t slot, DictEntry* entry) {
     py_newnil(&entry->key);
-    py_newnil(&entry->val);
+    if(Dict__has_values(self)) py_newnil(&entry->val);
     self->length--;
 
-    /* tidy */
-    // https://github.com/OpenHFT/Chronicle-Map/blob/820573a68471509ffc1b0584454f4a67c0be1b84/src/main/java/net/openhft/chronicle/hash/impl/CompactOffHeapLinearHashTable.java#L156
-    uint32_t mask = self->capacity - 1;
-    uint32_t posToRemove = idx;
-    uint32_t posToShift = posToRemove;
-    // int probe_count = 0;
-    // int swap_count = 0;
-    while(true) {
-        posToShift = Dict__step(posToShift);
-        uint32_t idx_z = Dict__get_index(self, posToShift);
-        if(idx_z == self->null_index_value) break;
-        uint64_t hash_z = c11__at(DictEntry, &self->entries, idx_z)->hash;
-        uint32_t insertPos = (uint64_t)hash_z % self->capacity;
-        // the following condition essentially means circular permutations
-        // of three (r = posToRemove, s = posToShift, i = insertPos)
-        // positions are accepted:
-        // [...i..r...s.] or
-        // [...r..s...i.] or
-        // [...s..i...r.]
-        bool cond1 = insertPos <= posToRemove;
-        bool cond2 = posToRemove <= posToShift;
-        if((cond1 && cond2) ||
-           // chain wrapped around capacity
-           (posToShift < insertPos && (cond1 || cond2))) {
-            Dict__swap_null_index(self, posToRemove, posToShift);
-            posToRemove = posToShift;
-            // swap_count++;
-        }
-        // probe_count++;
+    // no probe has passed a group with an empty slot, so the slot can be empty again.
+    // otherwise it stays deleted to keep the probe sequences that pass it
+    uint8_t* group = Dict__group(self, slot / kDictGroupWidth);
+    if(DictGroup__match_empty(group)) {
+        group[slot % kDictGroupWidth] = kDictCtrlEmpty;
+        self->growth_left++;
+    } else {
+        group[slot % kDictGroupWidth] = kDictCtrlDeleted;
     }
-    // printf("Dict__pop: probe_count=%d, swap_count=%d\n", probe_count, swap_count);
     // compact entries if necessary
     if(self->entries.length > 16 && (self->length < self->entries.length >> 1)) {
         Dict__compact_entries(self);  // compact entries
     }
-    // Dict__log_index(self, "after pop");
+}
+
+/// Delete an entry from the dict and return its value.
+/// -1: error, 0: not found, 1: found and deleted
+static int Dict__pop(Dict* self, py_Ref key) {
+    uint64_t hash;
+    uint32_t slot;
+    DictEntry* entry;
+    if(!Dict__probe(self, key, &hash, &slot, &entry)) return -1;
+    if(!entry) return 0;  // not found
+    py_assign(py_retval(), &entry->val);
+    Dict__erase(self, slot, entry);
     return 1;
 }
 
+int Dict__discard(Dict* self, py_TValue* key) {
+    uint64_t hash;
+    uint32_t slot;
+    DictEntry* entry;
+    if(!Dict__probe(self, key, &hash, &slot, &entry)) return -1;
+    if(!entry) return 0;
+    Dict__erase(self, slot, entry);
+    return 1;
+}
+
+bool Dict__copy(Dict* self, Dict* out) {
+    // `out` can be marked by the collection in `ManagedHeap__reserve`
+    memset(out, 0, sizeof(Dict));
+    c11_vector__ctor(&out->entries, self->entries.elem_size);
+    if(!ManagedHeap__reserve(&pk_current_vm->heap, Dict__external_bytes(self))) {
+        Dict__ctor(out, kDictMinCapacity, 0, self->entries.elem_size);
+        return false;
+    }
+    out->length = self->length;
+    out->capacity = self->capacity;
+    out->growth_left = self->growth_left;
+    out->index_is_short = self->index_is_short;
+    out->entries = c11_vector__copy(&self->entries);
+    size_t table_size = self->capacity / kDictGroupWidth * Dict__group_size(self);
+    out->table = PK_MALLOC(table_size);
+    memcpy(out->table, self->table, table_size);
+    ManagedHeap__account(&pk_current_vm->heap, Dict__external_bytes(out));
+    return true;
+}
+
 static void DictIterator__ctor(DictIterator* self, Dict* dict, int mode) {
     assert(mode >= 0 && mode <= 2);
     self->dict = dict;
     self->dict_backup = *dict;  // backup the dict
-    self->curr = dict->entries.data;
-    self->end = self->curr + dict->entries.length;
+    self->index = 0;
     self->mode = mode;
 }
 
 static DictEntry* DictIterator__next(DictIterator* self) {
     DictEntry* retval;
     do {
-        if(self->curr == self->end) return NULL;
-        retval = self->curr++;
+        if(self->index == self->dict->entries.length) return NULL;
+        retval = Dict__entry(self->dict, self->index++);
     } while(py_isnil(&retval->key));
     return retval;
 }
@@ -353,13 +405,13 @@ static bool dict__new__(int argc, py_Ref argv) {
     py_Type cls = py_totype(argv);
     int slots = cls == tp_dict ? 0 : -1;
     Dict* ud = py_newobject(py_retval(), cls, slots, sizeof(Dict));
-    Dict__ctor(ud, 17, 4);
+    Dict__ctor(ud, kDictMinCapacity, 4, sizeof(DictEntry));
     return true;
 }
 
 void py_newdict(py_OutRef out) {
     Dict* ud = py_newobject(out, tp_dict, 0, sizeof(Dict));
-    Dict__ctor(ud, 17, 4);
+    Dict__ctor(ud, kDictMinCapacity, 4, sizeof(DictEntry));
 }
 
 static bool dict__init__(int argc, py_Ref argv) {
@@ -374,6 +426,7 @@ static bool dict__init__(int argc, py_Ref argv) {
     if(length == -1) { return TypeError("dict.__init__() expects a list or tuple"); }
 
     Dict* self = py_touserdata(argv);
+    pk__write_barrier(argv->_obj);
     for(int i = 0; i < length; i++) {
         py_Ref tuple = &p[i];
         if(!py_istuple(tuple) || py_tuple_len(tuple) != 2) {
@@ -389,7 +442,7 @@ static bool dict__init__(int argc, py_Ref argv) {
 
 static bool dict__getitem__(int argc, py_Ref argv) {
     PY_CHECK_ARGC(2);
-    Dict* self = py_touserdata(argv);
+    Dict* self = PyObject__userdata(argv->_obj);
     DictEntry* entry;
     if(!Dict__try_get(self, py_arg(1), &entry)) return false;
     if(entry) {
@@ -404,7 +457,9 @@ static bool dict__getitem__(int argc, py_Ref argv) {
 
 static bool dict__setitem__(int argc, py_Ref argv) {
     PY_CHECK_ARGC(3);
-    Dict* self = py_touserdata(argv);
+    Dict* self = PyObject__userdata(argv->_obj);
+    pk__write_barrier_value(argv->_obj, py_arg(1));
+    pk__write_barrier_value(argv->_obj, py_arg(2));
     bool ok = Dict__set(self, py_arg(1), py_arg(2));
     if(ok) py_newnone(py_retval());
     return ok;
@@ -424,7 +479,7 @@ static bool dict__delitem__(int argc, py_Ref argv) {
 
 static bool dict__contains__(int argc, py_Ref argv) {
     PY_CHECK_ARGC(2);
-    Dict* self = py_touserdata(argv);
+    Dict* self = PyObject__userdata(argv->_obj);
     DictEntry* entry;
     if(!Dict__try_get(self, py_arg(1), &entry)) return false;
     py_newbool(py_retval(), entry != NULL);
@@ -433,7 +488,7 @@ static bool dict__contains__(int argc, py_Ref argv) {
 
 static bool dict__len__(int argc, py_Ref argv) {
     PY_CHECK_ARGC(1);
-    Dict* self = py_touserdata(argv);
+    Dict* self = PyObject__userdata(argv->_obj);
     py_newint(py_retval(), self->length);
     return true;
 }
@@ -464,7 +519,7 @@ static bool dict__repr__(int argc, py_Ref argv) {
 static bool dict__eq__(int argc, py_Ref argv) {
     PY_CHECK_ARGC(2);
     Dict* self = py_touserdata(py_arg(0));
-    if(!py_isdict(py_arg(1))) {
+    if(!py_isinstance(py_arg(1), tp_dict)) {
         py_newnotimplemented(py_retval());
         return true;
     }
@@ -521,25 +576,16 @@ static bool dict_copy(int argc, py_Ref argv) {
     PY_CHECK_ARGC(1);
     Dict* self = py_touserdata(argv);
     Dict* new_dict = py_newobject(py_retval(), tp_dict, 0, sizeof(Dict));
-    new_dict->length = self->length;
-    new_dict->capacity = self->capacity;
-    new_dict->null_index_value = self->null_index_value;
-    new_dict->index_is_short = self->index_is_short;
-    // copy entries
-    new_dict->entries = c11_vector__copy(&self->entries);
-    // copy indices
-    size_t indices_size = self->index_is_short ? self->capacity * sizeof(uint16_t)
-                                               : self->capacity * sizeof(uint32_t);
-    new_dict->indices = PK_MALLOC(indices_size);
-    memcpy(new_dict->indices, self->indices, indices_size);
+    if(!Dict__copy(self, new_dict)) return false;
     return true;
 }
 
 static bool dict_update(int argc, py_Ref argv) {
     PY_CHECK_ARGC(2);
-    PY_CHECK_ARG_TYPE(1, tp_dict);
+    if(!py_checkinstance(py_arg(1), tp_dict)) return false;
     Dict* self = py_touserdata(argv);
     Dict* other = py_touserdata(py_arg(1));
+    pk__write_barrier(argv->_obj);
     for(int i = 0; i < other->entries.length; i++) {
         DictEntry* entry = c11__at(DictEntry, &other->entries, i);
         if(py_isnil(&entry->key)) continue;
@@ -550,7 +596,7 @@ static bool dict_update(int argc, py_Ref argv) {
 }
 
 static bool dict_get(int argc, py_Ref argv) {
-    Dict* self = py_touserdata(argv);
+    Dict* self = PyObject__userdata(argv->_obj);
     if(argc > 3) return TypeError("get() takes at most 3 arguments (%d given)", argc);
     py_Ref default_val = argc == 3 ? py_arg(2) : py_None();
     DictEntry* entry;
@@ -569,9 +615,9 @@ static bool dict_pop(int argc, py_Ref argv) {
     return true;
 }
 
-static bool dict_keys(int argc, py_Ref argv) {
+bool dict_keys(int argc, py_Ref argv) {
     PY_CHECK_ARGC(1);
-    Dict* self = py_touserdata(argv);
+    Dict* self = PyObject__userdata(argv->_obj);
     DictIterator* ud = py_newobject(py_retval(), tp_dict_iterator, 1, sizeof(DictIterator));
     DictIterator__ctor(ud, self, 0);
     py_setslot(py_retval(), 0, argv);  // keep a reference to the dict
@@ -580,7 +626,7 @@ static bool dict_keys(int argc, py_Ref argv) {
 
 static bool dict_values(int argc, py_Ref argv) {
     PY_CHECK_ARGC(1);
-    Dict* self = py_touserdata(argv);
+    Dict* self = PyObject__userdata(argv->_obj);
     DictIterator* ud = py_newobject(py_retval(), tp_dict_iterator, 1, sizeof(DictIterator));
     DictIterator__ctor(ud, self, 1);
     py_setslot(py_retval(), 0, argv);  // keep a reference to the dict
@@ -589,7 +635,7 @@ static bool dict_values(int argc, py_Ref argv) {
 
 static bool dict_items(int argc, py_Ref argv) {
     PY_CHECK_ARGC(1);
-    Dict* self = py_touserdata(argv);
+    Dict* self = PyObject__userdata(argv->_obj);
     DictIterator* ud = py_newobject(py_retval(), tp_dict_iterator, 1, sizeof(DictIterator));
     DictIterator__ctor(ud, self, 2);
     py_setslot(py_retval(), 0, argv);  // keep a reference to the dict
@@ -625,30 +671,40 @@ py_Type pk_dict__register() {
 }
 
 //////////////////////////
-bool dict_items__next__(int argc, py_Ref argv) {
-    PY_CHECK_ARGC(1);
-    DictIterator* iter = py_touserdata(py_arg(0));
-    if(DictIterator__modified(iter)) return RuntimeError("dictionary modified during iteration");
+int dict_items__next(py_Ref self) {
+    DictIterator* iter = py_touserdata(self);
+    if(DictIterator__modified(iter)) {
+        RuntimeError("dictionary modified during iteration");
+        return -1;
+    }
     DictEntry* entry = (DictIterator__next(iter));
     if(entry) {
         switch(iter->mode) {
             case 0:  // keys
                 py_assign(py_retval(), &entry->key);
-                return true;
+                return 1;
             case 1:  // values
                 py_assign(py_retval(), &entry->val);
-                return true;
+                return 1;
             case 2:  // items
             {
                 py_Ref p = py_newtuple(py_retval(), 2);
                 p[0] = entry->key;
                 p[1] = entry->val;
-                return true;
+                return 1;
             }
             default: c11__unreachable();
         }
     }
-    return StopIteration();
+    return 0;
+}
+
+bool dict_items__next__(int argc, py_Ref argv) {
+    PY_CHECK_ARGC(1);
+    int res = dict_items__next(argv);
+    if(res == -1) return false;
+    if(res == 0) return StopIteration();
+    return true;
 }
 
 bool dict_items__len__(int argc, py_Ref argv) {
@@ -670,7 +726,7 @@ py_Type pk_dict_items__register() {
 
 int py_dict_getitem(py_Ref self, py_Ref key) {
     assert(py_isdict(self));
-    Dict* ud = py_touserdata(self);
+    Dict* ud = PyObject__userdata(self->_obj);
     DictEntry* entry;
     if(!Dict__try_get(ud, key, &entry)) return -1;
     if(entry) {
@@ -682,7 +738,9 @@ int py_dict_getitem(py_Ref self, py_Ref key) {
 
 bool py_dict_setitem(py_Ref self, py_Ref key, py_Ref val) {
     assert(py_isdict(self));
-    Dict* ud = py_touserdata(self);
+    Dict* ud = PyObject__userdata(self->_obj);
+    pk__write_barrier_value(self->_obj, key);
+    pk__write_barrier_value(self->_obj, val);
     return Dict__set(ud, key, val);
 }
 
@@ -736,7 +794,7 @@ int py_dict_delitem_by_int(py_Ref self, py_i64 key) {
 
 int py_dict_len(py_Ref self) {
     assert(py_isdict(self));
-    Dict* ud = py_touserdata(self);
+    Dict* ud = PyObject__userdata(self->_obj);
     return ud->length;
 }
 
@@ -21,6 +21,7 @@ void py_BaseException__stpush(py_Frame* frame,
     frame_dump->name = func_name ? c11_string__new(func_name) : NULL;
 
     if(py_debugger_status() == 1) {
+        pk__write_barrier(self->_obj);
         if(frame != NULL) {
             py_Frame_newlocals(frame, &frame_dump->locals);
             py_Frame_newglobals(frame, &frame_dump->globals);
@@ -54,6 +55,7 @@ static bool _py_BaseException__init__(int argc, py_Ref argv) {
     py_newnone(py_retval());
     if(argc == 1 + 0) return true;
     if(argc == 1 + 1) {
+        pk__write_barrier_value(argv->_obj, &argv[1]);
         py_assign(&ud->args, &argv[1]);
         return true;
     }
@@ -288,6 +290,7 @@ bool py_raise(py_Ref exc) {
         FrameExcInfo* info = Frame__top_exc_info(vm->top_frame);
         if(info && !py_isnil(&info->exc)) {
             BaseException* ud = py_touserdata(exc);
+            pk__write_barrier_value(exc->_obj, &info->exc);
             ud->inner_exc = info->exc;
         }
     }
@@ -1,11 +1,20 @@
 #include "pocketpy/pocketpy.h"
 
 #include "pocketpy/common/utils.h"
+#include "pocketpy/common/algorithm.h"
 #include "pocketpy/interpreter/vm.h"
 #include "pocketpy/interpreter/types.h"
 #include "pocketpy/objects/iterator.h"
 #include "pocketpy/common/sstream.h"
 
+// account the growth of the buffer of `self`, `capacity` is its capacity before
+static void List__account(List* self, int capacity) {
+    if(self->capacity > capacity) {
+        int64_t bytes = (int64_t)(self->capacity - capacity) * sizeof(py_TValue);
+        ManagedHeap__account(&pk_current_vm->heap, bytes);
+    }
+}
+
 void py_newlist(py_OutRef out) {
     List* ud = py_newobject(out, tp_list, 0, sizeof(List));
     c11_vector__ctor(ud, sizeof(py_TValue));
@@ -16,6 +25,7 @@ void py_newlistn(py_OutRef out, int n) {
     List* ud = py_touserdata(out);
     c11_vector__reserve(ud, n);
     ud->length = n;
+    List__account(ud, 0);
 }
 
 py_Ref py_list_data(py_Ref self) {
@@ -29,7 +39,8 @@ py_Ref py_list_getitem(py_Ref self, int i) {
 }
 
 void py_list_setitem(py_Ref self, int i, py_Ref val) {
-    List* ud = py_touserdata(self);
+    List* ud = PyObject__userdata(self->_obj);
+    pk__write_barrier_value(self->_obj, val);
     c11__setitem(py_TValue, ud, i, *val);
 }
 
@@ -39,7 +50,7 @@ void py_list_delitem(py_Ref self, int i) {
 }
 
 int py_list_len(py_Ref self) {
-    List* ud = py_touserdata(self);
+    List* ud = PyObject__userdata(self->_obj);
     return ud->length;
 }
 
@@ -51,13 +62,20 @@ void py_list_swap(py_Ref self, int i, int j) {
 }
 
 void py_list_append(py_Ref self, py_Ref val) {
-    List* ud = py_touserdata(self);
+    List* ud = PyObject__userdata(self->_obj);
+    pk__write_barrier_value(self->_obj, val);
+    int capacity = ud->capacity;
     c11_vector__push(py_TValue, ud, *val);
+    List__account(ud, capacity);
 }
 
 py_ItemRef py_list_emplace(py_Ref self) {
     List* ud = py_touserdata(self);
+    // the caller writes to the new item
+    pk__write_barrier(self->_obj);
+    int capacity = ud->capacity;
     c11_vector__emplace(ud);
+    List__account(ud, capacity);
     return &c11_vector__back(py_TValue, ud);
 }
 
@@ -68,7 +86,10 @@ void py_list_clear(py_Ref self) {
 
 void py_list_insert(py_Ref self, int i, py_Ref val) {
     List* ud = py_touserdata(self);
+    pk__write_barrier_value(self->_obj, val);
+    int capacity = ud->capacity;
     c11_vector__insert(py_TValue, ud, i, *val);
+    List__account(ud, capacity);
 }
 
 ////////////////////////////////
@@ -132,7 +153,7 @@ static bool list__new__(int argc, py_Ref argv) {
 
 static bool list__getitem__(int argc, py_Ref argv) {
     PY_CHECK_ARGC(2);
-    List* self = py_touserdata(py_arg(0));
+    List* self = PyObject__userdata(argv->_obj);
     py_Ref _1 = py_arg(1);
     if(_1->type == tp_int) {
         int index = py_toint(py_arg(1));
@@ -148,6 +169,7 @@ static bool list__getitem__(int argc, py_Ref argv) {
         PK_SLICE_LOOP(i, start, stop, step) {
             c11_vector__push(py_TValue, list, c11__getitem(py_TValue, self, i));
         }
+        List__account(list, 0);
         return true;
     } else {
         return TypeError("list indices must be integers");
@@ -157,9 +179,10 @@ static bool list__getitem__(int argc, py_Ref argv) {
 static bool list__setitem__(int argc, py_Ref argv) {
     PY_CHECK_ARGC(3);
     PY_CHECK_ARG_TYPE(1, tp_int);
-    List* self = py_touserdata(py_arg(0));
+    List* self = PyObject__userdata(argv->_obj);
     int index = py_toint(py_arg(1));
     if(!pk__normalize_index(&index, self->length)) return false;
+    pk__write_barrier_value(argv->_obj, py_arg(2));
     c11__setitem(py_TValue, self, index, *py_arg(2));
     py_newnone(py_retval());
     return true;
@@ -187,6 +210,7 @@ static bool list__add__(int argc, py_Ref argv) {
         List* list = py_touserdata(py_retval());
         c11_vector__extend(py_TValue, list, list_0->data, list_0->length);
         c11_vector__extend(py_TValue, list, list_1->data, list_1->length);
+        List__account(list, 0);
     } else {
         py_newnotimplemented(py_retval());
     }
@@ -199,12 +223,15 @@ static bool list__mul__(int argc, py_Ref argv) {
     py_Ref _1 = py_arg(1);
     if(py_istype(_1, tp_int)) {
         int n = py_toint(_1);
+        List* list_0 = py_touserdata(_0);
+        int64_t bytes = (int64_t)c11__max(n, 0) * list_0->length * sizeof(py_TValue);
+        if(!ManagedHeap__reserve(&pk_current_vm->heap, bytes)) return false;
         py_newlist(py_retval());
         List* list = py_touserdata(py_retval());
-        List* list_0 = py_touserdata(_0);
         for(int i = 0; i < n; i++) {
             c11_vector__extend(py_TValue, list, list_0->data, list_0->length);
         }
+        List__account(list, 0);
     } else {
         py_newnotimplemented(py_retval());
     }
@@ -215,6 +242,12 @@ static bool list__rmul__(int argc, py_Ref argv) { return list__mul__(argc, argv)
 
 static bool list_append(int argc, py_Ref argv) {
     PY_CHECK_ARGC(2);
+    List* self = PyObject__userdata(argv->_obj);
+    if(self->length == self->capacity) {
+        // a growing list is where a loop of appends hits the memory limit
+        int64_t bytes = (int64_t)(c11_vector__nextcap(self) - self->capacity) * sizeof(py_TValue);
+        if(!ManagedHeap__reserve(&pk_current_vm->heap, bytes)) return false;
+    }
     py_list_append(py_arg(0), py_arg(1));
     py_newnone(py_retval());
     return true;
@@ -246,7 +279,10 @@ static bool list_extend(int argc, py_Ref argv) {
     py_TValue* p;
     int length = pk_arrayview(py_arg(1), &p);
     if(length == -1) return TypeError("extend() argument must be a list or tuple");
+    pk__write_barrier(argv->_obj);
+    int capacity = self->capacity;
     c11_vector__extend(py_TValue, self, p, length);
+    List__account(self, capacity);
     py_newnone(py_retval());
     return true;
 }
@@ -276,6 +312,7 @@ static bool list_copy(int argc, py_Ref argv) {
     List* self = py_touserdata(py_arg(0));
     List* list = py_touserdata(py_retval());
     c11_vector__extend(py_TValue, list, self->data, self->length);
+    List__account(list, 0);
     return true;
 }
 
@@ -345,50 +382,145 @@ static bool list_insert(int argc, py_Ref argv) {
     if(index < 0) index += self->length;
     if(index < 0) index = 0;
     if(index > self->length) index = self->length;
-    c11_vector__insert(py_TValue, self, index, *py_arg(2));
+    py_list_insert(py_arg(0), index, py_arg(2));
     py_newnone(py_retval());
     return true;
 }
 
-static int lt_with_key(py_TValue* a, py_TValue* b, py_TValue* key) {
-    if(!key) return py_less(a, b);
-    VM* vm = pk_current_vm;
-    // project a
-    py_push(key);
-    py_pushnil();
-    py_push(a);
-    if(!py_vectorcall(1, 0)) return -1;
-    py_push(py_retval());
-    // project b
-    py_push(key);
-    py_pushnil();
-    py_push(b);
-    if(!py_vectorcall(1, 0)) return -1;
-    py_push(py_retval());
-    // binary op
-    bool ok = pk_stack_binaryop(vm, __lt__, __gt__);
-    if(!ok) return -1;
-    py_shrink(2);
-    return py_bool(py_retval());
+typedef int (*ListSort_lt)(const void* a, const void* b, void* extra);
+
+typedef struct {
+    PyObject* items;   // the list being sorted, or its decorated pairs
+    PyObject* buffer;  // merge buffer of the timsort
+} ListSort;
+
+static int ListSort__lt_int(const void* a, const void* b, void* extra) {
+    return ((const py_TValue*)a)->_i64 < ((const py_TValue*)b)->_i64;
 }
 
-// sort(self, key=None, reverse=False)
-static bool list_sort(int argc, py_Ref argv) {
-    List* self = py_touserdata(py_arg(0));
+static int ListSort__lt_float(const void* a, const void* b, void* extra) {
+    return ((const py_TValue*)a)->_f64 < ((const py_TValue*)b)->_f64;
+}
 
-    py_Ref key = py_arg(1);
-    if(py_isnone(key)) key = NULL;
+// same as `int.__lt__` and `float.__lt__`
+static int ListSort__lt_number(const void* a_, const void* b_, void* extra) {
+    const py_TValue *a = a_, *b = b_;
+    if(a->type == tp_int && b->type == tp_int) return a->_i64 < b->_i64;
+    py_f64 x = a->type == tp_int ? (py_f64)a->_i64 : a->_f64;
+    py_f64 y = b->type == tp_int ? (py_f64)b->_i64 : b->_f64;
+    return x < y;
+}
 
-    bool ok = c11__stable_sort(self->data,
-                               self->length,
-                               sizeof(py_TValue),
-                               (int (*)(const void*, const void*, void*))lt_with_key,
-                               key);
+static int ListSort__lt_str(const void* a, const void* b, void* extra) {
+    return c11_sv__cmp(py_tosv((py_Ref)a), py_tosv((py_Ref)b)) < 0;
+}
+
+static int ListSort__lt_object(const void* a, const void* b, void* extra) {
+    ListSort* self = extra;
+    // `__lt__` may run a gc step, and elements may have moved into scanned lists since the last one
+    pk__write_barrier(self->items);
+    pk__write_barrier(self->buffer);
+    return py_less((py_Ref)a, (py_Ref)b);
+}
+
+// compares without calling `__lt__` if all keys are ints, floats or strs
+static ListSort_lt ListSort__pick_lt(py_TValue* p, int length, int stride) {
+    int n_int = 0, n_float = 0, n_str = 0;
+    for(int i = 0; i < length; i++) {
+        switch(p[i * stride].type) {
+            case tp_int: n_int++; break;
+            case tp_float: n_float++; break;
+            case tp_str: n_str++; break;
+            default: return ListSort__lt_object;
+        }
+    }
+    if(n_int == length) return ListSort__lt_int;
+    if(n_float == length) return ListSort__lt_float;
+    if(n_str == length) return ListSort__lt_str;
+    if(n_str == 0) return ListSort__lt_number;
+    return ListSort__lt_object;
+}
+
+// sorts a list that is not reachable from user code
+static bool List__sort(py_Ref items, py_Ref key, bool reverse) {
+    List* ud = py_touserdata(items);
+    int length = ud->length;
+    if(length < 2) return true;
+    py_TValue* data = ud->data;
+    // reversing before and after the sort keeps equal elements in their order
+    if(reverse) c11__reverse(py_TValue, ud);
+
+    int stride = 1;
+    py_Ref pairs = items;
+    if(key) {
+        // decorate as [key(x0), x0, key(x1), x1, ...] so that `key` is called once per element
+        stride = 2;
+        pairs = py_pushtmp();
+        py_newlistn(pairs, length * 2);
+        py_TValue* p = py_list_data(pairs);
+        for(int i = 0; i < length; i++) {
+            py_newnil(&p[i * 2]);
+            p[i * 2 + 1] = data[i];
+        }
+        for(int i = 0; i < length; i++) {
+            if(!py_call(key, 1, &data[i])) return false;
+            pk__write_barrier_value(pairs->_obj, py_retval());
+            p[i * 2] = *py_retval();
+        }
+    }
+
+    py_TValue* p = py_list_data(pairs);
+    ListSort_lt f_lt = ListSort__pick_lt(p, length, stride);
+    ListSort ctx = {pairs->_obj, NULL};
+    py_TValue* buffer = NULL;
+    if(f_lt == ListSort__lt_object) {
+        // `__lt__` may trigger a gc, so the merge buffer must be reachable
+        py_StackRef tmp = py_pushtmp();
+        int n = (length / 2 + 1) * stride;
+        py_newlistn(tmp, n);
+        buffer = py_list_data(tmp);
+        for(int i = 0; i < n; i++) {
+            py_newnil(&buffer[i]);
+        }
+        ctx.buffer = tmp->_obj;
+    }
+    bool ok = c11__timsort(p, length, stride * sizeof(py_TValue), f_lt, &ctx, buffer);
     if(!ok) return false;
 
+    if(key) {
+        for(int i = 0; i < length; i++) {
+            data[i] = p[i * 2 + 1];
+        }
+    }
+    if(reverse) c11__reverse(py_TValue, ud);
+    return true;
+}
+
+// sort(self, key=None, reverse=False)
+static bool list_sort(int argc, py_Ref argv) {
     PY_CHECK_ARG_TYPE(2, tp_bool);
-    bool reverse = py_tobool(py_arg(2));
-    if(reverse) c11__reverse(py_TValue, self);
+    List* self = py_touserdata(py_arg(0));
+    py_Ref key = py_isnone(py_arg(1)) ? NULL : py_arg(1);
+    py_StackRef p0 = py_peek(0);
+
+    // the elements move to a new list while they are sorted, user code sees an empty list
+    py_StackRef items = py_pushtmp();
+    py_newlist(items);
+    List* ud = py_touserdata(items);
+    List tmp = *self;
+    *self = *ud;
+    *ud = tmp;
+    bool ok = List__sort(items, key, py_tobool(py_arg(2)));
+    bool modified = self->length != 0;
+    tmp = *self;
+    *self = *ud;
+    *ud = tmp;
+    // the sorted elements may be younger than `self`
+    pk__write_barrier(argv->_obj);
+    py_shrink(py_peek(0) - p0);
+
+    if(!ok) return false;
+    if(modified) return ValueError("list modified during sort");
     py_newnone(py_retval());
     return true;
 }
@@ -396,7 +528,7 @@ static bool list_sort(int argc, py_Ref argv) {
 static bool list__iter__(int argc, py_Ref argv) {
     PY_CHECK_ARGC(1);
     list_iterator* ud = py_newobject(py_retval(), tp_list_iterator, 1, sizeof(list_iterator));
-    ud->vec = py_touserdata(argv);
+    ud->vec = PyObject__userdata(argv->_obj);
     ud->index = 0;
     py_setslot(py_retval(), 0, argv);  // keep a reference to the object
     return true;
@@ -166,6 +166,18 @@ int py_next(py_Ref val) {
         case tp_str_iterator:
             if(str_iterator__next__(1, val)) return 1;
             break;
+        case tp_enumerate:
+            if(enumerate__next__(1, val)) return 1;
+            break;
+        case tp_zip:
+            if(zip__next__(1, val)) return 1;
+            break;
+        case tp_map:
+            if(map__next__(1, val)) return 1;
+            break;
+        case tp_filter:
+            if(filter__next__(1, val)) return 1;
+            break;
         default: {
             py_Ref tmp = py_tpfindmagic(val->type, __next__);
             if(!tmp) {
@@ -210,9 +222,17 @@ bool py_getattr(py_Ref self, py_Name name) {
             py_Ref getter = py_getslot(cls_var, 0);
             return py_call(getter, 1, self);
         }
+        if(py_istype(cls_var, tp_member_descriptor)) {
+            py_Ref res = pk_member__ref(cls_var, self);
+            if(res) {
+                py_assign(py_retval(), res);
+                return true;
+            }
+            goto __FALLBACK;
+        }
     }
     // handle instance __dict__
-    if(self->is_ptr && self->_obj->slots == -1) {
+    if(self->is_ptr && self->_obj->slots < 0) {
         if(!py_istype(self, tp_type)) {
             py_Ref res = py_getdict(self, name);
             if(res) {
@@ -266,6 +286,7 @@ bool py_getattr(py_Ref self, py_Name name) {
         }
     }
 
+__FALLBACK:;
     py_Ref fallback = pk_tpfindmagic(ti, __getattr__);
     if(fallback) {
         py_push(fallback);
@@ -310,14 +331,17 @@ bool py_setattr(py_Ref self, py_Name name, py_Ref val) {
                 return TypeError("readonly attribute: '%n'", name);
             }
         }
+        if(py_istype(cls_var, tp_member_descriptor)) return pk_member__set(cls_var, self, val);
     }
 
     // handle instance __dict__
-    if(self->is_ptr && self->_obj->slots == -1) {
+    if(self->is_ptr && self->_obj->slots < 0) {
         py_setdict(self, name, val);
         return true;
     }
 
+    // instances of classes with `__slots__`
+    if(ti->inst_slots >= 0) return AttributeError(self, name);
     return TypeError("cannot set attribute");
 }
 
@@ -325,10 +349,14 @@ bool py_delattr(py_Ref self, py_Name name) {
     py_TypeInfo* ti = pk_typeinfo(self->type);
     if(ti->delattribute) return ti->delattribute(self, name);
 
-    if(self->is_ptr && self->_obj->slots == -1) {
+    py_Ref cls_var = pk_tpfindname(ti, name);
+    if(cls_var && py_istype(cls_var, tp_member_descriptor)) return pk_member__del(cls_var, self);
+
+    if(self->is_ptr && self->_obj->slots < 0) {
         if(py_deldict(self, name)) return true;
         return AttributeError(self, name);
     }
+    if(ti->inst_slots >= 0) return AttributeError(self, name);
     return TypeError("cannot delete attribute");
 }
 
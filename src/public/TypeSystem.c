@@ -97,6 +97,7 @@ void py_tphookattributes(py_Type type,
                          bool (*getunboundmethod)(py_Ref self, py_Name name)) {
     assert(type);
     py_TypeInfo* ti = pk_typeinfo(type);
+    pk_tpmodified(ti);
     ti->getattribute = getattribute;
     ti->setattribute = setattribute;
     ti->delattribute = delattribute;
@@ -47,7 +47,7 @@ bool py_tobool(py_Ref self) {
 
 py_Type py_totype(py_Ref self) {
     assert(self->type == tp_type);
-    py_TypeInfo* ud = py_touserdata(self);
+    py_TypeInfo* ud = PyObject__userdata(self->_obj);
     return ud->index;
 }
 
@@ -43,9 +43,10 @@ char* py_newstrn(py_OutRef out, int size) {
         return ud->data;
     }
     ManagedHeap* heap = &pk_current_vm->heap;
-    int total_size = sizeof(c11_string) + size + 1;
+    int total_size = sizeof(uint64_t) + sizeof(c11_string) + size + 1;
     PyObject* obj = ManagedHeap__gcnew(heap, tp_str, 0, total_size);
-    c11_string* ud = PyObject__userdata(obj);
+    *pk_strobj__hash(PyObject__userdata(obj)) = 0;
+    c11_string* ud = pk_strobj__string(PyObject__userdata(obj));
     c11_string__ctor3(ud, size);
     out->type = tp_str;
     out->is_ptr = true;
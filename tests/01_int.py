@@ -871,4 +871,45 @@ assert 9 // 7 == 1
 assert 9 % 8 == 1
 assert 9 // 8 == 1
 assert 9 % 9 == 0
-assert 9 // 9 == 1
\ No newline at end of file
+assert 9 // 9 == 1
+# quickened binary ops must de-optimize when operand types change
+def arith(a, b):
+    return a + b, a - b, a * b, a / b, a < b, a == b
+
+for _ in range(10):
+    assert arith(7, 2) == (9, 5, 14, 3.5, False, False)
+assert arith(7.5, 2) == (9.5, 5.5, 15.0, 3.75, False, False)
+assert arith(2, 7.5) == (9.5, -5.5, 15.0, 2 / 7.5, True, False)
+assert arith(3, 3) == (6, 0, 9, 1.0, False, True)
+
+def divmod_int(a, b):
+    return a // b, a % b
+
+for _ in range(10):
+    assert divmod_int(-7, 2) == (-4, 1)
+try:
+    divmod_int(1, 0)
+    exit(1)
+except ZeroDivisionError:
+    pass
+assert divmod_int(7, -2) == (-4, -1)
+assert divmod_int(7.0, 2) == (3.0, 1.0)
+
+def concat(a, b):
+    return a + b
+
+assert concat(1, 2) == 3
+assert concat('a', 'b') == 'ab'
+assert concat([1], [2]) == [1, 2]
+assert concat(1, 2) == 3
+
+# sites with mixed operand types back off and keep giving the right answers
+for i in range(200):
+    if i % 3 == 0:
+        assert concat('a', 'b') == 'ab'
+    elif i % 3 == 1:
+        assert concat(i, 1) == i + 1
+    else:
+        assert concat(i, 0.5) == i + 0.5
+    assert arith(i, 2)[0] == i + 2
+    assert arith(i * 0.5, 2)[0] == i * 0.5 + 2
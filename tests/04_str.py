@@ -240,4 +240,14 @@ assert f"{(1, 2, 3)}" == "(1, 2, 3)"
 
 
 assert id('1' * 16) is not None
-assert id('1' * 15) is None
\ No newline at end of file
+assert id('1' * 15) is None
+# hashes of heap strings are cached, they must agree with fresh strings
+a = 'abcdefghijklmnopqrstuvwxyz' * 3
+b = ''.join(list(a))
+assert a is not b
+assert hash(a) == hash(b) == hash(a)
+assert hash('x' * 15) == hash('xxxxxxx' + 'xxxxxxxx')
+assert hash('y' * 100) != hash('y' * 99)
+d = {a: 1, 'x' * 16: 2}
+assert d[b] == 1
+assert d['xxxxxxxx' + 'xxxxxxxx'] == 2
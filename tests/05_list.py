@@ -133,6 +133,81 @@ assert sorted(a, key=key) == [9, 8, 4, 2, 2]
 assert sorted(a, key=key, reverse=True) == [2, 2, 4, 8, 9]
 assert a == [8, 2, 4, 2, 9]
 
+# sort is stable, also with reverse=True
+a = [(1, 'a'), (0, 'b'), (1, 'c'), (0, 'd')]
+assert sorted(a, key=lambda x: x[0]) == [(0, 'b'), (0, 'd'), (1, 'a'), (1, 'c')]
+assert sorted(a, key=lambda x: x[0], reverse=True) == [(1, 'a'), (1, 'c'), (0, 'b'), (0, 'd')]
+
+# key is called once per element
+calls = []
+def key(x):
+    calls.append(x)
+    return -x
+a = [3, 1, 2]
+a.sort(key=key)
+assert a == [3, 2, 1] and sorted(calls) == [1, 2, 3]
+
+# runs, random data and the native comparisons
+import random
+random.seed(7)
+for n in [0, 1, 2, 63, 64, 65, 1000, 5000]:
+    a = [random.randint(-100, 100) for _ in range(n)]
+    s = sorted(a)
+    assert all([s[i] <= s[i + 1] for i in range(n - 1)])
+    assert sorted(s) == s and sorted(s[::-1]) == s
+    assert sorted([x + 0.5 for x in a]) == [x + 0.5 for x in s]
+    assert sorted([str(x) for x in a]) == sorted([str(x) for x in a], key=lambda x: x)
+    b = [(x, i) for i, x in enumerate(a)]
+    assert sorted(b, key=lambda t: t[0]) == sorted(b)
+
+a = list(range(100)) + list(range(50)) + list(range(100, 0, -1))
+assert sorted(a) == sorted(a, key=lambda x: (x,))
+assert sorted([3, 1.5, 2, -0.5]) == [-0.5, 1.5, 2, 3]
+assert sorted(['b', 'ab', 'a', '']) == ['', 'a', 'ab', 'b']
+
+# user defined __lt__, the elements survive collections while sorting
+import gc
+class Item:
+    def __init__(self, v):
+        self.v = v
+    def __lt__(self, other):
+        if random.randint(0, 50) == 0:
+            gc.collect()
+        return self.v < other.v
+
+a = [Item(random.randint(0, 100)) for _ in range(500)]
+s = sorted(a)
+assert [x.v for x in s] == sorted([x.v for x in a])
+del a
+gc.collect()
+assert len([str(x.v) for x in s]) == 500
+
+# errors leave the list as a permutation of its elements
+a = [3, 2, 'x', 1] * 20
+try:
+    a.sort()
+    exit(1)
+except TypeError:
+    pass
+assert len(a) == 80 and a.count('x') == 20 and sorted(a, key=str).count(1) == 20
+
+# the list looks empty while it is sorted
+a = [3, 1, 2]
+def peek(x):
+    assert len(a) == 0
+    return x
+a.sort(key=peek)
+assert a == [1, 2, 3]
+def grow(x):
+    a.append(x)
+    return x
+try:
+    a.sort(key=grow)
+    exit(1)
+except ValueError:
+    pass
+assert a == [1, 2, 3]
+
 # test unpack ex
 a, *b = [1,2,3,4]
 assert a == 1
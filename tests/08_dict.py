@@ -178,4 +178,30 @@ d = {
 
 del d['a']
 assert 'a' not in d
-assert d['gc'] == 1
\ No newline at end of file
+assert d['gc'] == 1
+# grow, delete and reinsert across many probe groups
+d = {}
+for i in range(5000):
+    d[i * 16] = i
+for i in range(0, 5000, 2):
+    del d[i * 16]
+assert len(d) == 2500
+for i in range(5000):
+    assert (i * 16 in d) == (i % 2 == 1)
+for i in range(0, 5000, 2):
+    d[i * 16] = -i
+assert len(d) == 5000
+assert list(d.values())[:3] == [1, 3, 5]
+assert d[0] == 0 and d[32] == -2
+
+# string keys that share a prefix
+d = {}
+for i in range(1000):
+    d['key_' + str(i)] = i
+for i in range(1000):
+    assert d['key_' + str(i)] == i
+    assert 'key_' + str(i + 1000) not in d
+d.clear()
+assert len(d) == 0 and 'key_1' not in d
+d['key_1'] = 1
+assert d == {'key_1': 1}
@@ -50,3 +50,36 @@ try:
 except StopIteration:
     pass
 
+
+# specialized FOR_ITER
+def collect(it):
+    res = []
+    for x in it:
+        res.append(x)
+    return res
+
+assert collect(range(5)) == [0, 1, 2, 3, 4]
+assert collect(range(5, 0, -2)) == [5, 3, 1]
+assert collect(range(0)) == []
+assert collect([1, 2, 3]) == [1, 2, 3]
+assert collect((4, 5)) == [4, 5]
+assert collect({'a': 1, 'b': 2}) == ['a', 'b']
+assert collect({'a': 1}.items()) == [('a', 1)]
+assert collect('ab') == ['a', 'b']
+assert collect(range(3)) == [0, 1, 2]
+
+a = [1, 2, 3]
+res = []
+for x in a:
+    if x == 1:
+        a.append(4)
+    res.append(x)
+assert res == [1, 2, 3, 4]
+
+d = {'a': 1}
+try:
+    for k in d:
+        d['b'] = 2
+    exit(1)
+except RuntimeError:
+    pass
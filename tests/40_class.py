@@ -135,4 +135,45 @@ assert MyClass.b == 1
 assert MyClass.c == 2
 assert MyClass.d == 3
 
-assert MyClass(1, 2).m == 1
\ No newline at end of file
+assert MyClass(1, 2).m == 1
+# inline caches must observe class dict mutations
+class Base:
+    k = 1
+    def f(self):
+        return 'base'
+
+class Derived(Base):
+    pass
+
+def probe(obj):
+    return obj.f(), obj.k
+
+d = Derived()
+for _ in range(3):
+    assert probe(d) == ('base', 1)
+Base.f = lambda self: 'patched'
+Base.k = 2
+assert probe(d) == ('patched', 2)
+Derived.f = lambda self: 'derived'
+assert probe(d) == ('derived', 2)
+d.k = 3
+assert probe(d) == ('derived', 3)
+del Derived.f
+assert probe(d) == ('patched', 3)
+
+class WithProperty:
+    def __init__(self):
+        self._x = 0
+    @property
+    def x(self):
+        return self._x + 1
+
+def get_x(obj):
+    return obj.x
+
+wp = WithProperty()
+for i in range(3):
+    wp._x = i
+    assert get_x(wp) == i + 1
+WithProperty.x = 100
+assert get_x(wp) == 100
@@ -0,0 +1,119 @@
+class A:
+    def __init__(self, x, y):
+        self.x = x
+        self.y = y
+
+# attributes keep their insertion order
+a = A(1, 2)
+a.z = 3
+assert list(a.__dict__.items()) == [('x', 1), ('y', 2), ('z', 3)]
+assert a.__dict__['z'] == 3
+assert 'y' in a.__dict__
+
+# instances with different layouts at the same attribute sites
+class B:
+    pass
+
+def make(reverse):
+    b = B()
+    if reverse:
+        b.y = 'y'
+        b.x = 'x'
+    else:
+        b.x = 'x'
+        b.y = 'y'
+    return b
+
+objs = [make(i % 2 == 0) for i in range(10)]
+for b in objs:
+    assert b.x == 'x' and b.y == 'y'
+    b.x = b.y + '!'
+assert [b.x for b in objs] == ['y!'] * 10
+assert [k for k, _ in objs[0].__dict__.items()] == ['y', 'x']
+assert [k for k, _ in objs[1].__dict__.items()] == ['x', 'y']
+
+# deleting the last attribute, then another one
+a = A(1, 2)
+del a.y
+assert not hasattr(a, 'y')
+a.y = 5
+assert a.y == 5
+del a.x
+assert not hasattr(a, 'x')
+assert a.y == 5
+a.x = 6
+a.w = 7
+assert (a.x, a.y, a.w) == (6, 5, 7)
+try:
+    del a.nothing
+    exit(1)
+except AttributeError:
+    pass
+
+# many attributes, beyond the inline ones and the limit of a shape
+class C:
+    pass
+
+c = C()
+for i in range(100):
+    setattr(c, f'a{i}', i)
+for i in range(100):
+    assert getattr(c, f'a{i}') == i
+assert len(c.__dict__.items()) == 100
+c.a50 = 'x'
+assert c.a50 == 'x'
+del c.a0
+assert not hasattr(c, 'a0')
+assert c.a99 == 99
+
+c2 = C()
+for i in range(20):
+    setattr(c2, f'b{i}', [i])
+assert sum([getattr(c2, f'b{i}')[0] for i in range(20)]) == 190
+
+# clearing the dict
+a = A(1, 2)
+a.__dict__.clear()
+assert not hasattr(a, 'x')
+a.y = 3
+assert list(a.__dict__.items()) == [('y', 3)]
+
+# subclasses share the attribute logic
+class D(A):
+    def __init__(self):
+        super().__init__(10, 20)
+        self.z = 30
+
+d = D()
+assert (d.x, d.y, d.z) == (10, 20, 30)
+assert [k for k, _ in d.__dict__.items()] == ['x', 'y', 'z']
+
+# instance attributes shadow class attributes and methods
+class E:
+    v = 1
+    def f(self):
+        return 'method'
+
+e = E()
+assert e.v == 1
+e.v = 2
+assert e.v == 2 and E.v == 1
+e.f = lambda: 'attr'
+g = e.f
+assert g() == 'attr'
+assert E().f() == 'method'
+
+# objects survive collections with values in the extra buffer
+import gc
+class F:
+    pass
+
+fs = []
+for i in range(1000):
+    f = F()
+    for j in range(12):
+        setattr(f, f'k{j}', [i, j])
+    fs.append(f)
+gc.collect()
+assert fs[999].k11 == [999, 11]
+assert sum([f.k5[0] for f in fs]) == 499500
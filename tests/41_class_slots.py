@@ -0,0 +1,145 @@
+class Point:
+    __slots__ = ('x', 'y')
+
+    def __init__(self, x, y):
+        self.x = x
+        self.y = y
+
+    def norm2(self):
+        return self.x * self.x + self.y * self.y
+
+p = Point(3, 4)
+assert p.x == 3 and p.y == 4
+assert p.norm2() == 25
+assert p.__dict__ is None
+assert repr(Point.x) == "<member 'x' of 'Point' objects>"
+assert Point.__slots__ == ('x', 'y')
+
+# the same attribute sites with different values
+pts = [Point(i, -i) for i in range(100)]
+for q in pts:
+    q.x += 1
+assert sum([q.x for q in pts]) == 5050
+assert sum([q.y for q in pts]) == -4950
+
+# only the names in __slots__ can be set
+try:
+    p.z = 1
+    exit(1)
+except AttributeError:
+    pass
+assert not hasattr(p, 'z')
+
+# unset and deleted slots
+class Node:
+    __slots__ = 'value', 'next'
+
+n = Node()
+assert not hasattr(n, 'value')
+n.value = 1
+assert getattr(n, 'value') == 1
+del n.value
+assert not hasattr(n, 'value')
+try:
+    del n.value
+    exit(1)
+except AttributeError:
+    pass
+setattr(n, 'next', None)
+assert n.next is None
+
+# a single string is a single slot
+class Single:
+    __slots__ = 'abc'
+
+s = Single()
+s.abc = 'abc'
+assert s.abc == 'abc'
+
+# subclasses add their own slots after the ones of the base
+class Point3(Point):
+    __slots__ = ('z',)
+
+    def __init__(self, x, y, z):
+        super().__init__(x, y)
+        self.z = z
+
+p3 = Point3(1, 2, 3)
+assert (p3.x, p3.y, p3.z) == (1, 2, 3)
+assert p3.norm2() == 5
+assert p3.__dict__ is None
+
+# subclasses without __slots__ get a __dict__
+class Colored(Point):
+    def __init__(self, x, y, color):
+        super().__init__(x, y)
+        self.color = color
+
+c = Colored(1, 2, 'red')
+assert (c.x, c.y, c.color) == (1, 2, 'red')
+c.extra = 1
+assert c.extra == 1
+del c.x
+assert not hasattr(c, 'x')
+
+# '__dict__' in __slots__ keeps the instance dict
+class Both:
+    __slots__ = ('a', '__dict__')
+
+b = Both()
+b.a = 1
+b.other = 2
+assert (b.a, b.other) == (1, 2)
+
+# slots work with properties and class attributes
+class Temp:
+    __slots__ = ('_c',)
+    unit = 'C'
+
+    def __init__(self, c):
+        self._c = c
+
+    @property
+    def f(self):
+        return self._c * 9 / 5 + 32
+
+    @f.setter
+    def f(self, value):
+        self._c = (value - 32) * 5 / 9
+
+t = Temp(100)
+assert t.f == 212 and t.unit == 'C'
+t.f = 32
+assert t._c == 0
+
+# a slot name cannot also be a class variable
+try:
+    class Bad:
+        __slots__ = ('a',)
+        a = 1
+    exit(1)
+except ValueError:
+    pass
+
+try:
+    class Bad2:
+        __slots__ = (1,)
+    exit(1)
+except TypeError:
+    pass
+
+# slot values survive collections
+import gc
+nodes = []
+for i in range(1000):
+    n = Node()
+    n.value = [i]
+    n.next = nodes[-1] if nodes else None
+    nodes.append(n)
+gc.collect()
+total = 0
+n = nodes[-1]
+while n is not None:
+    total += n.value[0]
+    n = n.next
+assert total == 499500
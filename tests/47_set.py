@@ -87,4 +87,130 @@ assert not {1,2,3}.isdisjoint({2,3,4})
 
 # a = set()
 # b = {*a, 1, 2, 3, *a, *a}
-# assert b == {1, 2, 3}
\ No newline at end of file
+# assert b == {1, 2, 3}
+
+# pop and remove
+a = {1, 2, 3}
+x = a.pop()
+assert x not in a and len(a) == 2
+a.clear()
+try:
+    a.pop()
+    exit(1)
+except KeyError:
+    pass
+try:
+    a.remove(1)
+    exit(1)
+except KeyError:
+    pass
+
+# methods accept any iterables, operators only sets
+a = {1, 2, 3}
+assert a.union([3, 4], (5,)) == {1, 2, 3, 4, 5}
+assert a.intersection([2, 3, 4], range(3)) == {2}
+assert a.difference([1], [2]) == {3}
+assert a.symmetric_difference([3, 4]) == {1, 2, 4}
+assert a.issubset(range(5))
+assert a.issuperset([1, 2])
+assert a.isdisjoint('abc')
+try:
+    a | [4]
+    exit(1)
+except TypeError:
+    pass
+
+a = {1, 2, 3}
+a.intersection_update([2, 3, 4])
+assert a == {2, 3}
+a.difference_update([3])
+assert a == {2}
+a.symmetric_difference_update({2, 5})
+assert a == {5}
+a.update([1], [2, 3])
+assert a == {1, 2, 3, 5}
+
+# comparisons
+assert {1, 2} < {1, 2, 3}
+assert not {1, 2} < {1, 2}
+assert {1, 2} <= {1, 2}
+assert {1, 2, 3} > {1}
+assert {1, 2} >= {2}
+assert {1, 2} != {1, 3}
+assert {1, 2} != [1, 2]
+
+# repr and iteration keep the insertion order
+assert repr({3, 1, 2}) == '{3, 1, 2}'
+assert repr(set()) == 'set()'
+assert list({'b', 'a', 'b'}) == ['b', 'a']
+assert sorted({i % 7 for i in range(100)}) == list(range(7))
+
+# sets are not hashable
+try:
+    hash({1})
+    exit(1)
+except TypeError:
+    pass
+
+# frozenset
+f = frozenset([1, 2, 2, 3])
+assert len(f) == 3 and 2 in f
+assert f == {1, 2, 3} and {1, 2, 3} == f
+assert repr(f) == 'frozenset({1, 2, 3})'
+assert repr(frozenset()) == 'frozenset()'
+assert frozenset(f) is f
+assert f.copy() is f
+assert type(f | {4}) is frozenset
+assert type({4} | f) is set
+assert f & {2, 3, 4} == frozenset({2, 3})
+assert not hasattr(f, 'add')
+
+assert hash(frozenset([1, 2, 3])) == hash(frozenset([3, 2, 1]))
+assert hash(frozenset()) == hash(frozenset())
+d = {frozenset(['a', 'b']): 1}
+assert d[frozenset(['b', 'a'])] == 1
+s = {frozenset([1]), frozenset([1]), frozenset([2])}
+assert len(s) == 2
+
+# subclasses
+class MySet(set):
+    def __init__(self, iterable):
+        super().__init__(iterable)
+        self.tag = 'tagged'
+
+m = MySet([1, 2])
+m.add(3)
+assert m == {1, 2, 3} and m.tag == 'tagged'
+assert isinstance(m, set)
+assert type(m | {4}) is set
+assert repr(m) == 'MySet({1, 2, 3})'
+
+class MyFrozenSet(frozenset):
+    pass
+
+mf = MyFrozenSet([1, 2])
+assert type(mf) is MyFrozenSet and mf == {1, 2}
+assert hash(mf) == hash(frozenset([1, 2]))
+
+# keys with a user defined hash
+class Key:
+    def __init__(self, v):
+        self.v = v
+    def __hash__(self):
+        return hash(self.v)
+    def __eq__(self, other):
+        return self.v == other.v
+    def __ne__(self, other):
+        return self.v != other.v
+
+a = {Key(1), Key(2), Key(1)}
+assert len(a) == 2
+assert Key(2) in a
+assert len(a & {Key(2), Key(3)}) == 1
+
+# elements survive collections
+import gc
+a = {str(i) for i in range(1000)}
+m = MySet([str(i) for i in range(100)])
+gc.collect()
+assert '999' in a and '99' in m
@@ -127,4 +127,20 @@ def f():
     a = yield from g()
     yield a
 
-assert list(f()) == [1, 2, 3]
\ No newline at end of file
+assert list(f()) == [1, 2, 3]
+# suspended stack values must survive gc
+import gc
+
+def g_gc():
+    a = [1, 2, 3]
+    for x in [[4], [5]]:
+        yield a, x
+        gc.collect()
+    yield [i for i in a]
+
+it = g_gc()
+assert next(it) == ([1, 2, 3], [4])
+gc.collect()
+assert next(it) == ([1, 2, 3], [5])
+gc.collect()
+assert next(it) == [1, 2, 3]
@@ -49,4 +49,94 @@ assert not all([True, False])
 assert not all([False, False])
 
 assert list(enumerate([1,2,3])) == [(0,1), (1,2), (2,3)]
-assert list(enumerate([1,2,3], 1)) == [(1,1), (2,2), (3,3)]
\ No newline at end of file
+assert list(enumerate([1,2,3], 1)) == [(1,1), (2,2), (3,3)]
+# lazy iterators
+e = enumerate('ab', start=10)
+assert type(e) is enumerate and iter(e) is e
+assert next(e) == (10, 'a')
+assert list(e) == [(11, 'b')]
+assert list(enumerate(range(3))) == [(0, 0), (1, 1), (2, 2)]
+
+assert list(zip([1, 2, 3], 'ab')) == [(1, 'a'), (2, 'b')]
+assert list(zip([1, 2], (3, 4), range(5, 7))) == [(1, 3, 5), (2, 4, 6)]
+assert list(zip()) == []
+assert list(zip([1, 2])) == [(1,), (2,)]
+assert dict(list(zip('abc', range(3)))) == {'a': 0, 'b': 1, 'c': 2}
+
+m = map(lambda x: x * 2, [1, 2, 3])
+assert type(m) is map
+assert list(m) == [2, 4, 6]
+assert list(m) == []
+assert list(map(lambda x, y: x + y, [1, 2, 3], [10, 20])) == [11, 22]
+assert list(map(str, range(3))) == ['0', '1', '2']
+
+assert list(filter(lambda x: x % 2, range(6))) == [1, 3, 5]
+assert list(filter(None, [0, 1, '', 'a', None, [], [0]])) == [1, 'a', [0]]
+
+def gen():
+    yield 1
+    yield 2
+    yield 3
+
+assert list(zip(gen(), map(lambda x: -x, gen()))) == [(1, -1), (2, -2), (3, -3)]
+
+# sum
+assert sum([]) == 0
+assert sum([1, 2, 3]) == 6
+assert sum((1.5, 2.5)) == 4.0
+assert sum([1, 2.5, 1]) == 4.5
+assert sum(range(101)) == 5050
+assert sum(range(10, 0, -2)) == 30
+assert sum([1, 2], 10) == 13
+assert sum([[1], [2, 3]], []) == [1, 2, 3]
+assert sum(map(len, ['a', 'bc'])) == 3
+
+# min and max
+assert min(3, 1, 2) == 1 and max(3, 1, 2) == 3
+assert min('bca') == 'a' and max(range(5)) == 4
+assert min([(1, 'b'), (1, 'a')]) == (1, 'a')
+assert min(['aa', 'b', 'cc'], key=len) == 'b'
+assert max(['aa', 'b', 'cc'], key=len) == 'aa'
+assert min([3, 1, 1], key=lambda x: 0) == 3
+assert max(gen()) == 3
+for f in [min, max]:
+    try:
+        f([])
+        exit(1)
+    except ValueError:
+        pass
+    try:
+        f()
+        exit(1)
+    except TypeError:
+        pass
+
+# any and all stop early
+def bools(*args):
+    for b in args:
+        if b is None:
+            raise RuntimeError
+        yield b
+
+assert any(bools(0, 1, None))
+assert not all(bools(1, 0, None))
+assert any(range(2)) and not all(range(2))
+
+# sorted and reversed
+assert sorted('cab') == ['a', 'b', 'c']
+assert sorted(range(3), reverse=True) == [2, 1, 0]
+assert sorted([(1, 'b'), (0, 'x'), (1, 'a')], key=lambda t: t[0]) == [(0, 'x'), (1, 'b'), (1, 'a')]
+t = (1, 2)
+assert sorted(t) == [1, 2] and t == (1, 2)
+assert list(reversed((1, 2, 3))) == [3, 2, 1]
+assert list(reversed(range(3))) == [2, 1, 0]
+assert list(reversed(list(gen()))) == [3, 2, 1]
+
+# the input list may change while it is walked
+a = [1, 2, 3]
+def grow(x):
+    if len(a) < 6:
+        a.append(x)
+    return x
+assert max(a, key=grow) == 3
+assert len(a) == 6
@@ -1,4 +1,7 @@
 import gc
+from collections import deque
+from array import array
+from array2d import array2d
 
 gc.setup_debug_callback(print)
 
@@ -12,4 +15,221 @@ gc.collect()
 
 create_garbage()
 create_garbage()
-create_garbage()
\ No newline at end of file
+create_garbage()
+gc.setup_debug_callback(None)
+
+# generational mode
+assert gc.isgenerational()
+
+class Entity:
+    def __init__(self, i):
+        self.id = i
+        self.items = []
+        self.tags = {}
+
+world = [Entity(i) for i in range(1000)]
+gc.collect()    # everything above is old now
+
+# old objects pointing to young ones
+for e in world:
+    e.items.append([e.id, str(e.id)])
+    e.tags[str(e.id)] = (e.id, [e.id])
+    e.child = Entity(-e.id)
+world.append(Entity(1000))
+create_garbage()
+assert gc.collect(0) >= 20000
+
+for i, e in enumerate(world[:1000]):
+    assert e.items == [[i, str(i)]]
+    assert e.tags[str(i)] == (i, [i])
+    assert e.child.id == -i
+assert world[-1].id == 1000
+
+# survivors of a minor collection are promoted, only a full collection frees them
+gc.disable()
+gc.collect()
+x = world.pop()
+assert gc.collect(0) == 0
+del x
+assert gc.collect(0) == 0
+assert gc.collect() == 3
+gc.enable()
+
+# switching modes keeps objects alive
+gc.set_generational(False)
+assert not gc.isgenerational()
+create_garbage()
+gc.collect()
+assert world[999].child.id == -999
+gc.set_generational(True)
+assert gc.collect(0) == 0
+assert world[999].tags['999'] == (999, [999])
+
+try:
+    gc.collect(2)
+    exit(1)
+except ValueError:
+    pass
+
+# incremental collection, the heap is changed between steps
+gc.disable()
+for generational in [False, True]:
+    gc.collect()
+    gc.set_generational(generational)   # the next collection is a full one
+    assert gc.step(1000)                # but it is not due yet
+    while gc.step(0):
+        create_garbage()
+    kept = {}
+    steps = 0
+    while not gc.step(0):
+        e = world[steps % len(world)]
+        e.tags[steps] = [steps, str(steps)]
+        e.items = [steps]
+        kept[steps] = Entity(steps)
+        steps += 1
+    assert steps > 1
+    create_garbage()
+    gc.collect()
+    for i in range(steps):
+        assert world[i % len(world)].tags[i] == [i, str(i)]
+        assert kept[i].id == i
+    for e in world[steps:]:
+        assert e.items == [[e.id, str(e.id)]]
+gc.enable()
+assert gc.isgenerational()
+
+try:
+    gc.step(-1)
+    exit(1)
+except ValueError:
+    pass
+
+# empty arenas are given back after a spike
+import pkpy
+
+def get_usage(key):
+    s = pkpy.memory_usage()
+    i = s.index(key + '=') + len(key) + 1
+    j = i
+    while s[j] in '0123456789':
+        j += 1
+    return int(s[i:j])
+
+gc.collect()
+base = get_usage('reserved_bytes')
+released = get_usage('released_arenas')
+spike = [[i] for i in range(100000)]
+peak = get_usage('reserved_bytes')
+assert peak > base
+del spike
+gc.collect()
+assert get_usage('released_arenas') > released
+assert get_usage('reserved_bytes') < (base + peak) // 2
+
+# large objects keep their marks in a bitmap indexed by slot, freed slots are reused
+for generational in [False, True]:
+    gc.collect()
+    gc.set_generational(generational)
+    large = []
+    for i in range(3000):
+        t = tuple(range(i % 30 + 20))
+        if i % 3 == 0:
+            large.append(t)
+    count = get_usage('len(large_objects)')
+    del t
+    gc.collect()
+    assert get_usage('len(large_objects)') < count
+    for i, t in enumerate(large):
+        assert t == tuple(range(i * 3 % 30 + 20))
+assert gc.isgenerational()
+
+# collections are paced by bytes, a few huge objects trigger them as well
+gc.collect()
+base = gc.get_memory_usage()
+for i in range(200):
+    s = 'x' * 100000
+    chunk = [i] * 10000
+assert gc.get_memory_usage() < base + 40 * 1024 * 1024
+del s, chunk
+
+# hard memory limit
+for generational in [False, True]:
+    gc.set_generational(generational)
+    gc.collect()
+    base = gc.get_memory_usage()
+    gc.set_memory_limit(base + 8 * 1024 * 1024)
+    assert gc.get_memory_limit() == base + 8 * 1024 * 1024
+    # garbage is collected before the limit is reached
+    for i in range(50):
+        garbage = [[j] for j in range(10000)]
+    del garbage
+    try:
+        a = [0] * (10 ** 7)
+        exit(1)
+    except MemoryError:
+        pass
+    try:
+        a = 'abc' * (10 ** 7)
+        exit(1)
+    except MemoryError:
+        pass
+    a = []
+    try:
+        while True:
+            a.append([len(a)])
+        exit(1)
+    except MemoryError:
+        # the handler can still make calls, only reservations raise
+        n = len(a)
+        a = None
+    assert n > 0
+    # the buffers of other containers are reserved too
+    d, st, q, arr = {}, set(), deque(), array('q')
+    for add in [lambda i: d.__setitem__(i, i), st.add, q.append, arr.append]:
+        i = 0
+        try:
+            while True:
+                add(i)
+                i += 1
+        except MemoryError:
+            pass
+        assert i > 0
+    d = st = q = arr = add = None
+    try:
+        a = array2d(4096, 4096, dtype='int32')
+        exit(1)
+    except MemoryError:
+        pass
+    a = b'x'
+    try:
+        while True:
+            a = a + a
+    except MemoryError:
+        a = None
+    gc.collect()
+    assert gc.get_memory_usage() <= base + 8 * 1024 * 1024
+    a = [[i] for i in range(10000)]
+    assert a[-1] == [9999]
+    gc.set_memory_limit(0)
+    a = [0] * (10 ** 6)
+    del a
+assert gc.isgenerational()
+
+try:
+    gc.set_memory_limit(-1)
+    exit(1)
+except ValueError:
+    pass
+
+# containers filled by native code survive a collection in the middle
+def _gen(n):
+    for i in range(n):
+        if i % 50 == 0:
+            gc.collect()
+        yield [i]
+
+for t in zip(_gen(200), _gen(200)):
+    saved = t
+    for _ in range(200):
+        [[j] for j in range(10)]
+    assert saved[0] == saved[1]
@@ -0,0 +1,87 @@
+import tracemalloc
+import json
+
+assert not tracemalloc.is_tracing()
+try:
+    tracemalloc.take_snapshot()
+    exit(1)
+except RuntimeError:
+    pass
+
+tracemalloc.start()
+assert tracemalloc.is_tracing()
+
+def make_lists(n):
+    return [[i] for i in range(n)]
+
+s1 = tracemalloc.take_snapshot()
+keep = make_lists(1000)
+for _ in range(10):
+    temp = make_lists(100)
+del temp
+s2 = tracemalloc.take_snapshot()
+
+# the line that keeps 1000 lists alive is the biggest one
+top = s2.statistics(limit=1)
+assert len(top) == 1
+assert top[0]['filename'].endswith('71_tracemalloc.py'), top
+assert top[0]['lineno'] == 15, top
+assert top[0]['count'] == 1001, top
+assert top[0]['size'] > 1000 * 32, top
+assert top[0]['total_count'] >= 1001 + 10 * 101, top
+
+# group by type
+stats = s2.statistics('type', 'count')
+assert stats[0]['type'] == 'list', stats
+assert stats[0]['filename'] is None and stats[0]['lineno'] is None
+for i in range(1, len(stats)):
+    assert stats[i-1]['count'] >= stats[i]['count'], stats
+
+# group by file
+stats = s2.statistics('filename')
+assert len(stats) == 1 and stats[0]['filename'].endswith('71_tracemalloc.py'), stats
+
+# group by line and type
+stats = s2.statistics('site', 'total_count', 2)
+assert len(stats) == 2
+assert stats[0]['type'] == 'list' and stats[0]['lineno'] == 15, stats
+
+# diff
+diff = s2.compare_to(s1, limit=1)
+assert diff[0]['lineno'] == 15, diff
+assert diff[0]['count_diff'] == diff[0]['count'], diff
+assert diff[0]['size_diff'] == diff[0]['size'], diff
+diff = s2.compare_to(s2)
+assert all([x['count_diff'] == 0 and x['size_diff'] == 0 for x in diff])
+
+# freed objects are not counted
+del keep
+s3 = tracemalloc.take_snapshot()
+stats = s3.compare_to(s2, 'lineno', 'count')
+assert stats[0]['lineno'] == 15, stats
+assert stats[0]['count'] == 0 and stats[0]['count_diff'] == -1001, stats
+
+# json export
+data = json.loads(s2.to_json())
+records = data['records']
+assert sum([r['count'] for r in records if r['lineno'] == 15]) == 1001
+for r in records:
+    assert set(r.keys()) == {'filename', 'lineno', 'type', 'count', 'size', 'total_count', 'total_size'}
+
+try:
+    s2.statistics('unknown')
+    exit(1)
+except ValueError:
+    pass
+
+try:
+    s2.statistics(sort_by='unknown')
+    exit(1)
+except ValueError:
+    pass
+
+tracemalloc.stop()
+assert not tracemalloc.is_tracing()
+
+# snapshots are still readable after stopping
+assert s2.statistics(limit=1) == top
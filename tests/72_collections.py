@@ -490,12 +490,12 @@ assertEqual(list(d), list(e))
 
 ########## test pickle #############
 
-# d = deque(range(200))
-# for _ in range(5 + 1):
-#     s = pickle.dumps(d)
-#     e = pickle.loads(s)
-#     assertNotEqual(id(e), id(d))
-#     assertEqual(list(e), list(d))
+d = deque(range(200))
+for _ in range(5 + 1):
+    s = pickle.dumps(d)
+    e = pickle.loads(s)
+    assertNotEqual(id(e), id(d))
+    assertEqual(list(e), list(d))
 
 ### test copy ########
 
@@ -524,23 +524,132 @@ q.append(1)
 q.append(2)
 q.append(3)
 assertEqual(list(q), [1, 2, 3])
-assertEqual(q._data, [1, 2, 3, None])
 q.append(4)
 assertEqual(list(q), [2, 3, 4])
-assertEqual(q._data, [None, 2, 3, 4])
 q.appendleft(1)
 assertEqual(list(q), [1, 2, 3])
-assertEqual(q._data, [1, 2, 3, None])
 q.appendleft(0)
 assertEqual(list(q), [0, 1, 2])
-assertEqual(q._data, [1, 2, None, 0])
 q.pop()
 assertEqual(list(q), [0, 1])
-assertEqual(q._data, [1, None, None, 0])
 assertEqual(len(q), 2)
-assertEqual(q._capacity, 4)
 q.popleft()
 assertEqual(list(q), [1])
-assertEqual(q._data, [1, None, None, None])
 
+q = deque([1, 2, 3], maxlen=2)
+assertEqual(list(q), [2, 3])
+assertEqual(repr(q), 'deque([2, 3], maxlen=2)')
+e = pickle.loads(pickle.dumps(q))
+assertEqual(e.maxlen, 2)
+q = deque(maxlen=0)
+q.append(1)
+q.appendleft(2)
+assertEqual(len(q), 0)
+assert not q
+
+# indexing, remove and reverse
+d = deque('abcde')
+d.rotate(2)
+assertEqual(d[0], 'd')
+assertEqual(d[-1], 'c')
+d[1] = 'E'
+assertEqual(list(d), ['d', 'E', 'a', 'b', 'c'])
+d.remove('a')
+assertEqual(list(d), ['d', 'E', 'b', 'c'])
+d.reverse()
+assertEqual(list(d), ['c', 'b', 'E', 'd'])
+try:
+    d[4]
+    exit(1)
+except IndexError:
+    pass
+try:
+    d.remove('x')
+    exit(1)
+except ValueError:
+    pass
+
+# extend with itself
+d = deque([1, 2])
+d.extend(d)
+assertEqual(list(d), [1, 2, 1, 2])
+d.extendleft(d)
+assertEqual(list(d), [2, 1, 2, 1, 1, 2, 1, 2])
+
+# subclasses
+class MyDeque(deque):
+    def push(self, x):
+        self.append(x)
+
+d = MyDeque([1], maxlen=3)
+d.push(2)
+d.tag = 'tagged'
+assertEqual(list(d), [1, 2])
+assertEqual(repr(d), 'MyDeque([1, 2], maxlen=3)')
+
+# a queue of objects that survive collections
+d = deque()
+for i in range(1000):
+    d.append([i])
+    if i % 2 == 0:
+        d.popleft()
+gc.collect()
+assertEqual(sum([x[0] for x in d]), sum(range(500, 1000)))
+
+# defaultdict
+a = defaultdict(list, [('x', [1])])
+a['y'].append(2)
+assertEqual(a, {'x': [1], 'y': [2]})
+assertEqual(a.default_factory, list)
+assertEqual(repr(defaultdict(int)), "defaultdict(<class 'int'>, {})")
+b = a.copy()
+assert type(b) is defaultdict
+b['z'].append(3)
+assert 'z' not in a
+c = defaultdict(int, {'k': 1})
+c['k'] += 1
+assertEqual(c['k'], 2)
+assertEqual(c.get('missing'), None)
+assert 'missing' not in c
+d = defaultdict()
+try:
+    d['x']
+    exit(1)
+except KeyError:
+    pass
+assert isinstance(a, dict)
+assert a == a.copy()
+
+class MyDefaultDict(defaultdict):
+    pass
 
+m = MyDefaultDict(lambda: 'default')
+assertEqual(m['x'], 'default')
+gc.collect()
+assertEqual(m.default_factory(), 'default')
+
+# Counter
+c = Counter('abracadabra')
+assertEqual(c['a'], 5)
+assertEqual(c['z'], 0)
+assert 'z' not in c
+assertEqual(c.most_common(2), [('a', 5), ('b', 2)])
+assertEqual(c.most_common(0), [])
+assertEqual(len(c.most_common()), 5)
+assertEqual(repr(Counter('aab')), "Counter({'a': 2, 'b': 1})")
+assertEqual(repr(Counter()), 'Counter()')
+assertEqual(c.total(), 11)
+assert isinstance(c, dict)
+assert c == dict(list(c.items()))
+assert c == c.copy()
+c.update(['a', 'z'])
+assertEqual(c['a'], 6)
+c.update({'a': 4})
+assertEqual(c['a'], 10)
+c.subtract('aaaaaaaaaaz')
+assertEqual(c['a'], 0)
+assertEqual(c['z'], 0)
+c['q'] += 1
+assertEqual(c['q'], 1)
+assertEqual(Counter([i % 3 for i in range(30)]), {0: 10, 1: 10, 2: 10})
+assertEqual(Counter(range(3)), {0: 1, 1: 1, 2: 1})
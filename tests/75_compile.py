@@ -3,3 +3,144 @@ assert eval("1+2") == 3
 code = compile("1+2", "<eval>", "eval")
 # print(code)
 assert eval(code) == 3
+
+# bytecode serialization
+from pkpy import compile_to_bytes, exec_bytes, compile_cache
+
+src = '''
+def f(a, *args, b=(1, 2.5, ('x', None)), c=True, e=..., **kwargs):
+    """doc of f"""
+    for i in range(3):
+        a += i
+    return a, b, args, c, e, kwargs
+
+class Point:
+    def __init__(self, x, y):
+        self.x = x
+        self.y = y
+    def norm2(self):
+        return self.x * self.x + self.y * self.y
+
+def gen():
+    for i in [1, 2, 3]:
+        yield i * i
+g = gen()
+res = f(10, 7, 8, c=b'b', d=-12345678901)
+res2 = f(1, **{'c': 2})
+'''
+data = compile_to_bytes(src, '<pkc>', 'exec')
+assert type(data) is bytes
+assert data[:3] == b'pkc'
+assert compile_to_bytes(src, '<pkc>', 'exec') == data
+
+exec_bytes(data)
+assert res == (13, (1, 2.5, ('x', None)), (7, 8), b'b', ..., {'d': -12345678901}), res
+assert res2 == (4, (1, 2.5, ('x', None)), (), 2, ..., {})
+assert f(0) == (3, (1, 2.5, ('x', None)), (), True, ..., {})
+assert f.__doc__ == 'doc of f'
+assert Point(3, 4).norm2() == 25
+assert list(g) == [1, 4, 9]
+assert exec_bytes(compile_to_bytes('1 + 2 * 3', '<pkc>', 'eval')) == 7
+
+# quickened code is written back in its generic form
+def add(a, b):
+    return a + b
+for _ in range(10):
+    add(1, 2)
+assert exec_bytes(compile_to_bytes('(lambda a, b: a + b)(1.5, 2)', '<pkc>', 'eval')) == 3.5
+
+# runtime errors still carry the filename
+try:
+    exec_bytes(compile_to_bytes('x = 1\n1 / 0', 'foo.py', 'exec'))
+    exit(1)
+except ZeroDivisionError:
+    pass
+
+for bad in [b'', b'xyz', data[:-1], data + b'\x00', data[:4] + b'\xff' + data[5:]]:
+    try:
+        exec_bytes(bad)
+        exit(1)
+    except ValueError:
+        pass
+
+# every instruction argument is checked against its table or the code length
+def read_varint(buf, i):
+    v = 0
+    shift = 0
+    while True:
+        b = buf[i]
+        i += 1
+        v |= (b & 0x7f) << shift
+        shift += 7
+        if b < 0x80:
+            return v, i
+
+def skip_str(buf, i):
+    n, i = read_varint(buf, i)
+    return i + n // 2   # zigzag-encoded
+
+def instructions(buf):
+    i = skip_str(buf, 4)            # "pkc" format, version
+    i += 8 + 2                      # opcode hash, mode, is_dynamic
+    i = skip_str(buf, i) + 8        # filename, source hash
+    _, i = read_varint(buf, i)      # source size
+    i = skip_str(buf, i)            # name
+    _, i = read_varint(buf, i)      # start_line
+    _, i = read_varint(buf, i)      # end_line
+    n, i = read_varint(buf, i)
+    res = []
+    for _ in range(n // 2):
+        start = i + 1
+        _, i = read_varint(buf, start)
+        res.append((start, i))
+    return res
+
+a, c = 1, 2
+blob = compile_to_bytes('if a:\n    b = c\n', '<pkc>', 'exec')
+exec_bytes(blob)
+assert b == 2
+rejected = 0
+for start, end in instructions(blob):
+    for arg in [b'\xff\xff\x01', b'\x80\x80\x02']:
+        try:
+            exec_bytes(blob[:start] + arg + blob[end:])
+        except ValueError:
+            rejected += 1
+# the two global loads, the store and the jump
+assert rejected == 8, rejected
+
+try:
+    compile_to_bytes('1', '<pkc>', 'xxx')
+    exit(1)
+except ValueError:
+    pass
+
+# .pkc compile cache of `import`
+try:
+    import os
+except ImportError:
+    exit(0)
+
+mod_src = 'def hello(name):\n    return "hello " + name\n'
+with open('_pkc_test_a.py', 'wt') as fp:
+    fp.write(mod_src)
+compile_cache(True)
+import _pkc_test_a
+assert _pkc_test_a.hello('a') == 'hello a'
+assert os.path.exists('_pkc_test_a.pkc')
+with open('_pkc_test_a.pkc', 'rb') as fp:
+    assert fp.read() == compile_to_bytes(mod_src, '_pkc_test_a.py', 'exec')
+
+# a corrupted cache is ignored and rewritten
+with open('_pkc_test_b.py', 'wt') as fp:
+    fp.write(mod_src)
+with open('_pkc_test_b.pkc', 'wb') as fp:
+    fp.write(b'pkc-garbage')
+import _pkc_test_b
+assert _pkc_test_b.hello('b') == 'hello b'
+with open('_pkc_test_b.pkc', 'rb') as fp:
+    assert fp.read() == compile_to_bytes(mod_src, '_pkc_test_b.py', 'exec')
+compile_cache(False)
+
+for name in ['_pkc_test_a.py', '_pkc_test_a.pkc', '_pkc_test_b.py', '_pkc_test_b.pkc']:
+    os.remove(name)
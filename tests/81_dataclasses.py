@@ -56,4 +56,21 @@ config = PrimaryForceConfig(
    planetary_humidity = 4
 )
 
-assert config.planetary_wind == 'default'
\ No newline at end of file
+assert config.planetary_wind == 'default'
+@dataclass
+class Slotted:
+    __slots__ = ('x', 'y')
+    x: int
+    y: list
+
+s = Slotted(1, [2])
+assert s.__dict__ is None
+assert repr(s) == "Slotted(x=1, y=[2])"
+assert asdict(s) == {'x': 1, 'y': [2]}
+assert s == Slotted(1, [2])
+assert s != Slotted(1, [3])
+try:
+    Slotted(1)
+    exit(1)
+except TypeError:
+    pass
@@ -0,0 +1,264 @@
+from array import array, typecodes
+import pickle
+
+assert typecodes == 'bhiqfd'
+
+# construction
+a = array('i', [1, 2, 3])
+assert len(a) == 3
+assert a.typecode == 'i' and a.itemsize == 4
+assert repr(a) == "array('i', [1, 2, 3])"
+assert repr(array('d')) == "array('d')"
+assert array('h', range(4)).tolist() == [0, 1, 2, 3]
+assert array('q', map(lambda x: x * x, [1, 2, 3])).tolist() == [1, 4, 9]
+assert array('f', [1, 2.5]).tolist() == [1.0, 2.5]
+assert array('d', a).tolist() == [1.0, 2.0, 3.0]
+assert array('b', a) == a
+assert [array(tc).itemsize for tc in typecodes] == [1, 2, 4, 8, 4, 8]
+
+try:
+    array('x')
+    exit(1)
+except ValueError:
+    pass
+
+try:
+    array('b', [128])
+    exit(1)
+except ValueError:
+    pass
+
+try:
+    array('i', [1.5])
+    exit(1)
+except TypeError:
+    pass
+
+try:
+    array('i', array('d', [1.0]))
+    exit(1)
+except TypeError:
+    pass
+
+try:
+    array('b', array('i', [1000]))
+    exit(1)
+except ValueError:
+    pass
+
+# sequence methods
+a = array('i', [1, 2, 3])
+a.append(4)
+a.extend([5, 6])
+a.extend(array('i', [7]))
+a.extend(a)
+assert a.tolist() == [1, 2, 3, 4, 5, 6, 7, 1, 2, 3, 4, 5, 6, 7]
+assert a.pop() == 7 and a.pop(0) == 1
+a.insert(0, 0)
+a.insert(100, 8)
+a.insert(-1, 9)
+assert a.tolist() == [0, 2, 3, 4, 5, 6, 7, 1, 2, 3, 4, 5, 6, 9, 8]
+a.remove(2)
+del a[0]
+assert a.tolist() == [3, 4, 5, 6, 7, 1, 2, 3, 4, 5, 6, 9, 8]
+assert a.index(4) == 1 and a.count(3) == 2 and a.count(100) == 0
+assert 9 in a and 10 not in a and 9.0 in a
+a.reverse()
+assert a.tolist() == [8, 9, 6, 5, 4, 3, 2, 1, 7, 6, 5, 4, 3]
+assert list(a) == a.tolist()
+assert a[0] == 8 and a[-1] == 3
+a[0] = -8
+assert a[0] == -8
+
+try:
+    a[100]
+    exit(1)
+except IndexError:
+    pass
+
+try:
+    array('i').pop()
+    exit(1)
+except IndexError:
+    pass
+
+# slices are copies
+a = array('i', range(10))
+b = a[2:5]
+b[0] = 100
+assert a[2] == 2 and b.tolist() == [100, 3, 4]
+assert a[::-3].tolist() == [9, 6, 3, 0]
+a[1:3] = array('i', [7, 7, 7, 7])
+assert a.tolist() == [0, 7, 7, 7, 7, 3, 4, 5, 6, 7, 8, 9]
+a[::2] = array('i', [1, 1, 1, 1, 1, 1])
+assert a.tolist() == [1, 7, 1, 7, 1, 3, 1, 5, 1, 7, 1, 9]
+a[2:] = a[:2]
+assert a.tolist() == [1, 7, 1, 7]
+
+# equality
+assert array('i', [1, 2]) == array('d', [1.0, 2.0])
+assert array('i', [1, 2]) != array('i', [1, 3])
+assert array('i', [1, 2]) != array('i', [1, 2, 3])
+assert array('i') == array('b')
+
+# bytes
+a = array('h', [1, -2, 300])
+data = a.tobytes()
+assert len(data) == 6
+b = array('h')
+b.frombytes(data)
+assert b == a
+assert array('h', data) == a
+b.fromlist([4])
+assert b.tolist() == [1, -2, 300, 4]
+
+try:
+    b.fromlist([5, 1.5])
+    exit(1)
+except TypeError:
+    pass
+assert b.tolist() == [1, -2, 300, 4]
+
+try:
+    array('i', b'abc')
+    exit(1)
+except ValueError:
+    pass
+
+# pickle
+for tc in typecodes:
+    a = array(tc, [1, 2, 3])
+    b = pickle.loads(pickle.dumps(a))
+    assert b == a and b.typecode == tc
+assert pickle.loads(pickle.dumps([array('d', [0.5])]))[0].tolist() == [0.5]
+
+# views share the buffer
+a = array('i', range(10))
+v = a.view(2, 5)
+assert v.tolist() == [2, 3, 4]
+v[0] = 100
+assert a[2] == 100
+a[3] = 200
+assert v[1] == 200
+w = v.view(1)
+assert w.tolist() == [200, 4]
+w.fill(-1)
+assert a.tolist() == [0, 1, 100, -1, -1, 5, 6, 7, 8, 9]
+assert a.view(-2).tolist() == [8, 9]
+assert len(a.view(5, 5)) == 0
+
+try:
+    v.append(1)
+    exit(1)
+except TypeError:
+    pass
+
+try:
+    a.view(5, 11)
+    exit(1)
+except IndexError:
+    pass
+
+# a view is checked against its base on each access
+v = a.view(8)
+for i in range(5):
+    a.pop()
+try:
+    v[0]
+    exit(1)
+except ValueError:
+    pass
+
+# element-wise arithmetic
+a = array('i', [1, 2, 3, 4])
+b = array('i', [10, 20, 30, 40])
+assert a.add(b).tolist() == [11, 22, 33, 44]
+assert b.sub(a).tolist() == [9, 18, 27, 36]
+assert a.mul(b).tolist() == [10, 40, 90, 160]
+assert a.add(1).tolist() == [2, 3, 4, 5]
+assert a.mul(2).typecode == 'i'
+assert b.div(a).tolist() == [10.0, 10.0, 10.0, 10.0]
+assert b.div(a).typecode == 'd'
+assert a.div(0).tolist() == [float('inf')] * 4
+
+try:
+    a.add(array('i', [1]))
+    exit(1)
+except ValueError:
+    pass
+
+try:
+    a.add('1')
+    exit(1)
+except TypeError:
+    pass
+
+# integers wrap around, except when a scalar does not fit
+c = array('b', [100, -100])
+assert c.add(100).tolist() == [-56, 0]
+assert c.add(1000).tolist() == [1100, 900]
+assert c.add(1000).typecode == 'q'
+
+# promotion
+assert array('b', [1]).add(array('h', [1])).typecode == 'h'
+assert array('q', [1]).add(array('i', [1])).typecode == 'q'
+assert array('f', [1]).add(array('h', [1])).typecode == 'f'
+assert array('f', [1]).add(array('i', [1])).typecode == 'd'
+assert array('f', [1]).add(array('d', [1])).typecode == 'd'
+assert array('f', [1]).add(0.5).typecode == 'f'
+assert array('i', [1]).add(0.5).tolist() == [1.5]
+assert array('f', [0.5, 1.5]).mul(array('b', [2, 4])).tolist() == [1.0, 6.0]
+
+# comparisons return masks
+a = array('d', [1.0, 2.5, 3.0, -1.0])
+assert a.lt(2).tolist() == [1, 0, 0, 1]
+assert a.le(3).tolist() == [1, 1, 1, 1]
+assert a.gt(array('i', [1, 2, 3, 4])).tolist() == [0, 1, 0, 0]
+assert a.ge(1).typecode == 'b'
+assert a.eq(3).tolist() == [0, 0, 1, 0]
+assert a.ne(3).tolist() == [1, 1, 0, 1]
+assert a.compress(a.gt(0)).tolist() == [1.0, 2.5, 3.0]
+assert a.compress(a.gt(10)).tolist() == []
+
+# reductions
+a = array('i', [3, -1, 4, 1, -5])
+assert a.sum() == 2 and a.min() == -5 and a.max() == 4
+assert array('f', [0.5, 0.25]).sum() == 0.75
+assert array('i').sum() == 0
+assert a.dot(a) == 52
+assert a.dot(array('d', [0.5] * 5)) == 1.0
+assert array('b', [100, 100]).sum() == 200
+assert array('b', [100, 100]).dot(array('b', [100, 100])) == 20000
+
+try:
+    array('d').max()
+    exit(1)
+except ValueError:
+    pass
+
+# array2d
+from array2d import array2d
+g = array2d(3, 2, default=0)
+g[1, 0] = 5
+g[2, 1] = 7
+a = array('i', g)
+assert a.tolist() == [0, 5, 0, 0, 0, 7]
+g2 = a.mul(2).to_array2d(3, 2)
+assert g2.n_cols == 3 and g2.n_rows == 2
+assert g2[1, 0] == 10 and g2[2, 1] == 14
+
+try:
+    a.to_array2d(4, 2)
+    exit(1)
+except ValueError:
+    pass
+
+# subclasses
+class Samples(array):
+    pass
+
+s = Samples('d', [1, 2])
+s.name = 'x'
+assert repr(s) == "Samples('d', [1.0, 2.0])"
+assert s.add(1).tolist() == [2.0, 3.0]
+assert isinstance(pickle.loads(pickle.dumps(s)), Samples)
@@ -244,6 +244,55 @@ vis, cnt = a.get_connected_components(2, 'von Neumann')
 assert cnt == 1
 vis, cnt = a.get_connected_components(0, 'Moore')
 assert cnt == 2
+assert vis.tolist() == [[0, 0, 1, 0], [2, 0, 0, 0], [2, 0, 0, 0], [0, 2, 2, 2]]
+
+# test get_distance_field
+grid = array2d[int].fromlist([
+    [0, 0, 0, 0],
+    [1, 1, 0, 1],
+    [0, 0, 0, 0],
+    [0, 1, 1, 0],
+])
+dist = grid.get_distance_field(vec2i(0, 0), 0)
+assert dist.dtype == 'int32'
+assert dist.tolist() == [[0, 1, 2, 3], [-1, -1, 3, -1], [6, 5, 4, 5], [7, -1, -1, 6]]
+dist = grid.get_distance_field([vec2i(0, 0), vec2i(0, 3)], lambda v: v == 0, 'Moore')
+assert dist.tolist() == [[0, 1, 2, 3], [-1, -1, 2, -1], [1, 1, 2, 3], [0, -1, -1, 3]]
+assert grid.get_distance_field([], 0).count(-1) == 16
+try:
+    grid.get_distance_field(vec2i(4, 0), 0)
+    exit(1)
+except IndexError:
+    pass
+
+# test flood_fill
+region = grid.flood_fill(vec2i(3, 0))
+assert region.dtype == 'bool'
+assert region.count(True) == 11
+assert region.tolist()[3] == [True, False, False, True]
+assert grid.flood_fill(vec2i(0, 1), 'Moore').count(True) == 2
+assert grid.flood_fill(vec2i(1, 3)).tolist()[3] == [False, True, True, False]
+
+# test find_path
+path = grid.find_path(vec2i(0, 0), vec2i(0, 3), 0)
+assert path == [vec2i(0, 0), vec2i(1, 0), vec2i(2, 0), vec2i(2, 1), vec2i(2, 2),
+                vec2i(1, 2), vec2i(0, 2), vec2i(0, 3)]
+assert len(grid.find_path(vec2i(0, 0), vec2i(0, 3), 0, 'Moore')) == 5
+assert grid.find_path(vec2i(0, 0), vec2i(1, 1), 0) is None
+assert grid.find_path(vec2i(2, 2), vec2i(2, 2), 0) == [vec2i(2, 2)]
+assert grid.find_path(vec2i(0, 0), vec2i(3, 3), lambda v: v != 1) is not None
+# a cost grid, negative costs block the cells
+costs = array2d[int].fromlist([
+    [1, 9, 1],
+    [1, 9, 1],
+    [1, 1, 1],
+])
+assert costs.find_path(vec2i(0, 0), vec2i(2, 0)) == [
+    vec2i(0, 0), vec2i(0, 1), vec2i(0, 2), vec2i(1, 2), vec2i(2, 2), vec2i(2, 1), vec2i(2, 0)]
+costs[1, 2] = -1
+assert costs.find_path(vec2i(0, 0), vec2i(2, 0)) == [vec2i(0, 0), vec2i(1, 0), vec2i(2, 0)]
+costs = costs.astype('float32')
+assert len(costs.find_path(vec2i(0, 0), vec2i(2, 2), None, 'Moore')) == 3
 
 # test zip_with
 a = array2d[int].fromlist([[1, 2], [3, 4]])
@@ -279,6 +328,97 @@ assert (a ^ b).tolist() == [[False, True], [False, True]]
 assert (~a).tolist() == [[False, True], [True, False]]
 assert (~b).tolist() == [[False, False], [True, True]]
 
+# typed storage
+a = array2d(3, 2, dtype='int32')
+assert a.dtype == 'int32'
+assert a.tolist() == [[0, 0, 0], [0, 0, 0]]
+assert array2d(2, 2).dtype is None
+assert array2d(2, 2, default=1.5, dtype='float32').tolist() == [[1.5, 1.5], [1.5, 1.5]]
+a = array2d(3, 2, default=lambda p: p.x + p.y, dtype='int8')
+assert a.tolist() == [[0, 1, 2], [1, 2, 3]]
+assert a[2, 1] == 3
+a[0, 0] = -128
+assert a[0, 0] == -128
+try:
+    a[0, 0] = 128
+    exit(1)
+except ValueError:
+    pass
+try:
+    a[0, 0] = 'x'
+    exit(1)
+except TypeError:
+    pass
+try:
+    array2d(2, 2, dtype='int64')
+    exit(1)
+except ValueError:
+    pass
+a[0, 0] = 0
+
+# int8 is promoted to int32, int32 wraps around
+assert (a + a).dtype == 'int32'
+assert (a * 100).tolist() == [[0, 100, 200], [100, 200, 300]]
+big = array2d(1, 1, default=2**31 - 1, dtype='int32')
+assert (big + 1)[0, 0] == -2**31
+assert (a / 2).dtype == 'float32'
+assert (a / 2).tolist() == [[0.0, 0.5, 1.0], [0.5, 1.0, 1.5]]
+assert (a + 0.5).dtype == 'float32'
+assert (a - a.astype('float32')).tolist() == [[0.0] * 3, [0.0] * 3]
+# no typed kernel
+assert (a // 2).dtype is None
+assert (a // 2).tolist() == [[0, 0, 1], [0, 1, 1]]
+assert (a % 2).tolist() == [[0, 1, 0], [1, 0, 1]]
+assert (a & 1).tolist() == [[0, 1, 0], [1, 0, 1]]
+assert (~a).tolist() == [[-1, -2, -3], [-2, -3, -4]]
+
+m = a > 1
+assert m.dtype == 'bool'
+assert m.tolist() == [[False, False, True], [False, True, True]]
+assert (m & (a < 3)).tolist() == [[False, False, True], [False, True, False]]
+assert (~m).tolist() == [[True, True, False], [True, False, False]]
+assert (m ^ m).any() == False
+assert (m | ~m).all() == True
+assert m.count(True) == 3
+assert a.count(1) == 2
+assert a.count(1.5) == 0
+assert a.count('1') == 0
+assert (a == a.astype(None)).all()
+
+# count_neighbors and convolve give int32 grids
+g = array2d(4, 4, default=0, dtype='int8')
+g[1, 1] = 1
+g[2, 2] = 1
+n = g.count_neighbors(1, 'Moore')
+assert n.dtype == 'int32'
+assert n.tolist() == g.astype(None).count_neighbors(1, 'Moore').tolist()
+n = g.count_neighbors(1, 'von Neumann')
+assert n.tolist() == g.astype(None).count_neighbors(1, 'von Neumann').tolist()
+k = array2d(3, 3, default=1)
+c = g.convolve(k, 0)
+assert c.dtype == 'int32'
+assert c.tolist() == [[1, 1, 1, 0], [1, 2, 2, 1], [1, 2, 2, 1], [0, 1, 1, 1]]
+assert c == g.astype(None).convolve(k, 0)
+c = array2d(2, 2, default=2**30, dtype='int32').convolve(k, 0)
+assert c.dtype is None
+assert c[0, 0] == 2**32
+
+# copy, views and pickle keep the packed values
+b = a.copy()
+assert b.dtype == 'int8' and b == a
+b[0, 0] = 5
+assert a[0, 0] == 0
+v = a[1:3, 0:2]
+assert v.tolist() == [[1, 2], [2, 3]]
+assert (v + 1).tolist() == [[2, 3], [3, 4]]
+assert v.astype('int32').dtype == 'int32'
+import pickle
+for dtype in ['int8', 'int32', 'float32', 'bool']:
+    x = (a > 1).astype(dtype) if dtype == 'bool' else a.astype(dtype)
+    y = pickle.loads(pickle.dumps(x))
+    assert y.dtype == dtype
+    assert y.tolist() == x.tolist()
+
 # stackoverflow bug due to recursive mark-and-sweep
 # class Cell:
 #     neighbors: list['Cell']
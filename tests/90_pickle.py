@@ -141,6 +141,24 @@ class Data:
 
 test(Data(1))
 
+@dataclass
+class SlotData:
+    __slots__ = ('a', 'b')
+    a: int
+    b: list
+
+class SlotData3(SlotData):
+    __slots__ = ('c',)
+
+o = test(SlotData(1, [2, 3]))
+assert o.__dict__ is None
+o = SlotData3(4, [])
+o.c = 'c'
+o = pkl.loads(pkl.dumps(o))
+assert (o.a, o.b, o.c) == (4, [], 'c')
+o = pkl.loads(pkl.dumps(SlotData3(5, None)))
+assert o.a == 5 and not hasattr(o, 'c')
+
 exit()
 
 from pickle import dumps, loads, _wrap, _unwrap
@@ -14,3 +14,59 @@ def g(a):
     return f([1,2,3] + a)
 
 assert dis(f) is None
+
+# superinstructions
+class V:
+    def __init__(self, x):
+        self.x = x
+    def __lt__(self, other):
+        return self.x < other.x
+    def __add__(self, other):
+        return V(self.x + other)
+
+def cmp(a, b):
+    if a < b:
+        return 'lt'
+    return 'ge'
+
+assert dis(cmp) is None
+assert cmp(1, 2) == 'lt'
+assert cmp(2.5, 2) == 'ge'
+assert cmp(1, 1.5) == 'lt'
+assert cmp('a', 'b') == 'lt'
+assert cmp(V(3), V(2)) == 'ge'
+
+def add1(a):
+    return a + 1
+
+assert add1(1) == 2
+assert add1(0.5) == 1.5
+assert add1(V(1)).x == 2
+try:
+    add1('a')
+    exit(1)
+except TypeError:
+    pass
+
+def getx(v):
+    return v.x
+
+assert getx(V(7)) == 7
+
+def unbound(flag):
+    if flag:
+        b = 1
+    a = 2
+    return a, b
+
+assert unbound(True) == (2, 1)
+try:
+    unbound(False)
+    exit(1)
+except UnboundLocalError:
+    pass
+
+def const():
+    return 'abc'
+
+assert const() == 'abc'